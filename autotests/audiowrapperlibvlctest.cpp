@@ -0,0 +1,146 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "audiowrapper.h"
+
+#include "config-upnp-qt.h"
+
+#include <QObject>
+#include <QUrl>
+
+#include <QtTest>
+
+class AudioWrapperLibvlcTest: public QObject
+{
+    Q_OBJECT
+
+public:
+
+    explicit AudioWrapperLibvlcTest(QObject *aParent = nullptr) : QObject(aParent)
+    {
+    }
+
+private:
+
+    static QUrl sampleFile(const QString &fileName)
+    {
+        return QUrl::fromLocalFile(QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music/") + fileName);
+    }
+
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        qRegisterMetaType<QMediaPlayer::State>("QMediaPlayer::State");
+        qRegisterMetaType<QMediaPlayer::MediaStatus>("QMediaPlayer::MediaStatus");
+    }
+
+    void testNextSourceBookkeeping()
+    {
+        const auto firstSource = sampleFile(QStringLiteral("test.ogg"));
+        const auto secondSource = sampleFile(QStringLiteral("test.mp3"));
+        const auto thirdSource = sampleFile(QStringLiteral("testMany.ogg"));
+
+        AudioWrapper audioWrapper;
+
+        QSignalSpy nextSourceChangedSpy(&audioWrapper, &AudioWrapper::nextSourceChanged);
+        QSignalSpy switchedToNextSourceSpy(&audioWrapper, &AudioWrapper::switchedToNextSource);
+
+        audioWrapper.setSource(firstSource);
+
+        QCOMPARE(audioWrapper.source(), firstSource);
+        QVERIFY(audioWrapper.nextSource().isEmpty());
+
+        audioWrapper.setNextSource(secondSource);
+
+        QCOMPARE(nextSourceChangedSpy.count(), 1);
+        QCOMPARE(audioWrapper.nextSource(), secondSource);
+        QCOMPARE(audioWrapper.source(), firstSource);
+
+        // the same next source keeps the prepared media
+        audioWrapper.setNextSource(secondSource);
+
+        QCOMPARE(nextSourceChangedSpy.count(), 1);
+
+        // another current source does not drop the prepared one
+        audioWrapper.setSource(thirdSource);
+
+        QCOMPARE(audioWrapper.source(), thirdSource);
+        QCOMPARE(audioWrapper.nextSource(), secondSource);
+        QCOMPARE(nextSourceChangedSpy.count(), 1);
+
+        // the prepared media becomes the current one
+        audioWrapper.setSource(secondSource);
+
+        QCOMPARE(audioWrapper.source(), secondSource);
+        QVERIFY(audioWrapper.nextSource().isEmpty());
+        QCOMPARE(nextSourceChangedSpy.count(), 2);
+        QCOMPARE(audioWrapper.playbackState(), QMediaPlayer::StoppedState);
+        QCOMPARE(switchedToNextSourceSpy.count(), 0);
+
+        // a new next source is prepared on the player left free by the previous one
+        audioWrapper.setNextSource(firstSource);
+
+        QCOMPARE(nextSourceChangedSpy.count(), 3);
+        QCOMPARE(audioWrapper.nextSource(), firstSource);
+
+        audioWrapper.setNextSource({});
+
+        QCOMPARE(nextSourceChangedSpy.count(), 4);
+        QVERIFY(audioWrapper.nextSource().isEmpty());
+
+        audioWrapper.setSource(firstSource);
+
+        QCOMPARE(audioWrapper.source(), firstSource);
+        QCOMPARE(nextSourceChangedSpy.count(), 4);
+    }
+
+    void testSwitchToPreRolledNextSource()
+    {
+        const auto firstSource = sampleFile(QStringLiteral("test.ogg"));
+        const auto secondSource = sampleFile(QStringLiteral("test.mp3"));
+
+        AudioWrapper audioWrapper;
+
+        QSignalSpy switchedToNextSourceSpy(&audioWrapper, &AudioWrapper::switchedToNextSource);
+        QSignalSpy statusChangedSpy(&audioWrapper, &AudioWrapper::statusChanged);
+
+        // the next source is pre-rolled as soon as the current one plays
+        audioWrapper.setPreRollWindow(3600000);
+        audioWrapper.setSource(firstSource);
+        audioWrapper.setNextSource(secondSource);
+        audioWrapper.play();
+
+        if (!QTest::qWaitFor([&audioWrapper]() {return audioWrapper.playbackState() == QMediaPlayer::PlayingState;}, 5000)) {
+            QSKIP("libvlc cannot play the sample files on this system");
+        }
+
+        QSignalSpy stoppedSpy(&audioWrapper, &AudioWrapper::stopped);
+
+        QTRY_COMPARE_WITH_TIMEOUT(switchedToNextSourceSpy.count(), 1, 30000);
+
+        QCOMPARE(switchedToNextSourceSpy.at(0).at(0).toUrl(), secondSource);
+        QCOMPARE(audioWrapper.source(), secondSource);
+        QVERIFY(audioWrapper.nextSource().isEmpty());
+
+        QCoreApplication::processEvents();
+
+        QCOMPARE(stoppedSpy.count(), 0);
+        QCOMPARE(audioWrapper.playbackState(), QMediaPlayer::PlayingState);
+        for (const auto &oneStatus : statusChangedSpy) {
+            QVERIFY(oneStatus.at(0).value<QMediaPlayer::MediaStatus>() != QMediaPlayer::EndOfMedia);
+        }
+
+        audioWrapper.stop();
+
+        QTRY_COMPARE(audioWrapper.playbackState(), QMediaPlayer::StoppedState);
+    }
+};
+
+QTEST_GUILESS_MAIN(AudioWrapperLibvlcTest)
+
+
+#include "audiowrapperlibvlctest.moc"
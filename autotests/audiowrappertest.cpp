@@ -0,0 +1,411 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "audiowrapper.h"
+
+#include <QObject>
+#include <QUrl>
+#include <QTimer>
+#include <QVector>
+#include <QMediaService>
+#include <QMediaPlayerControl>
+#include <QMediaTimeRange>
+
+#include <private/qmediaserviceprovider_p.h>
+
+#include <QtTest>
+
+/**
+ * Media player backend without any audio output. Opening a source takes
+ * LoadDelay milliseconds, starting a loaded source is immediate.
+ */
+class StandInPlayerControl : public QMediaPlayerControl
+{
+    Q_OBJECT
+
+public:
+
+    static constexpr int LoadDelay = 100;
+
+    static constexpr qint64 SourceDuration = 10000;
+
+    explicit StandInPlayerControl(QObject *parent = nullptr) : QMediaPlayerControl(parent)
+    {
+    }
+
+    QMediaPlayer::State state() const override
+    {
+        return mState;
+    }
+
+    QMediaPlayer::MediaStatus mediaStatus() const override
+    {
+        return mStatus;
+    }
+
+    qint64 duration() const override
+    {
+        return mStatus == QMediaPlayer::LoadingMedia || mStatus == QMediaPlayer::NoMedia ? 0 : SourceDuration;
+    }
+
+    qint64 position() const override
+    {
+        return mPosition;
+    }
+
+    void setPosition(qint64 position) override
+    {
+        playTo(position);
+    }
+
+    int volume() const override
+    {
+        return mVolume;
+    }
+
+    void setVolume(int volume) override
+    {
+        mVolume = volume;
+        Q_EMIT volumeChanged(mVolume);
+    }
+
+    bool isMuted() const override
+    {
+        return mMuted;
+    }
+
+    void setMuted(bool muted) override
+    {
+        mMuted = muted;
+        Q_EMIT mutedChanged(mMuted);
+    }
+
+    int bufferStatus() const override
+    {
+        return 100;
+    }
+
+    bool isAudioAvailable() const override
+    {
+        return true;
+    }
+
+    bool isVideoAvailable() const override
+    {
+        return false;
+    }
+
+    bool isSeekable() const override
+    {
+        return true;
+    }
+
+    QMediaTimeRange availablePlaybackRanges() const override
+    {
+        return {};
+    }
+
+    qreal playbackRate() const override
+    {
+        return 1.;
+    }
+
+    void setPlaybackRate(qreal rate) override
+    {
+        Q_UNUSED(rate)
+    }
+
+    QMediaContent media() const override
+    {
+        return mMedia;
+    }
+
+    const QIODevice *mediaStream() const override
+    {
+        return nullptr;
+    }
+
+    void setMedia(const QMediaContent &media, QIODevice *stream) override
+    {
+        Q_UNUSED(stream)
+
+        mMedia = media;
+        mPosition = 0;
+        mPlayRequested = false;
+        setState(QMediaPlayer::StoppedState);
+        Q_EMIT mediaChanged(mMedia);
+
+        if (mMedia.isNull()) {
+            setStatus(QMediaPlayer::NoMedia);
+            return;
+        }
+
+        setStatus(QMediaPlayer::LoadingMedia);
+
+        QTimer::singleShot(LoadDelay, this, [this, media]() {
+            if (mMedia != media) {
+                return;
+            }
+
+            Q_EMIT durationChanged(SourceDuration);
+            setStatus(QMediaPlayer::LoadedMedia);
+
+            if (mPlayRequested) {
+                mPlayRequested = false;
+                setState(QMediaPlayer::PlayingState);
+            }
+        });
+    }
+
+    void play() override
+    {
+        if (mStatus == QMediaPlayer::LoadingMedia) {
+            mPlayRequested = true;
+            return;
+        }
+
+        setState(QMediaPlayer::PlayingState);
+    }
+
+    void pause() override
+    {
+        mPlayRequested = false;
+        setState(QMediaPlayer::PausedState);
+    }
+
+    void stop() override
+    {
+        mPlayRequested = false;
+        setState(QMediaPlayer::StoppedState);
+    }
+
+    void playTo(qint64 position)
+    {
+        mPosition = position;
+        Q_EMIT positionChanged(mPosition);
+    }
+
+    /**
+     * Signal the end of the source in the order used by the Qt 5 backends:
+     * the stopped state comes before the EndOfMedia status.
+     */
+    void reachEnd()
+    {
+        playTo(SourceDuration);
+        mStatus = QMediaPlayer::EndOfMedia;
+        setState(QMediaPlayer::StoppedState);
+        Q_EMIT mediaStatusChanged(mStatus);
+    }
+
+private:
+
+    void setState(QMediaPlayer::State state)
+    {
+        if (mState != state) {
+            mState = state;
+            Q_EMIT stateChanged(mState);
+        }
+    }
+
+    void setStatus(QMediaPlayer::MediaStatus status)
+    {
+        if (mStatus != status) {
+            mStatus = status;
+            Q_EMIT mediaStatusChanged(mStatus);
+        }
+    }
+
+    QMediaContent mMedia;
+
+    QMediaPlayer::State mState = QMediaPlayer::StoppedState;
+
+    QMediaPlayer::MediaStatus mStatus = QMediaPlayer::NoMedia;
+
+    qint64 mPosition = 0;
+
+    int mVolume = 100;
+
+    bool mMuted = false;
+
+    bool mPlayRequested = false;
+
+};
+
+class StandInMediaService : public QMediaService
+{
+    Q_OBJECT
+
+public:
+
+    explicit StandInMediaService(QObject *parent = nullptr) : QMediaService(parent), mControl(new StandInPlayerControl(this))
+    {
+    }
+
+    QMediaControl *requestControl(const char *name) override
+    {
+        if (qstrcmp(name, QMediaPlayerControl_iid) == 0) {
+            return mControl;
+        }
+
+        return nullptr;
+    }
+
+    void releaseControl(QMediaControl *control) override
+    {
+        Q_UNUSED(control)
+    }
+
+    StandInPlayerControl *mControl = nullptr;
+
+};
+
+class StandInServiceProvider : public QMediaServiceProvider
+{
+    Q_OBJECT
+
+public:
+
+    QMediaService *requestService(const QByteArray &type, const QMediaServiceProviderHint &hint) override
+    {
+        Q_UNUSED(type)
+        Q_UNUSED(hint)
+
+        auto newService = new StandInMediaService;
+        mControls.push_back(newService->mControl);
+
+        return newService;
+    }
+
+    void releaseService(QMediaService *service) override
+    {
+        mControls.removeAll(static_cast<StandInMediaService*>(service)->mControl);
+        delete service;
+    }
+
+    QVector<StandInPlayerControl*> mControls;
+
+};
+
+class AudioWrapperTest: public QObject
+{
+    Q_OBJECT
+
+public:
+
+    explicit AudioWrapperTest(QObject *aParent = nullptr) : QObject(aParent)
+    {
+    }
+
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        QMediaServiceProvider::setDefaultServiceProvider(&mServiceProvider);
+    }
+
+    void testPreRolledNextSource()
+    {
+        const auto firstSource = QUrl::fromLocalFile(QStringLiteral("/1.ogg"));
+        const auto secondSource = QUrl::fromLocalFile(QStringLiteral("/2.ogg"));
+
+        AudioWrapper audioWrapper;
+
+        QCOMPARE(mServiceProvider.mControls.size(), 2);
+        auto firstControl = mServiceProvider.mControls.at(0);
+        auto secondControl = mServiceProvider.mControls.at(1);
+
+        QSignalSpy statusChangedSpy(&audioWrapper, &AudioWrapper::statusChanged);
+        QSignalSpy switchedToNextSourceSpy(&audioWrapper, &AudioWrapper::switchedToNextSource);
+        QSignalSpy transitionLatencyChangedSpy(&audioWrapper, &AudioWrapper::transitionLatencyChanged);
+
+        audioWrapper.setPreRollWindow(2000);
+        audioWrapper.setSource(firstSource);
+        audioWrapper.play();
+
+        QTRY_COMPARE(audioWrapper.playbackState(), QMediaPlayer::PlayingState);
+
+        audioWrapper.setNextSource(secondSource);
+        firstControl->playTo(7000);
+
+        QVERIFY(secondControl->media().isNull());
+
+        firstControl->playTo(8500);
+
+        QCOMPARE(secondControl->media(), QMediaContent{secondSource});
+        QCOMPARE(secondControl->state(), QMediaPlayer::PausedState);
+        QTRY_COMPARE(secondControl->mediaStatus(), QMediaPlayer::LoadedMedia);
+
+        QSignalSpy stoppedSpy(&audioWrapper, &AudioWrapper::stopped);
+        QSignalSpy playbackStateChangedSpy(&audioWrapper, &AudioWrapper::playbackStateChanged);
+
+        firstControl->reachEnd();
+
+        QCOMPARE(switchedToNextSourceSpy.count(), 1);
+        QCOMPARE(switchedToNextSourceSpy.at(0).at(0).toUrl(), secondSource);
+        QCOMPARE(secondControl->state(), QMediaPlayer::PlayingState);
+        QCOMPARE(audioWrapper.playbackState(), QMediaPlayer::PlayingState);
+        QVERIFY(audioWrapper.nextSource().isEmpty());
+
+        for (const auto &oneStatus : statusChangedSpy) {
+            QVERIFY(oneStatus.at(0).value<QMediaPlayer::MediaStatus>() != QMediaPlayer::EndOfMedia);
+        }
+
+        QCoreApplication::processEvents();
+
+        QCOMPARE(stoppedSpy.count(), 0);
+        for (const auto &oneState : playbackStateChangedSpy) {
+            QVERIFY(oneState.at(0).value<QMediaPlayer::State>() != QMediaPlayer::StoppedState);
+        }
+
+        QCOMPARE(transitionLatencyChangedSpy.count(), 1);
+        QVERIFY(audioWrapper.transitionLatency() < StandInPlayerControl::LoadDelay * 1000);
+    }
+
+    void testNextSourceNotPreRolled()
+    {
+        const auto firstSource = QUrl::fromLocalFile(QStringLiteral("/1.ogg"));
+        const auto secondSource = QUrl::fromLocalFile(QStringLiteral("/2.ogg"));
+
+        AudioWrapper audioWrapper;
+
+        QCOMPARE(mServiceProvider.mControls.size(), 2);
+        auto firstControl = mServiceProvider.mControls.at(0);
+
+        QSignalSpy statusChangedSpy(&audioWrapper, &AudioWrapper::statusChanged);
+        QSignalSpy switchedToNextSourceSpy(&audioWrapper, &AudioWrapper::switchedToNextSource);
+        QSignalSpy transitionLatencyChangedSpy(&audioWrapper, &AudioWrapper::transitionLatencyChanged);
+
+        audioWrapper.setSource(firstSource);
+        audioWrapper.play();
+
+        QTRY_COMPARE(audioWrapper.playbackState(), QMediaPlayer::PlayingState);
+
+        QSignalSpy stoppedSpy(&audioWrapper, &AudioWrapper::stopped);
+
+        firstControl->reachEnd();
+
+        QCOMPARE(switchedToNextSourceSpy.count(), 0);
+        QCOMPARE(statusChangedSpy.last().at(0).value<QMediaPlayer::MediaStatus>(), QMediaPlayer::EndOfMedia);
+        QCOMPARE(audioWrapper.playbackState(), QMediaPlayer::StoppedState);
+        QCOMPARE(stoppedSpy.count(), 1);
+
+        audioWrapper.setSource(secondSource);
+        audioWrapper.play();
+
+        QTRY_COMPARE(transitionLatencyChangedSpy.count(), 1);
+        QVERIFY(audioWrapper.transitionLatency() >= StandInPlayerControl::LoadDelay * 1000);
+    }
+
+private:
+
+    StandInServiceProvider mServiceProvider;
+
+};
+
+QTEST_GUILESS_MAIN(AudioWrapperTest)
+
+
+#include "audiowrappertest.moc"
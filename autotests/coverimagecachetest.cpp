@@ -0,0 +1,213 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "coverimagecache.h"
+#include "coverprefetcher.h"
+#include "datatypes.h"
+#include "performancecounters.h"
+#include "config-upnp-qt.h"
+
+#include <QObject>
+#include <QImage>
+#include <QTemporaryDir>
+#include <QDir>
+#include <QStandardItemModel>
+#include <QThread>
+#include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+
+#include <memory>
+#include <vector>
+
+#include <QtTest>
+
+class CoverImageCacheTest: public QObject
+{
+    Q_OBJECT
+
+public:
+
+    explicit CoverImageCacheTest(QObject *aParent = nullptr) : QObject(aParent)
+    {
+    }
+
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+    }
+
+    void init()
+    {
+        PerformanceCounters::reset();
+    }
+
+    void testMemoryAndDiskCache()
+    {
+#if defined KF5FileMetaData_FOUND && KF5FileMetaData_FOUND
+        QTemporaryDir cacheDirectory;
+        QVERIFY(cacheDirectory.isValid());
+
+        const auto trackFileName = QString{QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/cover_art/artist4/test.ogg")};
+
+        CoverImageCache coverCache;
+        coverCache.setCacheDirectory(cacheDirectory.path());
+
+        auto firstImage = coverCache.image(trackFileName, {64, 64});
+        QVERIFY(!firstImage.isNull());
+        QVERIFY(firstImage.width() <= 64);
+        QVERIFY(firstImage.height() <= 64);
+        QCOMPARE(PerformanceCounters::value(PerformanceCounters::CoverCacheMisses), 1);
+        QCOMPARE(PerformanceCounters::value(PerformanceCounters::CoverMemoryCacheHits), 0);
+        QCOMPARE(QDir{cacheDirectory.path()}.entryList(QDir::Files).size(), 1);
+
+        auto secondImage = coverCache.image(trackFileName, {64, 64});
+        QCOMPARE(secondImage, firstImage);
+        QCOMPARE(PerformanceCounters::value(PerformanceCounters::CoverCacheMisses), 1);
+        QCOMPARE(PerformanceCounters::value(PerformanceCounters::CoverMemoryCacheHits), 1);
+
+        coverCache.clear();
+
+        auto thirdImage = coverCache.image(trackFileName, {64, 64});
+        QCOMPARE(thirdImage.size(), firstImage.size());
+        QCOMPARE(PerformanceCounters::value(PerformanceCounters::CoverCacheMisses), 1);
+        QCOMPARE(PerformanceCounters::value(PerformanceCounters::CoverDiskCacheHits), 1);
+
+        auto otherSizeImage = coverCache.image(trackFileName, {32, 32});
+        QVERIFY(otherSizeImage.width() <= 32);
+        QCOMPARE(PerformanceCounters::value(PerformanceCounters::CoverCacheMisses), 2);
+
+        const auto thumbnailFileName = coverCache.thumbnailFileName(trackFileName, {64, 64});
+        QVERIFY(!thumbnailFileName.isEmpty());
+        QVERIFY(thumbnailFileName.startsWith(cacheDirectory.path()));
+        QCOMPARE(QImage{thumbnailFileName}.size(), firstImage.size());
+#endif
+    }
+
+    void testDiskCacheEviction()
+    {
+#if defined KF5FileMetaData_FOUND && KF5FileMetaData_FOUND
+        QTemporaryDir cacheDirectory;
+        QVERIFY(cacheDirectory.isValid());
+
+        const auto trackFileName = QString{QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/cover_art/artist4/test.ogg")};
+
+        CoverImageCache coverCache;
+        coverCache.setCacheDirectory(cacheDirectory.path());
+
+        const auto oldThumbnailFileName = coverCache.thumbnailFileName(trackFileName, {64, 64});
+        QVERIFY(!oldThumbnailFileName.isEmpty());
+
+        QFile oldThumbnail(oldThumbnailFileName);
+        QVERIFY(oldThumbnail.open(QIODevice::ReadWrite));
+        QVERIFY(oldThumbnail.setFileTime(QDateTime::currentDateTimeUtc().addSecs(-3600), QFileDevice::FileModificationTime));
+        oldThumbnail.close();
+
+        coverCache.setMaximumDiskSize(QFileInfo{oldThumbnailFileName}.size() + 1);
+
+        const auto newThumbnailFileName = coverCache.thumbnailFileName(trackFileName, {32, 32});
+        QVERIFY(!newThumbnailFileName.isEmpty());
+        QVERIFY(!QFile::exists(oldThumbnailFileName));
+
+        coverCache.clear();
+
+        QVERIFY(!coverCache.image(trackFileName, {64, 64}).isNull());
+        QCOMPARE(PerformanceCounters::value(PerformanceCounters::CoverCacheMisses), 3);
+#endif
+    }
+
+    void testConcurrentRequests()
+    {
+#if defined KF5FileMetaData_FOUND && KF5FileMetaData_FOUND
+        QTemporaryDir cacheDirectory;
+        QVERIFY(cacheDirectory.isValid());
+
+        const auto trackFileName = QString{QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/cover_art/artist4/test.ogg")};
+
+        CoverImageCache coverCache;
+        coverCache.setCacheDirectory(cacheDirectory.path());
+
+        std::vector<std::unique_ptr<QThread>> allThreads;
+        for (int i = 0; i < 8; ++i) {
+            allThreads.emplace_back(QThread::create([&coverCache, trackFileName]() {
+                auto coverImage = coverCache.image(trackFileName, {64, 64});
+                Q_UNUSED(coverImage)
+            }));
+        }
+
+        for (auto &oneThread : allThreads) {
+            oneThread->start();
+        }
+
+        for (auto &oneThread : allThreads) {
+            QVERIFY(oneThread->wait());
+        }
+
+        QCOMPARE(PerformanceCounters::value(PerformanceCounters::CoverCacheMisses), 1);
+        QCOMPARE(PerformanceCounters::value(PerformanceCounters::CoverMemoryCacheHits), 7);
+#endif
+    }
+
+    void testFileWithoutCover()
+    {
+        QTemporaryDir cacheDirectory;
+        QVERIFY(cacheDirectory.isValid());
+
+        const auto trackFileName = QString{QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music/cover.jpg")};
+
+        CoverImageCache coverCache;
+        coverCache.setCacheDirectory(cacheDirectory.path());
+
+        QVERIFY(coverCache.image(trackFileName, {64, 64}).isNull());
+        QVERIFY(coverCache.image(trackFileName, {64, 64}).isNull());
+        QVERIFY(coverCache.thumbnailFileName(trackFileName, {64, 64}).isEmpty());
+        QCOMPARE(PerformanceCounters::value(PerformanceCounters::CoverCacheMisses), 1);
+        QCOMPARE(PerformanceCounters::value(PerformanceCounters::CoverMemoryCacheHits), 2);
+        QCOMPARE(QDir{cacheDirectory.path()}.entryList(QDir::Files).size(), 0);
+    }
+
+    void testPrefetchRows()
+    {
+#if defined KF5FileMetaData_FOUND && KF5FileMetaData_FOUND
+        const auto trackFileName = QString{QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/cover_art/artist4/test.ogg")};
+
+        CoverImageCache::instance().clear();
+
+        QStandardItemModel viewModel;
+        for (int i = 0; i < 10; ++i) {
+            auto *newItem = new QStandardItem;
+            if (i == 5) {
+                newItem->setData(QString{QStringLiteral("image://cover/") + trackFileName}, DataTypes::ImageUrlRole);
+            } else {
+                newItem->setData(QStringLiteral("file:///not_existing.png"), DataTypes::ImageUrlRole);
+            }
+            viewModel.appendRow(newItem);
+        }
+
+        CoverPrefetcher prefetcher;
+        prefetcher.setModel(&viewModel);
+        prefetcher.setThumbnailSize({48, 48});
+        prefetcher.setPrefetchMargin(2);
+
+        prefetcher.prefetchRows(0, 2);
+
+        prefetcher.prefetchRows(3, 3);
+
+        QTRY_COMPARE(PerformanceCounters::value(PerformanceCounters::CoverCacheMisses) +
+                     PerformanceCounters::value(PerformanceCounters::CoverDiskCacheHits), 1);
+
+        QVERIFY(!CoverImageCache::instance().image(trackFileName, {48, 48}).isNull());
+        QCOMPARE(PerformanceCounters::value(PerformanceCounters::CoverMemoryCacheHits), 1);
+#endif
+    }
+};
+
+QTEST_GUILESS_MAIN(CoverImageCacheTest)
+
+
+#include "coverimagecachetest.moc"
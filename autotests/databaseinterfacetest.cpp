@@ -21,6 +21,9 @@
 #include <QDir>
 #include <QFile>
 #include <QTemporaryFile>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QRegularExpression>
 
 #include <QDebug>
 
@@ -48,6 +51,7 @@ private Q_SLOTS:
         qRegisterMetaType<QHash<qlonglong,int>>("QHash<qlonglong,int>");
         qRegisterMetaType<QHash<QUrl,QDateTime>>("QHash<QUrl,QDateTime>");
         qRegisterMetaType<DataTypes::ListTrackDataType>("ListTrackDataType");
+        qRegisterMetaType<DataTypes::ListTrackRecord>("ListTrackRecord");
         qRegisterMetaType<DataTypes::ListAlbumDataType>("ListAlbumDataType");
         qRegisterMetaType<DataTypes::ListArtistDataType>("ListArtistDataType");
         qRegisterMetaType<DataTypes::ListGenreDataType>("ListGenreDataType");
@@ -56,6 +60,7 @@ private Q_SLOTS:
         qRegisterMetaType<DataTypes::ArtistDataType>("ArtistDataType");
         qRegisterMetaType<DataTypes::GenreDataType>("GenreDataType");
 	qRegisterMetaType<DataTypes::ListRadioDataType>("ListRadioDataType");
+        qRegisterMetaType<DataTypes::DirectoryFingerprints>("DataTypes::DirectoryFingerprints");
     }
 
     void avoidCrashInTrackIdFromTitleAlbumArtist()
@@ -1129,6 +1134,281 @@ private Q_SLOTS:
         }
     }
 
+    void searchTracksAndAlbums()
+    {
+        DatabaseInterface musicDb;
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        QCOMPARE(musicDbErrorSpy.count(), 0);
+
+        const auto allTracksIds = musicDb.searchData(ElisaUtils::Track, QStringLiteral("TRACK"));
+
+        if (!allTracksIds) {
+            QSKIP("SQLite is built without full-text search");
+        }
+
+        QCOMPARE(allTracksIds->count(), musicDb.allTracksData().count());
+
+        const auto albumIds = musicDb.searchData(ElisaUtils::Album, QStringLiteral("album3 artist7"));
+
+        QVERIFY(albumIds);
+        QCOMPARE(*albumIds, QVector<qulonglong>{musicDb.albumIdFromTitleAndArtist(QStringLiteral("album3"), QStringLiteral("artist7"), QStringLiteral("/"))});
+
+        const auto trackIds = musicDb.searchData(ElisaUtils::Track, QStringLiteral("track6 artist"));
+
+        QVERIFY(trackIds);
+        QCOMPARE(trackIds->count(), 1);
+
+        auto track = musicDb.trackDataFromDatabaseId(trackIds->first());
+
+        QCOMPARE(track.title(), QStringLiteral("track6"));
+
+        // a part of a word is found by the trigram index or left to the views by the word index
+        const auto partialWordIds = musicDb.searchData(ElisaUtils::Track, QStringLiteral("rack6"));
+
+        QVERIFY(!partialWordIds || partialWordIds->contains(track.databaseId()));
+
+        musicDb.removeTracksList({track.resourceURI()});
+
+        QVERIFY(!musicDb.searchData(ElisaUtils::Track, QStringLiteral("track6 artist")));
+        QVERIFY(!musicDb.searchData(ElisaUtils::Track, QStringLiteral(" \"* ")));
+        QCOMPARE(musicDbErrorSpy.count(), 0);
+    }
+
+    void preferredTracksQueryPlans()
+    {
+        QTemporaryFile databaseFile;
+        databaseFile.open();
+
+        qDebug() << "preferredTracksQueryPlans" << databaseFile.fileName();
+
+        {
+            DatabaseInterface musicDb;
+
+            QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+            QSignalSpy musicDbErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+            musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
+
+            musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+            musicDbTrackAddedSpy.wait(300);
+
+            musicDb.removeTracksList({QUrl::fromLocalFile(QStringLiteral("/$1")), QUrl::fromLocalFile(QStringLiteral("/$10"))});
+
+            auto modifiedTrack = mNewTracks[2];
+            modifiedTrack[DataTypes::AlbumRole] = QStringLiteral("album2");
+            musicDb.insertTracksList({modifiedTrack}, mNewCovers);
+
+            const auto queriesPlans = musicDb.readQueriesPlans();
+
+            qDebug() << "preferredTracksQueryPlans" << queriesPlans;
+
+            // the tracks are read from the partial indexes of the preferred copies, no table is scanned
+            const auto queriesIndexes = QList<QPair<QString, QString>>{
+                    {QStringLiteral("tracksDataPage"), QStringLiteral("TracksTitleSortIndex")},
+                    {QStringLiteral("tracksCount"), QStringLiteral("TracksPreferredIndex")},
+            };
+            for (const auto &oneQuery : queriesIndexes) {
+                const auto &queryPlan = queriesPlans[oneQuery.first];
+                const auto &indexName = oneQuery.second;
+
+                QVERIFY(!queryPlan.isEmpty());
+                QVERIFY(std::any_of(queryPlan.begin(), queryPlan.end(), [&indexName](const QString &oneStep) {
+                    return oneStep.contains(QRegularExpression(QStringLiteral("^(SEARCH|SCAN) tracks USING (COVERING )?INDEX ") + indexName));
+                }));
+                QVERIFY(std::none_of(queryPlan.begin(), queryPlan.end(), [](const QString &oneStep) {
+                    return oneStep.startsWith(QStringLiteral("SCAN")) && !oneStep.contains(QStringLiteral("USING"));
+                }));
+            }
+
+            QCOMPARE(musicDbErrorSpy.count(), 0);
+        }
+
+        {
+            auto checkDatabase = QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), QStringLiteral("queryPlans"));
+            checkDatabase.setDatabaseName(databaseFile.fileName());
+            QVERIFY(checkDatabase.open());
+
+            QSqlQuery flagsQuery(checkDatabase);
+
+            // the flag maintained on insertion, modification and removal matches the subquery it replaces
+            QVERIFY(flagsQuery.exec(QStringLiteral("SELECT COUNT(*) "
+                                                   "FROM "
+                                                   "`Tracks` tracks "
+                                                   "WHERE "
+                                                   "tracks.`IsPreferred` != (tracks.`Priority` = ("
+                                                   "     SELECT "
+                                                   "     MIN(`Priority`) "
+                                                   "     FROM "
+                                                   "     `Tracks` tracks2 "
+                                                   "     WHERE "
+                                                   "     tracks.`Title` = tracks2.`Title` AND "
+                                                   "     (tracks.`ArtistName` IS NULL OR tracks.`ArtistName` = tracks2.`ArtistName`) AND "
+                                                   "     (tracks.`AlbumTitle` IS NULL OR tracks.`AlbumTitle` = tracks2.`AlbumTitle`) AND "
+                                                   "     (tracks.`AlbumArtistName` IS NULL OR tracks.`AlbumArtistName` = tracks2.`AlbumArtistName`) AND "
+                                                   "     (tracks.`AlbumPath` IS NULL OR tracks.`AlbumPath` = tracks2.`AlbumPath`)"
+                                                   "))")));
+            QVERIFY(flagsQuery.next());
+            QCOMPARE(flagsQuery.value(0).toInt(), 0);
+
+            checkDatabase.close();
+        }
+
+        QSqlDatabase::removeDatabase(QStringLiteral("queryPlans"));
+    }
+
+    void readSortedTracksPages()
+    {
+        QTemporaryFile databaseFile;
+        databaseFile.open();
+
+        qDebug() << "readSortedTracksPages" << databaseFile.fileName();
+
+        DatabaseInterface musicDb;
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        const auto tracksCount = musicDb.tracksCount();
+        QVERIFY(tracksCount > 3);
+
+        for (const auto sortRole : {DataTypes::TitleRole, DataTypes::ArtistRole, DataTypes::DurationRole}) {
+            for (const auto sortOrder : {Qt::AscendingOrder, Qt::DescendingOrder}) {
+                const auto allTracks = musicDb.tracksDataPage(sortRole, sortOrder, {}, 0, 0, -1);
+
+                QCOMPARE(allTracks.size(), tracksCount);
+
+                // the pages following the last track of the previous one and the pages read by offset match the whole list
+                auto lastSortKey = QVariant{};
+                auto lastDatabaseId = qulonglong{0};
+                auto readTracksCount = 0;
+
+                while (readTracksCount < tracksCount) {
+                    const auto onePage = musicDb.tracksDataPage(sortRole, sortOrder, lastSortKey, lastDatabaseId, 0, 3);
+                    const auto offsetPage = musicDb.tracksDataPage(sortRole, sortOrder, {}, 0, readTracksCount, 3);
+
+                    QCOMPARE(onePage.size(), std::min(3, tracksCount - readTracksCount));
+                    QCOMPARE(offsetPage.size(), onePage.size());
+
+                    for (int i = 0; i < onePage.size(); ++i) {
+                        QCOMPARE(onePage[i].databaseId(), allTracks[readTracksCount + i].databaseId());
+                        QCOMPARE(offsetPage[i].databaseId(), allTracks[readTracksCount + i].databaseId());
+                    }
+
+                    readTracksCount += onePage.size();
+                    lastSortKey = DatabaseInterface::trackSortKey(onePage.last(), sortRole);
+                    lastDatabaseId = onePage.last().databaseId();
+                }
+
+                QVERIFY(musicDb.tracksDataPage(sortRole, sortOrder, lastSortKey, lastDatabaseId, 0, 3).isEmpty());
+            }
+        }
+
+        const auto tracksByTitle = musicDb.tracksDataPage(DataTypes::TitleRole, Qt::AscendingOrder, {}, 0, 0, -1);
+
+        QVERIFY(std::is_sorted(tracksByTitle.begin(), tracksByTitle.end(), [](const auto &left, const auto &right) {
+            return left.title().compare(right.title(), Qt::CaseInsensitive) < 0;
+        }));
+
+        const auto tracksByDuration = musicDb.tracksDataPage(DataTypes::DurationRole, Qt::DescendingOrder, {}, 0, 0, -1);
+
+        QVERIFY(std::is_sorted(tracksByDuration.begin(), tracksByDuration.end(), [](const auto &left, const auto &right) {
+            return left.duration() > right.duration();
+        }));
+
+        QCOMPARE(musicDbErrorSpy.count(), 0);
+    }
+
+    void readTracksWithReadOnlyConnection()
+    {
+        QTemporaryFile myTempDatabase;
+        myTempDatabase.open();
+
+        DatabaseInterface musicDb;
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+
+        musicDb.init(QStringLiteral("testDbWriter"), myTempDatabase.fileName());
+
+        DatabaseInterface readMusicDb;
+
+        QSignalSpy readMusicDbDatabaseErrorSpy(&readMusicDb, &DatabaseInterface::databaseError);
+
+        readMusicDb.initReadOnly(QStringLiteral("testDbReader"), myTempDatabase.fileName());
+
+        QCOMPARE(readMusicDb.allTracksData().count(), 0);
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        QCOMPARE(musicDbTrackAddedSpy.count(), 1);
+        QCOMPARE(readMusicDb.allAlbumsData().count(), 5);
+        QCOMPARE(readMusicDb.allTracksData().count(), musicDb.allTracksData().count());
+        QCOMPARE(readMusicDb.allArtistsData().count(), musicDb.allArtistsData().count());
+
+        auto firstAlbumId = musicDb.albumIdFromTitleAndArtist(QStringLiteral("album1"), QStringLiteral("Various Artists"), QStringLiteral("/"));
+
+        QCOMPARE(readMusicDb.albumData(firstAlbumId).count(), musicDb.albumData(firstAlbumId).count());
+        QCOMPARE(readMusicDbDatabaseErrorSpy.count(), 0);
+    }
+
+    void notifyChangesAfterCommit()
+    {
+        QTemporaryFile myTempDatabase;
+        myTempDatabase.open();
+
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDbWriter"), myTempDatabase.fileName());
+
+        DatabaseInterface readMusicDb;
+
+        readMusicDb.initReadOnly(QStringLiteral("testDbReader"), myTempDatabase.fileName());
+
+        auto genresSeenByReader = QList<int>{};
+        connect(&musicDb, &DatabaseInterface::genresAdded,
+                this, [&genresSeenByReader, &readMusicDb]() {genresSeenByReader.push_back(readMusicDb.allGenresData().count());});
+
+        auto removedTracksSeenByReader = QList<bool>{};
+        connect(&musicDb, &DatabaseInterface::trackRemoved,
+                this, [&removedTracksSeenByReader, &readMusicDb](qulonglong removedTrackId) {
+            removedTracksSeenByReader.push_back(readMusicDb.trackDataFromDatabaseId(removedTrackId).isEmpty());
+        });
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+        QVERIFY(!genresSeenByReader.isEmpty());
+        QCOMPARE(genresSeenByReader.last(), musicDb.allGenresData().count());
+
+        auto playedTracksSeenByReader = QList<int>{};
+        connect(&musicDb, &DatabaseInterface::trackModified,
+                this, [&playedTracksSeenByReader, &readMusicDb]() {playedTracksSeenByReader.push_back(readMusicDb.recentlyPlayedTracksData(10).count());});
+
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$1")), QDateTime::currentDateTime());
+
+        QCOMPARE(playedTracksSeenByReader, QList<int>{1});
+
+        musicDb.removeTracksList({QUrl::fromLocalFile(QStringLiteral("/$1")), QUrl::fromLocalFile(QStringLiteral("/$2"))});
+
+        QCOMPARE(removedTracksSeenByReader, (QList<bool>{true, true}));
+    }
+
     void restoreModifiedTracksWidthDatabaseFile()
     {
         QTemporaryFile myTempDatabase;
@@ -4530,6 +4810,235 @@ private Q_SLOTS:
         QCOMPARE(restoredTracks.count(), 23);
     }
 
+    void restoreDirectoriesFingerprints()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy musicDbRestoredDirectoriesSpy(&musicDb, &DatabaseInterface::restoredDirectoriesFingerprints);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        const auto firstDirectory = QUrl::fromLocalFile(QStringLiteral("/$1"));
+        const auto secondDirectory = QUrl::fromLocalFile(QStringLiteral("/$1/$2"));
+
+        auto scannedDirectories = DataTypes::DirectoryFingerprints{};
+        scannedDirectories[firstDirectory].mParentDirectory = QUrl::fromLocalFile(QStringLiteral("/"));
+        scannedDirectories[firstDirectory].mModificationTime = QDateTime::fromMSecsSinceEpoch(1234);
+        scannedDirectories[firstDirectory].mEntriesCount = 3;
+        scannedDirectories[secondDirectory].mParentDirectory = firstDirectory;
+        scannedDirectories[secondDirectory].mModificationTime = QDateTime::fromMSecsSinceEpoch(5678);
+        scannedDirectories[secondDirectory].mEntriesCount = 12;
+
+        musicDb.updateDirectoriesFingerprints(scannedDirectories);
+
+        musicDb.askRestoredTracks();
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+        QCOMPARE(musicDbRestoredDirectoriesSpy.count(), 1);
+
+        auto restoredDirectories = musicDbRestoredDirectoriesSpy.at(0).at(0).value<DataTypes::DirectoryFingerprints>();
+
+        QCOMPARE(restoredDirectories.count(), 2);
+        QCOMPARE(restoredDirectories[secondDirectory].mParentDirectory, firstDirectory);
+        QCOMPARE(restoredDirectories[secondDirectory].mModificationTime, QDateTime::fromMSecsSinceEpoch(5678));
+        QCOMPARE(restoredDirectories[secondDirectory].mEntriesCount, 12);
+
+        musicDb.removeDirectoriesFingerprints({secondDirectory});
+
+        musicDb.askRestoredTracks();
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+        QCOMPARE(musicDbRestoredDirectoriesSpy.count(), 2);
+
+        restoredDirectories = musicDbRestoredDirectoriesSpy.at(1).at(0).value<DataTypes::DirectoryFingerprints>();
+
+        QCOMPARE(restoredDirectories.count(), 1);
+        QCOMPARE(restoredDirectories.contains(firstDirectory), true);
+
+        musicDb.clearData();
+
+        musicDb.askRestoredTracks();
+
+        QCOMPARE(musicDbRestoredDirectoriesSpy.count(), 3);
+        QCOMPARE(musicDbRestoredDirectoriesSpy.at(2).at(0).value<DataTypes::DirectoryFingerprints>().count(), 0);
+    }
+
+    void addLargeBatchOfTracks()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbGenresAddedSpy(&musicDb, &DatabaseInterface::genresAdded);
+        QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        auto newTracks = DataTypes::ListTrackDataType();
+        for (int i = 0; i < 500; ++i) {
+            const auto trackIndex = QString::number(i);
+            const auto artistName = QStringLiteral("artist") + QString::number(i % 50);
+            const auto albumIndex = QString::number(i % 25);
+
+            newTracks.push_back({true, QStringLiteral("$") + trackIndex, QStringLiteral("0"), QStringLiteral("track") + trackIndex,
+                                 artistName, QStringLiteral("album") + albumIndex, QStringLiteral("artist") + albumIndex,
+                                 i / 25 + 1, 1, QTime::fromMSecsSinceStartOfDay(i + 1),
+                                 {QUrl::fromLocalFile(QStringLiteral("/batch/$") + trackIndex)},
+                                 QDateTime::fromMSecsSinceEpoch(i + 1), {}, 1, false,
+                                 QStringLiteral("genre") + QString::number(i % 10), QStringLiteral("composer1"),
+                                 QStringLiteral("lyricist1"), false});
+        }
+
+        musicDb.insertTracksList(newTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+        QCOMPARE(musicDb.allTracksData().count(), 500);
+        QCOMPARE(musicDb.allArtistsData().count(), 50);
+        QCOMPARE(musicDb.allAlbumsData().count(), 25);
+        QCOMPARE(musicDb.allGenresData().count(), 10);
+        QCOMPARE(musicDbArtistAddedSpy.count(), 1);
+        QCOMPARE(musicDbArtistAddedSpy.at(0).at(0).value<DataTypes::ListArtistDataType>().count(), 50);
+        QCOMPARE(musicDbAlbumAddedSpy.count(), 1);
+        QCOMPARE(musicDbTrackAddedSpy.count(), 1);
+        QCOMPARE(musicDbTrackAddedSpy.at(0).at(0).value<DataTypes::ListTrackRecord>().count(), 500);
+        QCOMPARE(musicDbGenresAddedSpy.count(), 1);
+        QCOMPARE(musicDbGenresAddedSpy.at(0).at(0).value<DataTypes::ListGenreDataType>().count(), 10);
+
+        auto trackId = musicDb.trackIdFromFileName(QUrl::fromLocalFile(QStringLiteral("/batch/$321")));
+        auto track = musicDb.trackDataFromDatabaseId(trackId);
+
+        QCOMPARE(track.title(), QStringLiteral("track321"));
+        QCOMPARE(track.artist(), QStringLiteral("artist21"));
+        QCOMPARE(track.album(), QStringLiteral("album21"));
+        QCOMPARE(track.albumArtist(), QStringLiteral("artist21"));
+        QCOMPARE(track.genre(), QStringLiteral("genre1"));
+
+        musicDb.insertTracksList(newTracks, mNewCovers);
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+        QCOMPARE(musicDb.allTracksData().count(), 500);
+        QCOMPARE(musicDb.allArtistsData().count(), 50);
+        QCOMPARE(musicDbArtistAddedSpy.count(), 1);
+        QCOMPARE(musicDbTrackAddedSpy.count(), 1);
+        QCOMPARE(musicDbGenresAddedSpy.count(), 1);
+        QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
+    }
+
+    void addDuplicatedTracksInOneBatch()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        auto newTracks = DataTypes::ListTrackDataType();
+        for (int i = 0; i < 3; ++i) {
+            const auto trackIndex = QString::number(i);
+
+            newTracks.push_back({true, QStringLiteral("$") + trackIndex, QStringLiteral("0"), QStringLiteral("track1"),
+                                 QStringLiteral("artist1"), QStringLiteral("album1"), QStringLiteral("artist1"),
+                                 1, 1, QTime::fromMSecsSinceStartOfDay(1),
+                                 {QUrl::fromLocalFile(QStringLiteral("/duplicated/$") + trackIndex)},
+                                 QDateTime::fromMSecsSinceEpoch(1), {}, 1, false,
+                                 QStringLiteral("genre1"), QStringLiteral("composer1"), QStringLiteral("lyricist1"), false});
+        }
+
+        musicDb.insertTracksList(newTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+        QCOMPARE(musicDb.allTracksData().count(), 3);
+        QCOMPARE(musicDb.allAlbumsData().count(), 1);
+        QCOMPARE(musicDbTrackAddedSpy.count(), 1);
+        QCOMPARE(musicDbTrackAddedSpy.at(0).at(0).value<DataTypes::ListTrackRecord>().count(), 3);
+
+        auto trackId = musicDb.trackIdFromFileName(QUrl::fromLocalFile(QStringLiteral("/duplicated/$2")));
+        auto track = musicDb.trackDataFromDatabaseId(trackId);
+
+        QCOMPARE(track.title(), QStringLiteral("track1"));
+        QCOMPARE(track.resourceURI(), QUrl::fromLocalFile(QStringLiteral("/duplicated/$2")));
+    }
+
+    void removeLargeBatchOfTracks()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        auto newTracks = DataTypes::ListTrackDataType();
+        auto firstAlbumFiles = QList<QUrl>{};
+        auto otherFiles = QList<QUrl>{};
+        for (int i = 0; i < 500; ++i) {
+            const auto trackIndex = QString::number(i);
+            const auto artistName = QStringLiteral("artist") + QString::number(i % 50);
+            const auto albumIndex = QString::number(i % 25);
+            const auto trackFile = QUrl::fromLocalFile(QStringLiteral("/batch/$") + trackIndex);
+
+            newTracks.push_back({true, QStringLiteral("$") + trackIndex, QStringLiteral("0"), QStringLiteral("track") + trackIndex,
+                                 artistName, QStringLiteral("album") + albumIndex, QStringLiteral("artist") + albumIndex,
+                                 i / 25 + 1, 1, QTime::fromMSecsSinceStartOfDay(i + 1), {trackFile},
+                                 QDateTime::fromMSecsSinceEpoch(i + 1), {}, 1, false,
+                                 QStringLiteral("genre") + QString::number(i % 10), QStringLiteral("composer1"),
+                                 QStringLiteral("lyricist1"), false});
+
+            if (i % 25 == 0) {
+                firstAlbumFiles.push_back(trackFile);
+            } else {
+                otherFiles.push_back(trackFile);
+            }
+        }
+
+        musicDb.insertTracksList(newTracks, mNewCovers);
+
+        QCOMPARE(musicDb.allTracksData().count(), 500);
+        QCOMPARE(musicDb.allAlbumsData().count(), 25);
+        QCOMPARE(musicDb.allArtistsData().count(), 50);
+
+        musicDb.removeTracksList(firstAlbumFiles + QList<QUrl>{QUrl::fromLocalFile(QStringLiteral("/batch/unknown"))});
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+        QCOMPARE(musicDbTrackRemovedSpy.count(), 20);
+        QCOMPARE(musicDbAlbumRemovedSpy.count(), 1);
+        QCOMPARE(musicDbArtistRemovedSpy.count(), 2);
+        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(musicDb.allTracksData().count(), 480);
+        QCOMPARE(musicDb.allAlbumsData().count(), 24);
+        QCOMPARE(musicDb.allArtistsData().count(), 48);
+        QCOMPARE(musicDb.trackIdFromFileName(firstAlbumFiles.first()), qulonglong(0));
+
+        musicDb.removeTracksList(otherFiles.mid(0, 10));
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+        QCOMPARE(musicDbTrackRemovedSpy.count(), 30);
+        QCOMPARE(musicDbAlbumRemovedSpy.count(), 1);
+        QCOMPARE(musicDbArtistRemovedSpy.count(), 2);
+        QCOMPARE(musicDbAlbumModifiedSpy.count(), 10);
+
+        musicDb.removeTracksList(otherFiles.mid(10));
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+        QCOMPARE(musicDbTrackRemovedSpy.count(), 500);
+        QCOMPARE(musicDbAlbumRemovedSpy.count(), 25);
+        QCOMPARE(musicDbArtistRemovedSpy.count(), 50);
+        QCOMPARE(musicDb.allTracksData().count(), 0);
+        QCOMPARE(musicDb.allAlbumsData().count(), 0);
+        QCOMPARE(musicDb.allArtistsData().count(), 0);
+    }
+
     void addOneTrackWithParticularPath()
     {
         DatabaseInterface musicDb;
@@ -4746,6 +5255,147 @@ private Q_SLOTS:
         QCOMPARE(frequentlyPlayedTracksData[4].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$9")));
     }
 
+    void readFrequentlyPlayedTracksDataWithDecay()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        QCOMPARE(musicDb.allTracksData().count(), 22);
+        QCOMPARE(musicDbTrackAddedSpy.count(), 1);
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+
+        const auto lastPlayDate = QDateTime::fromSecsSinceEpoch(1553289740);
+
+        // older plays weigh less: three plays two hundred days ago rank below one play a hundred days ago
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$9")), lastPlayDate.addDays(-200));
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$9")), lastPlayDate.addDays(-200).addSecs(300));
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$9")), lastPlayDate.addDays(-200).addSecs(600));
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$5")), lastPlayDate.addDays(-100));
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$7")), lastPlayDate.addDays(-1));
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$17")), lastPlayDate.addSecs(-60));
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$8")), lastPlayDate);
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+
+        auto frequentlyPlayedTracksData = musicDb.frequentlyPlayedTracksData(10);
+
+        QCOMPARE(frequentlyPlayedTracksData.count(), 5);
+        QCOMPARE(frequentlyPlayedTracksData[0].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$8")));
+        QCOMPARE(frequentlyPlayedTracksData[1].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$17")));
+        QCOMPARE(frequentlyPlayedTracksData[2].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$7")));
+        QCOMPARE(frequentlyPlayedTracksData[3].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$5")));
+        QCOMPARE(frequentlyPlayedTracksData[4].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$9")));
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+    }
+
+    void readFrequentlyPlayedTracksDataWithFilter()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        QCOMPARE(musicDb.allTracksData().count(), 22);
+        QCOMPARE(musicDbTrackAddedSpy.count(), 1);
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+
+        const auto lastPlayDate = QDateTime::fromSecsSinceEpoch(1553289740);
+
+        // older plays weigh less: three plays two hundred days ago rank below one play a hundred days ago
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$9")), lastPlayDate.addDays(-200));
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$9")), lastPlayDate.addDays(-200).addSecs(300));
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$9")), lastPlayDate.addDays(-200).addSecs(600));
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$5")), lastPlayDate.addDays(-100));
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$7")), lastPlayDate.addDays(-1));
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$17")), lastPlayDate.addSecs(-60));
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$8")), lastPlayDate);
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+
+        auto frequentlyPlayedTracksData = musicDb.frequentlyPlayedTracksData(10);
+
+        QCOMPARE(frequentlyPlayedTracksData.count(), 5);
+        QCOMPARE(frequentlyPlayedTracksData[0].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$8")));
+        QCOMPARE(frequentlyPlayedTracksData[1].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$17")));
+        QCOMPARE(frequentlyPlayedTracksData[2].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$7")));
+        QCOMPARE(frequentlyPlayedTracksData[3].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$5")));
+        QCOMPARE(frequentlyPlayedTracksData[4].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$9")));
+
+        auto artistTracksData = musicDb.frequentlyPlayedTracksData(ElisaUtils::Artist, QStringLiteral("artist1"), 10);
+
+        QCOMPARE(artistTracksData.count(), 4);
+        QCOMPARE(artistTracksData[0].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$8")));
+        QCOMPARE(artistTracksData[1].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$7")));
+        QCOMPARE(artistTracksData[2].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$5")));
+        QCOMPARE(artistTracksData[3].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$9")));
+
+        auto firstArtistTracksData = musicDb.frequentlyPlayedTracksData(ElisaUtils::Artist, QStringLiteral("artist1"), 2);
+
+        QCOMPARE(firstArtistTracksData.count(), 2);
+        QCOMPARE(firstArtistTracksData[0].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$8")));
+        QCOMPARE(firstArtistTracksData[1].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$7")));
+
+        const auto albumId = musicDb.albumIdFromTitleAndArtist(QStringLiteral("album4"), QStringLiteral("artist2"), QStringLiteral("/"));
+        auto albumTracksData = musicDb.frequentlyPlayedTracksData(ElisaUtils::Album, albumId, 10);
+
+        QCOMPARE(albumTracksData.count(), 1);
+        QCOMPARE(albumTracksData[0].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$17")));
+
+        auto genreTracksData = musicDb.frequentlyPlayedTracksData(ElisaUtils::Genre, QStringLiteral("genre2"), 10);
+
+        QCOMPARE(genreTracksData.count(), 3);
+        QCOMPARE(genreTracksData[0].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$8")));
+        QCOMPARE(genreTracksData[1].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$7")));
+        QCOMPARE(genreTracksData[2].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$9")));
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+    }
+
+    void frequentlyPlayedTracksQueryPlan()
+    {
+        DatabaseInterface musicDb;
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$9")), QDateTime::fromSecsSinceEpoch(1553279650));
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$17")), QDateTime::fromSecsSinceEpoch(1553288650));
+
+        const auto queryPlan = musicDb.readQueriesPlans().value(QStringLiteral("frequentlyPlayedTracksData"));
+
+        qDebug() << "frequentlyPlayedTracksQueryPlan" << queryPlan;
+
+        // the ranking walks the play score index instead of sorting all the played tracks
+        QVERIFY(!queryPlan.isEmpty());
+        QVERIFY(queryPlan.first().contains(QStringLiteral("TracksDataPlayScoreIndex")));
+        for (const auto &oneStep : queryPlan) {
+            QVERIFY(!oneStep.contains(QStringLiteral("TEMP B-TREE FOR ORDER BY")));
+        }
+
+        QCOMPARE(musicDbErrorSpy.count(), 0);
+    }
+
     void readAllGenresData()
     {
         DatabaseInterface musicDb;
@@ -0,0 +1,108 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "datatypes.h"
+#include "models/datamodel.h"
+#include "models/gridviewproxymodel.h"
+
+#include <QObject>
+#include <QString>
+#include <QTime>
+#include <QCollator>
+
+#include <QtTest>
+
+class DataModelBenchmark: public QObject
+{
+    Q_OBJECT
+
+public:
+
+    explicit DataModelBenchmark(QObject *aParent = nullptr) : QObject(aParent)
+    {
+    }
+
+private Q_SLOTS:
+
+    void sortLargeModel_data()
+    {
+        QTest::addColumn<int>("sortRole");
+
+        QTest::newRow("title") << static_cast<int>(DataTypes::TitleRole);
+        QTest::newRow("artist") << static_cast<int>(DataTypes::ArtistRole);
+        QTest::newRow("album") << static_cast<int>(DataTypes::AlbumRole);
+        QTest::newRow("album artist") << static_cast<int>(DataTypes::AlbumArtistRole);
+        QTest::newRow("year") << static_cast<int>(DataTypes::YearRole);
+        QTest::newRow("duration") << static_cast<int>(DataTypes::DurationRole);
+    }
+
+    void sortLargeModel()
+    {
+        QFETCH(int, sortRole);
+
+        DataModel tracksModel;
+        GridViewProxyModel proxyModel;
+
+        tracksModel.initialize(nullptr, nullptr, ElisaUtils::Track, ElisaUtils::NoFilter, {}, {}, 0, {});
+
+        const auto tracksCount = 400000;
+
+        auto newTracks = DataTypes::ListTrackRecord();
+        newTracks.reserve(tracksCount);
+        for (int i = 0; i < tracksCount; ++i) {
+            // a scrambled index gives unsorted values in every column
+            const auto scrambledIndex = static_cast<int>((qint64{i} * 7919) % tracksCount);
+
+            auto oneTrack = DataTypes::TrackRecord{};
+            oneTrack.setDatabaseId(qulonglong(i + 1));
+            oneTrack.setTitle(QStringLiteral("track%1").arg(scrambledIndex));
+            oneTrack.setArtist(QStringLiteral("artist%1").arg(scrambledIndex % 5000));
+            oneTrack.setAlbum(QStringLiteral("album%1").arg(scrambledIndex % 20000));
+            oneTrack.setAlbumArtist(QStringLiteral("Artist%1").arg(scrambledIndex % 3000));
+            oneTrack.setYear(1950 + scrambledIndex % 70);
+            oneTrack.setDuration(QTime::fromMSecsSinceStartOfDay(scrambledIndex));
+            oneTrack.setElementType(ElisaUtils::Track);
+            newTracks.push_back(oneTrack);
+        }
+
+        tracksModel.tracksAdded(newTracks);
+
+        proxyModel.setSourceModel(&tracksModel);
+        proxyModel.setSortRole(sortRole);
+
+        QBENCHMARK_ONCE {
+            proxyModel.sortModel(Qt::AscendingOrder);
+        }
+
+        QCOMPARE(proxyModel.rowCount(), tracksCount);
+
+        auto collator = QCollator{};
+        collator.setCaseSensitivity(Qt::CaseInsensitive);
+
+        for (int row = 1; row < tracksCount; row += 997) {
+            const auto previousValue = proxyModel.index(row - 1, 0).data(sortRole);
+            const auto value = proxyModel.index(row, 0).data(sortRole);
+
+            switch (value.type())
+            {
+            case QVariant::String:
+                QVERIFY(collator.compare(previousValue.toString(), value.toString()) <= 0);
+                break;
+            case QVariant::Time:
+                QVERIFY(previousValue.toTime() <= value.toTime());
+                break;
+            default:
+                QVERIFY(previousValue.toInt() <= value.toInt());
+                break;
+            }
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(DataModelBenchmark)
+
+
+#include "datamodelbenchmark.moc"
@@ -9,20 +9,26 @@
 #include "databaseinterface.h"
 #include "datatypes.h"
 #include "models/datamodel.h"
+#include "models/gridviewproxymodel.h"
 
 #include <QObject>
 #include <QUrl>
 #include <QString>
 #include <QHash>
+#include <QSet>
 #include <QVector>
 #include <QThread>
 #include <QStandardPaths>
 #include <QAbstractItemModelTester>
+#include <QStandardItemModel>
+#include <QCollator>
 
 #include <QDebug>
 
 #include <QtTest>
 
+#include <algorithm>
+
 class DataModelTests: public QObject, public DatabaseTestData
 {
     Q_OBJECT
@@ -41,6 +47,7 @@ private Q_SLOTS:
         qRegisterMetaType<QHash<QString,QUrl>>("QHash<QString,QUrl>");
         qRegisterMetaType<QVector<qlonglong>>("QVector<qlonglong>");
         qRegisterMetaType<QHash<qlonglong,int>>("QHash<qlonglong,int>");
+        qRegisterMetaType<DataTypes::EntryDataList>("DataTypes::EntryDataList");
     }
 
     void removeOneTrack()
@@ -87,7 +94,7 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        albumsModel.tracksAdded(musicDb.albumData(musicDb.albumIdFromTitleAndArtist(QStringLiteral("album1"), QStringLiteral("Various Artists"), QStringLiteral("/"))));
+        albumsModel.tracksAdded(DataTypes::toListTrackRecord(musicDb.albumData(musicDb.albumIdFromTitleAndArtist(QStringLiteral("album1"), QStringLiteral("Various Artists"), QStringLiteral("/")))));
 
         QCOMPARE(albumsModel.rowCount(), 4);
         QCOMPARE(beginInsertRowsSpy.count(), 1);
@@ -154,7 +161,7 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        albumsModel.tracksAdded(musicDb.albumData(musicDb.albumIdFromTitleAndArtist(QStringLiteral("album3"), QStringLiteral("artist2"), QStringLiteral("/"))));
+        albumsModel.tracksAdded(DataTypes::toListTrackRecord(musicDb.albumData(musicDb.albumIdFromTitleAndArtist(QStringLiteral("album3"), QStringLiteral("artist2"), QStringLiteral("/")))));
 
         QCOMPARE(albumsModel.rowCount(), 3);
         QCOMPARE(beginInsertRowsSpy.count(), 1);
@@ -235,7 +242,7 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        albumsModel.tracksAdded(musicDb.albumData(musicDb.albumIdFromTitleAndArtist(QStringLiteral("album1"), QStringLiteral("Various Artists"), QStringLiteral("/"))));
+        albumsModel.tracksAdded(DataTypes::toListTrackRecord(musicDb.albumData(musicDb.albumIdFromTitleAndArtist(QStringLiteral("album1"), QStringLiteral("Various Artists"), QStringLiteral("/")))));
 
         QCOMPARE(albumsModel.rowCount(), 4);
         QCOMPARE(beginInsertRowsSpy.count(), 1);
@@ -351,7 +358,7 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        albumsModel.tracksAdded(musicDb.albumData(musicDb.albumIdFromTitleAndArtist(QStringLiteral("album1"), QStringLiteral("Various Artists"), QStringLiteral("/"))));
+        albumsModel.tracksAdded(DataTypes::toListTrackRecord(musicDb.albumData(musicDb.albumIdFromTitleAndArtist(QStringLiteral("album1"), QStringLiteral("Various Artists"), QStringLiteral("/")))));
 
         QCOMPARE(albumsModel.rowCount(), 4);
         QCOMPARE(beginInsertRowsSpy.count(), 1);
@@ -712,6 +719,12 @@ private Q_SLOTS:
         auto newTracks = DataTypes::ListTrackDataType();
         newTracks.push_back(newTrack);
 
+        // the full data read before the modification must not be served afterwards
+        for (int row = 0; row < tracksModel.rowCount(); ++row) {
+            const auto fullData = tracksModel.data(tracksModel.index(row, 0), DataTypes::ColumnsRoles::FullDataRole).value<DataTypes::MusicDataType>();
+            QVERIFY(!fullData.isEmpty());
+        }
+
         musicDb.insertTracksList(newTracks, mNewCovers);
 
         QCOMPARE(beginInsertRowsSpy.count(), 1);
@@ -730,6 +743,9 @@ private Q_SLOTS:
 
         QCOMPARE(tracksModel.data(changedIndex, DataTypes::ColumnsRoles::RatingRole).isValid(), true);
         QCOMPARE(tracksModel.data(changedIndex, DataTypes::ColumnsRoles::RatingRole).toInt(), 5);
+
+        const auto changedFullData = tracksModel.data(changedIndex, DataTypes::ColumnsRoles::FullDataRole).value<DataTypes::MusicDataType>();
+        QCOMPARE(changedFullData[DataTypes::ColumnsRoles::RatingRole].toInt(), 5);
     }
 
     void addEmptyTracksListAllTracks()
@@ -751,7 +767,7 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        tracksModel.tracksAdded(newTracks);
+        tracksModel.tracksAdded(DataTypes::toListTrackRecord(newTracks));
 
         QCOMPARE(beginInsertRowsSpy.count(), 0);
         QCOMPARE(endInsertRowsSpy.count(), 0);
@@ -1552,7 +1568,7 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        albumsModel.tracksAdded(musicDb.albumData(musicDb.albumIdFromTitleAndArtist(QStringLiteral("album1"), QStringLiteral("Various Artists"), QStringLiteral("/"))));
+        albumsModel.tracksAdded(DataTypes::toListTrackRecord(musicDb.albumData(musicDb.albumIdFromTitleAndArtist(QStringLiteral("album1"), QStringLiteral("Various Artists"), QStringLiteral("/")))));
 
         QCOMPARE(albumsModel.rowCount(), 4);
         QCOMPARE(beginInsertRowsSpy.count(), 1);
@@ -1587,6 +1603,440 @@ private Q_SLOTS:
         QCOMPARE(beginInsertRowsSpy.at(1).at(1).toInt(), 2);
         QCOMPARE(beginInsertRowsSpy.at(1).at(2).toInt(), 2);
     }
+
+    void modifyAndRemoveTracksInLargeModel()
+    {
+        DataModel tracksModel;
+
+        tracksModel.initialize(nullptr, nullptr, ElisaUtils::Track, ElisaUtils::NoFilter, {}, {}, 0, {});
+
+        const auto tracksCount = 100000;
+        const auto removedTracksCount = 1000;
+
+        auto newTracks = DataTypes::ListTrackDataType();
+        newTracks.reserve(tracksCount);
+        for (int i = 0; i < tracksCount; ++i) {
+            auto oneTrack = DataTypes::TrackDataType{};
+            oneTrack[DataTypes::DatabaseIdRole] = qulonglong(i + 1);
+            oneTrack[DataTypes::TitleRole] = QStringLiteral("track%1").arg(i + 1);
+            oneTrack[DataTypes::DurationRole] = QTime::fromMSecsSinceStartOfDay(1000);
+            oneTrack[DataTypes::ElementTypeRole] = QVariant::fromValue(ElisaUtils::Track);
+            newTracks.push_back(oneTrack);
+        }
+
+        tracksModel.tracksAdded(DataTypes::toListTrackRecord(newTracks));
+
+        QCOMPARE(tracksModel.rowCount(), tracksCount);
+
+        QSignalSpy dataChangedSpy(&tracksModel, &DataModel::dataChanged);
+
+        QBENCHMARK {
+            for (int i = tracksCount - removedTracksCount; i < tracksCount; ++i) {
+                tracksModel.trackModified(newTracks[i]);
+            }
+        }
+
+        QVERIFY(dataChangedSpy.count() >= removedTracksCount);
+        QCOMPARE(dataChangedSpy.last().at(0).toModelIndex().row(), tracksCount - 1);
+
+        QBENCHMARK_ONCE {
+            for (int i = 0; i < removedTracksCount; ++i) {
+                tracksModel.trackRemoved(qulonglong(i + 1));
+            }
+        }
+
+        QCOMPARE(tracksModel.rowCount(), tracksCount - removedTracksCount);
+        QCOMPARE(tracksModel.data(tracksModel.index(0, 0), DataTypes::DatabaseIdRole).toULongLong(), qulonglong(removedTracksCount + 1));
+
+        dataChangedSpy.clear();
+
+        auto modifiedTrack = newTracks.last();
+        modifiedTrack[DataTypes::TitleRole] = QStringLiteral("modified");
+        tracksModel.trackModified(modifiedTrack);
+
+        QCOMPARE(dataChangedSpy.count(), 1);
+        QCOMPARE(dataChangedSpy.at(0).at(0).toModelIndex().row(), tracksCount - removedTracksCount - 1);
+        QCOMPARE(tracksModel.data(tracksModel.index(tracksCount - removedTracksCount - 1, 0), DataTypes::TitleRole).toString(), QStringLiteral("modified"));
+    }
+
+    void removeScatteredTracksInModel()
+    {
+        DataModel tracksModel;
+
+        tracksModel.initialize(nullptr, nullptr, ElisaUtils::Track, ElisaUtils::NoFilter, {}, {}, 0, {});
+
+        const auto tracksCount = 6000;
+
+        auto newTracks = DataTypes::ListTrackDataType();
+        newTracks.reserve(tracksCount);
+        for (int i = 0; i < tracksCount; ++i) {
+            auto oneTrack = DataTypes::TrackDataType{};
+            oneTrack[DataTypes::DatabaseIdRole] = qulonglong(i + 1);
+            oneTrack[DataTypes::TitleRole] = QStringLiteral("track%1").arg(i + 1);
+            oneTrack[DataTypes::DurationRole] = QTime::fromMSecsSinceStartOfDay(1000);
+            oneTrack[DataTypes::ElementTypeRole] = QVariant::fromValue(ElisaUtils::Track);
+            newTracks.push_back(oneTrack);
+        }
+
+        tracksModel.tracksAdded(DataTypes::toListTrackRecord(newTracks));
+
+        QSignalSpy rowsAboutToBeRemovedSpy(&tracksModel, &DataModel::rowsAboutToBeRemoved);
+
+        auto remainingIds = QVector<qulonglong>{};
+        for (int i = tracksCount - 1; i >= 0; --i) {
+            if (i % 3 == 1) {
+                tracksModel.trackRemoved(qulonglong(i + 1));
+            }
+        }
+        for (int i = 0; i < tracksCount; i += 2) {
+            if (i % 3 != 1) {
+                tracksModel.trackRemoved(qulonglong(i + 1));
+            }
+        }
+        for (int i = 0; i < tracksCount; ++i) {
+            if (i % 3 != 1 && i % 2 != 0) {
+                remainingIds.push_back(qulonglong(i + 1));
+            }
+        }
+
+        QCOMPARE(tracksModel.rowCount(), remainingIds.size());
+        QCOMPARE(rowsAboutToBeRemovedSpy.count(), tracksCount - remainingIds.size());
+
+        for (int row = 0; row < remainingIds.size(); ++row) {
+            QCOMPARE(tracksModel.data(tracksModel.index(row, 0), DataTypes::DatabaseIdRole).toULongLong(), remainingIds[row]);
+        }
+
+        QSignalSpy dataChangedSpy(&tracksModel, &DataModel::dataChanged);
+
+        for (int row = 0; row < remainingIds.size(); row += 97) {
+            auto modifiedTrack = newTracks[static_cast<int>(remainingIds[row] - 1)];
+            modifiedTrack[DataTypes::TitleRole] = QStringLiteral("modified");
+            tracksModel.trackModified(modifiedTrack);
+
+            QCOMPARE(dataChangedSpy.last().at(0).toModelIndex().row(), row);
+        }
+
+        auto addedTrack = newTracks.first();
+        addedTrack[DataTypes::DatabaseIdRole] = qulonglong(tracksCount + 1);
+        tracksModel.tracksAdded({DataTypes::TrackRecord{addedTrack}});
+
+        tracksModel.trackRemoved(remainingIds.first());
+
+        QCOMPARE(tracksModel.rowCount(), remainingIds.size());
+        QCOMPARE(tracksModel.data(tracksModel.index(0, 0), DataTypes::DatabaseIdRole).toULongLong(), remainingIds[1]);
+
+        auto modifiedTrack = addedTrack;
+        modifiedTrack[DataTypes::TitleRole] = QStringLiteral("modified");
+        tracksModel.trackModified(modifiedTrack);
+
+        QCOMPARE(dataChangedSpy.last().at(0).toModelIndex().row(), remainingIds.size() - 1);
+    }
+
+    void filterNarrowerAndWider()
+    {
+        QStandardItemModel tracksModel;
+        GridViewProxyModel proxyModel;
+
+        const auto tracksCount = 200;
+
+        for (int i = 0; i < tracksCount; ++i) {
+            auto oneTrack = new QStandardItem(QStringLiteral("track%1").arg(i));
+            oneTrack->setData(qulonglong(i + 1), DataTypes::DatabaseIdRole);
+            oneTrack->setData(QStringLiteral("artist%1").arg(i % 13), DataTypes::ArtistRole);
+            oneTrack->setData(i % 11, DataTypes::RatingRole);
+            tracksModel.appendRow(oneTrack);
+        }
+
+        proxyModel.setSourceModel(&tracksModel);
+
+        auto proxyRows = [](const GridViewProxyModel &model) {
+            auto result = QStringList{};
+            for (int row = 0; row < model.rowCount(); ++row) {
+                result.push_back(model.index(row, 0).data(Qt::DisplayRole).toString());
+            }
+            return result;
+        };
+
+        auto expectedRows = [&tracksModel](const QString &filterText, int filterRating) {
+            auto result = QStringList{};
+            for (int row = 0; row < tracksModel.rowCount(); ++row) {
+                const auto oneTrack = tracksModel.item(row);
+                if (oneTrack->data(DataTypes::RatingRole).toInt() < filterRating) {
+                    continue;
+                }
+                if (oneTrack->text().contains(filterText, Qt::CaseInsensitive) ||
+                    oneTrack->data(DataTypes::ArtistRole).toString().contains(filterText, Qt::CaseInsensitive)) {
+                    result.push_back(oneTrack->text());
+                }
+            }
+            return result;
+        };
+
+        // each step is narrower or wider than the previous one and only tests again a part of the rows
+        const auto filterSteps = QVector<QPair<QString, int>>{
+            {QStringLiteral("1"), 0},
+            {QStringLiteral("12"), 0},
+            {QStringLiteral("12"), 6},
+            {QStringLiteral("1"), 6},
+            {QStringLiteral("ARTIST1"), 6},
+            {QStringLiteral("artist12"), 8},
+            {QStringLiteral("1"), 0},
+            {QString(), 0},
+        };
+
+        for (const auto &oneStep : filterSteps) {
+            proxyModel.setFilterText(oneStep.first);
+            proxyModel.setFilterRating(oneStep.second);
+
+            QTRY_COMPARE(proxyRows(proxyModel), expectedRows(oneStep.first, oneStep.second));
+
+            // the same filter applied from scratch tests all the rows
+            GridViewProxyModel referenceProxyModel;
+            referenceProxyModel.setFilterText(oneStep.first);
+            referenceProxyModel.setFilterRating(oneStep.second);
+            referenceProxyModel.setSourceModel(&tracksModel);
+
+            QTRY_COMPARE(proxyRows(referenceProxyModel), proxyRows(proxyModel));
+        }
+    }
+
+    void sortRowsInParallel()
+    {
+        QStandardItemModel tracksModel;
+        GridViewProxyModel proxyModel;
+
+        // enough rows to compute the sort keys in several tasks
+        const auto tracksCount = 10000;
+
+        for (int i = 0; i < tracksCount; ++i) {
+            const auto titleIndex = (i * 7919) % tracksCount;
+            const auto title = QStringLiteral("%1 %2").arg(titleIndex % 2 ? QStringLiteral("track") : QStringLiteral("Track"))
+                    .arg(titleIndex, 5, 10, QLatin1Char('0'));
+
+            auto oneTrack = new QStandardItem(title);
+            oneTrack->setData(title, DataTypes::TitleRole);
+            oneTrack->setData(QTime::fromMSecsSinceStartOfDay(tracksCount - titleIndex), DataTypes::DurationRole);
+            tracksModel.appendRow(oneTrack);
+        }
+
+        proxyModel.setSourceModel(&tracksModel);
+
+        auto proxyRows = [&proxyModel]() {
+            auto result = QStringList{};
+            for (int row = 0; row < proxyModel.rowCount(); ++row) {
+                result.push_back(proxyModel.index(row, 0).data(DataTypes::TitleRole).toString());
+            }
+            return result;
+        };
+
+        auto expectedRows = QStringList{};
+        for (int row = 0; row < tracksModel.rowCount(); ++row) {
+            expectedRows.push_back(tracksModel.item(row)->text());
+        }
+
+        proxyModel.setSortRole(DataTypes::TitleRole);
+        proxyModel.sortModel(Qt::AscendingOrder);
+
+        auto collator = QCollator{};
+        collator.setCaseSensitivity(proxyModel.sortCaseSensitivity());
+        std::sort(expectedRows.begin(), expectedRows.end(), collator);
+
+        QCOMPARE(proxyRows(), expectedRows);
+
+        proxyModel.sortModel(Qt::DescendingOrder);
+
+        std::reverse(expectedRows.begin(), expectedRows.end());
+
+        QCOMPARE(proxyRows(), expectedRows);
+
+        // the numeric values are sorted by number
+        proxyModel.setSortRole(DataTypes::DurationRole);
+        proxyModel.sortModel(Qt::AscendingOrder);
+
+        QCOMPARE(proxyModel.index(0, 0).data(DataTypes::DurationRole).toTime().msecsSinceStartOfDay(), 1);
+        QCOMPARE(proxyModel.index(tracksCount - 1, 0).data(DataTypes::DurationRole).toTime().msecsSinceStartOfDay(), tracksCount);
+        for (int row = 1; row < proxyModel.rowCount(); ++row) {
+            QVERIFY(proxyModel.index(row - 1, 0).data(DataTypes::DurationRole).toTime() <
+                    proxyModel.index(row, 0).data(DataTypes::DurationRole).toTime());
+        }
+    }
+
+    void loadAllTracksByPages()
+    {
+        DatabaseInterface musicDb;
+        DataModel tracksModel;
+        GridViewProxyModel proxyModel;
+
+        connect(&musicDb, &DatabaseInterface::tracksAdded,
+                &tracksModel, &DataModel::tracksAdded);
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        const auto tracksCount = 3000;
+
+        // the database ids do not follow the order of the titles
+        auto newTracks = DataTypes::ListTrackDataType();
+        for (int i = 0; i < tracksCount; ++i) {
+            const auto trackIndex = QString::number(i);
+            const auto titleIndex = (i * 7) % tracksCount;
+
+            newTracks.push_back({true, QStringLiteral("$") + trackIndex, QStringLiteral("0"),
+                                 QStringLiteral("track%1").arg(titleIndex, 4, 10, QLatin1Char('0')),
+                                 QStringLiteral("artist1"), QStringLiteral("album") + QString::number(i / 20), QStringLiteral("artist1"),
+                                 i % 20 + 1, 1, QTime::fromMSecsSinceStartOfDay(i + 1),
+                                 {QUrl::fromLocalFile(QStringLiteral("/pages/$") + trackIndex)},
+                                 QDateTime::fromMSecsSinceEpoch(i + 1), {}, titleIndex % 10, false,
+                                 QStringLiteral("genre1"), QStringLiteral("composer1"), QStringLiteral("lyricist1"), false});
+        }
+
+        musicDb.insertTracksList(newTracks, mNewCovers);
+
+        auto rowTitle = [&proxyModel](int row) {
+            return proxyModel.data(proxyModel.index(row, 0), DataTypes::TitleRole);
+        };
+
+        tracksModel.setPagedLoading(true);
+        proxyModel.setSourceModel(&tracksModel);
+        proxyModel.setSortRole(DataTypes::TitleRole);
+        proxyModel.sortModel(Qt::AscendingOrder);
+
+        tracksModel.initialize(nullptr, &musicDb, ElisaUtils::Track, ElisaUtils::NoFilter, {}, {}, 0, {});
+
+        QCOMPARE(tracksModel.isLoadingPages(), true);
+        QCOMPARE(proxyModel.rowCount(), tracksCount);
+        QCOMPARE(rowTitle(0).toString(), QStringLiteral("track0000"));
+        QCOMPARE(rowTitle(499).toString(), QStringLiteral("track0499"));
+
+        // the rows of a page not loaded are empty until the page is read
+        QVERIFY(!rowTitle(2600).isValid());
+        QTRY_COMPARE(rowTitle(2600).toString(), QStringLiteral("track2600"));
+
+        // the pages far from the last read row are released and read again when needed
+        QVERIFY(!rowTitle(0).isValid());
+        QTRY_COMPARE(rowTitle(0).toString(), QStringLiteral("track0000"));
+        QTRY_COMPARE(rowTitle(500).toString(), QStringLiteral("track0500"));
+        QTRY_COMPARE(rowTitle(1000).toString(), QStringLiteral("track1000"));
+
+        // the database sorts the pages
+        proxyModel.sortModel(Qt::DescendingOrder);
+
+        QTRY_COMPARE(rowTitle(0).toString(), QStringLiteral("track2999"));
+        QTRY_COMPARE(rowTitle(501).toString(), QStringLiteral("track2498"));
+
+        proxyModel.setSortRole(DataTypes::DurationRole);
+        proxyModel.sortModel(Qt::AscendingOrder);
+
+        QTRY_COMPARE(proxyModel.data(proxyModel.index(0, 0), DataTypes::DurationRole).toTime(), QTime::fromMSecsSinceStartOfDay(1));
+
+        proxyModel.setSortRole(DataTypes::TitleRole);
+
+        // a new track is read at its sorted row
+        auto newTrack = newTracks.first();
+        newTrack[DataTypes::TitleRole] = QStringLiteral("track0000a");
+        newTrack[DataTypes::ResourceRole] = QUrl::fromLocalFile(QStringLiteral("/pages/$new"));
+        musicDb.insertTracksList({newTrack}, mNewCovers);
+
+        QTRY_COMPARE(proxyModel.rowCount(), tracksCount + 1);
+        QTRY_COMPARE(rowTitle(1).toString(), QStringLiteral("track0000a"));
+        QTRY_COMPARE(rowTitle(2).toString(), QStringLiteral("track0001"));
+
+        // filtering the rows loads all of them
+        proxyModel.setFilterRating(8);
+
+        QCOMPARE(tracksModel.isLoadingPages(), false);
+        QTRY_COMPARE(proxyModel.rowCount(), tracksCount / 5);
+        QCOMPARE(rowTitle(0).toString(), QStringLiteral("track0008"));
+
+        proxyModel.setFilterRating(0);
+
+        QCOMPARE(tracksModel.isLoadingPages(), true);
+        QTRY_COMPARE(proxyModel.rowCount(), tracksCount + 1);
+        QTRY_COMPARE(rowTitle(1).toString(), QStringLiteral("track0000a"));
+
+        // enqueueing all the rows reads all the pages in the order of the view
+        QSignalSpy entriesToEnqueueSpy(&proxyModel, &AbstractMediaProxyModel::entriesToEnqueue);
+
+        proxyModel.enqueueToPlayList({});
+
+        QTRY_COMPARE(entriesToEnqueueSpy.count(), 1);
+
+        const auto enqueuedEntries = entriesToEnqueueSpy.at(0).at(0).value<DataTypes::EntryDataList>();
+
+        QCOMPARE(enqueuedEntries.size(), tracksCount + 1);
+        QCOMPARE(std::get<1>(enqueuedEntries.at(0)), QStringLiteral("track0000"));
+        QCOMPARE(std::get<1>(enqueuedEntries.at(1)), QStringLiteral("track0000a"));
+        QCOMPARE(std::get<1>(enqueuedEntries.at(tracksCount)), QStringLiteral("track2999"));
+
+        // views filtering by artist load all their tracks at once
+        DataModel artistTracksModel;
+
+        artistTracksModel.setPagedLoading(true);
+        artistTracksModel.initialize(nullptr, &musicDb, ElisaUtils::Track, ElisaUtils::FilterByArtist, {}, QStringLiteral("artist1"), 0, {});
+
+        QCOMPARE(artistTracksModel.isLoadingPages(), false);
+        QTRY_COMPARE(artistTracksModel.rowCount(), tracksCount + 1);
+        QVERIFY(artistTracksModel.data(artistTracksModel.index(2600, 0), DataTypes::TitleRole).isValid());
+    }
+
+    void trackRecordConversion()
+    {
+        auto newTrack = DataTypes::TrackDataType{true, QStringLiteral("$23"), QStringLiteral("0"), QStringLiteral("track6"),
+                QStringLiteral("artist2"), QStringLiteral("album1"), QStringLiteral("Various Artists"), 2, 1,
+                QTime::fromMSecsSinceStartOfDay(23), {QUrl::fromLocalFile(QStringLiteral("/$23"))},
+                QDateTime::fromMSecsSinceEpoch(23),
+                QUrl::fromLocalFile(QStringLiteral("album1")), 5, true,
+        {}, QStringLiteral("composer1"), QStringLiteral("lyricist1"), false};
+        newTrack[DataTypes::DatabaseIdRole] = 42ULL;
+        newTrack[DataTypes::ElementTypeRole] = QVariant::fromValue(ElisaUtils::Track);
+        newTrack[DataTypes::LyricsRole] = QStringLiteral("lyrics");
+
+        auto trackRecord = DataTypes::TrackRecord{newTrack};
+
+        QCOMPARE(trackRecord.isEmpty(), false);
+        QCOMPARE(trackRecord.isValid(), true);
+        QCOMPARE(trackRecord.databaseId(), 42ULL);
+        QCOMPARE(trackRecord.title(), QStringLiteral("track6"));
+        QCOMPARE(trackRecord.artist(), QStringLiteral("artist2"));
+        QCOMPARE(trackRecord.album(), QStringLiteral("album1"));
+        QCOMPARE(trackRecord.trackNumber(), 2);
+        QCOMPARE(trackRecord.discNumber(), 1);
+        QCOMPARE(trackRecord.resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$23")));
+        QCOMPARE(trackRecord.elementType(), ElisaUtils::Track);
+        QCOMPARE(trackRecord.contains(DataTypes::LyricsRole), true);
+        QCOMPARE(trackRecord.value(DataTypes::LyricsRole), QVariant{QStringLiteral("lyrics")});
+        QCOMPARE(trackRecord.contains(DataTypes::YearRole), false);
+        QCOMPARE(trackRecord.value(DataTypes::YearRole).isValid(), false);
+        QCOMPARE(trackRecord.toTrackDataType(), newTrack);
+
+        trackRecord.insert(DataTypes::YearRole, 2021);
+        QCOMPARE(trackRecord.contains(DataTypes::YearRole), true);
+        QCOMPARE(trackRecord[DataTypes::YearRole].toInt(), 2021);
+
+        // values are converted to the type of the member holding the role
+        trackRecord.insert(DataTypes::TrackNumberRole, QVariant{qlonglong{3}});
+        trackRecord.insert(DataTypes::ResourceRole, QStringLiteral("file:///$24"));
+        trackRecord.insert(DataTypes::LastPlayDate, QDateTime::fromMSecsSinceEpoch(Q_INT64_C(1553289740000)));
+        trackRecord.insert(DataTypes::ElementTypeRole, ElisaUtils::Radio);
+        QCOMPARE(trackRecord.trackNumber(), 3);
+        QCOMPARE(trackRecord[DataTypes::TrackNumberRole].type(), QVariant::Int);
+        QCOMPARE(trackRecord.resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$24")));
+        QCOMPARE(trackRecord[DataTypes::LastPlayDate].toLongLong(), Q_INT64_C(1553289740000));
+        QCOMPARE(trackRecord.elementType(), ElisaUtils::Radio);
+
+        auto typedRecord = DataTypes::TrackRecord{};
+        typedRecord.setDatabaseId(43);
+        typedRecord.setTitle(QStringLiteral("track7"));
+        typedRecord.setGenre({});
+        QCOMPARE(typedRecord.hasDatabaseId(), true);
+        QCOMPARE(typedRecord.hasArtist(), false);
+        QCOMPARE(typedRecord.hasGenre(), true);
+        QCOMPARE(typedRecord.toTrackDataType(), (DataTypes::TrackDataType{{DataTypes::DatabaseIdRole, 43ULL},
+                                                                          {DataTypes::TitleRole, QStringLiteral("track7")},
+                                                                          {DataTypes::GenreRole, QString{}}}));
+
+        QCOMPARE(DataTypes::TrackRecord{}.isEmpty(), true);
+        QCOMPARE(DataTypes::TrackRecord{}.toTrackDataType().isEmpty(), true);
+    }
 };
 
 QTEST_GUILESS_MAIN(DataModelTests)
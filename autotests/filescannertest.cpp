@@ -10,6 +10,10 @@
 #include <QObject>
 #include <QList>
 #include <QUrl>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QTemporaryDir>
 
 
 #include <QtTest>
@@ -89,6 +93,61 @@ private Q_SLOTS:
         QVERIFY(!fileScanner.searchForCoverFile(mTestTracksForDirectory.at(8)).isEmpty());
     }
 
+    void testCoverFileCache()
+    {
+        QTemporaryDir albumDirectory;
+        QVERIFY(albumDirectory.isValid());
+
+        const auto trackFileName = albumDirectory.filePath(QStringLiteral("track.ogg"));
+
+        FileScanner fileScanner;
+        QVERIFY(fileScanner.searchForCoverFile(trackFileName).isEmpty());
+
+        QFile coverFile(albumDirectory.filePath(QStringLiteral("Folder.JPG")));
+        QVERIFY(coverFile.open(QIODevice::WriteOnly));
+        coverFile.close();
+
+        QVERIFY(fileScanner.searchForCoverFile(trackFileName).isEmpty());
+
+        fileScanner.invalidateDirectoryCoverFile(albumDirectory.path());
+        QCOMPARE(fileScanner.searchForCoverFile(trackFileName), QUrl::fromLocalFile(albumDirectory.filePath(QStringLiteral("Folder.JPG"))));
+
+        fileScanner.updateDirectoryCoverFile(albumDirectory.path(), {QStringLiteral("track.ogg"), QStringLiteral("front.png"), QStringLiteral("cover.jpg")});
+        QCOMPARE(fileScanner.searchForCoverFile(trackFileName), QUrl::fromLocalFile(albumDirectory.filePath(QStringLiteral("cover.jpg"))));
+
+        const auto albumName = QFileInfo(albumDirectory.path()).fileName();
+        fileScanner.updateDirectoryCoverFile(albumDirectory.path(), {QStringLiteral("track.ogg"), albumName + QStringLiteral(".png")});
+        QCOMPARE(fileScanner.searchForCoverFile(trackFileName), QUrl::fromLocalFile(albumDirectory.filePath(albumName + QStringLiteral(".png"))));
+    }
+
+    void testCoverFileCacheWithLinkedDirectory()
+    {
+        QTemporaryDir baseDirectory;
+        QVERIFY(baseDirectory.isValid());
+
+        const auto albumPath = baseDirectory.filePath(QStringLiteral("album"));
+        const auto linkedAlbumPath = baseDirectory.filePath(QStringLiteral("linkedAlbum"));
+        QVERIFY(QDir(baseDirectory.path()).mkdir(QStringLiteral("album")));
+        if (!QFile::link(albumPath, linkedAlbumPath)) {
+            QSKIP("symbolic links are not supported");
+        }
+
+        const auto trackFileName = linkedAlbumPath + QStringLiteral("/track.ogg");
+
+        FileScanner fileScanner;
+        QVERIFY(fileScanner.searchForCoverFile(trackFileName).isEmpty());
+
+        QFile coverFile(albumPath + QStringLiteral("/cover.jpg"));
+        QVERIFY(coverFile.open(QIODevice::WriteOnly));
+        coverFile.close();
+
+        fileScanner.invalidateDirectoryCoverFile(QFileInfo(albumPath).canonicalFilePath());
+        QCOMPARE(fileScanner.searchForCoverFile(trackFileName), QUrl::fromLocalFile(linkedAlbumPath + QStringLiteral("/cover.jpg")));
+
+        fileScanner.updateDirectoryCoverFile(QFileInfo(albumPath).canonicalFilePath(), {QStringLiteral("track.ogg"), QStringLiteral("front.png")});
+        QCOMPARE(fileScanner.searchForCoverFile(trackFileName), QUrl::fromLocalFile(QFileInfo(albumPath).canonicalFilePath() + QStringLiteral("/front.png")));
+    }
+
     void benchmarkFileScan()
     {
         FileScanner fileScanner;
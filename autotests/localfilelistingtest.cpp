@@ -7,6 +7,7 @@
 #include "databasetestdata.h"
 
 #include "file/localfilelisting.h"
+#include "abstractfile/directorywatcher.h"
 
 #include "config-upnp-qt.h"
 
@@ -46,6 +47,7 @@ private Q_SLOTS:
         qRegisterMetaType<QVector<qlonglong>>("QVector<qlonglong>");
         qRegisterMetaType<QHash<qlonglong,int>>("QHash<qlonglong,int>");
         qRegisterMetaType<QList<QUrl>>("QList<QUrl>");
+        qRegisterMetaType<DataTypes::DirectoryFingerprints>("DataTypes::DirectoryFingerprints");
     }
 
     void initialTestWithNoTrack()
@@ -115,6 +117,174 @@ private Q_SLOTS:
         QCOMPARE(newCovers.count(), 5);
     }
 
+    void initialTestWithTracksAndParallelScan()
+    {
+        LocalFileListing myListing;
+
+        QString musicPath = QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music");
+
+        QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+        QSignalSpy removedTracksListSpy(&myListing, &LocalFileListing::removedTracksList);
+
+        myListing.setMetadataExtractionThreadCount(4);
+
+        QCOMPARE(myListing.metadataExtractionThreadCount(), 4);
+
+        myListing.init();
+
+        myListing.setAllRootPaths({musicPath});
+
+        myListing.refreshContent();
+
+        QVERIFY(tracksListSpy.count() > 0);
+        QCOMPARE(removedTracksListSpy.count(), 0);
+
+        auto allNewTracksCount = 0;
+        for (const auto &oneNewTracksSignal : tracksListSpy) {
+            allNewTracksCount += oneNewTracksSignal.at(0).value<DataTypes::ListTrackDataType>().count();
+        }
+        auto newCovers = tracksListSpy.last().at(1).value<QHash<QString, QUrl>>();
+
+        QCOMPARE(allNewTracksCount, 5);
+        QCOMPARE(newCovers.count(), 5);
+
+        myListing.setMetadataExtractionThreadCount(1);
+
+        QCOMPARE(myListing.metadataExtractionThreadCount(), 1);
+    }
+
+    void skipUnchangedDirectories()
+    {
+        QString musicPath = QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music");
+
+        auto allFiles = QHash<QUrl, QDateTime>{};
+        auto allDirectories = DataTypes::DirectoryFingerprints{};
+
+        {
+            LocalFileListing myListing;
+
+            QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+            QSignalSpy scannedDirectoriesSpy(&myListing, &LocalFileListing::scannedDirectoriesFingerprints);
+
+            myListing.init();
+            myListing.setAllRootPaths({musicPath});
+            myListing.refreshContent();
+
+            for (const auto &oneSignal : qAsConst(tracksListSpy)) {
+                const auto newTracks = oneSignal.at(0).value<DataTypes::ListTrackDataType>();
+                for (const auto &oneTrack : newTracks) {
+                    allFiles[oneTrack.resourceURI()] = oneTrack.fileModificationTime();
+                }
+            }
+
+            QCOMPARE(allFiles.count(), 5);
+            QCOMPARE(scannedDirectoriesSpy.count(), 1);
+
+            allDirectories = scannedDirectoriesSpy.at(0).at(0).value<DataTypes::DirectoryFingerprints>();
+
+            QCOMPARE(allDirectories.count(), 1);
+        }
+
+        LocalFileListing myListing;
+
+        QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+        QSignalSpy removedTracksListSpy(&myListing, &LocalFileListing::removedTracksList);
+        QSignalSpy indexingStatisticsSpy(&myListing, &LocalFileListing::indexingStatistics);
+
+        myListing.init();
+        myListing.setAllRootPaths({musicPath});
+        myListing.restoredDirectoriesFingerprints(allDirectories);
+        myListing.restoredTracks(allFiles);
+
+        QCOMPARE(tracksListSpy.count(), 0);
+        QCOMPARE(removedTracksListSpy.count(), 0);
+        QCOMPARE(indexingStatisticsSpy.count(), 1);
+
+        const auto &statisticsSignal = indexingStatisticsSpy.at(0);
+        QCOMPARE(statisticsSignal.at(0).toInt(), 0);
+        QCOMPARE(statisticsSignal.at(1).toInt(), 1);
+        QCOMPARE(statisticsSignal.at(2).toInt(), 5);
+
+        QSignalSpy removedAllDirectoriesSpy(&myListing, &LocalFileListing::removedAllDirectoriesFingerprints);
+        QSignalSpy askRestoredTracksSpy(&myListing, &LocalFileListing::askRestoredTracks);
+
+        myListing.rescanAllContent();
+
+        QCOMPARE(removedAllDirectoriesSpy.count(), 1);
+        QCOMPARE(askRestoredTracksSpy.count(), 1);
+
+        myListing.restoredDirectoriesFingerprints({});
+        myListing.restoredTracks(allFiles);
+
+        QCOMPARE(tracksListSpy.count(), 0);
+        QCOMPARE(removedTracksListSpy.count(), 0);
+        QCOMPARE(indexingStatisticsSpy.count(), 2);
+
+        const auto &rescanStatisticsSignal = indexingStatisticsSpy.at(1);
+        QCOMPARE(rescanStatisticsSignal.at(0).toInt(), 1);
+        QCOMPARE(rescanStatisticsSignal.at(1).toInt(), 0);
+        QCOMPARE(rescanStatisticsSignal.at(2).toInt(), 5);
+    }
+
+    void rescanModifiedFilesOfUnchangedDirectories()
+    {
+        QString musicPath = QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music");
+
+        auto allFiles = QHash<QUrl, QDateTime>{};
+        auto allDirectories = DataTypes::DirectoryFingerprints{};
+
+        {
+            LocalFileListing myListing;
+
+            QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+            QSignalSpy scannedDirectoriesSpy(&myListing, &LocalFileListing::scannedDirectoriesFingerprints);
+
+            myListing.init();
+            myListing.setAllRootPaths({musicPath});
+            myListing.refreshContent();
+
+            for (const auto &oneSignal : qAsConst(tracksListSpy)) {
+                const auto newTracks = oneSignal.at(0).value<DataTypes::ListTrackDataType>();
+                for (const auto &oneTrack : newTracks) {
+                    allFiles[oneTrack.resourceURI()] = oneTrack.fileModificationTime();
+                }
+            }
+
+            QCOMPARE(allFiles.count(), 5);
+            QCOMPARE(scannedDirectoriesSpy.count(), 1);
+
+            allDirectories = scannedDirectoriesSpy.at(0).at(0).value<DataTypes::DirectoryFingerprints>();
+        }
+
+        const auto modifiedFile = allFiles.begin().key();
+        allFiles[modifiedFile] = allFiles[modifiedFile].addSecs(-3600);
+
+        LocalFileListing myListing;
+
+        QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+        QSignalSpy removedTracksListSpy(&myListing, &LocalFileListing::removedTracksList);
+        QSignalSpy indexingStatisticsSpy(&myListing, &LocalFileListing::indexingStatistics);
+
+        myListing.init();
+        myListing.setAllRootPaths({musicPath});
+        myListing.restoredDirectoriesFingerprints(allDirectories);
+        myListing.restoredTracks(allFiles);
+
+        QCOMPARE(tracksListSpy.count(), 1);
+        QCOMPARE(removedTracksListSpy.count(), 0);
+        QCOMPARE(indexingStatisticsSpy.count(), 1);
+
+        const auto newTracks = tracksListSpy.at(0).at(0).value<DataTypes::ListTrackDataType>();
+
+        QCOMPARE(newTracks.count(), 1);
+        QCOMPARE(newTracks.at(0).resourceURI(), modifiedFile);
+
+        const auto &statisticsSignal = indexingStatisticsSpy.at(0);
+        QCOMPARE(statisticsSignal.at(0).toInt(), 0);
+        QCOMPARE(statisticsSignal.at(1).toInt(), 1);
+        QCOMPARE(statisticsSignal.at(2).toInt(), 4);
+    }
+
     void addAndRemoveTracks()
     {
         LocalFileListing myListing;
@@ -407,6 +577,135 @@ private Q_SLOTS:
         QCOMPARE(newCoversLast.count(), 1);
     }
 
+    void addManyTracksAndRemoveOneTrack()
+    {
+        LocalFileListing myListing;
+
+        QString musicOriginPath = QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music");
+
+        QString musicPath = QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH) + QStringLiteral("/music2/data/innerData");
+
+        QString musicParentPath = QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH) + QStringLiteral("/music2");
+        QDir musicParentDirectory(musicParentPath);
+        QDir rootDirectory(QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH));
+
+        musicParentDirectory.removeRecursively();
+        rootDirectory.mkpath(QStringLiteral("music2/data/innerData"));
+
+        QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+        QSignalSpy removedTracksListSpy(&myListing, &LocalFileListing::removedTracksList);
+        QSignalSpy errorWatchingFileSystemChangesSpy(&myListing, &LocalFileListing::errorWatchingFileSystemChanges);
+
+        myListing.init();
+        myListing.setAllRootPaths({musicParentPath});
+        myListing.refreshContent();
+
+        QCOMPARE(tracksListSpy.count(), 0);
+        QCOMPARE(removedTracksListSpy.count(), 0);
+
+        const auto tracksCount = 20;
+
+        QFile myTrack(musicOriginPath + QStringLiteral("/test.ogg"));
+        for (int i = 0; i < tracksCount; ++i) {
+            QCOMPARE(myTrack.copy(musicPath + QStringLiteral("/test%1.ogg").arg(i)), true);
+        }
+
+        auto newTracksCount = 0;
+        while (newTracksCount < tracksCount) {
+            if (tracksListSpy.isEmpty()) {
+                QCOMPARE(tracksListSpy.wait(), true);
+            }
+
+            newTracksCount += tracksListSpy.takeFirst().at(0).value<DataTypes::ListTrackDataType>().count();
+        }
+
+        QCOMPARE(newTracksCount, tracksCount);
+        QCOMPARE(removedTracksListSpy.count(), 0);
+
+        QCOMPARE(QFile::remove(musicPath + QStringLiteral("/test7.ogg")), true);
+
+        auto removedFilesWorking = removedTracksListSpy.wait();
+
+        if (!removedFilesWorking && errorWatchingFileSystemChangesSpy.count()) {
+            QEXPECT_FAIL("", "Impossible watching file system for changes", Abort);
+        }
+        QCOMPARE(removedFilesWorking, true);
+
+        QCOMPARE(removedTracksListSpy.count(), 1);
+
+        auto removedTracks = removedTracksListSpy.at(0).at(0).value<QList<QUrl>>();
+        QCOMPARE(removedTracks, QList<QUrl>{QUrl::fromLocalFile(QFileInfo(musicPath + QStringLiteral("/test7.ogg")).absoluteFilePath())});
+        QCOMPARE(tracksListSpy.count(), 0);
+    }
+
+    void coalesceBurstOfDirectoryChanges()
+    {
+        QString watchedPath = QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH) + QStringLiteral("/burst");
+        QDir watchedDirectory(watchedPath);
+        QDir rootDirectory(QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH));
+
+        watchedDirectory.removeRecursively();
+        rootDirectory.mkpath(QStringLiteral("burst"));
+
+        DirectoryWatcher myWatcher;
+
+        if (!myWatcher.isValid()) {
+            QSKIP("Directory watcher is not available on this system");
+        }
+
+        const auto coalescingInterval = 300;
+        myWatcher.setCoalescingInterval(coalescingInterval);
+
+        auto allChanges = QList<DirectoryWatcher::Changes>{};
+        connect(&myWatcher, &DirectoryWatcher::directoriesChanged,
+                this, [&allChanges](const DirectoryWatcher::Changes &changes) {allChanges.push_back(changes);});
+
+        QCOMPARE(myWatcher.addDirectory(watchedPath), true);
+
+        const auto filesCount = 50;
+
+        for (int i = 0; i < filesCount; ++i) {
+            QFile newFile(watchedPath + QStringLiteral("/file%1.ogg").arg(i));
+            QCOMPARE(newFile.open(QIODevice::WriteOnly), true);
+            newFile.write("data");
+            newFile.close();
+
+            QCOMPARE(newFile.open(QIODevice::Append), true);
+            newFile.write("more data");
+            newFile.close();
+        }
+
+        QFile temporaryFile(watchedPath + QStringLiteral("/temporary.ogg"));
+        QCOMPARE(temporaryFile.open(QIODevice::WriteOnly), true);
+        temporaryFile.close();
+        QCOMPARE(temporaryFile.remove(), true);
+
+        QCOMPARE(QFile::rename(watchedPath + QStringLiteral("/file0.ogg"), watchedPath + QStringLiteral("/renamed.ogg")), true);
+
+        QVERIFY(QTest::qWaitFor([&allChanges]() {return !allChanges.isEmpty();}, 10 * coalescingInterval));
+        QTest::qWait(3 * coalescingInterval);
+
+        QCOMPARE(allChanges.count(), 1);
+
+        const auto &createdFiles = allChanges.at(0).mCreatedFiles;
+
+        QCOMPARE(createdFiles.count(), filesCount);
+        QCOMPARE(createdFiles.contains(watchedPath + QStringLiteral("/renamed.ogg")), true);
+        QCOMPARE(createdFiles.contains(watchedPath + QStringLiteral("/file0.ogg")), false);
+        QCOMPARE(createdFiles.contains(watchedPath + QStringLiteral("/temporary.ogg")), false);
+        QCOMPARE(allChanges.at(0).mModifiedFiles.count(), 0);
+        QCOMPARE(allChanges.at(0).mDeletedFiles.count(), 0);
+        QCOMPARE(allChanges.at(0).mMovedFiles.count(), 0);
+
+        QCOMPARE(QFile::remove(watchedPath + QStringLiteral("/file1.ogg")), true);
+
+        QVERIFY(QTest::qWaitFor([&allChanges]() {return allChanges.count() > 1;}, 10 * coalescingInterval));
+
+        QCOMPARE(allChanges.count(), 2);
+        QCOMPARE(allChanges.at(1).mDeletedFiles, QStringList{watchedPath + QStringLiteral("/file1.ogg")});
+        QCOMPARE(allChanges.at(1).mCreatedFiles.count(), 0);
+    }
+
     void restoreRemovedTracks()
     {
         LocalFileListing myListing;
@@ -8947,6 +8947,70 @@ void ManageAudioPlayerTest::testRestorePlayListAndSettingsAutomaticPlay()
     QCOMPARE(skipNextTrackSpy.wait(300), true);
 }
 
+void ManageAudioPlayerTest::switchToPreparedNextTrack()
+{
+    Elisa::ElisaConfiguration::self()->setDefaults();
+    ManageAudioPlayer myPlayer;
+    QStandardItemModel myPlayList;
+
+    QSignalSpy playerSourceChangedSpy(&myPlayer, &ManageAudioPlayer::playerSourceChanged);
+    QSignalSpy playerNextSourceChangedSpy(&myPlayer, &ManageAudioPlayer::playerNextSourceChanged);
+    QSignalSpy playerStopSpy(&myPlayer, &ManageAudioPlayer::playerStop);
+    QSignalSpy skipNextTrackSpy(&myPlayer, &ManageAudioPlayer::skipNextTrack);
+    QSignalSpy startedPlayingTrackSpy(&myPlayer, &ManageAudioPlayer::startedPlayingTrack);
+
+    myPlayList.appendRow(new QStandardItem);
+    myPlayList.appendRow(new QStandardItem);
+    myPlayList.appendRow(new QStandardItem);
+
+    myPlayList.item(0, 0)->setData(QUrl::fromUserInput(QStringLiteral("file:///1.mp3")), ManageAudioPlayerTest::ResourceRole);
+    myPlayList.item(1, 0)->setData(QUrl::fromUserInput(QStringLiteral("file:///2.mp3")), ManageAudioPlayerTest::ResourceRole);
+    myPlayList.item(2, 0)->setData(QUrl::fromUserInput(QStringLiteral("file:///3.mp3")), ManageAudioPlayerTest::ResourceRole);
+
+    myPlayer.setPlayListModel(&myPlayList);
+    myPlayer.setUrlRole(ManageAudioPlayerTest::ResourceRole);
+    myPlayer.setIsPlayingRole(ManageAudioPlayerTest::IsPlayingRole);
+    myPlayer.setCurrentTrack(myPlayList.index(0, 0));
+    myPlayer.setNextTrack(myPlayList.index(1, 0));
+
+    QCOMPARE(playerSourceChangedSpy.count(), 1);
+    QCOMPARE(playerNextSourceChangedSpy.count(), 1);
+    QCOMPARE(playerNextSourceChangedSpy.at(0).at(0).toUrl(), QUrl::fromUserInput(QStringLiteral("file:///2.mp3")));
+
+    myPlayer.ensurePlay();
+    myPlayer.setPlayerStatus(QMediaPlayer::LoadedMedia);
+    myPlayer.setPlayerPlaybackState(QMediaPlayer::PlayingState);
+
+    QCOMPARE(startedPlayingTrackSpy.count(), 1);
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), ManageAudioPlayerTest::IsPlayingRole).toBool(), true);
+
+    myPlayer.playerSwitchedToNextSource(QUrl::fromUserInput(QStringLiteral("file:///2.mp3")));
+
+    QVERIFY(skipNextTrackSpy.wait());
+
+    myPlayer.setNextTrack(myPlayList.index(2, 0));
+    myPlayer.setCurrentTrack(myPlayList.index(1, 0));
+
+    QCOMPARE(playerSourceChangedSpy.count(), 1);
+    QCOMPARE(playerStopSpy.count(), 0);
+    QCOMPARE(startedPlayingTrackSpy.count(), 2);
+    QCOMPARE(startedPlayingTrackSpy.at(1).at(0).toUrl(), QUrl::fromUserInput(QStringLiteral("file:///2.mp3")));
+    QCOMPARE(playerNextSourceChangedSpy.count(), 3);
+    QCOMPARE(playerNextSourceChangedSpy.at(2).at(0).toUrl(), QUrl::fromUserInput(QStringLiteral("file:///3.mp3")));
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), ManageAudioPlayerTest::IsPlayingRole).toBool(), false);
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), ManageAudioPlayerTest::IsPlayingRole).toBool(), true);
+    QCOMPARE(myPlayer.playerPlaybackState(), QMediaPlayer::PlayingState);
+
+    myPlayer.playerSwitchedToNextSource(QUrl::fromUserInput(QStringLiteral("file:///3.mp3")));
+
+    QVERIFY(skipNextTrackSpy.wait());
+
+    myPlayer.setCurrentTrack(myPlayList.index(0, 0));
+
+    QCOMPARE(startedPlayingTrackSpy.count(), 2);
+    QTRY_COMPARE(playerStopSpy.count(), 1);
+}
+
 QTEST_GUILESS_MAIN(ManageAudioPlayerTest)
 
 
@@ -79,6 +79,8 @@ private Q_SLOTS:
 
     void playSingleAndClearPlayListTrack();
 
+    void switchToPreparedNextTrack();
+
 };
 
 #endif // MANAGEAUDIOPLAYERTEST_H
@@ -20,6 +20,7 @@
 #include <QUrl>
 #include <QTime>
 #include <QTemporaryFile>
+#include <QTemporaryDir>
 #include <QAbstractItemModelTester>
 
 MediaPlayListProxyModelTest::MediaPlayListProxyModelTest(QObject *parent) : QObject(parent)
@@ -52,7 +53,7 @@ void MediaPlayListProxyModelTest::simpleInitialCase()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -64,7 +65,7 @@ void MediaPlayListProxyModelTest::simpleInitialCase()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -72,6 +73,9 @@ void MediaPlayListProxyModelTest::simpleInitialCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -81,8 +85,8 @@ void MediaPlayListProxyModelTest::simpleInitialCase()
     connect(&myPlayList, &MediaPlayList::newUrlInList,
             &myListener, &TracksListener::newUrlInList,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
@@ -97,7 +101,7 @@ void MediaPlayListProxyModelTest::simpleInitialCase()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto newTrackID = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track6"), QStringLiteral("artist1 and artist2"), QStringLiteral("album2"), 6, 1);
@@ -112,7 +116,7 @@ void MediaPlayListProxyModelTest::simpleInitialCase()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -125,7 +129,7 @@ void MediaPlayListProxyModelTest::simpleInitialCase()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 }
 
@@ -147,7 +151,7 @@ void MediaPlayListProxyModelTest::enqueueAlbumCase()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -158,7 +162,7 @@ void MediaPlayListProxyModelTest::enqueueAlbumCase()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -166,11 +170,14 @@ void MediaPlayListProxyModelTest::enqueueAlbumCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -190,7 +197,7 @@ void MediaPlayListProxyModelTest::enqueueAlbumCase()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayListProxyModel.enqueue({{{{DataTypes::ElementTypeRole, ElisaUtils::Album}, {DataTypes::DatabaseIdRole, myDatabaseContent.albumIdFromTitleAndArtist(QStringLiteral("album2"), QStringLiteral("artist1"), QStringLiteral("/"))}},
@@ -206,7 +213,7 @@ void MediaPlayListProxyModelTest::enqueueAlbumCase()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayListProxyModel.rowCount(), 6);
@@ -273,7 +280,7 @@ void MediaPlayListProxyModelTest::enqueueArtistCase()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -285,7 +292,7 @@ void MediaPlayListProxyModelTest::enqueueArtistCase()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -293,11 +300,14 @@ void MediaPlayListProxyModelTest::enqueueArtistCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -318,7 +328,7 @@ void MediaPlayListProxyModelTest::enqueueArtistCase()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayListProxyModel.enqueue({{{{DataTypes::ElementTypeRole, ElisaUtils::Artist}}, QStringLiteral("artist1"), {}}}, {}, {});
@@ -331,7 +341,7 @@ void MediaPlayListProxyModelTest::enqueueArtistCase()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayListProxyModel.rowCount(), 1);
@@ -346,7 +356,7 @@ void MediaPlayListProxyModelTest::enqueueArtistCase()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayListProxyModel.rowCount(), 6);
@@ -413,7 +423,7 @@ void MediaPlayListProxyModelTest::enqueueMultipleAlbumsCase()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -424,7 +434,7 @@ void MediaPlayListProxyModelTest::enqueueMultipleAlbumsCase()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -432,11 +442,14 @@ void MediaPlayListProxyModelTest::enqueueMultipleAlbumsCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -456,7 +469,7 @@ void MediaPlayListProxyModelTest::enqueueMultipleAlbumsCase()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayListProxyModel.enqueue({{{{DataTypes::ElementTypeRole, ElisaUtils::Album},
@@ -476,7 +489,7 @@ void MediaPlayListProxyModelTest::enqueueMultipleAlbumsCase()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 5);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(myPlayListProxyModel.rowCount(), 9);
@@ -564,7 +577,7 @@ void MediaPlayListProxyModelTest::enqueueTrackByUrl()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -576,7 +589,7 @@ void MediaPlayListProxyModelTest::enqueueTrackByUrl()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -585,6 +598,9 @@ void MediaPlayListProxyModelTest::enqueueTrackByUrl()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -594,8 +610,8 @@ void MediaPlayListProxyModelTest::enqueueTrackByUrl()
     connect(&myPlayList, &MediaPlayList::newUrlInList,
             &myListener, &TracksListener::newUrlInList,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
@@ -610,7 +626,7 @@ void MediaPlayListProxyModelTest::enqueueTrackByUrl()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -627,7 +643,7 @@ void MediaPlayListProxyModelTest::enqueueTrackByUrl()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 1);
 
@@ -641,7 +657,7 @@ void MediaPlayListProxyModelTest::enqueueTrackByUrl()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 1);
 }
@@ -664,7 +680,7 @@ void MediaPlayListProxyModelTest::enqueueTracksByUrl()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -676,7 +692,7 @@ void MediaPlayListProxyModelTest::enqueueTracksByUrl()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -685,6 +701,9 @@ void MediaPlayListProxyModelTest::enqueueTracksByUrl()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -694,8 +713,8 @@ void MediaPlayListProxyModelTest::enqueueTracksByUrl()
     connect(&myPlayList, &MediaPlayList::newUrlInList,
             &myListener, &TracksListener::newUrlInList,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
@@ -710,7 +729,7 @@ void MediaPlayListProxyModelTest::enqueueTracksByUrl()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -731,7 +750,7 @@ void MediaPlayListProxyModelTest::enqueueTracksByUrl()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 2);
 
@@ -745,7 +764,7 @@ void MediaPlayListProxyModelTest::enqueueTracksByUrl()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 2);
 }
@@ -768,7 +787,7 @@ void MediaPlayListProxyModelTest::enqueueReplaceAndPlay()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -780,7 +799,7 @@ void MediaPlayListProxyModelTest::enqueueReplaceAndPlay()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -788,11 +807,14 @@ void MediaPlayListProxyModelTest::enqueueReplaceAndPlay()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -813,7 +835,7 @@ void MediaPlayListProxyModelTest::enqueueReplaceAndPlay()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackID = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track6"), QStringLiteral("artist1 and artist2"),
@@ -828,7 +850,7 @@ void MediaPlayListProxyModelTest::enqueueReplaceAndPlay()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -841,7 +863,7 @@ void MediaPlayListProxyModelTest::enqueueReplaceAndPlay()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayListProxyModel.data(myPlayListProxyModel.index(0, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track6"));
@@ -862,7 +884,7 @@ void MediaPlayListProxyModelTest::enqueueReplaceAndPlay()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -875,7 +897,7 @@ void MediaPlayListProxyModelTest::enqueueReplaceAndPlay()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(myPlayListProxyModel.data(myPlayListProxyModel.index(1, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track1"));
@@ -900,7 +922,7 @@ void MediaPlayListProxyModelTest::enqueueReplaceAndPlay()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 6);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(myPlayListProxyModel.data(myPlayListProxyModel.index(0, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track1"));
@@ -947,7 +969,7 @@ void MediaPlayListProxyModelTest::removeFirstTrackOfAlbum()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -959,7 +981,7 @@ void MediaPlayListProxyModelTest::removeFirstTrackOfAlbum()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -967,11 +989,14 @@ void MediaPlayListProxyModelTest::removeFirstTrackOfAlbum()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -992,7 +1017,7 @@ void MediaPlayListProxyModelTest::removeFirstTrackOfAlbum()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayListProxyModel.enqueue({{{{DataTypes::ElementTypeRole, ElisaUtils::Album},
@@ -1009,7 +1034,7 @@ void MediaPlayListProxyModelTest::removeFirstTrackOfAlbum()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     myPlayListProxyModel.removeRow(0);
@@ -1022,7 +1047,7 @@ void MediaPlayListProxyModelTest::removeFirstTrackOfAlbum()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 }
 
@@ -1059,11 +1084,14 @@ void MediaPlayListProxyModelTest::testSaveLoadPlayList()
     connect(&myListenerSave, &TracksListener::trackHasChanged,
             &myPlayListSave, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListenerSave, &TracksListener::tracksHaveChanged,
+            &myPlayListSave, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListenerSave, &TracksListener::tracksListAdded,
             &myPlayListSave, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayListSave, &MediaPlayList::newTrackByNameInList,
-            &myListenerSave, &TracksListener::trackByNameInList,
+    connect(&myPlayListSave, &MediaPlayList::newTracksByNameInList,
+            &myListenerSave, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayListSave, &MediaPlayList::newEntryInList,
             &myListenerSave, &TracksListener::newEntryInList,
@@ -1076,11 +1104,14 @@ void MediaPlayListProxyModelTest::testSaveLoadPlayList()
     connect(&myListenerRestore, &TracksListener::trackHasChanged,
             &myPlayListRestore, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListenerRestore, &TracksListener::tracksHaveChanged,
+            &myPlayListRestore, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListenerRestore, &TracksListener::tracksListAdded,
             &myPlayListRestore, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayListRestore, &MediaPlayList::newTrackByNameInList,
-            &myListenerRestore, &TracksListener::trackByNameInList,
+    connect(&myPlayListRestore, &MediaPlayList::newTracksByNameInList,
+            &myListenerRestore, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayListRestore, &MediaPlayList::newEntryInList,
             &myListenerRestore, &TracksListener::newEntryInList,
@@ -1255,11 +1286,14 @@ void MediaPlayListProxyModelTest::testSavePersistentState()
     connect(&myListenerSave, &TracksListener::trackHasChanged,
             &myPlayListSave, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListenerSave, &TracksListener::tracksHaveChanged,
+            &myPlayListSave, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListenerSave, &TracksListener::tracksListAdded,
             &myPlayListSave, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayListSave, &MediaPlayList::newTrackByNameInList,
-            &myListenerSave, &TracksListener::trackByNameInList,
+    connect(&myPlayListSave, &MediaPlayList::newTracksByNameInList,
+            &myListenerSave, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayListSave, &MediaPlayList::newEntryInList,
             &myListenerSave, &TracksListener::newEntryInList,
@@ -1269,11 +1303,14 @@ void MediaPlayListProxyModelTest::testSavePersistentState()
     connect(&myListenerRead, &TracksListener::trackHasChanged,
             &myPlayListRead, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListenerRead, &TracksListener::tracksHaveChanged,
+            &myPlayListRead, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListenerRead, &TracksListener::tracksListAdded,
             &myPlayListRead, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayListRead, &MediaPlayList::newTrackByNameInList,
-            &myListenerRead, &TracksListener::trackByNameInList,
+    connect(&myPlayListRead, &MediaPlayList::newTracksByNameInList,
+            &myListenerRead, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayListRead, &MediaPlayList::newEntryInList,
             &myListenerRead, &TracksListener::newEntryInList,
@@ -1541,11 +1578,14 @@ void MediaPlayListProxyModelTest::testRestoreSettings()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayListModel, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayListModel, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayListModel, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayListModel, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayListModel, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayListModel, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -1622,11 +1662,14 @@ void MediaPlayListProxyModelTest::testSaveAndRestoreSettings()
     connect(&myListenerSave, &TracksListener::trackHasChanged,
             &myPlayListSave, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListenerSave, &TracksListener::tracksHaveChanged,
+            &myPlayListSave, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListenerSave, &TracksListener::tracksListAdded,
             &myPlayListSave, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayListSave, &MediaPlayList::newTrackByNameInList,
-            &myListenerSave, &TracksListener::trackByNameInList,
+    connect(&myPlayListSave, &MediaPlayList::newTracksByNameInList,
+            &myListenerSave, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayListSave, &MediaPlayList::newEntryInList,
             &myListenerSave, &TracksListener::newEntryInList,
@@ -1637,11 +1680,14 @@ void MediaPlayListProxyModelTest::testSaveAndRestoreSettings()
     connect(&myListenerRestore, &TracksListener::trackHasChanged,
             &myPlayListRestore, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListenerRestore, &TracksListener::tracksHaveChanged,
+            &myPlayListRestore, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListenerRestore, &TracksListener::tracksListAdded,
             &myPlayListRestore, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayListRestore, &MediaPlayList::newTrackByNameInList,
-            &myListenerRestore, &TracksListener::trackByNameInList,
+    connect(&myPlayListRestore, &MediaPlayList::newTracksByNameInList,
+            &myListenerRestore, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayListRestore, &MediaPlayList::newEntryInList,
             &myListenerRestore, &TracksListener::newEntryInList,
@@ -1763,6 +1809,149 @@ void MediaPlayListProxyModelTest::testSaveAndRestoreSettings()
     QCOMPARE(myPlayListRestoreProxyModel.shufflePlayList(), true);
 }
 
+void MediaPlayListProxyModelTest::testSaveAndRestoreSession()
+{
+    MediaPlayList myPlayListSave;
+    QAbstractItemModelTester testModelSave(&myPlayListSave);
+    MediaPlayListProxyModel myPlayListSaveProxyModel;
+    myPlayListSaveProxyModel.setPlayListModel(&myPlayListSave);
+    QAbstractItemModelTester testProxyModelSave(&myPlayListSaveProxyModel);
+    DatabaseInterface myDatabaseContent;
+    TracksListener myListenerSave(&myDatabaseContent);
+    MediaPlayList myPlayListRestore;
+    QAbstractItemModelTester testModelRestore(&myPlayListRestore);
+    MediaPlayListProxyModel myPlayListRestoreProxyModel;
+    myPlayListRestoreProxyModel.setPlayListModel(&myPlayListRestore);
+    QAbstractItemModelTester testProxyModelRestore(&myPlayListRestoreProxyModel);
+    TracksListener myListenerRestore(&myDatabaseContent);
+
+    QSignalSpy dataChangedSaveSpy(&myPlayListSaveProxyModel, &MediaPlayListProxyModel::dataChanged);
+    QSignalSpy currentTrackChangedRestoreSpy(&myPlayListRestoreProxyModel, &MediaPlayListProxyModel::currentTrackChanged);
+    QSignalSpy dataChangedRestoreSpy(&myPlayListRestore, &MediaPlayList::dataChanged);
+    QSignalSpy newTracksByNameInListRestoreSpy(&myPlayListRestore, &MediaPlayList::newTracksByNameInList);
+
+    myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
+
+    connect(&myListenerSave, &TracksListener::trackHasChanged,
+            &myPlayListSave, &MediaPlayList::trackChanged,
+            Qt::QueuedConnection);
+    connect(&myListenerSave, &TracksListener::tracksHaveChanged,
+            &myPlayListSave, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
+    connect(&myListenerSave, &TracksListener::tracksListAdded,
+            &myPlayListSave, &MediaPlayList::tracksListAdded,
+            Qt::QueuedConnection);
+    connect(&myPlayListSave, &MediaPlayList::newTracksByNameInList,
+            &myListenerSave, &TracksListener::tracksByNameInList,
+            Qt::QueuedConnection);
+    connect(&myPlayListSave, &MediaPlayList::newEntryInList,
+            &myListenerSave, &TracksListener::newEntryInList,
+            Qt::QueuedConnection);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListenerSave, &TracksListener::tracksAdded);
+
+    connect(&myListenerRestore, &TracksListener::trackHasChanged,
+            &myPlayListRestore, &MediaPlayList::trackChanged,
+            Qt::QueuedConnection);
+    connect(&myListenerRestore, &TracksListener::tracksHaveChanged,
+            &myPlayListRestore, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
+    connect(&myListenerRestore, &TracksListener::tracksListAdded,
+            &myPlayListRestore, &MediaPlayList::tracksListAdded,
+            Qt::QueuedConnection);
+    connect(&myPlayListRestore, &MediaPlayList::newTracksByNameInList,
+            &myListenerRestore, &TracksListener::tracksByNameInList,
+            Qt::QueuedConnection);
+    connect(&myPlayListRestore, &MediaPlayList::newEntryInList,
+            &myListenerRestore, &TracksListener::newEntryInList,
+            Qt::QueuedConnection);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListenerRestore, &TracksListener::tracksAdded);
+
+    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers);
+
+    myPlayListSaveProxyModel.setRepeatMode(MediaPlayListProxyModel::Repeat::Playlist);
+    myPlayListSaveProxyModel.setShufflePlayList(true);
+
+    myPlayListSaveProxyModel.enqueue({{{{DataTypes::ElementTypeRole, ElisaUtils::Track},
+                                        {DataTypes::DatabaseIdRole, myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1)}},
+                                       QStringLiteral("track1"), {}}}, {}, {});
+    myPlayListSaveProxyModel.enqueue({{{{DataTypes::ElementTypeRole, ElisaUtils::Track},
+                                        {DataTypes::DatabaseIdRole, myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist3"), QStringLiteral("album1"), 3, 3)}},
+                                       QStringLiteral("track3"), {}}}, {}, {});
+    myPlayListSaveProxyModel.enqueue({{{{DataTypes::ElementTypeRole, ElisaUtils::Track},
+                                        {DataTypes::DatabaseIdRole, myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track5"), QStringLiteral("artist1"), QStringLiteral("album2"), 5, 1)}},
+                                       QStringLiteral("track5"), {}}}, {}, {});
+    myPlayListSaveProxyModel.enqueue({{{{DataTypes::ElementTypeRole, ElisaUtils::Track},
+                                        {DataTypes::DatabaseIdRole, myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album1"), 1, 1)}},
+                                       QStringLiteral("track1"), {}}}, {}, {});
+
+    QVERIFY(dataChangedSaveSpy.wait());
+
+    myPlayListSaveProxyModel.skipNextTrack();
+    myPlayListSaveProxyModel.skipNextTrack();
+
+    QTemporaryDir sessionDirectory;
+    QVERIFY(sessionDirectory.isValid());
+
+    const auto sessionFileName = sessionDirectory.filePath(QStringLiteral("playListSession.bin"));
+
+    QVERIFY(!myPlayListSaveProxyModel.saveSession());
+
+    myPlayListSaveProxyModel.setSessionFileName(sessionFileName);
+
+    QVERIFY(myPlayListSaveProxyModel.saveSession());
+
+    myPlayListRestoreProxyModel.setSessionFileName(sessionFileName);
+    const auto sessionState = myPlayListSaveProxyModel.sessionPersistentState();
+    QVERIFY(!sessionState.contains(QStringLiteral("playList")));
+    QCOMPARE(sessionState.value(QStringLiteral("shufflePlayList")).toBool(), true);
+
+    myPlayListRestoreProxyModel.setPersistentState(sessionState);
+
+    QCOMPARE(myPlayListRestoreProxyModel.rowCount(), 4);
+    QCOMPARE(currentTrackChangedRestoreSpy.count(), 1);
+    QCOMPARE(newTracksByNameInListRestoreSpy.count(), 1);
+    QCOMPARE(myPlayListRestoreProxyModel.repeatMode(), MediaPlayListProxyModel::Repeat::Playlist);
+    QCOMPARE(myPlayListRestoreProxyModel.shufflePlayList(), true);
+
+    QVERIFY(dataChangedRestoreSpy.wait());
+
+    for (int row = 0; row < 4; ++row) {
+        QCOMPARE(myPlayListRestore.data(myPlayListRestore.index(row, 0), MediaPlayList::IsValidRole).toBool(), true);
+        QCOMPARE(myPlayListRestore.data(myPlayListRestore.index(row, 0), MediaPlayList::DatabaseIdRole),
+                 myPlayListSave.data(myPlayListSave.index(row, 0), MediaPlayList::DatabaseIdRole));
+        QCOMPARE(myPlayListRestore.data(myPlayListRestore.index(row, 0), MediaPlayList::AlbumRole),
+                 myPlayListSave.data(myPlayListSave.index(row, 0), MediaPlayList::AlbumRole));
+    }
+}
+
+void MediaPlayListProxyModelTest::testRestoreCorruptedSession()
+{
+    MediaPlayList myPlayList;
+    QAbstractItemModelTester testModel(&myPlayList);
+    MediaPlayListProxyModel myPlayListProxyModel;
+    myPlayListProxyModel.setPlayListModel(&myPlayList);
+    QAbstractItemModelTester testProxyModel(&myPlayListProxyModel);
+
+    QTemporaryDir sessionDirectory;
+    QVERIFY(sessionDirectory.isValid());
+
+    const auto sessionFileName = sessionDirectory.filePath(QStringLiteral("playListSession.bin"));
+
+    QFile sessionFile(sessionFileName);
+    QVERIFY(sessionFile.open(QIODevice::WriteOnly));
+    sessionFile.write("ELPS not a valid snapshot");
+    sessionFile.close();
+
+    myPlayListProxyModel.setSessionFileName(sessionFileName);
+    myPlayListProxyModel.setPersistentState({{QStringLiteral("playListSession"), true},
+                                             {QStringLiteral("repeatMode"), QVariant::fromValue(MediaPlayListProxyModel::Repeat::One)}});
+
+    QCOMPARE(myPlayListProxyModel.rowCount(), 0);
+    QCOMPARE(myPlayListProxyModel.repeatMode(), MediaPlayListProxyModel::Repeat::One);
+}
+
 void MediaPlayListProxyModelTest::shufflePlayList()
 {
     MediaPlayList myPlayList;
@@ -1783,11 +1972,14 @@ void MediaPlayListProxyModelTest::shufflePlayList()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -1884,11 +2076,14 @@ void MediaPlayListProxyModelTest::testShuffleMode()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -1993,11 +2188,14 @@ void MediaPlayListProxyModelTest::randomAndContinuePlayList()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -2109,11 +2307,14 @@ void MediaPlayListProxyModelTest::continuePlayList()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -2224,11 +2425,14 @@ void MediaPlayListProxyModelTest::previousAndNextTracksTest()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -2345,11 +2549,14 @@ void MediaPlayListProxyModelTest::remainingTracksTest()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -2437,7 +2644,7 @@ void MediaPlayListProxyModelTest::clearPlayListCase()
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy currentTrackChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::currentTrackChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -2450,7 +2657,7 @@ void MediaPlayListProxyModelTest::clearPlayListCase()
     QCOMPARE(tracksCountChangedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(currentTrackChangedSpy.count(), 0);
 
@@ -2459,11 +2666,14 @@ void MediaPlayListProxyModelTest::clearPlayListCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -2485,7 +2695,7 @@ void MediaPlayListProxyModelTest::clearPlayListCase()
     QCOMPARE(tracksCountChangedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(currentTrackChangedSpy.count(), 0);
 
@@ -2504,7 +2714,7 @@ void MediaPlayListProxyModelTest::clearPlayListCase()
     QCOMPARE(tracksCountChangedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
     QCOMPARE(currentTrackChangedSpy.count(), 1);
 
@@ -2560,7 +2770,7 @@ void MediaPlayListProxyModelTest::clearPlayListCase()
     QCOMPARE(tracksCountChangedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
     QCOMPARE(currentTrackChangedSpy.count(), 2);
 
@@ -2590,7 +2800,7 @@ void MediaPlayListProxyModelTest::undoClearPlayListCase()
     QSignalSpy displayUndoNotificationSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::displayUndoNotification);
     QSignalSpy currentTrackChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::currentTrackChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -2603,7 +2813,7 @@ void MediaPlayListProxyModelTest::undoClearPlayListCase()
     QCOMPARE(tracksCountChangedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(currentTrackChangedSpy.count(), 0);
 
@@ -2612,11 +2822,14 @@ void MediaPlayListProxyModelTest::undoClearPlayListCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -2638,7 +2851,7 @@ void MediaPlayListProxyModelTest::undoClearPlayListCase()
     QCOMPARE(tracksCountChangedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(currentTrackChangedSpy.count(), 0);
 
@@ -2657,7 +2870,7 @@ void MediaPlayListProxyModelTest::undoClearPlayListCase()
     QCOMPARE(tracksCountChangedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
     QCOMPARE(currentTrackChangedSpy.count(), 1);
 
@@ -2713,7 +2926,7 @@ void MediaPlayListProxyModelTest::undoClearPlayListCase()
     QCOMPARE(tracksCountChangedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
     QCOMPARE(currentTrackChangedSpy.count(), 2);
 
@@ -2732,7 +2945,7 @@ void MediaPlayListProxyModelTest::undoClearPlayListCase()
     QCOMPARE(tracksCountChangedSpy.count(), 5);
     QCOMPARE(persistentStateChangedSpy.count(), 6);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 6);
+    QCOMPARE(newTracksByNameInListSpy.count(), 1);
     QCOMPARE(newEntryInListSpy.count(), 1);
     QCOMPARE(currentTrackChangedSpy.count(), 3);
     QCOMPARE(displayUndoNotificationSpy.count(), 1);
@@ -2802,7 +3015,7 @@ void MediaPlayListProxyModelTest::undoReplacePlayListCase()
     QSignalSpy currentTrackChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::currentTrackChanged);
     QSignalSpy displayUndoNotificationSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::displayUndoNotification);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -2815,7 +3028,7 @@ void MediaPlayListProxyModelTest::undoReplacePlayListCase()
     QCOMPARE(tracksCountChangedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(currentTrackChangedSpy.count(), 0);
 
@@ -2824,11 +3037,14 @@ void MediaPlayListProxyModelTest::undoReplacePlayListCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -2850,7 +3066,7 @@ void MediaPlayListProxyModelTest::undoReplacePlayListCase()
     QCOMPARE(tracksCountChangedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(currentTrackChangedSpy.count(), 0);
 
@@ -2869,7 +3085,7 @@ void MediaPlayListProxyModelTest::undoReplacePlayListCase()
     QCOMPARE(tracksCountChangedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
     QCOMPARE(currentTrackChangedSpy.count(), 1);
 
@@ -2930,7 +3146,7 @@ void MediaPlayListProxyModelTest::undoReplacePlayListCase()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 7);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
     QCOMPARE(currentTrackChangedSpy.count(), 3);
 
@@ -2970,7 +3186,7 @@ void MediaPlayListProxyModelTest::undoReplacePlayListCase()
     QCOMPARE(tracksCountChangedSpy.count(), 9);
     QCOMPARE(persistentStateChangedSpy.count(), 10);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 6);
+    QCOMPARE(newTracksByNameInListSpy.count(), 1);
     QCOMPARE(newEntryInListSpy.count(), 2);
     QCOMPARE(currentTrackChangedSpy.count(), 5);
     QCOMPARE(displayUndoNotificationSpy.count(), 1);
@@ -3039,11 +3255,14 @@ void MediaPlayListProxyModelTest::testBringUpAndSkipPreviousAndContinueCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -3240,11 +3459,14 @@ void MediaPlayListProxyModelTest::testBringUpAndRemoveMultipleNotBeginCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -3317,11 +3539,14 @@ void MediaPlayListProxyModelTest::testBringUpAndPlayCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -3375,11 +3600,14 @@ void MediaPlayListProxyModelTest::testBringUpAndSkipNextCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -3433,11 +3661,14 @@ void MediaPlayListProxyModelTest::testBringUpAndSkipPreviousCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -3499,11 +3730,14 @@ void MediaPlayListProxyModelTest::testBringUpAndSkipPreviousWithSeekCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -3573,7 +3807,7 @@ void MediaPlayListProxyModelTest::testRemoveSelection()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -3585,7 +3819,7 @@ void MediaPlayListProxyModelTest::testRemoveSelection()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -3593,11 +3827,14 @@ void MediaPlayListProxyModelTest::testRemoveSelection()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -3618,7 +3855,7 @@ void MediaPlayListProxyModelTest::testRemoveSelection()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayListProxyModel.enqueue({{{{DataTypes::ElementTypeRole, ElisaUtils::Artist}}, QStringLiteral("artist1"), {}}},
@@ -3632,7 +3869,7 @@ void MediaPlayListProxyModelTest::testRemoveSelection()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(rowsAboutToBeInsertedSpy.wait(), true);
@@ -3645,7 +3882,7 @@ void MediaPlayListProxyModelTest::testRemoveSelection()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayListProxyModel.tracksCount(), 6);
@@ -3703,7 +3940,7 @@ void MediaPlayListProxyModelTest::testRemoveSelection()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 6);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayListProxyModel.tracksCount(), 3);
@@ -3749,7 +3986,7 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayArtist()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -3761,7 +3998,7 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayArtist()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -3769,11 +4006,14 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayArtist()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -3794,7 +4034,7 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayArtist()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayListProxyModel.enqueue({{{{DataTypes::ElementTypeRole, ElisaUtils::Artist}}, QStringLiteral("artist3"), {}}},
@@ -3808,7 +4048,7 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayArtist()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(rowsAboutToBeInsertedSpy.wait(), true);
@@ -3821,7 +4061,7 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayArtist()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayListProxyModel.tracksCount(), 1);
@@ -3850,7 +4090,7 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayArtist()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 5);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(rowsAboutToBeInsertedSpy.wait(), true);
@@ -3863,7 +4103,7 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayArtist()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 7);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(myPlayListProxyModel.tracksCount(), 1);
@@ -3900,7 +4140,7 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayTrackId()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -3912,7 +4152,7 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayTrackId()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -3920,11 +4160,14 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayTrackId()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -3945,7 +4188,7 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayTrackId()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist3"),
@@ -3964,7 +4207,7 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayTrackId()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -3977,7 +4220,7 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayTrackId()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayListProxyModel.tracksCount(), 1);
@@ -4011,7 +4254,7 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayTrackId()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -4024,7 +4267,7 @@ void MediaPlayListProxyModelTest::testReplaceAndPlayTrackId()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(myPlayListProxyModel.tracksCount(), 1);
@@ -4061,7 +4304,7 @@ void MediaPlayListProxyModelTest::testTrackBeenRemoved()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -4073,7 +4316,7 @@ void MediaPlayListProxyModelTest::testTrackBeenRemoved()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -4081,11 +4324,14 @@ void MediaPlayListProxyModelTest::testTrackBeenRemoved()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -4106,7 +4352,7 @@ void MediaPlayListProxyModelTest::testTrackBeenRemoved()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayListProxyModel.enqueue({{{{DataTypes::ElementTypeRole, ElisaUtils::Artist}}, QStringLiteral("artist1"), {}}},
@@ -4120,7 +4366,7 @@ void MediaPlayListProxyModelTest::testTrackBeenRemoved()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(rowsAboutToBeInsertedSpy.wait(), true);
@@ -4133,7 +4379,7 @@ void MediaPlayListProxyModelTest::testTrackBeenRemoved()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayListProxyModel.tracksCount(), 6);
@@ -4200,7 +4446,7 @@ void MediaPlayListProxyModelTest::testTrackBeenRemoved()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayListProxyModel.tracksCount(), 6);
@@ -4267,11 +4513,14 @@ void MediaPlayListProxyModelTest::finishPlayList()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -4332,11 +4581,14 @@ void MediaPlayListProxyModelTest::removeBeforeCurrentTrack()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -4415,11 +4667,14 @@ void MediaPlayListProxyModelTest::switchToTrackTest()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -4482,11 +4737,14 @@ void MediaPlayListProxyModelTest::singleTrack()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -4540,11 +4798,14 @@ void MediaPlayListProxyModelTest::testBringUpAndRemoveCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -4595,11 +4856,14 @@ void MediaPlayListProxyModelTest::testBringUpAndRemoveLastCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -4673,11 +4937,14 @@ void MediaPlayListProxyModelTest::testBringUpAndRemoveMultipleCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -4735,11 +5002,14 @@ void MediaPlayListProxyModelTest::testBringUpAndDownCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -4793,11 +5063,14 @@ void MediaPlayListProxyModelTest::testBringUpCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -4844,11 +5117,14 @@ void MediaPlayListProxyModelTest::testBringUpCaseFromNewAlbum()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -4899,7 +5175,7 @@ void MediaPlayListProxyModelTest::testSetData()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -4911,7 +5187,7 @@ void MediaPlayListProxyModelTest::testSetData()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -4919,11 +5195,14 @@ void MediaPlayListProxyModelTest::testSetData()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -4944,7 +5223,7 @@ void MediaPlayListProxyModelTest::testSetData()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist2"),
@@ -4960,7 +5239,7 @@ void MediaPlayListProxyModelTest::testSetData()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -4973,7 +5252,7 @@ void MediaPlayListProxyModelTest::testSetData()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayListProxyModel.data(myPlayListProxyModel.index(0, 0), MediaPlayList::ColumnsRoles::IsPlayingRole).toBool(), false);
@@ -4991,7 +5270,7 @@ void MediaPlayListProxyModelTest::testSetData()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5004,7 +5283,7 @@ void MediaPlayListProxyModelTest::testSetData()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(myPlayListProxyModel.data(myPlayListProxyModel.index(0, 0), MediaPlayList::ColumnsRoles::IsPlayingRole).toBool(), false);
@@ -5023,7 +5302,7 @@ void MediaPlayListProxyModelTest::testSetData()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5036,7 +5315,7 @@ void MediaPlayListProxyModelTest::testSetData()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(myPlayListProxyModel.data(myPlayListProxyModel.index(0, 0), MediaPlayList::ColumnsRoles::IsPlayingRole).toBool(), false);
@@ -5053,7 +5332,7 @@ void MediaPlayListProxyModelTest::testSetData()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(myPlayListProxyModel.data(myPlayListProxyModel.index(0, 0), MediaPlayList::ColumnsRoles::IsPlayingRole).toBool(), false);
@@ -5070,7 +5349,7 @@ void MediaPlayListProxyModelTest::testSetData()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(myPlayListProxyModel.setData(myPlayListProxyModel.index(4, 0), true, MediaPlayList::ColumnsRoles::TitleRole), false);
@@ -5083,7 +5362,7 @@ void MediaPlayListProxyModelTest::testSetData()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(myPlayListProxyModel.setData({}, true, MediaPlayList::ColumnsRoles::TitleRole), false);
@@ -5096,7 +5375,7 @@ void MediaPlayListProxyModelTest::testSetData()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 }
 
@@ -5118,7 +5397,7 @@ void MediaPlayListProxyModelTest::testHasHeader()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -5130,7 +5409,7 @@ void MediaPlayListProxyModelTest::testHasHeader()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -5138,11 +5417,14 @@ void MediaPlayListProxyModelTest::testHasHeader()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -5163,7 +5445,7 @@ void MediaPlayListProxyModelTest::testHasHeader()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1);
@@ -5178,7 +5460,7 @@ void MediaPlayListProxyModelTest::testHasHeader()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5191,7 +5473,7 @@ void MediaPlayListProxyModelTest::testHasHeader()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album1"), 1, 1);
@@ -5206,7 +5488,7 @@ void MediaPlayListProxyModelTest::testHasHeader()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5219,7 +5501,7 @@ void MediaPlayListProxyModelTest::testHasHeader()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), 2, 1);
@@ -5234,7 +5516,7 @@ void MediaPlayListProxyModelTest::testHasHeader()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5247,7 +5529,7 @@ void MediaPlayListProxyModelTest::testHasHeader()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist1"), QStringLiteral("album2"), 3, 1);
@@ -5262,7 +5544,7 @@ void MediaPlayListProxyModelTest::testHasHeader()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5275,7 +5557,7 @@ void MediaPlayListProxyModelTest::testHasHeader()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayListProxyModel.removeRow(2);
@@ -5288,7 +5570,7 @@ void MediaPlayListProxyModelTest::testHasHeader()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 5);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 }
 
@@ -5310,7 +5592,7 @@ void MediaPlayListProxyModelTest::testHasHeaderWithRemove()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -5322,7 +5604,7 @@ void MediaPlayListProxyModelTest::testHasHeaderWithRemove()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -5330,11 +5612,14 @@ void MediaPlayListProxyModelTest::testHasHeaderWithRemove()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -5355,7 +5640,7 @@ void MediaPlayListProxyModelTest::testHasHeaderWithRemove()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1);
@@ -5370,7 +5655,7 @@ void MediaPlayListProxyModelTest::testHasHeaderWithRemove()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5383,7 +5668,7 @@ void MediaPlayListProxyModelTest::testHasHeaderWithRemove()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), 2, 1);
@@ -5398,7 +5683,7 @@ void MediaPlayListProxyModelTest::testHasHeaderWithRemove()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5411,7 +5696,7 @@ void MediaPlayListProxyModelTest::testHasHeaderWithRemove()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album1"), 1, 1);
@@ -5426,7 +5711,7 @@ void MediaPlayListProxyModelTest::testHasHeaderWithRemove()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5439,7 +5724,7 @@ void MediaPlayListProxyModelTest::testHasHeaderWithRemove()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist1"), QStringLiteral("album2"), 3, 1);
@@ -5454,7 +5739,7 @@ void MediaPlayListProxyModelTest::testHasHeaderWithRemove()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5467,7 +5752,7 @@ void MediaPlayListProxyModelTest::testHasHeaderWithRemove()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayListProxyModel.removeRow(2);
@@ -5480,7 +5765,7 @@ void MediaPlayListProxyModelTest::testHasHeaderWithRemove()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 5);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayListProxyModel.removeRow(0);
@@ -5493,7 +5778,7 @@ void MediaPlayListProxyModelTest::testHasHeaderWithRemove()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 6);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 }
 
@@ -5515,7 +5800,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirst()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -5527,7 +5812,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -5535,11 +5820,14 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirst()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -5560,7 +5848,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1);
@@ -5575,7 +5863,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5588,7 +5876,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), 2, 1);
@@ -5603,7 +5891,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5616,7 +5904,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist1"), QStringLiteral("album2"), 3, 1);
@@ -5631,7 +5919,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5644,7 +5932,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track4"), QStringLiteral("artist1"), QStringLiteral("album2"), 4, 1);
@@ -5659,7 +5947,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5672,7 +5960,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayListProxyModel.moveRow(0, 3);
@@ -5685,7 +5973,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 5);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 }
 
@@ -5707,7 +5995,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnother()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -5719,7 +6007,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -5727,11 +6015,14 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnother()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -5752,7 +6043,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1);
@@ -5767,7 +6058,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5780,7 +6071,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), 2, 1);
@@ -5795,7 +6086,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5808,7 +6099,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist1"), QStringLiteral("album2"), 3, 1);
@@ -5823,7 +6114,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5836,7 +6127,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track4"), QStringLiteral("artist1"), QStringLiteral("album2"), 4, 1);
@@ -5851,7 +6142,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5864,7 +6155,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayListProxyModel.moveRow(3, 0);
@@ -5877,7 +6168,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 5);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 }
 
@@ -5899,7 +6190,7 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -5911,7 +6202,7 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -5919,11 +6210,14 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -5944,7 +6238,7 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist2"),
@@ -5960,7 +6254,7 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -5973,7 +6267,7 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"),
@@ -5989,7 +6283,7 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6002,7 +6296,7 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist2"),
@@ -6018,7 +6312,7 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6031,7 +6325,7 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist2"),
@@ -6047,7 +6341,7 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6060,7 +6354,7 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     auto fithTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track9"), QStringLiteral("artist2"),
@@ -6076,7 +6370,7 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsInsertedSpy.count(), 5);
     QCOMPARE(persistentStateChangedSpy.count(), 5);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 5);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6089,7 +6383,7 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsInsertedSpy.count(), 5);
     QCOMPARE(persistentStateChangedSpy.count(), 5);
     QCOMPARE(dataChangedSpy.count(), 5);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 5);
 
     auto sixthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist7"),
@@ -6105,7 +6399,7 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsInsertedSpy.count(), 6);
     QCOMPARE(persistentStateChangedSpy.count(), 6);
     QCOMPARE(dataChangedSpy.count(), 5);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 6);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6118,7 +6412,7 @@ void MediaPlayListProxyModelTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsInsertedSpy.count(), 6);
     QCOMPARE(persistentStateChangedSpy.count(), 6);
     QCOMPARE(dataChangedSpy.count(), 6);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 6);
 }
 
@@ -6140,7 +6434,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirstLikeQml()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -6152,7 +6446,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -6160,11 +6454,14 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirstLikeQml()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -6185,7 +6482,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1);
@@ -6200,7 +6497,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6213,7 +6510,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), 2, 1);
@@ -6228,7 +6525,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6241,7 +6538,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist1"), QStringLiteral("album2"), 3, 1);
@@ -6256,7 +6553,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6269,7 +6566,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track4"), QStringLiteral("artist1"), QStringLiteral("album2"), 4, 1);
@@ -6284,7 +6581,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6297,7 +6594,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayListProxyModel.moveRow(0, 3);
@@ -6310,7 +6607,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 5);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 }
 
@@ -6332,7 +6629,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnotherLikeQml()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -6344,7 +6641,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -6352,11 +6649,14 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnotherLikeQml()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -6377,7 +6677,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1);
@@ -6392,7 +6692,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6405,7 +6705,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), 2, 1);
@@ -6420,7 +6720,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6433,7 +6733,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist1"), QStringLiteral("album2"), 3, 1);
@@ -6448,7 +6748,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6461,7 +6761,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track4"), QStringLiteral("artist1"), QStringLiteral("album2"), 4, 1);
@@ -6476,7 +6776,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6489,7 +6789,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayListProxyModel.moveRow(3, 0);
@@ -6502,7 +6802,7 @@ void MediaPlayListProxyModelTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 5);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 }
 
@@ -6524,7 +6824,7 @@ void MediaPlayListProxyModelTest::testHasHeaderYetAnotherMoveLikeQml()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -6536,7 +6836,7 @@ void MediaPlayListProxyModelTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -6544,11 +6844,14 @@ void MediaPlayListProxyModelTest::testHasHeaderYetAnotherMoveLikeQml()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -6569,7 +6872,7 @@ void MediaPlayListProxyModelTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1);
@@ -6584,7 +6887,7 @@ void MediaPlayListProxyModelTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6597,7 +6900,7 @@ void MediaPlayListProxyModelTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), 2, 1);
@@ -6612,7 +6915,7 @@ void MediaPlayListProxyModelTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6625,7 +6928,7 @@ void MediaPlayListProxyModelTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album1"), 1, 1);
@@ -6640,7 +6943,7 @@ void MediaPlayListProxyModelTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6653,7 +6956,7 @@ void MediaPlayListProxyModelTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track4"), QStringLiteral("artist1"), QStringLiteral("album2"), 4, 1);
@@ -6668,7 +6971,7 @@ void MediaPlayListProxyModelTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -6681,7 +6984,7 @@ void MediaPlayListProxyModelTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayListProxyModel.moveRow(0, 2);
@@ -6694,7 +6997,7 @@ void MediaPlayListProxyModelTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 5);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayListProxyModel.moveRow(2, 0);
@@ -6707,7 +7010,7 @@ void MediaPlayListProxyModelTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(persistentStateChangedSpy.count(), 6);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 }
 
@@ -6729,7 +7032,7 @@ void MediaPlayListProxyModelTest::enqueueFiles()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -6741,7 +7044,7 @@ void MediaPlayListProxyModelTest::enqueueFiles()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -6750,11 +7053,14 @@ void MediaPlayListProxyModelTest::enqueueFiles()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -6775,7 +7081,7 @@ void MediaPlayListProxyModelTest::enqueueFiles()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -6792,7 +7098,7 @@ void MediaPlayListProxyModelTest::enqueueFiles()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 2);
 
@@ -6808,7 +7114,7 @@ void MediaPlayListProxyModelTest::enqueueFiles()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 2);
 
@@ -6844,7 +7150,7 @@ void MediaPlayListProxyModelTest::enqueueSampleFiles()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -6856,7 +7162,7 @@ void MediaPlayListProxyModelTest::enqueueSampleFiles()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -6865,11 +7171,14 @@ void MediaPlayListProxyModelTest::enqueueSampleFiles()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -6890,7 +7199,7 @@ void MediaPlayListProxyModelTest::enqueueSampleFiles()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -6909,7 +7218,7 @@ void MediaPlayListProxyModelTest::enqueueSampleFiles()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 2);
 
@@ -6927,7 +7236,7 @@ void MediaPlayListProxyModelTest::enqueueSampleFiles()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 2);
 
@@ -6978,7 +7287,7 @@ void MediaPlayListProxyModelTest::enqueueEmpty()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -6990,7 +7299,7 @@ void MediaPlayListProxyModelTest::enqueueEmpty()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -6998,11 +7307,14 @@ void MediaPlayListProxyModelTest::enqueueEmpty()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -7023,7 +7335,7 @@ void MediaPlayListProxyModelTest::enqueueEmpty()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayListProxyModel.enqueue(DataTypes::EntryDataList{}, {}, {});
@@ -7036,7 +7348,7 @@ void MediaPlayListProxyModelTest::enqueueEmpty()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayListProxyModel.enqueue(DataTypes::EntryDataList{}, {}, {});
@@ -7049,7 +7361,7 @@ void MediaPlayListProxyModelTest::enqueueEmpty()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayListProxyModel.enqueue(DataTypes::EntryDataList{}, ElisaUtils::AppendPlayList, ElisaUtils::DoNotTriggerPlay);
@@ -7062,7 +7374,7 @@ void MediaPlayListProxyModelTest::enqueueEmpty()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayListProxyModel.enqueue(DataTypes::EntryDataList{}, ElisaUtils::AppendPlayList, ElisaUtils::DoNotTriggerPlay);
@@ -7075,7 +7387,7 @@ void MediaPlayListProxyModelTest::enqueueEmpty()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayListProxyModel.enqueue(DataTypes::EntryDataList{},
@@ -7090,7 +7402,7 @@ void MediaPlayListProxyModelTest::enqueueEmpty()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 }
 
@@ -7112,7 +7424,7 @@ void MediaPlayListProxyModelTest::testMoveAndShuffle()
     QSignalSpy rowsInsertedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::rowsInserted);
     QSignalSpy persistentStateChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayListProxyModel, &MediaPlayListProxyModel::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -7124,7 +7436,7 @@ void MediaPlayListProxyModelTest::testMoveAndShuffle()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -7132,11 +7444,14 @@ void MediaPlayListProxyModelTest::testMoveAndShuffle()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -7157,7 +7472,7 @@ void MediaPlayListProxyModelTest::testMoveAndShuffle()
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(persistentStateChangedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1);
@@ -7172,7 +7487,7 @@ void MediaPlayListProxyModelTest::testMoveAndShuffle()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -7185,7 +7500,7 @@ void MediaPlayListProxyModelTest::testMoveAndShuffle()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), 2, 1);
@@ -7200,7 +7515,7 @@ void MediaPlayListProxyModelTest::testMoveAndShuffle()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -7213,7 +7528,7 @@ void MediaPlayListProxyModelTest::testMoveAndShuffle()
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist1"), QStringLiteral("album2"), 3, 1);
@@ -7228,7 +7543,7 @@ void MediaPlayListProxyModelTest::testMoveAndShuffle()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -7241,7 +7556,7 @@ void MediaPlayListProxyModelTest::testMoveAndShuffle()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     myPlayListProxyModel.setShufflePlayList(true);
@@ -7254,7 +7569,7 @@ void MediaPlayListProxyModelTest::testMoveAndShuffle()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     myPlayListProxyModel.moveRow(2, 0);
@@ -7267,7 +7582,7 @@ void MediaPlayListProxyModelTest::testMoveAndShuffle()
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(persistentStateChangedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 }
 
@@ -58,6 +58,10 @@ private Q_SLOTS:
 
     void testSaveAndRestoreSettings();
 
+    void testSaveAndRestoreSession();
+
+    void testRestoreCorruptedSession();
+
     void testBringUpAndSkipPreviousAndContinueCase();
 
     void testBringUpAndRemoveMultipleNotBeginCase();
@@ -45,7 +45,7 @@ void MediaPlayListTest::simpleInitialCase()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -56,7 +56,7 @@ void MediaPlayListTest::simpleInitialCase()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -64,6 +64,9 @@ void MediaPlayListTest::simpleInitialCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -73,8 +76,8 @@ void MediaPlayListTest::simpleInitialCase()
     connect(&myPlayList, &MediaPlayList::newUrlInList,
             &myListener, &TracksListener::newUrlInList,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
@@ -88,7 +91,7 @@ void MediaPlayListTest::simpleInitialCase()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto newTrackID = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track6"), QStringLiteral("artist1 and artist2"), QStringLiteral("album2"), 6, 1);
@@ -102,7 +105,7 @@ void MediaPlayListTest::simpleInitialCase()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -114,7 +117,7 @@ void MediaPlayListTest::simpleInitialCase()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 }
 
@@ -132,7 +135,7 @@ void MediaPlayListTest::enqueueAlbumCase()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -143,7 +146,7 @@ void MediaPlayListTest::enqueueAlbumCase()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -151,11 +154,14 @@ void MediaPlayListTest::enqueueAlbumCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -175,7 +181,7 @@ void MediaPlayListTest::enqueueAlbumCase()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayList.enqueueOneEntry({{{DataTypes::DatabaseIdRole, myDatabaseContent.albumIdFromTitleAndArtist(QStringLiteral("album2"), QStringLiteral("artist1"), QStringLiteral("/"))}},
@@ -190,7 +196,7 @@ void MediaPlayListTest::enqueueAlbumCase()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayList.rowCount(), 6);
@@ -253,7 +259,7 @@ void MediaPlayListTest::enqueueArtistCase()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -264,7 +270,7 @@ void MediaPlayListTest::enqueueArtistCase()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -272,11 +278,14 @@ void MediaPlayListTest::enqueueArtistCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -296,7 +305,7 @@ void MediaPlayListTest::enqueueArtistCase()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayList.enqueueOneEntry({{{DataTypes::ElementTypeRole, ElisaUtils::Artist}}, QStringLiteral("artist1"), {}});
@@ -308,7 +317,7 @@ void MediaPlayListTest::enqueueArtistCase()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayList.rowCount(), 1);
@@ -322,7 +331,7 @@ void MediaPlayListTest::enqueueArtistCase()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayList.rowCount(), 6);
@@ -385,7 +394,7 @@ void MediaPlayListTest::enqueueTrackByUrl()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -396,7 +405,7 @@ void MediaPlayListTest::enqueueTrackByUrl()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -405,6 +414,9 @@ void MediaPlayListTest::enqueueTrackByUrl()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -414,8 +426,8 @@ void MediaPlayListTest::enqueueTrackByUrl()
     connect(&myPlayList, &MediaPlayList::newUrlInList,
             &myListener, &TracksListener::newUrlInList,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
@@ -429,7 +441,7 @@ void MediaPlayListTest::enqueueTrackByUrl()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -444,7 +456,7 @@ void MediaPlayListTest::enqueueTrackByUrl()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 1);
 
@@ -457,7 +469,7 @@ void MediaPlayListTest::enqueueTrackByUrl()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 1);
 }
@@ -476,7 +488,7 @@ void MediaPlayListTest::enqueueTracksByUrl()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -487,7 +499,7 @@ void MediaPlayListTest::enqueueTracksByUrl()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
    QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -496,6 +508,9 @@ void MediaPlayListTest::enqueueTracksByUrl()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -505,8 +520,8 @@ void MediaPlayListTest::enqueueTracksByUrl()
     connect(&myPlayList, &MediaPlayList::newUrlInList,
             &myListener, &TracksListener::newUrlInList,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
@@ -520,7 +535,7 @@ void MediaPlayListTest::enqueueTracksByUrl()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -537,7 +552,7 @@ void MediaPlayListTest::enqueueTracksByUrl()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 2);
 
@@ -550,7 +565,7 @@ void MediaPlayListTest::enqueueTracksByUrl()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 2);
 }
@@ -569,7 +584,7 @@ void MediaPlayListTest::enqueueFiles()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -580,7 +595,7 @@ void MediaPlayListTest::enqueueFiles()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -589,11 +604,14 @@ void MediaPlayListTest::enqueueFiles()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -613,7 +631,7 @@ void MediaPlayListTest::enqueueFiles()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -626,7 +644,7 @@ void MediaPlayListTest::enqueueFiles()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 2);
 
@@ -641,7 +659,7 @@ void MediaPlayListTest::enqueueFiles()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 2);
 
@@ -673,7 +691,7 @@ void MediaPlayListTest::enqueueSampleFiles()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -684,7 +702,7 @@ void MediaPlayListTest::enqueueSampleFiles()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -693,11 +711,14 @@ void MediaPlayListTest::enqueueSampleFiles()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -717,7 +738,7 @@ void MediaPlayListTest::enqueueSampleFiles()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 0);
 
@@ -731,7 +752,7 @@ void MediaPlayListTest::enqueueSampleFiles()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 2);
 
@@ -748,7 +769,7 @@ void MediaPlayListTest::enqueueSampleFiles()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
     QCOMPARE(newUrlInListSpy.count(), 2);
 
@@ -795,7 +816,7 @@ void MediaPlayListTest::enqueueEmpty()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -806,7 +827,7 @@ void MediaPlayListTest::enqueueEmpty()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -814,11 +835,14 @@ void MediaPlayListTest::enqueueEmpty()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -838,7 +862,7 @@ void MediaPlayListTest::enqueueEmpty()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayList.enqueueOneEntry(DataTypes::EntryData{});
@@ -850,7 +874,7 @@ void MediaPlayListTest::enqueueEmpty()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayList.enqueueOneEntry(DataTypes::EntryData{});
@@ -862,7 +886,7 @@ void MediaPlayListTest::enqueueEmpty()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayList.enqueueOneEntry(DataTypes::EntryData{});
@@ -874,7 +898,7 @@ void MediaPlayListTest::enqueueEmpty()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayList.enqueueOneEntry(DataTypes::EntryData{});
@@ -886,7 +910,7 @@ void MediaPlayListTest::enqueueEmpty()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayList.enqueueOneEntry(DataTypes::EntryData{});
@@ -898,7 +922,7 @@ void MediaPlayListTest::enqueueEmpty()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 }
 
@@ -916,7 +940,7 @@ void MediaPlayListTest::removeFirstTrackOfAlbum()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -927,7 +951,7 @@ void MediaPlayListTest::removeFirstTrackOfAlbum()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -935,11 +959,14 @@ void MediaPlayListTest::removeFirstTrackOfAlbum()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -959,7 +986,7 @@ void MediaPlayListTest::removeFirstTrackOfAlbum()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayList.enqueueOneEntry({{{DataTypes::DatabaseIdRole, myDatabaseContent.albumIdFromTitleAndArtist(QStringLiteral("album2"), QStringLiteral("artist1"), QStringLiteral("/"))}},
@@ -974,7 +1001,7 @@ void MediaPlayListTest::removeFirstTrackOfAlbum()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     myPlayList.removeRows(0, 1);
@@ -986,7 +1013,7 @@ void MediaPlayListTest::removeFirstTrackOfAlbum()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 }
 
@@ -1004,7 +1031,7 @@ void MediaPlayListTest::testTrackBeenRemoved()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -1015,7 +1042,7 @@ void MediaPlayListTest::testTrackBeenRemoved()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -1023,11 +1050,14 @@ void MediaPlayListTest::testTrackBeenRemoved()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -1047,7 +1077,7 @@ void MediaPlayListTest::testTrackBeenRemoved()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayList.enqueueOneEntry(DataTypes::EntryData{{{DataTypes::ElementTypeRole, ElisaUtils::Artist}}, QStringLiteral("artist1"), {}});
@@ -1059,7 +1089,7 @@ void MediaPlayListTest::testTrackBeenRemoved()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(rowsAboutToBeInsertedSpy.wait(), true);
@@ -1071,7 +1101,7 @@ void MediaPlayListTest::testTrackBeenRemoved()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayList.rowCount(), 6);
@@ -1137,7 +1167,7 @@ void MediaPlayListTest::testTrackBeenRemoved()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayList.rowCount(), 6);
@@ -1200,7 +1230,7 @@ void MediaPlayListTest::testSetData()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -1211,7 +1241,7 @@ void MediaPlayListTest::testSetData()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -1219,11 +1249,14 @@ void MediaPlayListTest::testSetData()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -1243,7 +1276,7 @@ void MediaPlayListTest::testSetData()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist2"),
@@ -1257,7 +1290,7 @@ void MediaPlayListTest::testSetData()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -1269,7 +1302,7 @@ void MediaPlayListTest::testSetData()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::IsPlayingRole).toBool(), false);
@@ -1285,7 +1318,7 @@ void MediaPlayListTest::testSetData()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -1297,7 +1330,7 @@ void MediaPlayListTest::testSetData()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::IsPlayingRole).toBool(), false);
@@ -1314,7 +1347,7 @@ void MediaPlayListTest::testSetData()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -1326,7 +1359,7 @@ void MediaPlayListTest::testSetData()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::IsPlayingRole).toBool(), false);
@@ -1342,7 +1375,7 @@ void MediaPlayListTest::testSetData()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::IsPlayingRole).toBool(), false);
@@ -1358,7 +1391,7 @@ void MediaPlayListTest::testSetData()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(myPlayList.setData(myPlayList.index(4, 0), true, MediaPlayList::ColumnsRoles::TitleRole), false);
@@ -1370,7 +1403,7 @@ void MediaPlayListTest::testSetData()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(myPlayList.setData({}, true, MediaPlayList::ColumnsRoles::TitleRole), false);
@@ -1382,7 +1415,7 @@ void MediaPlayListTest::testSetData()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 }
 
@@ -1400,7 +1433,7 @@ void MediaPlayListTest::testHasHeader()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -1411,7 +1444,7 @@ void MediaPlayListTest::testHasHeader()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -1419,11 +1452,14 @@ void MediaPlayListTest::testHasHeader()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -1443,7 +1479,7 @@ void MediaPlayListTest::testHasHeader()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1);
@@ -1456,7 +1492,7 @@ void MediaPlayListTest::testHasHeader()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -1468,7 +1504,7 @@ void MediaPlayListTest::testHasHeader()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album1"), 1, 1);
@@ -1481,7 +1517,7 @@ void MediaPlayListTest::testHasHeader()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -1493,7 +1529,7 @@ void MediaPlayListTest::testHasHeader()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), 2, 1);
@@ -1506,7 +1542,7 @@ void MediaPlayListTest::testHasHeader()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -1518,7 +1554,7 @@ void MediaPlayListTest::testHasHeader()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist1"), QStringLiteral("album2"), 3, 1);
@@ -1531,7 +1567,7 @@ void MediaPlayListTest::testHasHeader()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -1543,7 +1579,7 @@ void MediaPlayListTest::testHasHeader()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayList.removeRows(2, 1);
@@ -1555,7 +1591,7 @@ void MediaPlayListTest::testHasHeader()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 }
 
@@ -1573,7 +1609,7 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -1584,7 +1620,7 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -1592,11 +1628,14 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -1616,7 +1655,7 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1);
@@ -1629,7 +1668,7 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -1641,7 +1680,7 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), 2, 1);
@@ -1654,7 +1693,7 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -1666,7 +1705,7 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album1"), 1, 1);
@@ -1679,7 +1718,7 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -1691,7 +1730,7 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist1"), QStringLiteral("album2"), 3, 1);
@@ -1704,7 +1743,7 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -1716,7 +1755,7 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayList.removeRows(2, 1);
@@ -1728,7 +1767,7 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayList.removeRows(0, 1);
@@ -1740,7 +1779,7 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 }
 
@@ -1758,7 +1797,7 @@ void MediaPlayListTest::testHasHeaderWithRestore()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -1769,7 +1808,7 @@ void MediaPlayListTest::testHasHeaderWithRestore()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContentHeaderWithRestore"));
@@ -1777,11 +1816,14 @@ void MediaPlayListTest::testHasHeaderWithRestore()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -1806,7 +1848,7 @@ void MediaPlayListTest::testHasHeaderWithRestore()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 4);
+    QCOMPARE(newTracksByNameInListSpy.count(), 1);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.insertTracksList(mNewTracks, mNewCovers);
@@ -1822,7 +1864,7 @@ void MediaPlayListTest::testHasHeaderWithRestore()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 4);
+    QCOMPARE(newTracksByNameInListSpy.count(), 1);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track1"));
@@ -1866,7 +1908,7 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -1877,7 +1919,7 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -1885,11 +1927,14 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -1909,7 +1954,7 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1);
@@ -1922,7 +1967,7 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -1934,7 +1979,7 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), 2, 1);
@@ -1947,7 +1992,7 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -1959,7 +2004,7 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist1"), QStringLiteral("album2"), 3, 1);
@@ -1972,7 +2017,7 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -1984,7 +2029,7 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track4"), QStringLiteral("artist1"), QStringLiteral("album2"), 4, 1);
@@ -1997,7 +2042,7 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2009,7 +2054,7 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayList.moveRows({}, 0, 1, {}, 3);
@@ -2021,7 +2066,7 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     QCOMPARE(rowsMovedSpy.count(), 1);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 }
 
@@ -2039,7 +2084,7 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -2050,7 +2095,7 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -2058,11 +2103,14 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -2082,7 +2130,7 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1);
@@ -2095,7 +2143,7 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2107,7 +2155,7 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), 2, 1);
@@ -2120,7 +2168,7 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2132,7 +2180,7 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist1"), QStringLiteral("album2"), 3, 1);
@@ -2145,7 +2193,7 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2157,7 +2205,7 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track4"), QStringLiteral("artist1"), QStringLiteral("album2"), 4, 1);
@@ -2170,7 +2218,7 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2182,7 +2230,7 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayList.moveRows({}, 3, 1, {}, 0);
@@ -2194,7 +2242,7 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     QCOMPARE(rowsMovedSpy.count(), 1);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 }
 
@@ -2212,7 +2260,7 @@ void MediaPlayListTest::restoreMultipleIdenticalTracks()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -2223,7 +2271,7 @@ void MediaPlayListTest::restoreMultipleIdenticalTracks()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContentHeaderWithRestore"));
@@ -2231,11 +2279,14 @@ void MediaPlayListTest::restoreMultipleIdenticalTracks()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -2260,7 +2311,7 @@ void MediaPlayListTest::restoreMultipleIdenticalTracks()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 4);
+    QCOMPARE(newTracksByNameInListSpy.count(), 1);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.insertTracksList(mNewTracks, mNewCovers);
@@ -2274,7 +2325,7 @@ void MediaPlayListTest::restoreMultipleIdenticalTracks()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 4);
+    QCOMPARE(newTracksByNameInListSpy.count(), 1);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track3"));
@@ -2322,7 +2373,7 @@ void MediaPlayListTest::restoreTrackWithoutAlbum()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -2333,7 +2384,7 @@ void MediaPlayListTest::restoreTrackWithoutAlbum()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("restoreTrackWithoutAlbum"), databaseFile.fileName());
@@ -2341,11 +2392,14 @@ void MediaPlayListTest::restoreTrackWithoutAlbum()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -2365,7 +2419,7 @@ void MediaPlayListTest::restoreTrackWithoutAlbum()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto newTrack = DataTypes::TrackDataType{};
@@ -2395,7 +2449,7 @@ void MediaPlayListTest::restoreTrackWithoutAlbum()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myPlayList.enqueueRestoredEntries(QVariantList({QStringList({QStringLiteral("0"), QStringLiteral("track19"), QStringLiteral("artist2"), {}, {}, {}, QString::number(ElisaUtils::PlayListEntryType::Unknown)})}));
@@ -2407,7 +2461,7 @@ void MediaPlayListTest::restoreTrackWithoutAlbum()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 1);
+    QCOMPARE(newTracksByNameInListSpy.count(), 1);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2419,7 +2473,7 @@ void MediaPlayListTest::restoreTrackWithoutAlbum()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 1);
+    QCOMPARE(newTracksByNameInListSpy.count(), 1);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track19"));
@@ -2444,7 +2498,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -2455,7 +2509,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -2463,11 +2517,14 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -2487,7 +2544,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist2"),
@@ -2501,7 +2558,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2513,7 +2570,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"),
@@ -2527,7 +2584,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2539,7 +2596,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist2"),
@@ -2553,7 +2610,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2565,7 +2622,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist2"),
@@ -2579,7 +2636,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2591,7 +2648,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     auto fithTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track9"), QStringLiteral("artist2"),
@@ -2605,7 +2662,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 5);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 5);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2617,7 +2674,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 5);
     QCOMPARE(dataChangedSpy.count(), 5);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 5);
 
     auto sixthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist7"),
@@ -2631,7 +2688,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 6);
     QCOMPARE(dataChangedSpy.count(), 5);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 6);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2643,7 +2700,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 6);
     QCOMPARE(dataChangedSpy.count(), 6);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 6);
 }
 
@@ -2661,7 +2718,7 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -2672,7 +2729,7 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -2680,11 +2737,14 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -2704,7 +2764,7 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1);
@@ -2717,7 +2777,7 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2729,7 +2789,7 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), 2, 1);
@@ -2742,7 +2802,7 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2754,7 +2814,7 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist1"), QStringLiteral("album2"), 3, 1);
@@ -2767,7 +2827,7 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2779,7 +2839,7 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track4"), QStringLiteral("artist1"), QStringLiteral("album2"), 4, 1);
@@ -2792,7 +2852,7 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2804,7 +2864,7 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayList.moveRows({}, 0, 1, {}, 3);
@@ -2816,7 +2876,7 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 1);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 }
 
@@ -2837,7 +2897,7 @@ void MediaPlayListTest::crashOnEnqueue()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -2848,7 +2908,7 @@ void MediaPlayListTest::crashOnEnqueue()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -2856,11 +2916,14 @@ void MediaPlayListTest::crashOnEnqueue()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -2880,7 +2943,7 @@ void MediaPlayListTest::crashOnEnqueue()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto newTrackID = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track6"), QStringLiteral("artist1 and artist2"),
@@ -2894,7 +2957,7 @@ void MediaPlayListTest::crashOnEnqueue()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2906,7 +2969,7 @@ void MediaPlayListTest::crashOnEnqueue()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 }
 
@@ -2924,7 +2987,7 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -2935,7 +2998,7 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -2943,11 +3006,14 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -2967,7 +3033,7 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1);
@@ -2980,7 +3046,7 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -2992,7 +3058,7 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), 2, 1);
@@ -3005,7 +3071,7 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -3017,7 +3083,7 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist1"), QStringLiteral("album2"), 3, 1);
@@ -3030,7 +3096,7 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -3042,7 +3108,7 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track4"), QStringLiteral("artist1"), QStringLiteral("album2"), 4, 1);
@@ -3055,7 +3121,7 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -3067,7 +3133,7 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayList.moveRows({}, 3, 1, {}, 0);
@@ -3079,7 +3145,7 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 1);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 }
 
@@ -3097,7 +3163,7 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
     QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
-    QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newEntryInListSpy(&myPlayList, &MediaPlayList::newEntryInList);
     QSignalSpy newUrlInListSpy(&myPlayList, &MediaPlayList::newUrlInList);
 
@@ -3108,7 +3174,7 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -3116,11 +3182,14 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
-    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
-            &myListener, &TracksListener::trackByNameInList,
+    connect(&myPlayList, &MediaPlayList::newTracksByNameInList,
+            &myListener, &TracksListener::tracksByNameInList,
             Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList,
@@ -3140,7 +3209,7 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 0);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 0);
 
     auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1);
@@ -3153,7 +3222,7 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -3165,7 +3234,7 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 1);
 
     auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), 2, 1);
@@ -3178,7 +3247,7 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -3190,7 +3259,7 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 2);
 
     auto thirdTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album1"), 1, 1);
@@ -3203,7 +3272,7 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -3215,7 +3284,7 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 3);
 
     auto fourthTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track4"), QStringLiteral("artist1"), QStringLiteral("album2"), 4, 1);
@@ -3228,7 +3297,7 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 3);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -3240,7 +3309,7 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayList.moveRows({}, 0, 1, {}, 2);
@@ -3252,7 +3321,7 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 1);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 
     myPlayList.moveRows({}, 2, 1, {}, 0);
@@ -3264,10 +3333,92 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     QCOMPARE(rowsMovedSpy.count(), 2);
     QCOMPARE(rowsInsertedSpy.count(), 4);
     QCOMPARE(dataChangedSpy.count(), 4);
-    QCOMPARE(newTrackByNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByNameInListSpy.count(), 0);
     QCOMPARE(newEntryInListSpy.count(), 4);
 }
 
+void MediaPlayListTest::updateLargeRestoredPlayList()
+{
+    MediaPlayList myPlayList;
+
+    QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
+    QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
+
+    const auto tracksCount = 2000;
+
+    auto restoredEntries = QVariantList{};
+    for (int i = 0; i < tracksCount; ++i) {
+        restoredEntries.push_back(QStringList{QStringLiteral("0"), QStringLiteral("track%1").arg(i % 1000), QStringLiteral("artist1"),
+                                              QStringLiteral("album%1").arg(i % 1000 / 10), QString::number(i % 10 + 1),
+                                              QStringLiteral("1"), QString::number(ElisaUtils::Track)});
+    }
+
+    myPlayList.enqueueRestoredEntries(restoredEntries);
+
+    QCOMPARE(myPlayList.rowCount(), tracksCount);
+    QCOMPARE(newTracksByNameInListSpy.count(), 1);
+
+    auto allTracks = DataTypes::ListTrackDataType{};
+    for (int i = 0; i < tracksCount / 2; ++i) {
+        auto oneTrack = DataTypes::TrackDataType{true, QStringLiteral("$%1").arg(i), QStringLiteral("0"), QStringLiteral("track%1").arg(i),
+                QStringLiteral("artist1"), QStringLiteral("album%1").arg(i / 10), QStringLiteral("artist1"), i % 10 + 1, 1,
+                QTime::fromMSecsSinceStartOfDay(1000), QUrl::fromLocalFile(QStringLiteral("/$%1").arg(i)),
+                QDateTime::fromMSecsSinceEpoch(1), {}, 1, false, {}, {}, {}, false};
+        oneTrack[DataTypes::DatabaseIdRole] = qulonglong(i + 1);
+        allTracks.push_back(oneTrack);
+    }
+
+    for (const auto &oneTrack : allTracks) {
+        myPlayList.trackChanged(oneTrack);
+    }
+
+    QCOMPARE(dataChangedSpy.count(), tracksCount / 2);
+
+    for (const auto &oneTrack : allTracks) {
+        myPlayList.trackChanged(oneTrack);
+    }
+
+    QCOMPARE(dataChangedSpy.count(), tracksCount);
+
+    for (int i = 0; i < tracksCount; ++i) {
+        QCOMPARE(myPlayList.data(myPlayList.index(i, 0), MediaPlayList::IsValidRole).toBool(), true);
+        QCOMPARE(myPlayList.data(myPlayList.index(i, 0), MediaPlayList::DatabaseIdRole).toULongLong(), qulonglong(i % 1000 + 1));
+    }
+
+    dataChangedSpy.clear();
+
+    auto modifiedTrack = allTracks[42];
+    modifiedTrack[DataTypes::TitleRole] = QStringLiteral("modified");
+    myPlayList.trackChanged(modifiedTrack);
+
+    QCOMPARE(dataChangedSpy.count(), 2);
+    QCOMPARE(dataChangedSpy.at(0).at(0).toModelIndex().row(), 42);
+    QCOMPARE(dataChangedSpy.at(1).at(0).toModelIndex().row(), 1042);
+    QCOMPARE(myPlayList.data(myPlayList.index(1042, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("modified"));
+
+    myPlayList.moveRows({}, 1042, 1, {}, 0);
+
+    dataChangedSpy.clear();
+
+    myPlayList.trackRemoved(43);
+
+    QCOMPARE(dataChangedSpy.count(), 2);
+    QCOMPARE(dataChangedSpy.at(0).at(0).toModelIndex().row(), 0);
+    QCOMPARE(dataChangedSpy.at(1).at(0).toModelIndex().row(), 43);
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::IsValidRole).toBool(), false);
+    QCOMPARE(myPlayList.data(myPlayList.index(43, 0), MediaPlayList::IsValidRole).toBool(), false);
+    QCOMPARE(myPlayList.data(myPlayList.index(44, 0), MediaPlayList::IsValidRole).toBool(), true);
+
+    dataChangedSpy.clear();
+
+    myPlayList.trackChanged(modifiedTrack);
+
+    QCOMPARE(dataChangedSpy.count(), 1);
+    QCOMPARE(dataChangedSpy.at(0).at(0).toModelIndex().row(), 0);
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::IsValidRole).toBool(), true);
+    QCOMPARE(myPlayList.data(myPlayList.index(43, 0), MediaPlayList::IsValidRole).toBool(), false);
+}
+
 CrashEnqueuePlayList::CrashEnqueuePlayList(MediaPlayList *list, QObject *parent) : QObject(parent), mList(list)
 {
 }
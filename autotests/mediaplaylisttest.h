@@ -71,6 +71,8 @@ private Q_SLOTS:
 
     void testHasHeaderYetAnotherMoveLikeQml();
 
+    void updateLargeRestoredPlayList();
+
     void crashOnEnqueue();
 
 };
@@ -44,6 +44,7 @@ private Q_SLOTS:
         qRegisterMetaType<QHash<qlonglong,int>>("QHash<qlonglong,int>");
         qRegisterMetaType<QList<QUrl>>("QList<QUrl>");
         qRegisterMetaType<DataTypes::ListTrackDataType>("ListTrackDataType");
+        qRegisterMetaType<DataTypes::ListTrackRecord>("ListTrackRecord");
         qRegisterMetaType<DataTypes::ListAlbumDataType>("ListAlbumDataType");
         qRegisterMetaType<DataTypes::ListArtistDataType>("ListArtistDataType");
         qRegisterMetaType<DataTypes::ListGenreDataType>("ListGenreDataType");
@@ -72,10 +73,11 @@ private Q_SLOTS:
         connect(&myDatabaseContent, &DatabaseInterface::tracksAdded, &myListener, &TracksListener::tracksAdded);
         connect(&myDatabaseContent, &DatabaseInterface::trackModified, &myListener, &TracksListener::trackModified);
         connect(&myListener, &TracksListener::trackHasChanged, &myPlayList, &MediaPlayList::trackChanged);
+        connect(&myListener, &TracksListener::tracksHaveChanged, &myPlayList, &MediaPlayList::tracksChanged);
         connect(&myListener, &TracksListener::trackHasBeenRemoved, &myPlayList, &MediaPlayList::trackRemoved);
         connect(&myListener, &TracksListener::tracksListAdded, &myPlayList, &MediaPlayList::tracksListAdded);
         connect(&myPlayList, &MediaPlayList::newEntryInList, &myListener, &TracksListener::newEntryInList);
-        connect(&myPlayList, &MediaPlayList::newTrackByNameInList, &myListener, &TracksListener::trackByNameInList);
+        connect(&myPlayList, &MediaPlayList::newTracksByNameInList, &myListener, &TracksListener::tracksByNameInList);
 
         QCOMPARE(trackHasChangedSpy.count(), 0);
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
@@ -194,10 +196,11 @@ private Q_SLOTS:
         connect(&myDatabaseContent, &DatabaseInterface::tracksAdded, &myListener, &TracksListener::tracksAdded);
         connect(&myDatabaseContent, &DatabaseInterface::trackModified, &myListener, &TracksListener::trackModified);
         connect(&myListener, &TracksListener::trackHasChanged, &myPlayList, &MediaPlayList::trackChanged);
+        connect(&myListener, &TracksListener::tracksHaveChanged, &myPlayList, &MediaPlayList::tracksChanged);
         connect(&myListener, &TracksListener::trackHasBeenRemoved, &myPlayList, &MediaPlayList::trackRemoved);
         connect(&myListener, &TracksListener::tracksListAdded, &myPlayList, &MediaPlayList::tracksListAdded);
         connect(&myPlayList, &MediaPlayList::newEntryInList, &myListener, &TracksListener::newEntryInList);
-        connect(&myPlayList, &MediaPlayList::newTrackByNameInList, &myListener, &TracksListener::trackByNameInList);
+        connect(&myPlayList, &MediaPlayList::newTracksByNameInList, &myListener, &TracksListener::tracksByNameInList);
 
         QCOMPARE(trackHasChangedSpy.count(), 0);
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
@@ -262,10 +265,11 @@ private Q_SLOTS:
         connect(&myDatabaseContent, &DatabaseInterface::tracksAdded, &myListener, &TracksListener::tracksAdded);
         connect(&myDatabaseContent, &DatabaseInterface::trackModified, &myListener, &TracksListener::trackModified);
         connect(&myListener, &TracksListener::trackHasChanged, &myPlayList, &MediaPlayList::trackChanged);
+        connect(&myListener, &TracksListener::tracksHaveChanged, &myPlayList, &MediaPlayList::tracksChanged);
         connect(&myListener, &TracksListener::trackHasBeenRemoved, &myPlayList, &MediaPlayList::trackRemoved);
         connect(&myListener, &TracksListener::tracksListAdded, &myPlayList, &MediaPlayList::tracksListAdded);
         connect(&myPlayList, &MediaPlayList::newEntryInList, &myListener, &TracksListener::newEntryInList);
-        connect(&myPlayList, &MediaPlayList::newTrackByNameInList, &myListener, &TracksListener::trackByNameInList);
+        connect(&myPlayList, &MediaPlayList::newTracksByNameInList, &myListener, &TracksListener::tracksByNameInList);
 
         QCOMPARE(trackHasChangedSpy.count(), 0);
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
@@ -326,10 +330,11 @@ private Q_SLOTS:
         connect(&myDatabaseContent, &DatabaseInterface::tracksAdded, &myListener, &TracksListener::tracksAdded);
         connect(&myDatabaseContent, &DatabaseInterface::trackModified, &myListener, &TracksListener::trackModified);
         connect(&myListener, &TracksListener::trackHasChanged, &myPlayList, &MediaPlayList::trackChanged);
+        connect(&myListener, &TracksListener::tracksHaveChanged, &myPlayList, &MediaPlayList::tracksChanged);
         connect(&myListener, &TracksListener::trackHasBeenRemoved, &myPlayList, &MediaPlayList::trackRemoved);
         connect(&myListener, &TracksListener::tracksListAdded, &myPlayList, &MediaPlayList::tracksListAdded);
         connect(&myPlayList, &MediaPlayList::newEntryInList, &myListener, &TracksListener::newEntryInList);
-        connect(&myPlayList, &MediaPlayList::newTrackByNameInList, &myListener, &TracksListener::trackByNameInList);
+        connect(&myPlayList, &MediaPlayList::newTracksByNameInList, &myListener, &TracksListener::tracksByNameInList);
 
         QCOMPARE(trackHasChangedSpy.count(), 0);
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
@@ -395,10 +400,11 @@ private Q_SLOTS:
         connect(&myDatabaseContent, &DatabaseInterface::tracksAdded, &myListener, &TracksListener::tracksAdded);
         connect(&myDatabaseContent, &DatabaseInterface::trackModified, &myListener, &TracksListener::trackModified);
         connect(&myListener, &TracksListener::trackHasChanged, &myPlayList, &MediaPlayList::trackChanged);
+        connect(&myListener, &TracksListener::tracksHaveChanged, &myPlayList, &MediaPlayList::tracksChanged);
         connect(&myListener, &TracksListener::trackHasBeenRemoved, &myPlayList, &MediaPlayList::trackRemoved);
         connect(&myListener, &TracksListener::tracksListAdded, &myPlayList, &MediaPlayList::tracksListAdded);
         connect(&myPlayList, &MediaPlayList::newEntryInList, &myListener, &TracksListener::newEntryInList);
-        connect(&myPlayList, &MediaPlayList::newTrackByNameInList, &myListener, &TracksListener::trackByNameInList);
+        connect(&myPlayList, &MediaPlayList::newTracksByNameInList, &myListener, &TracksListener::tracksByNameInList);
 
         QCOMPARE(trackHasChangedSpy.count(), 0);
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
@@ -464,6 +470,70 @@ private Q_SLOTS:
         QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::TrackNumberRole).toInt(), -1);
         QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::DiscNumberRole).toInt(), 0);
     }
+
+    void testRestoreTracksByNameInOneRequest()
+    {
+        MediaPlayList myPlayList;
+        DatabaseInterface myDatabaseContent;
+        TracksListener myListener(&myDatabaseContent);
+
+        QSignalSpy trackHasChangedSpy(&myListener, &TracksListener::trackHasChanged);
+        QSignalSpy tracksHaveChangedSpy(&myListener, &TracksListener::tracksHaveChanged);
+        QSignalSpy newTracksByNameInListSpy(&myPlayList, &MediaPlayList::newTracksByNameInList);
+
+        myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
+
+        connect(&myDatabaseContent, &DatabaseInterface::trackRemoved, &myListener, &TracksListener::trackRemoved);
+        connect(&myDatabaseContent, &DatabaseInterface::tracksAdded, &myListener, &TracksListener::tracksAdded);
+        connect(&myDatabaseContent, &DatabaseInterface::trackModified, &myListener, &TracksListener::trackModified);
+        connect(&myListener, &TracksListener::trackHasChanged, &myPlayList, &MediaPlayList::trackChanged);
+        connect(&myListener, &TracksListener::tracksHaveChanged, &myPlayList, &MediaPlayList::tracksChanged);
+        connect(&myListener, &TracksListener::trackHasBeenRemoved, &myPlayList, &MediaPlayList::trackRemoved);
+        connect(&myListener, &TracksListener::tracksListAdded, &myPlayList, &MediaPlayList::tracksListAdded);
+        connect(&myPlayList, &MediaPlayList::newEntryInList, &myListener, &TracksListener::newEntryInList);
+        connect(&myPlayList, &MediaPlayList::newTracksByNameInList, &myListener, &TracksListener::tracksByNameInList);
+
+        myDatabaseContent.insertTracksList(mNewTracks, mNewCovers);
+
+        myPlayList.enqueueRestoredEntries(QVariantList({QStringList({{}, QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album1"), QStringLiteral("1"), QStringLiteral("1"), {}}),
+                                                        QStringList({{}, QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), QStringLiteral("1"), QStringLiteral("1"), {}}),
+                                                        QStringList({{}, QStringLiteral("track2"), QStringLiteral("artist1"), QStringLiteral("album2"), QStringLiteral("2"), QStringLiteral("1"), {}}),
+                                                        QStringList({{}, QStringLiteral("track10"), QStringLiteral("artist1"), QStringLiteral("album3"), QStringLiteral("10"), QStringLiteral("1"), {}}),
+                                                        QStringList({{}, QStringLiteral("track3"), QStringLiteral("artist3"), QStringLiteral("album1"), QStringLiteral("3"), QStringLiteral("3"), {}})}));
+
+        QCOMPARE(newTracksByNameInListSpy.count(), 1);
+        QCOMPARE(newTracksByNameInListSpy.at(0).at(0).value<DataTypes::ListTrackDataType>().size(), 5);
+        QCOMPARE(trackHasChangedSpy.count(), 0);
+        QCOMPARE(tracksHaveChangedSpy.count(), 1);
+        QCOMPARE(tracksHaveChangedSpy.at(0).at(0).value<DataTypes::ListTrackDataType>().size(), 4);
+
+        QCOMPARE(myPlayList.rowCount(), 5);
+
+        QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::IsValidRole).toBool(), true);
+        QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::AlbumRole).toString(), QStringLiteral("album1"));
+        QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::DurationRole).toTime().msecsSinceStartOfDay(), 1);
+        QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::ColumnsRoles::IsValidRole).toBool(), true);
+        QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::ColumnsRoles::AlbumRole).toString(), QStringLiteral("album2"));
+        QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::ColumnsRoles::DurationRole).toTime().msecsSinceStartOfDay(), 5);
+        QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::ColumnsRoles::IsValidRole).toBool(), true);
+        QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::ColumnsRoles::DurationRole).toTime().msecsSinceStartOfDay(), 6);
+        QCOMPARE(myPlayList.data(myPlayList.index(3, 0), MediaPlayList::ColumnsRoles::IsValidRole).toBool(), false);
+        QCOMPARE(myPlayList.data(myPlayList.index(4, 0), MediaPlayList::ColumnsRoles::IsValidRole).toBool(), true);
+        QCOMPARE(myPlayList.data(myPlayList.index(4, 0), MediaPlayList::ColumnsRoles::DurationRole).toTime().msecsSinceStartOfDay(), 3);
+
+        myDatabaseContent.insertTracksList({{true, QStringLiteral("$100"), QStringLiteral("0"), QStringLiteral("track10"),
+                                             QStringLiteral("artist1"), QStringLiteral("album3"), QStringLiteral("artist1"),
+                                             10, 1, QTime::fromMSecsSinceStartOfDay(100), {QUrl::fromLocalFile(QStringLiteral("/$100"))},
+                                             QDateTime::fromMSecsSinceEpoch(100), {QUrl::fromLocalFile(QStringLiteral("album3"))}, 1, true,
+                                             {}, {}, QStringLiteral("lyricist1"), false}
+                                           }, mNewCovers);
+
+        QCOMPARE(trackHasChangedSpy.count(), 1);
+        QCOMPARE(tracksHaveChangedSpy.count(), 1);
+
+        QCOMPARE(myPlayList.data(myPlayList.index(3, 0), MediaPlayList::ColumnsRoles::IsValidRole).toBool(), true);
+        QCOMPARE(myPlayList.data(myPlayList.index(3, 0), MediaPlayList::ColumnsRoles::DurationRole).toTime().msecsSinceStartOfDay(), 100);
+    }
 };
 
 QTEST_GUILESS_MAIN(TracksListenerTests)
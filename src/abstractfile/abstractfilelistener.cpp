@@ -46,8 +46,16 @@ void AbstractFileListener::setDatabaseInterface(DatabaseInterface *model)
         connect(d->mFileListing, &AbstractFileListing::modifyTracksList, model, &DatabaseInterface::insertTracksList);
         connect(d->mFileListing, &AbstractFileListing::askRestoredTracks,
                 model, &DatabaseInterface::askRestoredTracks);
+        connect(model, &DatabaseInterface::restoredDirectoriesFingerprints,
+                d->mFileListing, &AbstractFileListing::restoredDirectoriesFingerprints);
         connect(model, &DatabaseInterface::restoredTracks,
                 d->mFileListing, &AbstractFileListing::restoredTracks);
+        connect(d->mFileListing, &AbstractFileListing::scannedDirectoriesFingerprints,
+                model, &DatabaseInterface::updateDirectoriesFingerprints);
+        connect(d->mFileListing, &AbstractFileListing::removedDirectoriesFingerprints,
+                model, &DatabaseInterface::removeDirectoriesFingerprints);
+        connect(d->mFileListing, &AbstractFileListing::removedAllDirectoriesFingerprints,
+                model, &DatabaseInterface::removeAllDirectoriesFingerprints);
         connect(model, &DatabaseInterface::cleanedDatabase,
                 d->mFileListing, &AbstractFileListing::refreshContent);
         connect(model, &DatabaseInterface::finishRemovingTracksList,
@@ -88,6 +96,8 @@ void AbstractFileListener::setFileListing(AbstractFileListing *fileIndexer)
             this, &AbstractFileListener::indexingStarted);
     connect(fileIndexer, &AbstractFileListing::indexingFinished,
             this, &AbstractFileListener::indexingFinished);
+    connect(fileIndexer, &AbstractFileListing::indexingStatistics,
+            this, &AbstractFileListener::indexingStatistics);
 }
 
 AbstractFileListing *AbstractFileListener::fileListing() const
@@ -48,6 +48,8 @@ Q_SIGNALS:
 
     void indexingFinished();
 
+    void indexingStatistics(int scannedDirectoriesCount, int skippedDirectoriesCount, int skippedFilesCount);
+
     void configurationChanged();
 
     void clearDatabase();
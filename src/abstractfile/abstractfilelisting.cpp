@@ -11,6 +11,8 @@
 #include "abstractfile/indexercommon.h"
 
 #include "filescanner.h"
+#include "parallelfilescanner.h"
+#include "abstractfile/directorywatcher.h"
 
 #include <QThread>
 #include <QHash>
@@ -34,18 +36,38 @@ public:
 
     QFileSystemWatcher mFileSystemWatcher;
 
+    DirectoryWatcher *mDirectoryWatcher = nullptr;
+
     QHash<QString, QUrl> mAllAlbumCover;
 
     QHash<QUrl, QSet<QPair<QUrl, bool>>> mDiscoveredFiles;
 
     FileScanner mFileScanner;
 
+    std::unique_ptr<ParallelFileScanner> mParallelFileScanner;
+
     QHash<QUrl, QDateTime> mAllFiles;
 
+    DataTypes::DirectoryFingerprints mRestoredDirectories;
+
+    QHash<QUrl, QList<QUrl>> mRestoredSubDirectories;
+
+    QHash<QUrl, QList<QUrl>> mRestoredFilesByDirectory;
+
+    DataTypes::DirectoryFingerprints mScannedDirectories;
+
+    QList<QUrl> mRemovedDirectoriesFingerprints;
+
     QAtomicInt mStopRequest = 0;
 
     int mImportedTracksCount = 0;
 
+    int mScannedDirectoriesCount = 0;
+
+    int mSkippedDirectoriesCount = 0;
+
+    int mSkippedFilesCount = 0;
+
     int mNewFilesEmitInterval = 1;
 
     bool mHandleNewFiles = true;
@@ -60,10 +82,19 @@ public:
 
 AbstractFileListing::AbstractFileListing(QObject *parent) : QObject(parent), d(std::make_unique<AbstractFileListingPrivate>())
 {
-    connect(&d->mFileSystemWatcher, &QFileSystemWatcher::directoryChanged,
-            this, &AbstractFileListing::directoryChanged);
-    connect(&d->mFileSystemWatcher, &QFileSystemWatcher::fileChanged,
-            this, &AbstractFileListing::fileChanged);
+    d->mDirectoryWatcher = new DirectoryWatcher(this);
+
+    if (d->mDirectoryWatcher->isValid()) {
+        connect(d->mDirectoryWatcher, &DirectoryWatcher::directoriesChanged,
+                this, &AbstractFileListing::directoryContentChanged);
+        connect(d->mDirectoryWatcher, &DirectoryWatcher::eventsLost,
+                this, &AbstractFileListing::directoryWatcherEventsLost);
+    } else {
+        connect(&d->mFileSystemWatcher, &QFileSystemWatcher::directoryChanged,
+                this, &AbstractFileListing::directoryChanged);
+        connect(&d->mFileSystemWatcher, &QFileSystemWatcher::fileChanged,
+                this, &AbstractFileListing::fileChanged);
+    }
 }
 
 AbstractFileListing::~AbstractFileListing()
@@ -102,6 +133,30 @@ void AbstractFileListing::restoredTracks(QHash<QUrl, QDateTime> allFiles)
     refreshContent();
 }
 
+void AbstractFileListing::rescanAllContent()
+{
+    qCInfo(orgKdeElisaIndexer()) << "AbstractFileListing::rescanAllContent";
+
+    d->mRestoredDirectories.clear();
+    d->mRestoredSubDirectories.clear();
+    d->mDiscoveredFiles.clear();
+
+    Q_EMIT removedAllDirectoriesFingerprints();
+
+    // the known tracks are read again and compared with the files as at startup
+    Q_EMIT askRestoredTracks();
+}
+
+void AbstractFileListing::restoredDirectoriesFingerprints(const DataTypes::DirectoryFingerprints &allDirectories)
+{
+    d->mRestoredDirectories = allDirectories;
+
+    d->mRestoredSubDirectories.clear();
+    for (auto itDirectory = allDirectories.cbegin(); itDirectory != allDirectories.cend(); ++itDirectory) {
+        d->mRestoredSubDirectories[itDirectory->mParentDirectory].push_back(itDirectory.key());
+    }
+}
+
 void AbstractFileListing::setAllRootPaths(const QStringList &allRootPaths)
 {
     d->mAllRootPaths = allRootPaths;
@@ -134,12 +189,42 @@ bool AbstractFileListing::canHandleRootPaths() const
     return true;
 }
 
+int AbstractFileListing::metadataExtractionThreadCount() const
+{
+    return d->mParallelFileScanner ? d->mParallelFileScanner->workerCount() : 1;
+}
+
+void AbstractFileListing::setMetadataExtractionThreadCount(int threadCount)
+{
+    if (threadCount == metadataExtractionThreadCount()) {
+        return;
+    }
+
+    qCDebug(orgKdeElisaIndexer()) << "AbstractFileListing::setMetadataExtractionThreadCount" << threadCount;
+
+    if (threadCount <= 1) {
+        d->mParallelFileScanner.reset();
+        return;
+    }
+
+    d->mParallelFileScanner = std::make_unique<ParallelFileScanner>(threadCount,
+                                                                    [this](FileScanner &scanner, const QUrl &scanFile, const QFileInfo &scanFileInfo) {
+        return extractTrackMetadata(scanner, scanFile, scanFileInfo);
+    });
+}
+
 void AbstractFileListing::scanDirectory(DataTypes::ListTrackDataType &newFiles, const QUrl &path, FileSystemWatchingModes watchForFileSystemChanges)
 {
     if (d->mStopRequest == 1) {
         return;
     }
 
+    const auto directoryModificationTime = QFileInfo(path.toLocalFile()).lastModified();
+
+    if (d->mHandleNewFiles && restoreUnchangedDirectory(newFiles, path, directoryModificationTime, watchForFileSystemChanges)) {
+        return;
+    }
+
     QDir rootDirectory(path.toLocalFile());
     rootDirectory.refresh();
 
@@ -152,6 +237,7 @@ void AbstractFileListing::scanDirectory(DataTypes::ListTrackDataType &newFiles,
     auto &currentDirectoryListingFiles = d->mDiscoveredFiles[path];
 
     auto currentFilesList = QSet<QUrl>();
+    auto currentFileNames = QStringList();
 
     rootDirectory.refresh();
     const auto entryList = rootDirectory.entryInfoList(QDir::NoDotAndDotDot | QDir::Files | QDir::Dirs);
@@ -161,6 +247,21 @@ void AbstractFileListing::scanDirectory(DataTypes::ListTrackDataType &newFiles,
         if (oneEntry.isDir() || oneEntry.isFile()) {
             currentFilesList.insert(newFilePath);
         }
+        if (oneEntry.isFile()) {
+            currentFileNames.push_back(oneEntry.fileName());
+        }
+    }
+
+    if (d->mHandleNewFiles && rootDirectory.exists()) {
+        ++d->mScannedDirectoriesCount;
+
+        // the new tracks of this directory will look for their cover without listing it again
+        d->mFileScanner.updateDirectoryCoverFile(rootDirectory.canonicalPath(), currentFileNames);
+
+        auto &directoryFingerprint = d->mScannedDirectories[path];
+        directoryFingerprint.mParentDirectory = path.adjusted(QUrl::RemoveFilename | QUrl::StripTrailingSlash);
+        directoryFingerprint.mModificationTime = directoryModificationTime;
+        directoryFingerprint.mEntriesCount = entryList.size();
     }
 
     auto removedTracks = QVector<QPair<QUrl, bool>>();
@@ -222,26 +323,27 @@ void AbstractFileListing::scanDirectory(DataTypes::ListTrackDataType &newFiles,
         if (itExistingFile != allFiles().end()) {
             if (*itExistingFile >= oneEntry.metadataChangeTime()) {
                 allFiles().erase(itExistingFile);
+                ++d->mSkippedFilesCount;
                 qCDebug(orgKdeElisaIndexer()) << "AbstractFileListing::scanDirectory" << newFilePath << "file not modified since last scan";
                 continue;
             }
         }
 
-        auto newTrack = scanOneFile(newFilePath, oneEntry, WatchChangedDirectories | WatchChangedFiles);
+        if (d->mParallelFileScanner) {
+            d->mParallelFileScanner->enqueueFile(newFilePath, path);
+            addParallelScanResults(newFiles, false);
 
-        if (newTrack.isValid() && d->mStopRequest == 0) {
-            addCover(newTrack);
+            if (d->mStopRequest == 1) {
+                break;
+            }
 
-            addFileInDirectory(newTrack.resourceURI(), path, WatchChangedDirectories | WatchChangedFiles);
-            newFiles.push_back(newTrack);
+            continue;
+        }
 
-            ++d->mImportedTracksCount;
+        auto newTrack = scanOneFile(newFilePath, oneEntry, WatchChangedDirectories | WatchChangedFiles);
 
-            if (newFiles.size() > d->mNewFilesEmitInterval && d->mStopRequest == 0) {
-                d->mNewFilesEmitInterval = std::min(50, 1 + d->mNewFilesEmitInterval * d->mNewFilesEmitInterval);
-                emitNewFiles(newFiles);
-                newFiles.clear();
-            }
+        if (newTrack.isValid() && d->mStopRequest == 0) {
+            addNewTrack(newFiles, newTrack, path);
         } else {
             qCDebug(orgKdeElisaIndexer()) << "AbstractFileListing::scanDirectory" << newFilePath << "is not a valid track";
         }
@@ -259,6 +361,8 @@ void AbstractFileListing::directoryChanged(const QString &path)
         return;
     }
 
+    d->mFileScanner.invalidateDirectoryCoverFile(path);
+
     Q_EMIT indexingStarted();
 
     scanDirectoryTree(path);
@@ -278,9 +382,157 @@ void AbstractFileListing::fileChanged(const QString &modifiedFileName)
     }
 }
 
+void AbstractFileListing::directoryContentChanged(const DirectoryWatcher::Changes &changes)
+{
+    qCDebug(orgKdeElisaIndexer()) << "AbstractFileListing::directoryContentChanged";
+
+    Q_EMIT indexingStarted();
+
+    auto allRemovedFiles = QList<QUrl>();
+
+    // a cover file may have been added or removed in any of the changed directories
+    auto invalidateCoverFile = [this](const QString &fileName) {
+        d->mFileScanner.invalidateDirectoryCoverFile(QFileInfo(fileName).absolutePath());
+    };
+
+    for (const auto &oneDirectory : changes.mDeletedDirectories) {
+        d->mFileScanner.invalidateDirectoryCoverFile(oneDirectory);
+    }
+    for (const auto &oneFile : changes.mCreatedFiles) {
+        invalidateCoverFile(oneFile);
+    }
+    for (const auto &oneFile : changes.mDeletedFiles) {
+        invalidateCoverFile(oneFile);
+    }
+    for (const auto &oneFile : changes.mModifiedFiles) {
+        invalidateCoverFile(oneFile);
+    }
+    for (const auto &oneMovedFile : changes.mMovedFiles) {
+        invalidateCoverFile(oneMovedFile.first);
+        invalidateCoverFile(oneMovedFile.second);
+    }
+
+    auto removeTrackFile = [this, &allRemovedFiles](const QString &fileName) {
+        const auto removedFile = QUrl::fromLocalFile(fileName);
+        auto itDirectory = d->mDiscoveredFiles.find(QUrl::fromLocalFile(QFileInfo(fileName).absolutePath()));
+        if (itDirectory != d->mDiscoveredFiles.end() && itDirectory->remove({removedFile, true})) {
+            allRemovedFiles.push_back(removedFile);
+        }
+    };
+
+    for (const auto &oneDirectory : changes.mDeletedDirectories) {
+        const auto removedDirectory = QUrl::fromLocalFile(oneDirectory);
+
+        removeDirectory(removedDirectory, allRemovedFiles);
+        d->mDirectoryWatcher->removeDirectoryTree(oneDirectory);
+
+        auto itParentDirectory = d->mDiscoveredFiles.find(QUrl::fromLocalFile(QFileInfo(oneDirectory).absolutePath()));
+        if (itParentDirectory != d->mDiscoveredFiles.end()) {
+            itParentDirectory->remove({removedDirectory, false});
+        }
+    }
+
+    for (const auto &oneFile : changes.mDeletedFiles) {
+        removeTrackFile(oneFile);
+    }
+
+    auto newFileNames = changes.mCreatedFiles;
+    for (const auto &oneMovedFile : changes.mMovedFiles) {
+        removeTrackFile(oneMovedFile.first);
+        newFileNames.push_back(oneMovedFile.second);
+    }
+
+    if (!allRemovedFiles.isEmpty()) {
+        Q_EMIT removedTracksList(allRemovedFiles);
+    }
+
+    auto newFiles = DataTypes::ListTrackDataType();
+    auto modifiedTracks = DataTypes::ListTrackDataType();
+
+    for (const auto &oneDirectory : changes.mCreatedDirectories) {
+        const auto newDirectory = QUrl::fromLocalFile(oneDirectory);
+
+        addFileInDirectory(newDirectory, QUrl::fromLocalFile(QFileInfo(oneDirectory).absolutePath()), WatchChangedDirectories);
+        scanDirectory(newFiles, newDirectory, WatchChangedDirectories | WatchChangedFiles);
+    }
+
+    auto scanChangedFile = [this, &newFiles, &modifiedTracks](const QString &fileName) {
+        const auto scanFile = QUrl::fromLocalFile(fileName);
+        const auto scanFileInfo = QFileInfo(fileName);
+        const auto directory = QUrl::fromLocalFile(scanFileInfo.absolutePath());
+
+        const auto itDirectory = d->mDiscoveredFiles.constFind(directory);
+        if (itDirectory != d->mDiscoveredFiles.constEnd() && itDirectory->contains({scanFile, true})) {
+            const auto modifiedTrack = scanOneFile(scanFile, scanFileInfo, WatchChangedDirectories | WatchChangedFiles);
+            if (modifiedTrack.isValid()) {
+                modifiedTracks.push_back(modifiedTrack);
+            }
+            return;
+        }
+
+        if (!d->mHandleNewFiles || !scanFileInfo.isFile()) {
+            return;
+        }
+
+        if (d->mParallelFileScanner) {
+            d->mParallelFileScanner->enqueueFile(scanFile, directory);
+            return;
+        }
+
+        const auto newTrack = scanOneFile(scanFile, scanFileInfo, WatchChangedDirectories | WatchChangedFiles);
+        if (newTrack.isValid()) {
+            addNewTrack(newFiles, newTrack, directory);
+        }
+    };
+
+    for (const auto &oneFile : qAsConst(newFileNames)) {
+        scanChangedFile(oneFile);
+    }
+
+    for (const auto &oneFile : changes.mModifiedFiles) {
+        scanChangedFile(oneFile);
+    }
+
+    if (d->mParallelFileScanner) {
+        addParallelScanResults(newFiles, true);
+    }
+
+    if (!newFiles.isEmpty()) {
+        emitNewFiles(newFiles);
+    }
+
+    if (!modifiedTracks.isEmpty()) {
+        Q_EMIT modifyTracksList(modifiedTracks, d->mAllAlbumCover);
+    }
+
+    emitDirectoriesFingerprints();
+
+    Q_EMIT indexingFinished();
+}
+
+void AbstractFileListing::directoryWatcherEventsLost()
+{
+    qCInfo(orgKdeElisaIndexer()) << "AbstractFileListing::directoryWatcherEventsLost" << "scanning again all directories";
+
+    Q_EMIT indexingStarted();
+
+    for (const auto &onePath : qAsConst(d->mAllRootPaths)) {
+        scanDirectoryTree(onePath);
+    }
+
+    Q_EMIT indexingFinished();
+}
+
 void AbstractFileListing::executeInit(QHash<QUrl, QDateTime> allFiles)
 {
     d->mAllFiles = std::move(allFiles);
+
+    d->mRestoredFilesByDirectory.clear();
+    if (!d->mRestoredDirectories.isEmpty()) {
+        for (auto itFile = d->mAllFiles.cbegin(); itFile != d->mAllFiles.cend(); ++itFile) {
+            d->mRestoredFilesByDirectory[itFile.key().adjusted(QUrl::RemoveFilename | QUrl::StripTrailingSlash)].push_back(itFile.key());
+        }
+    }
 }
 
 void AbstractFileListing::triggerStop()
@@ -290,6 +542,9 @@ void AbstractFileListing::triggerStop()
 void AbstractFileListing::triggerRefreshOfContent()
 {
     d->mImportedTracksCount = 0;
+    d->mScannedDirectoriesCount = 0;
+    d->mSkippedDirectoriesCount = 0;
+    d->mSkippedFilesCount = 0;
 }
 
 void AbstractFileListing::refreshContent()
@@ -297,6 +552,16 @@ void AbstractFileListing::refreshContent()
     triggerRefreshOfContent();
 }
 
+DataTypes::TrackDataType AbstractFileListing::extractTrackMetadata(FileScanner &scanner, const QUrl &scanFile, const QFileInfo &scanFileInfo) const
+{
+    if (!scanner.shouldScanFile(scanFile.toLocalFile())) {
+        qCDebug(orgKdeElisaIndexer) << "AbstractFileListing::extractTrackMetadata" << scanFile << "invalid mime type";
+        return {};
+    }
+
+    return scanner.scanOneFile(scanFile, scanFileInfo);
+}
+
 DataTypes::TrackDataType AbstractFileListing::scanOneFile(const QUrl &scanFile, const QFileInfo &scanFileInfo, FileSystemWatchingModes watchForFileSystemChanges)
 {
     DataTypes::TrackDataType newTrack;
@@ -323,7 +588,7 @@ DataTypes::TrackDataType AbstractFileListing::scanOneFile(const QUrl &scanFile,
 
     newTrack = d->mFileScanner.scanOneFile(scanFile, scanFileInfo);
 
-    if (newTrack.isValid() && scanFileInfo.exists()) {
+    if (newTrack.isValid() && scanFileInfo.exists() && !d->mDirectoryWatcher->isValid()) {
         if (watchForFileSystemChanges & WatchChangedFiles) {
             watchPath(scanFile.toLocalFile());
         }
@@ -334,7 +599,10 @@ DataTypes::TrackDataType AbstractFileListing::scanOneFile(const QUrl &scanFile,
 
 void AbstractFileListing::watchPath(const QString &pathName)
 {
-    if (!d->mFileSystemWatcher.addPath(pathName)) {
+    const auto watchResult = (d->mDirectoryWatcher->isValid() ? d->mDirectoryWatcher->addDirectory(pathName) :
+                                                                d->mFileSystemWatcher.addPath(pathName));
+
+    if (!watchResult) {
         qCDebug(orgKdeElisaIndexer) << "AbstractFileListing::watchPath" << "fail for" << pathName;
 
         if (!d->mErrorWatchingFileSystemChanges) {
@@ -382,9 +650,135 @@ void AbstractFileListing::scanDirectoryTree(const QString &path)
 
     scanDirectory(newFiles, QUrl::fromLocalFile(path), WatchChangedDirectories | WatchChangedFiles);
 
+    if (d->mParallelFileScanner) {
+        if (d->mStopRequest == 1) {
+            d->mParallelFileScanner->cancel();
+        } else {
+            addParallelScanResults(newFiles, true);
+        }
+    }
+
     if (!newFiles.isEmpty() && d->mStopRequest == 0) {
         emitNewFiles(newFiles);
     }
+
+    if (d->mStopRequest == 0) {
+        emitDirectoriesFingerprints();
+    } else {
+        d->mScannedDirectories.clear();
+    }
+}
+
+bool AbstractFileListing::restoreUnchangedDirectory(DataTypes::ListTrackDataType &newFiles, const QUrl &path, const QDateTime &modificationTime,
+                                                    FileSystemWatchingModes watchForFileSystemChanges)
+{
+    const auto itFingerprint = d->mRestoredDirectories.find(path);
+    if (itFingerprint == d->mRestoredDirectories.end()) {
+        return false;
+    }
+
+    const auto directoryFingerprint = *itFingerprint;
+    d->mRestoredDirectories.erase(itFingerprint);
+
+    if (!modificationTime.isValid()) {
+        d->mRemovedDirectoriesFingerprints.push_back(path);
+        return false;
+    }
+
+    if (directoryFingerprint.mModificationTime != modificationTime) {
+        return false;
+    }
+
+    const auto entriesCount = QDir(path.toLocalFile()).entryList(QDir::NoDotAndDotDot | QDir::Files | QDir::Dirs, QDir::NoSort).size();
+    if (directoryFingerprint.mEntriesCount != entriesCount) {
+        return false;
+    }
+
+    qCDebug(orgKdeElisaIndexer()) << "AbstractFileListing::restoreUnchangedDirectory" << path;
+
+    ++d->mSkippedDirectoriesCount;
+
+    if (watchForFileSystemChanges & WatchChangedDirectories) {
+        watchPath(path.toLocalFile());
+    }
+
+    // tracks are stored with canonical paths but a root path may be given as a symbolic link
+    auto contentPath = path;
+    if (d->mAllRootPaths.contains(path.toLocalFile())) {
+        contentPath = QUrl::fromLocalFile(QFileInfo(path.toLocalFile()).canonicalFilePath());
+    }
+
+    auto &currentDirectoryListingFiles = d->mDiscoveredFiles[path];
+
+    const auto restoredFiles = d->mRestoredFilesByDirectory.take(contentPath);
+    auto modifiedFiles = QList<QUrl>{};
+    for (const auto &oneFile : restoredFiles) {
+        // tags edited in place change the file but neither the time nor the entries of its directory
+        const auto knownModificationTime = d->mAllFiles.take(oneFile);
+        if (knownModificationTime < QFileInfo(oneFile.toLocalFile()).metadataChangeTime()) {
+            modifiedFiles.push_back(oneFile);
+        }
+
+        currentDirectoryListingFiles.insert({oneFile, true});
+
+        if ((watchForFileSystemChanges & WatchChangedFiles) && !d->mDirectoryWatcher->isValid()) {
+            watchPath(oneFile.toLocalFile());
+        }
+    }
+    d->mSkippedFilesCount += restoredFiles.size() - modifiedFiles.size();
+
+    for (const auto &oneFile : modifiedFiles) {
+        qCDebug(orgKdeElisaIndexer()) << "AbstractFileListing::restoreUnchangedDirectory" << oneFile << "modified since last scan";
+
+        if (d->mParallelFileScanner) {
+            d->mParallelFileScanner->enqueueFile(oneFile, path);
+            addParallelScanResults(newFiles, false);
+        } else {
+            const auto newTrack = scanOneFile(oneFile, QFileInfo(oneFile.toLocalFile()), watchForFileSystemChanges);
+
+            if (newTrack.isValid() && d->mStopRequest == 0) {
+                addNewTrack(newFiles, newTrack, path);
+            }
+        }
+
+        if (d->mStopRequest == 1) {
+            return true;
+        }
+    }
+
+    const auto subDirectories = d->mRestoredSubDirectories.take(contentPath);
+    for (const auto &oneDirectory : subDirectories) {
+        currentDirectoryListingFiles.insert({oneDirectory, false});
+    }
+
+    for (const auto &oneDirectory : subDirectories) {
+        scanDirectory(newFiles, oneDirectory, watchForFileSystemChanges);
+
+        if (d->mStopRequest == 1) {
+            break;
+        }
+    }
+
+    return true;
+}
+
+void AbstractFileListing::emitDirectoriesFingerprints()
+{
+    if (!d->mScannedDirectories.isEmpty()) {
+        Q_EMIT scannedDirectoriesFingerprints(std::exchange(d->mScannedDirectories, {}));
+    }
+
+    if (!d->mRemovedDirectoriesFingerprints.isEmpty()) {
+        Q_EMIT removedDirectoriesFingerprints(std::exchange(d->mRemovedDirectoriesFingerprints, {}));
+    }
+}
+
+void AbstractFileListing::reportIndexingStatistics()
+{
+    qCInfo(orgKdeElisaIndexer()) << "AbstractFileListing::reportIndexingStatistics" << d->mScannedDirectoriesCount << "scanned directories"
+                                 << d->mSkippedDirectoriesCount << "unchanged directories" << d->mSkippedFilesCount << "unchanged files";
+
+    Q_EMIT indexingStatistics(d->mScannedDirectoriesCount, d->mSkippedDirectoriesCount, d->mSkippedFilesCount);
 }
 
 void AbstractFileListing::setHandleNewFiles(bool handleThem)
@@ -410,6 +804,44 @@ void AbstractFileListing::addCover(const DataTypes::TrackDataType &newTrack)
     }
 }
 
+void AbstractFileListing::addNewTrack(DataTypes::ListTrackDataType &newFiles, const DataTypes::TrackDataType &newTrack, const QUrl &directoryName)
+{
+    addCover(newTrack);
+
+    addFileInDirectory(newTrack.resourceURI(), directoryName, WatchChangedDirectories | WatchChangedFiles);
+    newFiles.push_back(newTrack);
+
+    ++d->mImportedTracksCount;
+
+    if (newFiles.size() > d->mNewFilesEmitInterval && d->mStopRequest == 0) {
+        d->mNewFilesEmitInterval = std::min(50, 1 + d->mNewFilesEmitInterval * d->mNewFilesEmitInterval);
+        emitNewFiles(newFiles);
+        newFiles.clear();
+    }
+}
+
+void AbstractFileListing::addParallelScanResults(DataTypes::ListTrackDataType &newFiles, bool waitForPendingFiles)
+{
+    const auto scanResults = (waitForPendingFiles ? d->mParallelFileScanner->waitForResults() : d->mParallelFileScanner->takeResults());
+
+    for (const auto &oneResult : scanResults) {
+        if (d->mStopRequest == 1) {
+            break;
+        }
+
+        if (!oneResult.mTrack.isValid()) {
+            qCDebug(orgKdeElisaIndexer()) << "AbstractFileListing::addParallelScanResults" << oneResult.mFile << "is not a valid track";
+            continue;
+        }
+
+        if (!d->mDirectoryWatcher->isValid()) {
+            watchPath(oneResult.mTrack.resourceURI().toLocalFile());
+        }
+
+        addNewTrack(newFiles, oneResult.mTrack, oneResult.mDirectory);
+    }
+}
+
 void AbstractFileListing::removeDirectory(const QUrl &removedDirectory, QList<QUrl> &allRemovedFiles)
 {
     const auto itRemovedDirectory = d->mDiscoveredFiles.find(removedDirectory);
@@ -418,6 +850,8 @@ void AbstractFileListing::removeDirectory(const QUrl &removedDirectory, QList<QU
         return;
     }
 
+    d->mRemovedDirectoriesFingerprints.push_back(removedDirectory);
+
     const auto &currentRemovedDirectory = *itRemovedDirectory;
     for (const auto &itFile : currentRemovedDirectory) {
         if (itFile.first.isValid() && !itFile.first.isEmpty()) {
@@ -446,6 +880,15 @@ QHash<QUrl, QDateTime> &AbstractFileListing::allFiles()
 
 void AbstractFileListing::checkFilesToRemove()
 {
+    for (auto itDirectory = d->mRestoredDirectories.cbegin(); itDirectory != d->mRestoredDirectories.cend(); ++itDirectory) {
+        d->mRemovedDirectoriesFingerprints.push_back(itDirectory.key());
+    }
+    d->mRestoredDirectories.clear();
+    d->mRestoredSubDirectories.clear();
+    d->mRestoredFilesByDirectory.clear();
+
+    emitDirectoriesFingerprints();
+
     QList<QUrl> allRemovedFiles;
 
     for (auto itFile = d->mAllFiles.begin(); itFile != d->mAllFiles.end(); ++itFile) {
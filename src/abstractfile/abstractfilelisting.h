@@ -9,6 +9,7 @@
 
 #include "elisaLib_export.h"
 #include "datatypes.h"
+#include "abstractfile/directorywatcher.h"
 
 #include <QObject>
 #include <QString>
@@ -47,6 +48,8 @@ public:
 
     [[nodiscard]] virtual bool canHandleRootPaths() const;
 
+    [[nodiscard]] int metadataExtractionThreadCount() const;
+
 Q_SIGNALS:
 
     void tracksList(const DataTypes::ListTrackDataType &tracks, const QHash<QString, QUrl> &covers);
@@ -63,10 +66,24 @@ Q_SIGNALS:
 
     void errorWatchingFileSystemChanges();
 
+    void scannedDirectoriesFingerprints(const DataTypes::DirectoryFingerprints &scannedDirectories);
+
+    void removedDirectoriesFingerprints(const QList<QUrl> &removedDirectories);
+
+    void removedAllDirectoriesFingerprints();
+
+    void indexingStatistics(int scannedDirectoriesCount, int skippedDirectoriesCount, int skippedFilesCount);
+
 public Q_SLOTS:
 
     void refreshContent();
 
+    /**
+     * Scan again all the directories, even the ones whose fingerprint did not
+     * change, to find the files modified in place while Elisa was not running.
+     */
+    void rescanAllContent();
+
     void init();
 
     void stop();
@@ -75,18 +92,26 @@ public Q_SLOTS:
 
     void restoredTracks(QHash<QUrl, QDateTime> allFiles);
 
+    void restoredDirectoriesFingerprints(const DataTypes::DirectoryFingerprints &allDirectories);
+
     void setAllRootPaths(const QStringList &allRootPaths);
 
     void databaseFinishedInsertingTracksList();
 
     void databaseFinishedRemovingTracksList();
 
+    void setMetadataExtractionThreadCount(int threadCount);
+
 protected Q_SLOTS:
 
     void directoryChanged(const QString &path);
 
     void fileChanged(const QString &modifiedFileName);
 
+    void directoryContentChanged(const DirectoryWatcher::Changes &changes);
+
+    void directoryWatcherEventsLost();
+
 protected:
 
     virtual void executeInit(QHash<QUrl, QDateTime> allFiles);
@@ -99,18 +124,40 @@ protected:
 
     virtual DataTypes::TrackDataType scanOneFile(const QUrl &scanFile, const QFileInfo &scanFileInfo, FileSystemWatchingModes watchForFileSystemChanges);
 
+    /**
+     * Extract the metadata of one file from a worker thread of the parallel scan mode.
+     * Implementations must only use the given scanner and must not modify the listing state.
+     */
+    [[nodiscard]] virtual DataTypes::TrackDataType extractTrackMetadata(FileScanner &scanner, const QUrl &scanFile, const QFileInfo &scanFileInfo) const;
+
     void watchPath(const QString &pathName);
 
     void addFileInDirectory(const QUrl &newFile, const QUrl &directoryName, FileSystemWatchingModes watchForFileSystemChanges);
 
     void scanDirectoryTree(const QString &path);
 
+    /**
+     * Reuse the content known by the database for a directory whose fingerprint did not change
+     * since the previous scan. Only its files modified since they were last read are scanned.
+     * Return false if the directory needs to be scanned.
+     */
+    bool restoreUnchangedDirectory(DataTypes::ListTrackDataType &newFiles, const QUrl &path, const QDateTime &modificationTime,
+                                   FileSystemWatchingModes watchForFileSystemChanges);
+
+    void emitDirectoriesFingerprints();
+
+    void reportIndexingStatistics();
+
     void setHandleNewFiles(bool handleThem);
 
     void emitNewFiles(const DataTypes::ListTrackDataType &tracks);
 
     void addCover(const DataTypes::TrackDataType &newTrack);
 
+    void addNewTrack(DataTypes::ListTrackDataType &newFiles, const DataTypes::TrackDataType &newTrack, const QUrl &directoryName);
+
+    void addParallelScanResults(DataTypes::ListTrackDataType &newFiles, bool waitForPendingFiles);
+
     void removeDirectory(const QUrl &removedDirectory, QList<QUrl> &allRemovedFiles);
 
     void removeFile(const QUrl &oneRemovedTrack, QList<QUrl> &allRemovedFiles);
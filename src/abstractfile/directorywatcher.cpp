@@ -0,0 +1,398 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "directorywatcher.h"
+
+#include "abstractfile/indexercommon.h"
+
+#include <QHash>
+#include <QSet>
+#include <QFile>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QSocketNotifier>
+
+#if defined Q_OS_LINUX
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+class DirectoryWatcherPrivate
+{
+public:
+
+    enum class FileChange {
+        Created,
+        Modified,
+        Deleted,
+    };
+
+    enum class DirectoryChange {
+        Created,
+        Deleted,
+        Replaced,
+    };
+
+    void noteFileChange(const QString &path, FileChange change);
+
+    void noteDirectoryChange(const QString &path, DirectoryChange change);
+
+    QTimer mCoalescingTimer;
+
+    QElapsedTimer mFirstPendingEvent;
+
+    QSocketNotifier *mNotifier = nullptr;
+
+    QHash<int, QString> mPathFromWatch;
+
+    QHash<QString, int> mWatchFromPath;
+
+    QHash<QString, FileChange> mPendingFiles;
+
+    QHash<QString, DirectoryChange> mPendingDirectories;
+
+    QSet<QString> mFilesBeingWritten;
+
+    QHash<quint32, QString> mPendingMoves;
+
+    QList<QPair<QString, QString>> mMovedFiles;
+
+    int mInotifyDescriptor = -1;
+
+    int mCoalescingInterval = 200;
+
+    int mMaximumLatency = 2000;
+
+    bool mEventsLost = false;
+
+};
+
+void DirectoryWatcherPrivate::noteFileChange(const QString &path, FileChange change)
+{
+    auto itFile = mPendingFiles.find(path);
+    if (itFile == mPendingFiles.end()) {
+        mPendingFiles.insert(path, change);
+        return;
+    }
+
+    switch (change)
+    {
+    case FileChange::Created:
+        if (*itFile == FileChange::Deleted) {
+            *itFile = FileChange::Modified;
+        }
+        break;
+    case FileChange::Modified:
+        break;
+    case FileChange::Deleted:
+        if (*itFile == FileChange::Created) {
+            mPendingFiles.erase(itFile);
+        } else {
+            *itFile = FileChange::Deleted;
+        }
+        break;
+    }
+}
+
+void DirectoryWatcherPrivate::noteDirectoryChange(const QString &path, DirectoryChange change)
+{
+    auto itDirectory = mPendingDirectories.find(path);
+    if (itDirectory == mPendingDirectories.end()) {
+        mPendingDirectories.insert(path, change);
+        return;
+    }
+
+    if (change == DirectoryChange::Deleted) {
+        if (*itDirectory == DirectoryChange::Created) {
+            mPendingDirectories.erase(itDirectory);
+        } else {
+            *itDirectory = DirectoryChange::Deleted;
+        }
+    } else if (*itDirectory == DirectoryChange::Deleted) {
+        *itDirectory = DirectoryChange::Replaced;
+    }
+}
+
+bool DirectoryWatcher::Changes::isEmpty() const
+{
+    return mCreatedFiles.isEmpty() && mModifiedFiles.isEmpty() && mDeletedFiles.isEmpty() &&
+            mMovedFiles.isEmpty() && mCreatedDirectories.isEmpty() && mDeletedDirectories.isEmpty();
+}
+
+DirectoryWatcher::DirectoryWatcher(QObject *parent) : QObject(parent), d(std::make_unique<DirectoryWatcherPrivate>())
+{
+    d->mCoalescingTimer.setSingleShot(true);
+    connect(&d->mCoalescingTimer, &QTimer::timeout,
+            this, &DirectoryWatcher::emitPendingChanges);
+
+#if defined Q_OS_LINUX
+    d->mInotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (d->mInotifyDescriptor == -1) {
+        qCWarning(orgKdeElisaIndexer()) << "DirectoryWatcher::DirectoryWatcher" << "inotify is not available" << strerror(errno);
+        return;
+    }
+
+    d->mNotifier = new QSocketNotifier(d->mInotifyDescriptor, QSocketNotifier::Read, this);
+    connect(d->mNotifier, &QSocketNotifier::activated,
+            this, &DirectoryWatcher::readEvents);
+#endif
+}
+
+DirectoryWatcher::~DirectoryWatcher()
+{
+#if defined Q_OS_LINUX
+    if (d->mInotifyDescriptor != -1) {
+        delete d->mNotifier;
+        ::close(d->mInotifyDescriptor);
+    }
+#endif
+}
+
+bool DirectoryWatcher::isValid() const
+{
+    return d->mInotifyDescriptor != -1;
+}
+
+bool DirectoryWatcher::addDirectory(const QString &path)
+{
+#if defined Q_OS_LINUX
+    if (!isValid()) {
+        return false;
+    }
+
+    if (d->mWatchFromPath.contains(path)) {
+        return true;
+    }
+
+    const auto watchDescriptor = inotify_add_watch(d->mInotifyDescriptor, QFile::encodeName(path).constData(),
+                                                   IN_CREATE | IN_CLOSE_WRITE | IN_ATTRIB | IN_DELETE |
+                                                   IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR);
+
+    if (watchDescriptor == -1) {
+        qCDebug(orgKdeElisaIndexer()) << "DirectoryWatcher::addDirectory" << path << strerror(errno);
+        return false;
+    }
+
+    d->mPathFromWatch[watchDescriptor] = path;
+    d->mWatchFromPath[path] = watchDescriptor;
+
+    return true;
+#else
+    Q_UNUSED(path)
+
+    return false;
+#endif
+}
+
+void DirectoryWatcher::removeDirectoryTree(const QString &path)
+{
+    const auto childPrefix = QString(path + QLatin1Char('/'));
+
+    for (auto itWatch = d->mWatchFromPath.begin(); itWatch != d->mWatchFromPath.end(); ) {
+        if (itWatch.key() != path && !itWatch.key().startsWith(childPrefix)) {
+            ++itWatch;
+            continue;
+        }
+
+#if defined Q_OS_LINUX
+        inotify_rm_watch(d->mInotifyDescriptor, itWatch.value());
+#endif
+        d->mPathFromWatch.remove(itWatch.value());
+        itWatch = d->mWatchFromPath.erase(itWatch);
+    }
+}
+
+int DirectoryWatcher::watchedDirectoriesCount() const
+{
+    return d->mWatchFromPath.size();
+}
+
+int DirectoryWatcher::coalescingInterval() const
+{
+    return d->mCoalescingInterval;
+}
+
+void DirectoryWatcher::setCoalescingInterval(int interval)
+{
+    d->mCoalescingInterval = interval;
+    d->mMaximumLatency = 10 * interval;
+}
+
+void DirectoryWatcher::readEvents()
+{
+#if defined Q_OS_LINUX
+    alignas(struct inotify_event) char buffer[16384];
+
+    auto hasNewEvents = false;
+
+    while (true) {
+        const auto length = ::read(d->mInotifyDescriptor, buffer, sizeof(buffer));
+        if (length <= 0) {
+            break;
+        }
+
+        for (ssize_t position = 0; position < length; ) {
+            const auto *event = reinterpret_cast<const struct inotify_event *>(buffer + position);
+            position += sizeof(struct inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                qCInfo(orgKdeElisaIndexer()) << "DirectoryWatcher::readEvents" << "inotify queue overflow";
+                d->mEventsLost = true;
+                hasNewEvents = true;
+                continue;
+            }
+
+            if (event->mask & IN_IGNORED) {
+                const auto itPath = d->mPathFromWatch.find(event->wd);
+                if (itPath != d->mPathFromWatch.end()) {
+                    d->mWatchFromPath.remove(*itPath);
+                    d->mPathFromWatch.erase(itPath);
+                }
+                continue;
+            }
+
+            const auto itPath = d->mPathFromWatch.constFind(event->wd);
+            if (itPath == d->mPathFromWatch.constEnd() || event->len == 0) {
+                continue;
+            }
+
+            const auto path = QString(*itPath + QLatin1Char('/') + QFile::decodeName(event->name));
+            hasNewEvents = true;
+
+            if (event->mask & IN_ISDIR) {
+                if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                    d->noteDirectoryChange(path, DirectoryWatcherPrivate::DirectoryChange::Created);
+                } else if (event->mask & IN_DELETE) {
+                    d->noteDirectoryChange(path, DirectoryWatcherPrivate::DirectoryChange::Deleted);
+                } else if (event->mask & IN_MOVED_FROM) {
+                    removeDirectoryTree(path);
+                    d->noteDirectoryChange(path, DirectoryWatcherPrivate::DirectoryChange::Deleted);
+                }
+                continue;
+            }
+
+            if (event->mask & IN_CREATE) {
+                d->mFilesBeingWritten.insert(path);
+                d->noteFileChange(path, DirectoryWatcherPrivate::FileChange::Created);
+            } else if (event->mask & IN_CLOSE_WRITE) {
+                d->mFilesBeingWritten.remove(path);
+                d->noteFileChange(path, DirectoryWatcherPrivate::FileChange::Modified);
+            } else if (event->mask & IN_ATTRIB) {
+                d->noteFileChange(path, DirectoryWatcherPrivate::FileChange::Modified);
+            } else if (event->mask & IN_DELETE) {
+                d->mFilesBeingWritten.remove(path);
+                d->noteFileChange(path, DirectoryWatcherPrivate::FileChange::Deleted);
+            } else if (event->mask & IN_MOVED_FROM) {
+                d->mFilesBeingWritten.remove(path);
+                d->mPendingMoves[event->cookie] = path;
+            } else if (event->mask & IN_MOVED_TO) {
+                const auto itMove = d->mPendingMoves.find(event->cookie);
+                if (itMove == d->mPendingMoves.end()) {
+                    d->noteFileChange(path, DirectoryWatcherPrivate::FileChange::Created);
+                    continue;
+                }
+
+                const auto previousPath = *itMove;
+                d->mPendingMoves.erase(itMove);
+
+                const auto itPreviousChange = d->mPendingFiles.find(previousPath);
+                if (itPreviousChange != d->mPendingFiles.end() && *itPreviousChange == DirectoryWatcherPrivate::FileChange::Created) {
+                    // a file written under a temporary name and then renamed is only a new file
+                    d->mPendingFiles.erase(itPreviousChange);
+                    d->noteFileChange(path, DirectoryWatcherPrivate::FileChange::Created);
+                } else {
+                    d->mMovedFiles.push_back({previousPath, path});
+                }
+            }
+        }
+    }
+
+    if (!hasNewEvents) {
+        return;
+    }
+
+    if (!d->mCoalescingTimer.isActive()) {
+        d->mFirstPendingEvent.start();
+        d->mCoalescingTimer.start(d->mCoalescingInterval);
+    } else if (d->mFirstPendingEvent.elapsed() < d->mMaximumLatency) {
+        d->mCoalescingTimer.start(d->mCoalescingInterval);
+    }
+#endif
+}
+
+void DirectoryWatcher::emitPendingChanges()
+{
+    if (d->mEventsLost) {
+        d->mEventsLost = false;
+        d->mPendingFiles.clear();
+        d->mPendingDirectories.clear();
+        d->mPendingMoves.clear();
+        d->mMovedFiles.clear();
+        d->mFilesBeingWritten.clear();
+
+        Q_EMIT eventsLost();
+
+        return;
+    }
+
+    for (const auto &oneMovedFile : qAsConst(d->mPendingMoves)) {
+        d->noteFileChange(oneMovedFile, DirectoryWatcherPrivate::FileChange::Deleted);
+    }
+    d->mPendingMoves.clear();
+
+    auto changes = Changes{};
+
+    changes.mMovedFiles = std::move(d->mMovedFiles);
+    d->mMovedFiles.clear();
+
+    for (auto itFile = d->mPendingFiles.begin(); itFile != d->mPendingFiles.end(); ) {
+        if (d->mFilesBeingWritten.contains(itFile.key())) {
+            ++itFile;
+            continue;
+        }
+
+        switch (itFile.value())
+        {
+        case DirectoryWatcherPrivate::FileChange::Created:
+            changes.mCreatedFiles.push_back(itFile.key());
+            break;
+        case DirectoryWatcherPrivate::FileChange::Modified:
+            changes.mModifiedFiles.push_back(itFile.key());
+            break;
+        case DirectoryWatcherPrivate::FileChange::Deleted:
+            changes.mDeletedFiles.push_back(itFile.key());
+            break;
+        }
+
+        itFile = d->mPendingFiles.erase(itFile);
+    }
+
+    for (auto itDirectory = d->mPendingDirectories.cbegin(); itDirectory != d->mPendingDirectories.cend(); ++itDirectory) {
+        if (itDirectory.value() != DirectoryWatcherPrivate::DirectoryChange::Created) {
+            changes.mDeletedDirectories.push_back(itDirectory.key());
+        }
+        if (itDirectory.value() != DirectoryWatcherPrivate::DirectoryChange::Deleted) {
+            changes.mCreatedDirectories.push_back(itDirectory.key());
+        }
+    }
+    d->mPendingDirectories.clear();
+
+    if (changes.isEmpty()) {
+        return;
+    }
+
+    qCDebug(orgKdeElisaIndexer()) << "DirectoryWatcher::emitPendingChanges" << changes.mCreatedFiles.size() << "created"
+                                  << changes.mModifiedFiles.size() << "modified" << changes.mDeletedFiles.size() << "deleted"
+                                  << changes.mMovedFiles.size() << "moved files";
+
+    Q_EMIT directoriesChanged(changes);
+}
+
+
+#include "moc_directorywatcher.cpp"
@@ -0,0 +1,103 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef DIRECTORYWATCHER_H
+#define DIRECTORYWATCHER_H
+
+#include "elisaLib_export.h"
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QPair>
+
+#include <memory>
+
+class DirectoryWatcherPrivate;
+
+/**
+ * Watch directories for changes of the files they contain.
+ *
+ * Only directories are registered with the operating system. The events
+ * received during a short interval are merged and reported as one set of
+ * precise changes.
+ *
+ * This is implemented with inotify on Linux. On other systems isValid()
+ * returns false and callers should use QFileSystemWatcher instead.
+ */
+class ELISALIB_EXPORT DirectoryWatcher : public QObject
+{
+
+    Q_OBJECT
+
+public:
+
+    class Changes
+    {
+    public:
+
+        [[nodiscard]] bool isEmpty() const;
+
+        QStringList mCreatedFiles;
+
+        QStringList mModifiedFiles;
+
+        QStringList mDeletedFiles;
+
+        QList<QPair<QString, QString>> mMovedFiles;
+
+        /**
+         * A directory moved inside the watched tree is reported as deleted at
+         * its old location and created at its new one.
+         */
+        QStringList mCreatedDirectories;
+
+        QStringList mDeletedDirectories;
+    };
+
+    explicit DirectoryWatcher(QObject *parent = nullptr);
+
+    ~DirectoryWatcher() override;
+
+    [[nodiscard]] bool isValid() const;
+
+    bool addDirectory(const QString &path);
+
+    /**
+     * Stop watching the directory and all the watched directories below it.
+     */
+    void removeDirectoryTree(const QString &path);
+
+    [[nodiscard]] int watchedDirectoriesCount() const;
+
+    [[nodiscard]] int coalescingInterval() const;
+
+    void setCoalescingInterval(int interval);
+
+Q_SIGNALS:
+
+    void directoriesChanged(const DirectoryWatcher::Changes &changes);
+
+    /**
+     * Some events were lost by the operating system. The watched directories
+     * need to be scanned again.
+     */
+    void eventsLost();
+
+private Q_SLOTS:
+
+    void readEvents();
+
+    void emitPendingChanges();
+
+private:
+
+    std::unique_ptr<DirectoryWatcherPrivate> d;
+
+};
+
+#endif // DIRECTORYWATCHER_H
@@ -37,6 +37,20 @@ class ELISALIB_EXPORT AudioWrapper : public QObject
                WRITE setSource
                NOTIFY sourceChanged)
 
+    Q_PROPERTY(QUrl nextSource
+               READ nextSource
+               WRITE setNextSource
+               NOTIFY nextSourceChanged)
+
+    Q_PROPERTY(qint64 preRollWindow
+               READ preRollWindow
+               WRITE setPreRollWindow
+               NOTIFY preRollWindowChanged)
+
+    Q_PROPERTY(qint64 transitionLatency
+               READ transitionLatency
+               NOTIFY transitionLatencyChanged)
+
     Q_PROPERTY(QMediaPlayer::MediaStatus status
                READ status
                NOTIFY statusChanged)
@@ -74,6 +88,23 @@ public:
 
     [[nodiscard]] QUrl source() const;
 
+    /**
+     * Source that will be started without a gap when the current one ends.
+     */
+    [[nodiscard]] QUrl nextSource() const;
+
+    /**
+     * Time in microseconds between the end of the last track and the start
+     * of the following one.
+     */
+    [[nodiscard]] qint64 transitionLatency() const;
+
+    /**
+     * Time in milliseconds before the end of the current source when the next
+     * source is opened and buffered, paused, on a second player.
+     */
+    [[nodiscard]] qint64 preRollWindow() const;
+
     [[nodiscard]] QMediaPlayer::MediaStatus status() const;
 
     [[nodiscard]] QMediaPlayer::State playbackState() const;
@@ -94,6 +125,14 @@ Q_SIGNALS:
 
     void sourceChanged();
 
+    void nextSourceChanged();
+
+    void preRollWindowChanged();
+
+    void transitionLatencyChanged(qint64 latency);
+
+    void switchedToNextSource(const QUrl &source);
+
     void statusChanged(QMediaPlayer::MediaStatus status);
 
     void playbackStateChanged(QMediaPlayer::State state);
@@ -122,6 +161,10 @@ public Q_SLOTS:
 
     void setSource(const QUrl &source);
 
+    void setNextSource(const QUrl &source);
+
+    void setPreRollWindow(qint64 preRollWindow);
+
     void setPosition(qint64 position);
 
     void saveUndoPosition(qint64 position);
@@ -165,6 +208,8 @@ private:
 
     void playerSeekableSignalChanges(bool isSeekable);
 
+    void playerTransitionLatencySignalChanges(qint64 latency);
+
     friend class AudioWrapperPrivate;
 
     std::unique_ptr<AudioWrapperPrivate> d;
@@ -10,9 +10,13 @@
 
 #include "vlcLogging.h"
 #include "powermanagementinterface.h"
+#include "performancecounters.h"
 
 #include <QAudio>
 #include <QDir>
+#include <QElapsedTimer>
+
+#include <utility>
 
 #if defined Q_OS_WIN
 
@@ -38,10 +42,36 @@ public:
 
     libvlc_media_player_t *mPlayer = nullptr;
 
-    libvlc_event_manager_t *mPlayerEventManager = nullptr;
-
     libvlc_media_t *mMedia = nullptr;
 
+    /**
+     * Player holding the media of the next track while the current one is
+     * playing. It is started paused when the current track enters the
+     * pre-roll window and both players are exchanged when it ends.
+     */
+    libvlc_media_player_t *mNextPlayer = nullptr;
+
+    libvlc_media_t *mNextMedia = nullptr;
+
+    QUrl mNextSource;
+
+    QElapsedTimer mTransitionTimer;
+
+    qint64 mTransitionLatency = 0;
+
+    qint64 mPreRollWindow = 5000;
+
+    /**
+     * The next player has opened and buffered mNextMedia and waits paused.
+     */
+    bool mNextMediaIsPreRolled = false;
+
+    /**
+     * mMedia has been pre-rolled: it starts paused when it is played again
+     * from the stopped state.
+     */
+    bool mMediaStartsPaused = false;
+
     qint64 mMediaDuration = 0;
 
     QMediaPlayer::State mPreviousPlayerState = QMediaPlayer::StoppedState;
@@ -66,6 +96,24 @@ public:
 
     void vlcEventCallback(const struct libvlc_event_t *p_event);
 
+    void handleVlcEvent(const struct libvlc_event_t *p_event);
+
+    void attachPlayerEvents(libvlc_media_player_t *player);
+
+    [[nodiscard]] libvlc_media_t* createMedia(const QUrl &source) const;
+
+    void reloadMedia();
+
+    void preRollNextMedia(qint64 position);
+
+    void releaseNextMedia();
+
+    void useNextMedia();
+
+    void switchToNextMedia();
+
+    void signalMediaEnded();
+
     void mediaIsEnded();
 
     bool signalPlaybackChange(QMediaPlayer::State newPlayerState);
@@ -84,6 +132,8 @@ public:
 
     void signalErrorChange(QMediaPlayer::Error errorCode);
 
+    void signalTransitionLatency(qint64 latency);
+
 };
 
 static void vlc_callback(const struct libvlc_event_t *p_event, void *p_data)
@@ -105,22 +155,7 @@ AudioWrapper::AudioWrapper(QObject *parent) : QObject(parent), d(std::make_uniqu
         return;
     }
 
-    d->mPlayerEventManager = libvlc_media_player_event_manager(d->mPlayer);
-
-    libvlc_event_attach(d->mPlayerEventManager, libvlc_MediaPlayerOpening, &vlc_callback, d.get());
-    libvlc_event_attach(d->mPlayerEventManager, libvlc_MediaPlayerBuffering, &vlc_callback, d.get());
-    libvlc_event_attach(d->mPlayerEventManager, libvlc_MediaPlayerPlaying, &vlc_callback, d.get());
-    libvlc_event_attach(d->mPlayerEventManager, libvlc_MediaPlayerPaused, &vlc_callback, d.get());
-    libvlc_event_attach(d->mPlayerEventManager, libvlc_MediaPlayerStopped, &vlc_callback, d.get());
-    libvlc_event_attach(d->mPlayerEventManager, libvlc_MediaPlayerEndReached, &vlc_callback, d.get());
-    libvlc_event_attach(d->mPlayerEventManager, libvlc_MediaPlayerEncounteredError, &vlc_callback, d.get());
-    libvlc_event_attach(d->mPlayerEventManager, libvlc_MediaPlayerPositionChanged, &vlc_callback, d.get());
-    libvlc_event_attach(d->mPlayerEventManager, libvlc_MediaPlayerSeekableChanged, &vlc_callback, d.get());
-    libvlc_event_attach(d->mPlayerEventManager, libvlc_MediaPlayerLengthChanged, &vlc_callback, d.get());
-    libvlc_event_attach(d->mPlayerEventManager, libvlc_MediaPlayerMuted, &vlc_callback, d.get());
-    libvlc_event_attach(d->mPlayerEventManager, libvlc_MediaPlayerUnmuted, &vlc_callback, d.get());
-    libvlc_event_attach(d->mPlayerEventManager, libvlc_MediaPlayerAudioVolume, &vlc_callback, d.get());
-    libvlc_event_attach(d->mPlayerEventManager, libvlc_MediaPlayerAudioDevice, &vlc_callback, d.get());
+    d->attachPlayerEvents(d->mPlayer);
 }
 
 AudioWrapper::~AudioWrapper()
@@ -130,6 +165,16 @@ AudioWrapper::~AudioWrapper()
         if (d->mPlayer && d->mPreviousPlayerState != QMediaPlayer::StoppedState) {
             libvlc_media_player_stop(d->mPlayer);
         }
+        d->releaseNextMedia();
+        if (d->mNextPlayer) {
+            libvlc_media_player_release(d->mNextPlayer);
+        }
+        if (d->mPlayer) {
+            libvlc_media_player_release(d->mPlayer);
+        }
+        if (d->mMedia) {
+            libvlc_media_release(d->mMedia);
+        }
         libvlc_release(d->mInstance);
     }
 }
@@ -160,6 +205,21 @@ QUrl AudioWrapper::source() const
     return {};
 }
 
+QUrl AudioWrapper::nextSource() const
+{
+    return d->mNextSource;
+}
+
+qint64 AudioWrapper::transitionLatency() const
+{
+    return d->mTransitionLatency;
+}
+
+qint64 AudioWrapper::preRollWindow() const
+{
+    return d->mPreRollWindow;
+}
+
 QMediaPlayer::Error AudioWrapper::error() const
 {
     return d->mError;
@@ -219,31 +279,29 @@ void AudioWrapper::setVolume(qreal volume)
 
 void AudioWrapper::setSource(const QUrl &source)
 {
-    if (source.isLocalFile()) {
-        qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapper::setSource reading local resource";
-        d->mMedia = libvlc_media_new_path(d->mInstance, QDir::toNativeSeparators(source.toLocalFile()).toUtf8().constData());
-    } else {
-        qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapper::setSource reading remote resource";
-        d->mMedia = libvlc_media_new_location(d->mInstance, source.url().toUtf8().constData());
+    if (source.isEmpty()) {
+        d->mTransitionTimer.invalidate();
     }
 
-    if (!d->mMedia) {
-        qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapper::setSource"
-                 << "failed creating media"
-                 << libvlc_errmsg()
-                 << QDir::toNativeSeparators(source.toLocalFile()).toUtf8().constData();
+    if (d->mNextMedia && source == d->mNextSource) {
+        qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapper::setSource using prepared media";
 
-        d->mMedia = libvlc_media_new_path(d->mInstance, QDir::toNativeSeparators(source.toLocalFile()).toLatin1().constData());
-        if (!d->mMedia) {
-            qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapper::setSource"
-                     << "failed creating media"
-                     << libvlc_errmsg()
-                     << QDir::toNativeSeparators(source.toLocalFile()).toLatin1().constData();
+        d->useNextMedia();
+        Q_EMIT nextSourceChanged();
+    } else {
+        auto newMedia = d->createMedia(source);
+        if (!newMedia) {
             return;
         }
-    }
 
-    libvlc_media_player_set_media(d->mPlayer, d->mMedia);
+        if (d->mMedia) {
+            libvlc_media_release(d->mMedia);
+        }
+        d->mMedia = newMedia;
+        d->mMediaStartsPaused = false;
+
+        libvlc_media_player_set_media(d->mPlayer, d->mMedia);
+    }
 
     if (d->signalPlaybackChange(QMediaPlayer::StoppedState)) {
         Q_EMIT stopped();
@@ -256,6 +314,51 @@ void AudioWrapper::setSource(const QUrl &source)
     d->mHasSavedPosition = false;
 }
 
+void AudioWrapper::setNextSource(const QUrl &source)
+{
+    if (d->mNextSource == source && (d->mNextMedia || source.isEmpty())) {
+        return;
+    }
+
+    d->releaseNextMedia();
+    d->mNextSource = source;
+
+    if (!source.isEmpty() && d->mPlayer) {
+        if (!d->mNextPlayer) {
+            d->mNextPlayer = libvlc_media_player_new(d->mInstance);
+            if (d->mNextPlayer) {
+                d->attachPlayerEvents(d->mNextPlayer);
+            }
+        }
+
+        if (d->mNextPlayer) {
+            d->mNextMedia = d->createMedia(source);
+        }
+
+        if (d->mNextMedia) {
+            // probe the next track now, it is opened and buffered in the pre-roll window
+            libvlc_media_parse_with_options(d->mNextMedia, libvlc_media_parse_local, -1);
+            libvlc_media_player_set_media(d->mNextPlayer, d->mNextMedia);
+        }
+    }
+
+    Q_EMIT nextSourceChanged();
+
+    d->preRollNextMedia(position());
+}
+
+void AudioWrapper::setPreRollWindow(qint64 preRollWindow)
+{
+    if (d->mPreRollWindow == preRollWindow) {
+        return;
+    }
+
+    d->mPreRollWindow = preRollWindow;
+    Q_EMIT preRollWindowChanged();
+
+    d->preRollNextMedia(position());
+}
+
 void AudioWrapper::setPosition(qint64 position)
 {
     if (!d->mPlayer) {
@@ -296,6 +399,10 @@ void AudioWrapper::play()
         return;
     }
 
+    if (d->mMediaStartsPaused && libvlc_media_player_get_state(d->mPlayer) != libvlc_Paused) {
+        d->reloadMedia();
+    }
+
     libvlc_media_player_play(d->mPlayer);
 }
 
@@ -314,6 +421,7 @@ void AudioWrapper::stop()
         return;
     }
 
+    d->mTransitionTimer.invalidate();
     libvlc_media_player_stop(d->mPlayer);
 }
 
@@ -395,8 +503,25 @@ void AudioWrapper::playerSeekableSignalChanges(bool isSeekable)
     QMetaObject::invokeMethod(this, [this, isSeekable]() {Q_EMIT seekableChanged(isSeekable);}, Qt::QueuedConnection);
 }
 
+void AudioWrapper::playerTransitionLatencySignalChanges(qint64 latency)
+{
+    QMetaObject::invokeMethod(this, [this, latency]() {Q_EMIT transitionLatencyChanged(latency);}, Qt::QueuedConnection);
+}
+
 void AudioWrapperPrivate::vlcEventCallback(const struct libvlc_event_t *p_event)
 {
+    // called on a libvlc thread: the players and the state of the wrapper are only used from the thread of the wrapper
+    QMetaObject::invokeMethod(mParent, [this, event = *p_event]() {handleVlcEvent(&event);}, Qt::QueuedConnection);
+}
+
+void AudioWrapperPrivate::handleVlcEvent(const struct libvlc_event_t *p_event)
+{
+    // the player holding the next media or the one that just ended must not
+    // change the state seen by the rest of the application
+    if (p_event->p_obj != mPlayer) {
+        return;
+    }
+
     const auto eventType = static_cast<libvlc_event_e>(p_event->type);
 
     switch(eventType)
@@ -412,6 +537,10 @@ void AudioWrapperPrivate::vlcEventCallback(const struct libvlc_event_t *p_event)
     case libvlc_MediaPlayerPlaying:
         qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::vlcEventCallback" << "libvlc_MediaPlayerPlaying";
         signalPlaybackChange(QMediaPlayer::PlayingState);
+        if (mTransitionTimer.isValid()) {
+            signalTransitionLatency(mTransitionTimer.nsecsElapsed());
+            mTransitionTimer.invalidate();
+        }
         break;
     case libvlc_MediaPlayerPaused:
         qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::vlcEventCallback" << "libvlc_MediaPlayerPaused";
@@ -423,10 +552,12 @@ void AudioWrapperPrivate::vlcEventCallback(const struct libvlc_event_t *p_event)
         break;
     case libvlc_MediaPlayerEndReached:
         qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::vlcEventCallback" << "libvlc_MediaPlayerEndReached";
-        signalMediaStatusChange(QMediaPlayer::BufferedMedia);
-        signalMediaStatusChange(QMediaPlayer::NoMedia);
-        signalMediaStatusChange(QMediaPlayer::EndOfMedia);
-        mediaIsEnded();
+        mTransitionTimer.start();
+        if (mNextMedia) {
+            switchToNextMedia();
+        } else {
+            signalMediaEnded();
+        }
         break;
     case libvlc_MediaPlayerEncounteredError:
         qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::vlcEventCallback" << "libvlc_MediaPlayerEncounteredError";
@@ -437,6 +568,7 @@ void AudioWrapperPrivate::vlcEventCallback(const struct libvlc_event_t *p_event)
     case libvlc_MediaPlayerPositionChanged:
         qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::vlcEventCallback" << "libvlc_MediaPlayerPositionChanged";
         signalPositionChange(p_event->u.media_player_position_changed.new_position);
+        preRollNextMedia(mPreviousPosition);
         break;
     case libvlc_MediaPlayerSeekableChanged:
         qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::vlcEventCallback" << "libvlc_MediaPlayerSeekableChanged";
@@ -471,8 +603,171 @@ void AudioWrapperPrivate::vlcEventCallback(const struct libvlc_event_t *p_event)
     }
 }
 
+void AudioWrapperPrivate::attachPlayerEvents(libvlc_media_player_t *player)
+{
+    auto playerEventManager = libvlc_media_player_event_manager(player);
+
+    libvlc_event_attach(playerEventManager, libvlc_MediaPlayerOpening, &vlc_callback, this);
+    libvlc_event_attach(playerEventManager, libvlc_MediaPlayerBuffering, &vlc_callback, this);
+    libvlc_event_attach(playerEventManager, libvlc_MediaPlayerPlaying, &vlc_callback, this);
+    libvlc_event_attach(playerEventManager, libvlc_MediaPlayerPaused, &vlc_callback, this);
+    libvlc_event_attach(playerEventManager, libvlc_MediaPlayerStopped, &vlc_callback, this);
+    libvlc_event_attach(playerEventManager, libvlc_MediaPlayerEndReached, &vlc_callback, this);
+    libvlc_event_attach(playerEventManager, libvlc_MediaPlayerEncounteredError, &vlc_callback, this);
+    libvlc_event_attach(playerEventManager, libvlc_MediaPlayerPositionChanged, &vlc_callback, this);
+    libvlc_event_attach(playerEventManager, libvlc_MediaPlayerSeekableChanged, &vlc_callback, this);
+    libvlc_event_attach(playerEventManager, libvlc_MediaPlayerLengthChanged, &vlc_callback, this);
+    libvlc_event_attach(playerEventManager, libvlc_MediaPlayerMuted, &vlc_callback, this);
+    libvlc_event_attach(playerEventManager, libvlc_MediaPlayerUnmuted, &vlc_callback, this);
+    libvlc_event_attach(playerEventManager, libvlc_MediaPlayerAudioVolume, &vlc_callback, this);
+    libvlc_event_attach(playerEventManager, libvlc_MediaPlayerAudioDevice, &vlc_callback, this);
+}
+
+libvlc_media_t *AudioWrapperPrivate::createMedia(const QUrl &source) const
+{
+    libvlc_media_t *newMedia = nullptr;
+
+    if (source.isLocalFile()) {
+        qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::createMedia reading local resource";
+        newMedia = libvlc_media_new_path(mInstance, QDir::toNativeSeparators(source.toLocalFile()).toUtf8().constData());
+    } else {
+        qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::createMedia reading remote resource";
+        newMedia = libvlc_media_new_location(mInstance, source.url().toUtf8().constData());
+    }
+
+    if (!newMedia) {
+        qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::createMedia"
+                 << "failed creating media"
+                 << libvlc_errmsg()
+                 << QDir::toNativeSeparators(source.toLocalFile()).toUtf8().constData();
+
+        newMedia = libvlc_media_new_path(mInstance, QDir::toNativeSeparators(source.toLocalFile()).toLatin1().constData());
+        if (!newMedia) {
+            qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::createMedia"
+                     << "failed creating media"
+                     << libvlc_errmsg()
+                     << QDir::toNativeSeparators(source.toLocalFile()).toLatin1().constData();
+        }
+    }
+
+    return newMedia;
+}
+
+void AudioWrapperPrivate::reloadMedia()
+{
+    // a pre-rolled media would start paused again, a new media is created for the same source
+    auto newMedia = createMedia(mParent->source());
+    if (!newMedia) {
+        return;
+    }
+
+    libvlc_media_release(mMedia);
+    mMedia = newMedia;
+    mMediaStartsPaused = false;
+
+    libvlc_media_player_set_media(mPlayer, mMedia);
+}
+
+void AudioWrapperPrivate::preRollNextMedia(qint64 position)
+{
+    if (!mNextMedia || mNextMediaIsPreRolled || mPreviousPlayerState != QMediaPlayer::PlayingState) {
+        return;
+    }
+
+    if (mMediaDuration <= 0 || mMediaDuration - position > mPreRollWindow) {
+        return;
+    }
+
+    qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::preRollNextMedia" << mNextSource;
+
+    // the next player opens the media, fills its buffers and waits paused for the end of the current one
+    libvlc_media_add_option(mNextMedia, ":start-paused");
+
+    if (const auto currentVolume = libvlc_audio_get_volume(mPlayer); currentVolume != -1) {
+        libvlc_audio_set_volume(mNextPlayer, currentVolume);
+    }
+
+    libvlc_media_player_play(mNextPlayer);
+    mNextMediaIsPreRolled = true;
+}
+
+void AudioWrapperPrivate::releaseNextMedia()
+{
+    if (!mNextMedia) {
+        return;
+    }
+
+    if (mNextMediaIsPreRolled) {
+        libvlc_media_player_stop(mNextPlayer);
+        mNextMediaIsPreRolled = false;
+    }
+
+    libvlc_media_parse_stop(mNextMedia);
+    libvlc_media_player_set_media(mNextPlayer, nullptr);
+    libvlc_media_release(mNextMedia);
+    mNextMedia = nullptr;
+}
+
+void AudioWrapperPrivate::useNextMedia()
+{
+    const auto previousVolume = libvlc_audio_get_volume(mPlayer);
+    const auto previousMuted = libvlc_audio_get_mute(mPlayer);
+
+    std::swap(mPlayer, mNextPlayer);
+
+    if (mMedia) {
+        libvlc_media_release(mMedia);
+    }
+    mMedia = std::exchange(mNextMedia, nullptr);
+    mMediaStartsPaused = std::exchange(mNextMediaIsPreRolled, false);
+    mNextSource.clear();
+
+    // events of the previous player are ignored from now on
+    libvlc_media_player_stop(mNextPlayer);
+
+    if (previousVolume != -1) {
+        libvlc_audio_set_volume(mPlayer, previousVolume);
+    }
+    if (previousMuted != -1) {
+        libvlc_audio_set_mute(mPlayer, previousMuted);
+    }
+
+    // the media has usually been parsed, its duration is then known before playing it
+    if (const auto preparedDuration = libvlc_media_get_duration(mMedia); preparedDuration > 0) {
+        signalDurationChange(preparedDuration);
+    }
+}
+
+void AudioWrapperPrivate::switchToNextMedia()
+{
+    const auto newSource = mNextSource;
+
+    useNextMedia();
+
+    // a pre-rolled player is paused on its first buffers and only needs to be resumed
+    libvlc_media_player_play(mPlayer);
+
+    qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::switchToNextMedia" << newSource;
+
+    Q_EMIT mParent->sourceChanged();
+    Q_EMIT mParent->nextSourceChanged();
+    Q_EMIT mParent->switchedToNextSource(newSource);
+}
+
+void AudioWrapperPrivate::signalMediaEnded()
+{
+    signalMediaStatusChange(QMediaPlayer::BufferedMedia);
+    signalMediaStatusChange(QMediaPlayer::NoMedia);
+    signalMediaStatusChange(QMediaPlayer::EndOfMedia);
+    mediaIsEnded();
+}
+
 void AudioWrapperPrivate::mediaIsEnded()
 {
+    if (!mMedia) {
+        return;
+    }
+
     libvlc_media_release(mMedia);
     mMedia = nullptr;
 }
@@ -574,5 +869,17 @@ void AudioWrapperPrivate::signalErrorChange(QMediaPlayer::Error errorCode)
     }
 }
 
+void AudioWrapperPrivate::signalTransitionLatency(qint64 latency)
+{
+    PerformanceCounters::add(PerformanceCounters::TrackTransitions, 1);
+    PerformanceCounters::add(PerformanceCounters::TrackTransitionNanoseconds, latency);
+
+    mTransitionLatency = latency / 1000;
+
+    qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::signalTransitionLatency" << mTransitionLatency << "us";
+
+    mParent->playerTransitionLatencySignalChanges(mTransitionLatency);
+}
+
 
 #include "moc_audiowrapper.cpp"
@@ -8,9 +8,13 @@
 #include "powermanagementinterface.h"
 
 #include "qtMultimediaLogging.h"
+#include "performancecounters.h"
 
 #include <QTimer>
 #include <QAudio>
+#include <QElapsedTimer>
+
+#include <utility>
 
 #include "config-upnp-qt.h"
 
@@ -21,7 +25,31 @@ public:
 
     PowerManagementInterface mPowerInterface;
 
-    QMediaPlayer mPlayer;
+    AudioWrapper *mParent = nullptr;
+
+    QMediaPlayer mFirstPlayer;
+
+    QMediaPlayer mSecondPlayer;
+
+    /**
+     * Player connected to the rest of the application.
+     */
+    QMediaPlayer *mPlayer = &mFirstPlayer;
+
+    /**
+     * Player holding the next source paused near the end of the current one.
+     */
+    QMediaPlayer *mNextPlayer = &mSecondPlayer;
+
+    QUrl mNextSource;
+
+    QUrl mPreRolledSource;
+
+    QElapsedTimer mTransitionTimer;
+
+    qint64 mTransitionLatency = 0;
+
+    qint64 mPreRollWindow = 5000;
 
     qint64 mSavedPosition = 0.0;
 
@@ -29,21 +57,33 @@ public:
 
     bool mHasSavedPosition = false;
 
+    /**
+     * The current player stopped while a pre-rolled source waits for the
+     * EndOfMedia status that follows. The stopped state is only signaled if
+     * the player does not switch to the pre-rolled source.
+     */
+    bool mStoppedStateIsPending = false;
+
+    void connectPlayer(QMediaPlayer *player);
+
+    void signalPlayerState(QMediaPlayer::State newState);
+
+    void signalPendingStoppedState();
+
+    void preRollNextSource(qint64 position);
+
+    void releasePreRolledSource();
+
+    bool switchToPreRolledSource();
+
+    void signalTransitionLatency(qint64 latency);
+
 };
 
 AudioWrapper::AudioWrapper(QObject *parent) : QObject(parent), d(std::make_unique<AudioWrapperPrivate>())
 {
-    connect(&d->mPlayer, &QMediaPlayer::mutedChanged, this, &AudioWrapper::playerMutedChanged);
-    connect(&d->mPlayer, &QMediaPlayer::volumeChanged, this, &AudioWrapper::playerVolumeChanged);
-    connect(&d->mPlayer, &QMediaPlayer::mediaChanged, this, &AudioWrapper::sourceChanged);
-    connect(&d->mPlayer, &QMediaPlayer::mediaStatusChanged, this, &AudioWrapper::statusChanged);
-    connect(&d->mPlayer, &QMediaPlayer::mediaStatusChanged, this, &AudioWrapper::mediaStatusChanged);
-    connect(&d->mPlayer, &QMediaPlayer::stateChanged, this, &AudioWrapper::playbackStateChanged);
-    connect(&d->mPlayer, &QMediaPlayer::stateChanged, this, &AudioWrapper::playerStateChanged);
-    connect(&d->mPlayer, QOverload<QMediaPlayer::Error>::of(&QMediaPlayer::error), this, &AudioWrapper::errorChanged);
-    connect(&d->mPlayer, &QMediaPlayer::durationChanged, this, &AudioWrapper::durationChanged);
-    connect(&d->mPlayer, &QMediaPlayer::positionChanged, this, &AudioWrapper::positionChanged);
-    connect(&d->mPlayer, &QMediaPlayer::seekableChanged, this, &AudioWrapper::seekableChanged);
+    d->mParent = this;
+    d->connectPlayer(d->mPlayer);
 }
 
 AudioWrapper::~AudioWrapper()
@@ -53,12 +93,12 @@ AudioWrapper::~AudioWrapper()
 
 bool AudioWrapper::muted() const
 {
-    return d->mPlayer.isMuted();
+    return d->mPlayer->isMuted();
 }
 
 qreal AudioWrapper::volume() const
 {
-    auto realVolume = static_cast<qreal>(d->mPlayer.volume() / 100.0);
+    auto realVolume = static_cast<qreal>(d->mPlayer->volume() / 100.0);
     auto userVolume = static_cast<qreal>(QAudio::convertVolume(realVolume, QAudio::LinearVolumeScale, QAudio::LogarithmicVolumeScale));
 
     return userVolume * 100.0;
@@ -67,49 +107,69 @@ qreal AudioWrapper::volume() const
 QUrl AudioWrapper::source() const
 {
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 14, 0))
-    return d->mPlayer.media().request().url();
+    return d->mPlayer->media().request().url();
 #else
-    return d->mPlayer.media().canonicalUrl();
+    return d->mPlayer->media().canonicalUrl();
 #endif
 }
 
+QUrl AudioWrapper::nextSource() const
+{
+    return d->mNextSource;
+}
+
+qint64 AudioWrapper::transitionLatency() const
+{
+    return d->mTransitionLatency;
+}
+
+qint64 AudioWrapper::preRollWindow() const
+{
+    return d->mPreRollWindow;
+}
+
 QMediaPlayer::Error AudioWrapper::error() const
 {
-    if (d->mPlayer.error() != QMediaPlayer::NoError) {
-        qDebug() << "AudioWrapper::error" << d->mPlayer.errorString();
+    if (d->mPlayer->error() != QMediaPlayer::NoError) {
+        qDebug() << "AudioWrapper::error" << d->mPlayer->errorString();
     }
 
-    return d->mPlayer.error();
+    return d->mPlayer->error();
 }
 
 qint64 AudioWrapper::duration() const
 {
-    return d->mPlayer.duration();
+    return d->mPlayer->duration();
 }
 
 qint64 AudioWrapper::position() const
 {
-    return d->mPlayer.position();
+    return d->mPlayer->position();
 }
 
 bool AudioWrapper::seekable() const
 {
-    return d->mPlayer.isSeekable();
+    return d->mPlayer->isSeekable();
 }
 
 QMediaPlayer::State AudioWrapper::playbackState() const
 {
-    return d->mPlayer.state();
+    if (d->mStoppedStateIsPending) {
+        return QMediaPlayer::PlayingState;
+    }
+
+    return d->mPlayer->state();
 }
 
 QMediaPlayer::MediaStatus AudioWrapper::status() const
 {
-    return d->mPlayer.mediaStatus();
+    return d->mPlayer->mediaStatus();
 }
 
 void AudioWrapper::setMuted(bool muted)
 {
-    d->mPlayer.setMuted(muted);
+    d->mPlayer->setMuted(muted);
+    d->mNextPlayer->setMuted(muted);
 }
 
 void AudioWrapper::setVolume(qreal volume)
@@ -117,33 +177,67 @@ void AudioWrapper::setVolume(qreal volume)
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::setVolume" << volume;
 
     auto realVolume = static_cast<qreal>(QAudio::convertVolume(volume / 100.0, QAudio::LogarithmicVolumeScale, QAudio::LinearVolumeScale));
-    d->mPlayer.setVolume(qRound(realVolume * 100));
+    d->mPlayer->setVolume(qRound(realVolume * 100));
+    d->mNextPlayer->setVolume(qRound(realVolume * 100));
 }
 
 void AudioWrapper::setSource(const QUrl &source)
 {
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::setSource" << source;
 
-    d->mPlayer.setMedia({source});
+    if (source.isEmpty()) {
+        d->mTransitionTimer.invalidate();
+    }
+
+    d->mPlayer->setMedia({source});
+}
+
+void AudioWrapper::setNextSource(const QUrl &source)
+{
+    if (d->mNextSource == source) {
+        return;
+    }
+
+    qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::setNextSource" << source;
+
+    d->mNextSource = source;
+    if (d->mPreRolledSource != source) {
+        d->releasePreRolledSource();
+    }
+    Q_EMIT nextSourceChanged();
+
+    d->preRollNextSource(d->mPlayer->position());
+}
+
+void AudioWrapper::setPreRollWindow(qint64 preRollWindow)
+{
+    if (d->mPreRollWindow == preRollWindow) {
+        return;
+    }
+
+    d->mPreRollWindow = preRollWindow;
+    Q_EMIT preRollWindowChanged();
+
+    d->preRollNextSource(d->mPlayer->position());
 }
 
 void AudioWrapper::setPosition(qint64 position)
 {
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::setPosition" << position;
 
-    if (d->mPlayer.duration() <= 0) {
+    if (d->mPlayer->duration() <= 0) {
         savePosition(position);
         return;
     }
 
-    d->mPlayer.setPosition(position);
+    d->mPlayer->setPosition(position);
 }
 
 void AudioWrapper::play()
 {
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::play";
 
-    d->mPlayer.play();
+    d->mPlayer->play();
 
     if (d->mHasSavedPosition) {
         qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::playerDurationSignalChanges" << "restore old position" << d->mSavedPosition;
@@ -157,52 +251,64 @@ void AudioWrapper::pause()
 {
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::pause";
 
-    d->mPlayer.pause();
+    d->mPlayer->pause();
 }
 
 void AudioWrapper::stop()
 {
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::stop";
 
-    d->mPlayer.stop();
+    d->mTransitionTimer.invalidate();
+    d->mPlayer->stop();
 }
 
 void AudioWrapper::seek(qint64 position)
 {
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::seek" << position;
 
-    d->mPlayer.setPosition(position);
+    d->mPlayer->setPosition(position);
 }
 
 void AudioWrapper::mediaStatusChanged()
 {
-    qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::mediaStatusChanged" << d->mPlayer.mediaStatus();
+    const auto newStatus = d->mPlayer->mediaStatus();
+
+    qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::mediaStatusChanged" << newStatus;
+
+    if (newStatus == QMediaPlayer::EndOfMedia) {
+        d->mTransitionTimer.start();
+
+        if (d->switchToPreRolledSource()) {
+            d->mStoppedStateIsPending = false;
+            return;
+        }
+    }
+
+    d->signalPendingStoppedState();
+
+    Q_EMIT statusChanged(newStatus);
 }
 
 void AudioWrapper::playerStateChanged()
 {
-    qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::playerStateChanged" << d->mPlayer.state();
+    const auto newState = d->mPlayer->state();
 
-    switch(d->mPlayer.state())
-    {
-    case QMediaPlayer::State::StoppedState:
-        Q_EMIT stopped();
-        d->mPowerInterface.setPreventSleep(false);
-        break;
-    case QMediaPlayer::State::PlayingState:
-        Q_EMIT playing();
-        d->mPowerInterface.setPreventSleep(true);
-        break;
-    case QMediaPlayer::State::PausedState:
-        Q_EMIT paused();
-        d->mPowerInterface.setPreventSleep(false);
-        break;
+    qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::playerStateChanged" << newState;
+
+    if (newState == QMediaPlayer::StoppedState && !d->mPreRolledSource.isEmpty() && d->mPreRolledSource == d->mNextSource) {
+        // Qt reports the end of a source with a stopped state just before the EndOfMedia status
+        d->mStoppedStateIsPending = true;
+        QMetaObject::invokeMethod(this, [this]() {d->signalPendingStoppedState();}, Qt::QueuedConnection);
+        return;
     }
+
+    d->mStoppedStateIsPending = false;
+    d->signalPlayerState(newState);
 }
 
 void AudioWrapper::playerVolumeChanged()
 {
-    qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::playerVolumeChanged" << d->mPlayer.volume();
+    qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::playerVolumeChanged" << d->mPlayer->volume();
 
     QTimer::singleShot(0, [this]() {Q_EMIT volumeChanged();});
 }
@@ -257,6 +363,11 @@ void AudioWrapper::playerSeekableSignalChanges(bool isSeekable)
     QMetaObject::invokeMethod(this, [this, isSeekable]() {Q_EMIT seekableChanged(isSeekable);}, Qt::QueuedConnection);
 }
 
+void AudioWrapper::playerTransitionLatencySignalChanges(qint64 latency)
+{
+    QMetaObject::invokeMethod(this, [this, latency]() {Q_EMIT transitionLatencyChanged(latency);}, Qt::QueuedConnection);
+}
+
 void AudioWrapper::saveUndoPosition(qint64 position)
 {
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::saveUndoPosition" << position;
@@ -283,5 +394,140 @@ void AudioWrapper::savePosition(qint64 position)
     }
 }
 
+void AudioWrapperPrivate::connectPlayer(QMediaPlayer *player)
+{
+    QObject::connect(player, &QMediaPlayer::mutedChanged, mParent, &AudioWrapper::playerMutedChanged);
+    QObject::connect(player, &QMediaPlayer::volumeChanged, mParent, &AudioWrapper::playerVolumeChanged);
+    QObject::connect(player, &QMediaPlayer::mediaChanged, mParent, &AudioWrapper::sourceChanged);
+    QObject::connect(player, &QMediaPlayer::mediaStatusChanged, mParent, &AudioWrapper::mediaStatusChanged);
+    QObject::connect(player, &QMediaPlayer::stateChanged, mParent, &AudioWrapper::playerStateChanged);
+    QObject::connect(player, QOverload<QMediaPlayer::Error>::of(&QMediaPlayer::error), mParent, &AudioWrapper::errorChanged);
+    QObject::connect(player, &QMediaPlayer::durationChanged, mParent, &AudioWrapper::durationChanged);
+    QObject::connect(player, &QMediaPlayer::positionChanged, mParent, &AudioWrapper::positionChanged);
+    QObject::connect(player, &QMediaPlayer::positionChanged, mParent, [this](qint64 position) {preRollNextSource(position);});
+    QObject::connect(player, &QMediaPlayer::seekableChanged, mParent, &AudioWrapper::seekableChanged);
+}
+
+void AudioWrapperPrivate::signalPlayerState(QMediaPlayer::State newState)
+{
+    Q_EMIT mParent->playbackStateChanged(newState);
+
+    switch(newState)
+    {
+    case QMediaPlayer::State::StoppedState:
+        Q_EMIT mParent->stopped();
+        mPowerInterface.setPreventSleep(false);
+        break;
+    case QMediaPlayer::State::PlayingState:
+        Q_EMIT mParent->playing();
+        mPowerInterface.setPreventSleep(true);
+        if (mTransitionTimer.isValid()) {
+            signalTransitionLatency(mTransitionTimer.nsecsElapsed());
+            mTransitionTimer.invalidate();
+        }
+        break;
+    case QMediaPlayer::State::PausedState:
+        Q_EMIT mParent->paused();
+        mPowerInterface.setPreventSleep(false);
+        break;
+    }
+}
+
+void AudioWrapperPrivate::signalPendingStoppedState()
+{
+    if (!mStoppedStateIsPending) {
+        return;
+    }
+
+    mStoppedStateIsPending = false;
+    signalPlayerState(mPlayer->state());
+}
+
+void AudioWrapperPrivate::preRollNextSource(qint64 position)
+{
+    if (mNextSource.isEmpty() || mPreRolledSource == mNextSource) {
+        return;
+    }
+
+    const auto currentDuration = mPlayer->duration();
+    if (currentDuration <= 0 || currentDuration - position > mPreRollWindow) {
+        return;
+    }
+
+    qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapperPrivate::preRollNextSource" << mNextSource;
+
+    // a paused player opens and buffers its media, starting it later only flips its state
+    mPreRolledSource = mNextSource;
+    mNextPlayer->setMedia({mPreRolledSource});
+    mNextPlayer->pause();
+}
+
+void AudioWrapperPrivate::releasePreRolledSource()
+{
+    if (mPreRolledSource.isEmpty()) {
+        return;
+    }
+
+    mPreRolledSource.clear();
+    mNextPlayer->stop();
+    mNextPlayer->setMedia({});
+}
+
+bool AudioWrapperPrivate::switchToPreRolledSource()
+{
+    if (mPreRolledSource.isEmpty() || mPreRolledSource != mNextSource) {
+        return false;
+    }
+
+    switch (mNextPlayer->mediaStatus())
+    {
+    case QMediaPlayer::LoadedMedia:
+    case QMediaPlayer::BufferingMedia:
+    case QMediaPlayer::BufferedMedia:
+        break;
+    default:
+        // the next source is not ready, it is loaded again by the usual path
+        releasePreRolledSource();
+        return false;
+    }
+
+    auto endedPlayer = mPlayer;
+
+    QObject::disconnect(endedPlayer, nullptr, mParent, nullptr);
+    std::swap(mPlayer, mNextPlayer);
+    connectPlayer(mPlayer);
+
+    mPlayer->play();
+
+    endedPlayer->stop();
+    endedPlayer->setMedia({});
+
+    mPreRolledSource.clear();
+    const auto newSource = std::exchange(mNextSource, QUrl{});
+
+    qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapperPrivate::switchToPreRolledSource" << newSource;
+
+    Q_EMIT mParent->sourceChanged();
+    Q_EMIT mParent->nextSourceChanged();
+    Q_EMIT mParent->durationChanged(mPlayer->duration());
+    Q_EMIT mParent->seekableChanged(mPlayer->isSeekable());
+    Q_EMIT mParent->positionChanged(mPlayer->position());
+    Q_EMIT mParent->switchedToNextSource(newSource);
+
+    return true;
+}
+
+void AudioWrapperPrivate::signalTransitionLatency(qint64 latency)
+{
+    PerformanceCounters::add(PerformanceCounters::TrackTransitions, 1);
+    PerformanceCounters::add(PerformanceCounters::TrackTransitionNanoseconds, latency);
+
+    mTransitionLatency = latency / 1000;
+
+    qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapperPrivate::signalTransitionLatency" << mTransitionLatency << "us";
+
+    Q_EMIT mParent->transitionLatencyChanged(mTransitionLatency);
+}
+
 
 #include "moc_audiowrapper.cpp"
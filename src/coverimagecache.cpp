@@ -0,0 +1,314 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "coverimagecache.h"
+
+#include "config-upnp-qt.h"
+
+#include "performancecounters.h"
+#include "viewsLogging.h"
+
+#if defined KF5FileMetaData_FOUND && KF5FileMetaData_FOUND
+#include <KFileMetaData/EmbeddedImageData>
+#endif
+
+#include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QDir>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QCryptographicHash>
+#include <QMutexLocker>
+#include <QDebug>
+
+#include <algorithm>
+
+/**
+ * Default size in kibibytes of the decoded covers kept in memory.
+ */
+static const int DefaultMaximumMemoryCost = 64 * 1024;
+
+/**
+ * Default size in bytes of the thumbnails kept on disk.
+ */
+static const qint64 DefaultMaximumDiskSize = 100 * 1024 * 1024;
+
+
+static bool writeThumbnail(const QImage &image, const QString &thumbnailFileName)
+{
+    if (!QDir{}.mkpath(QFileInfo{thumbnailFileName}.absolutePath())) {
+        return false;
+    }
+
+    QSaveFile thumbnailFile(thumbnailFileName);
+    if (!thumbnailFile.open(QIODevice::WriteOnly)) {
+        qCDebug(orgKdeElisaViews()) << "CoverImageCache" << "cannot write" << thumbnailFileName << thumbnailFile.errorString();
+        return false;
+    }
+
+    if (!image.save(&thumbnailFile, "PNG")) {
+        thumbnailFile.cancelWriting();
+        return false;
+    }
+
+    return thumbnailFile.commit();
+}
+
+/**
+ * Mark a thumbnail as recently used: the disk cache removes the thumbnails with the oldest modification time first.
+ */
+static void touchThumbnail(const QString &thumbnailFileName)
+{
+    QFile thumbnailFile(thumbnailFileName);
+    if (thumbnailFile.open(QIODevice::ReadWrite)) {
+        thumbnailFile.setFileTime(QDateTime::currentDateTimeUtc(), QFileDevice::FileModificationTime);
+    }
+}
+
+/**
+ * Remove the least recently used thumbnails of directory until their total size is well below maximumSize.
+ *
+ * @return the total size of the remaining thumbnails
+ */
+static qint64 evictThumbnails(const QString &directory, qint64 maximumSize)
+{
+    const auto allThumbnails = QDir{directory}.entryInfoList({QStringLiteral("*.png")}, QDir::Files, QDir::Time | QDir::Reversed);
+
+    auto totalSize = qint64{0};
+    for (const auto &oneThumbnail : allThumbnails) {
+        totalSize += oneThumbnail.size();
+    }
+
+    if (totalSize <= maximumSize) {
+        return totalSize;
+    }
+
+    // leave some room so that the next thumbnails do not trigger a new scan of the directory
+    const auto targetSize = maximumSize / 4 * 3;
+    for (const auto &oneThumbnail : allThumbnails) {
+        if (totalSize <= targetSize) {
+            break;
+        }
+        if (QFile::remove(oneThumbnail.absoluteFilePath())) {
+            totalSize -= oneThumbnail.size();
+        }
+    }
+
+    return totalSize;
+}
+
+CoverImageCache &CoverImageCache::instance()
+{
+    static CoverImageCache sharedCache;
+
+    return sharedCache;
+}
+
+CoverImageCache::CoverImageCache()
+    : mCacheDirectory(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/covers")),
+      mMaximumDiskSize(DefaultMaximumDiskSize)
+{
+    mImages.setMaxCost(DefaultMaximumMemoryCost);
+}
+
+QImage CoverImageCache::image(const QString &fileName, const QSize &size)
+{
+    return cachedImage(fileName, size, nullptr);
+}
+
+QString CoverImageCache::thumbnailFileName(const QString &fileName, const QSize &size)
+{
+    auto result = QString{};
+
+    auto coverImage = cachedImage(fileName, size, &result);
+    Q_UNUSED(coverImage)
+
+    return result;
+}
+
+QString CoverImageCache::cacheDirectory() const
+{
+    QMutexLocker locker(&mMutex);
+
+    return mCacheDirectory;
+}
+
+void CoverImageCache::setCacheDirectory(const QString &directory)
+{
+    QMutexLocker locker(&mMutex);
+
+    mCacheDirectory = directory;
+    mDiskSize = -1;
+}
+
+void CoverImageCache::setMaximumMemoryCost(int maximumCost)
+{
+    QMutexLocker locker(&mMutex);
+
+    mImages.setMaxCost(maximumCost);
+}
+
+void CoverImageCache::setMaximumDiskSize(qint64 maximumSize)
+{
+    QMutexLocker locker(&mMutex);
+
+    mMaximumDiskSize = maximumSize;
+    mDiskSize = -1;
+}
+
+void CoverImageCache::clear()
+{
+    QMutexLocker locker(&mMutex);
+
+    mImages.clear();
+}
+
+QImage CoverImageCache::cachedImage(const QString &fileName, const QSize &size, QString *thumbnailFile)
+{
+    // a modified file gets new cache entries, the old thumbnails are never read again and end up evicted
+    const auto fileInfo = QFileInfo{fileName};
+    const auto cacheKey = QStringLiteral("%1|%2|%3|%4x%5").arg(fileName, QString::number(fileInfo.lastModified().toMSecsSinceEpoch()),
+                                                               QString::number(fileInfo.size()),
+                                                               QString::number(size.width()), QString::number(size.height()));
+
+    auto result = QImage{};
+    auto foundInMemory = false;
+    auto directory = QString{};
+
+    {
+        QMutexLocker locker(&mMutex);
+
+        directory = mCacheDirectory;
+
+        // the thread already decoding this cover stores it in memory before waking us up
+        while (mPendingDecodes.contains(cacheKey)) {
+            mDecodeFinished.wait(&mMutex);
+        }
+
+        if (const auto *memoryImage = mImages.object(cacheKey)) {
+            result = *memoryImage;
+            foundInMemory = true;
+        } else {
+            mPendingDecodes.insert(cacheKey);
+        }
+    }
+
+    auto diskFileName = QString{};
+    if (!directory.isEmpty()) {
+        diskFileName = directory + QLatin1Char('/') +
+                QString::fromLatin1(QCryptographicHash::hash(cacheKey.toUtf8(), QCryptographicHash::Sha1).toHex()) +
+                QStringLiteral(".png");
+    }
+
+    auto diskFileIsValid = false;
+    auto newThumbnailSize = qint64{0};
+
+    if (foundInMemory) {
+        PerformanceCounters::add(PerformanceCounters::CoverMemoryCacheHits, 1);
+    } else {
+        if (!diskFileName.isEmpty() && result.load(diskFileName, "PNG")) {
+            PerformanceCounters::add(PerformanceCounters::CoverDiskCacheHits, 1);
+            touchThumbnail(diskFileName);
+            diskFileIsValid = true;
+        } else {
+            PerformanceCounters::add(PerformanceCounters::CoverCacheMisses, 1);
+            result = extractImage(fileName, size);
+            if (!result.isNull() && !diskFileName.isEmpty()) {
+                diskFileIsValid = writeThumbnail(result, diskFileName);
+                if (diskFileIsValid) {
+                    newThumbnailSize = QFileInfo{diskFileName}.size();
+                }
+            }
+        }
+
+        // files without any embedded cover are also remembered with a null image
+        const auto cost = std::max(1, static_cast<int>(result.sizeInBytes() / 1024));
+
+        QMutexLocker locker(&mMutex);
+        mImages.insert(cacheKey, new QImage(result), cost);
+        mPendingDecodes.remove(cacheKey);
+        mDecodeFinished.wakeAll();
+    }
+
+    if (thumbnailFile && !result.isNull() && !diskFileName.isEmpty()) {
+        if (!diskFileIsValid) {
+            if (QFile::exists(diskFileName)) {
+                touchThumbnail(diskFileName);
+                diskFileIsValid = true;
+            } else if (writeThumbnail(result, diskFileName)) {
+                newThumbnailSize = QFileInfo{diskFileName}.size();
+                diskFileIsValid = true;
+            }
+        }
+        if (diskFileIsValid) {
+            *thumbnailFile = diskFileName;
+        }
+    }
+
+    if (newThumbnailSize) {
+        addThumbnailSize(directory, newThumbnailSize);
+    }
+
+    return result;
+}
+
+void CoverImageCache::addThumbnailSize(const QString &directory, qint64 thumbnailSize)
+{
+    auto maximumSize = qint64{0};
+
+    {
+        QMutexLocker locker(&mMutex);
+
+        if (directory != mCacheDirectory) {
+            return;
+        }
+
+        if (mDiskSize >= 0) {
+            mDiskSize += thumbnailSize;
+            if (mDiskSize <= mMaximumDiskSize) {
+                return;
+            }
+        }
+
+        maximumSize = mMaximumDiskSize;
+    }
+
+    // the directory is only scanned the first time and when the maximum size is exceeded
+    const auto remainingSize = evictThumbnails(directory, maximumSize);
+
+    QMutexLocker locker(&mMutex);
+
+    if (directory == mCacheDirectory) {
+        mDiskSize = remainingSize;
+    }
+}
+
+QImage CoverImageCache::extractImage(const QString &fileName, const QSize &size)
+{
+    PerformanceCounters::ScopedTimer decodeTimer(PerformanceCounters::CoverDecodeNanoseconds);
+
+    auto result = QImage{};
+
+#if defined KF5FileMetaData_FOUND && KF5FileMetaData_FOUND
+    KFileMetaData::EmbeddedImageData embeddedImage;
+
+    auto imageData = embeddedImage.imageData(fileName);
+
+    if (imageData.contains(KFileMetaData::EmbeddedImageData::FrontCover)) {
+        result = QImage::fromData(imageData[KFileMetaData::EmbeddedImageData::FrontCover]);
+        auto newCoverImage = result.scaled(size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        if (!newCoverImage.isNull()) {
+            result = std::move(newCoverImage);
+        }
+    }
+#else
+    Q_UNUSED(fileName)
+    Q_UNUSED(size)
+#endif
+
+    return result;
+}
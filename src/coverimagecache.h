@@ -0,0 +1,100 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef COVERIMAGECACHE_H
+#define COVERIMAGECACHE_H
+
+#include "elisaLib_export.h"
+
+#include <QString>
+#include <QSize>
+#include <QImage>
+#include <QCache>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QSet>
+
+/**
+ * Cache of the scaled covers embedded in the music files.
+ *
+ * Covers are first looked up in a bounded in-memory cache keyed by the path,
+ * modification time and size of the music file and by the requested size,
+ * then in a bounded directory of thumbnails stored on disk. Only when both
+ * miss is the cover extracted from the music file, decoded and scaled. The
+ * cache can be used from any thread and a cover requested by several threads
+ * at once is only decoded by one of them. Hits and misses are counted in
+ * PerformanceCounters.
+ */
+class ELISALIB_EXPORT CoverImageCache
+{
+public:
+
+    /**
+     * The cache shared by the image provider, the header bar and MPRIS.
+     */
+    static CoverImageCache& instance();
+
+    CoverImageCache();
+
+    /**
+     * Return the front cover embedded in fileName scaled to fit in size. The
+     * image is null if the file has no embedded cover.
+     */
+    [[nodiscard]] QImage image(const QString &fileName, const QSize &size);
+
+    /**
+     * Return the name of the thumbnail file for the front cover embedded in
+     * fileName, creating it if needed. The name is empty if the file has no
+     * embedded cover.
+     */
+    [[nodiscard]] QString thumbnailFileName(const QString &fileName, const QSize &size);
+
+    [[nodiscard]] QString cacheDirectory() const;
+
+    void setCacheDirectory(const QString &directory);
+
+    /**
+     * Set the maximum size in kibibytes of the decoded images kept in memory.
+     */
+    void setMaximumMemoryCost(int maximumCost);
+
+    /**
+     * Set the maximum size in bytes of the thumbnails stored on disk. When it
+     * is exceeded, the thumbnails read from disk the longest time ago are
+     * removed first.
+     */
+    void setMaximumDiskSize(qint64 maximumSize);
+
+    void clear();
+
+private:
+
+    [[nodiscard]] QImage cachedImage(const QString &fileName, const QSize &size, QString *thumbnailFile);
+
+    [[nodiscard]] static QImage extractImage(const QString &fileName, const QSize &size);
+
+    void addThumbnailSize(const QString &directory, qint64 thumbnailSize);
+
+    mutable QMutex mMutex;
+
+    QWaitCondition mDecodeFinished;
+
+    QCache<QString, QImage> mImages;
+
+    QSet<QString> mPendingDecodes;
+
+    QString mCacheDirectory;
+
+    qint64 mMaximumDiskSize;
+
+    /**
+     * Size of the thumbnails in mCacheDirectory or -1 if it was not yet computed.
+     */
+    qint64 mDiskSize = -1;
+
+};
+
+#endif // COVERIMAGECACHE_H
@@ -0,0 +1,182 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "coverprefetcher.h"
+
+#include "coverimagecache.h"
+#include "mediaplaylist.h"
+#include "datatypes.h"
+
+#include <QtConcurrent>
+
+#include <algorithm>
+
+CoverPrefetcher::CoverPrefetcher(QObject *parent) : QObject(parent)
+{
+    mThreadPool.setMaxThreadCount(1);
+}
+
+CoverPrefetcher::~CoverPrefetcher()
+{
+    mThreadPool.clear();
+    mThreadPool.waitForDone();
+}
+
+QAbstractItemModel *CoverPrefetcher::model() const
+{
+    return mModel;
+}
+
+MediaPlayListProxyModel *CoverPrefetcher::playList() const
+{
+    return mPlayList;
+}
+
+QSize CoverPrefetcher::thumbnailSize() const
+{
+    return mThumbnailSize;
+}
+
+int CoverPrefetcher::prefetchMargin() const
+{
+    return mPrefetchMargin;
+}
+
+void CoverPrefetcher::setModel(QAbstractItemModel *model)
+{
+    if (mModel == model) {
+        return;
+    }
+
+    cancel();
+
+    mModel = model;
+    Q_EMIT modelChanged();
+}
+
+void CoverPrefetcher::setPlayList(MediaPlayListProxyModel *playList)
+{
+    if (mPlayList == playList) {
+        return;
+    }
+
+    if (mPlayList) {
+        disconnect(mPlayList, &MediaPlayListProxyModel::nextTrackChanged, this, &CoverPrefetcher::nextTrackChanged);
+    }
+
+    mPlayList = playList;
+
+    if (mPlayList) {
+        connect(mPlayList, &MediaPlayListProxyModel::nextTrackChanged, this, &CoverPrefetcher::nextTrackChanged);
+    }
+
+    Q_EMIT playListChanged();
+}
+
+void CoverPrefetcher::setThumbnailSize(const QSize &size)
+{
+    if (mThumbnailSize == size) {
+        return;
+    }
+
+    mThumbnailSize = size;
+    Q_EMIT thumbnailSizeChanged();
+}
+
+void CoverPrefetcher::setPrefetchMargin(int margin)
+{
+    if (mPrefetchMargin == margin) {
+        return;
+    }
+
+    mPrefetchMargin = margin;
+    Q_EMIT prefetchMarginChanged();
+}
+
+void CoverPrefetcher::prefetchRows(int firstVisibleRow, int lastVisibleRow)
+{
+    cancel();
+
+    if (!mModel || mThumbnailSize.isEmpty()) {
+        return;
+    }
+
+    const auto rowsCount = mModel->rowCount();
+    if (rowsCount == 0) {
+        return;
+    }
+
+    // views report -1 when no delegate is under the requested point
+    firstVisibleRow = std::clamp(firstVisibleRow, 0, rowsCount - 1);
+    lastVisibleRow = std::clamp(std::max(lastVisibleRow, firstVisibleRow), 0, rowsCount - 1);
+
+    auto imageUrls = QVariantList{};
+    imageUrls.reserve(lastVisibleRow - firstVisibleRow + 1 + 2 * mPrefetchMargin);
+
+    for (int row = firstVisibleRow; row <= lastVisibleRow; ++row) {
+        imageUrls.push_back(mModel->index(row, 0).data(DataTypes::ImageUrlRole));
+    }
+
+    for (int distance = 1; distance <= mPrefetchMargin; ++distance) {
+        if (lastVisibleRow + distance < rowsCount) {
+            imageUrls.push_back(mModel->index(lastVisibleRow + distance, 0).data(DataTypes::ImageUrlRole));
+        }
+        if (firstVisibleRow - distance >= 0) {
+            imageUrls.push_back(mModel->index(firstVisibleRow - distance, 0).data(DataTypes::ImageUrlRole));
+        }
+    }
+
+    prefetchImages(imageUrls);
+}
+
+void CoverPrefetcher::cancel()
+{
+    ++mGeneration;
+    mThreadPool.clear();
+}
+
+void CoverPrefetcher::nextTrackChanged(const QPersistentModelIndex &nextTrack)
+{
+    if (!nextTrack.isValid() || mThumbnailSize.isEmpty()) {
+        return;
+    }
+
+    const auto imageUrl = nextTrack.data(MediaPlayList::ImageUrlRole).toString();
+    const auto coverPrefix = QStringLiteral("image://cover/");
+
+    if (!imageUrl.startsWith(coverPrefix)) {
+        return;
+    }
+
+    QtConcurrent::run(&mThreadPool, [size = mThumbnailSize, fileName = imageUrl.mid(coverPrefix.size())] () {
+        auto coverImage = CoverImageCache::instance().image(fileName, size);
+        Q_UNUSED(coverImage)
+    });
+}
+
+void CoverPrefetcher::prefetchImages(const QVariantList &imageUrls)
+{
+    const auto coverPrefix = QStringLiteral("image://cover/");
+    const auto generation = mGeneration.load();
+
+    for (const auto &oneImageUrl : imageUrls) {
+        const auto imageUrl = oneImageUrl.toString();
+        if (!imageUrl.startsWith(coverPrefix)) {
+            continue;
+        }
+
+        QtConcurrent::run(&mThreadPool, [this, generation, size = mThumbnailSize, fileName = imageUrl.mid(coverPrefix.size())] () {
+            if (mGeneration.load() != generation) {
+                return;
+            }
+
+            auto coverImage = CoverImageCache::instance().image(fileName, size);
+            Q_UNUSED(coverImage)
+        });
+    }
+}
+
+#include "moc_coverprefetcher.cpp"
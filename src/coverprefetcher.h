@@ -0,0 +1,118 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef COVERPREFETCHER_H
+#define COVERPREFETCHER_H
+
+#include "elisaLib_export.h"
+
+#include "mediaplaylistproxymodel.h"
+
+#include <QObject>
+#include <QAbstractItemModel>
+#include <QPersistentModelIndex>
+#include <QPointer>
+#include <QSize>
+#include <QThreadPool>
+
+#include <atomic>
+
+/**
+ * Warm the cover cache in the background for the entries around the visible
+ * part of a view and for the next track of the play list.
+ *
+ * Only the covers embedded in music files are prefetched. Each new request
+ * cancels the covers of the previous request that are not yet decoded.
+ */
+class ELISALIB_EXPORT CoverPrefetcher : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QAbstractItemModel* model
+               READ model
+               WRITE setModel
+               NOTIFY modelChanged)
+
+    Q_PROPERTY(MediaPlayListProxyModel* playList
+               READ playList
+               WRITE setPlayList
+               NOTIFY playListChanged)
+
+    Q_PROPERTY(QSize thumbnailSize
+               READ thumbnailSize
+               WRITE setThumbnailSize
+               NOTIFY thumbnailSizeChanged)
+
+    Q_PROPERTY(int prefetchMargin
+               READ prefetchMargin
+               WRITE setPrefetchMargin
+               NOTIFY prefetchMarginChanged)
+
+public:
+
+    explicit CoverPrefetcher(QObject *parent = nullptr);
+
+    ~CoverPrefetcher() override;
+
+    [[nodiscard]] QAbstractItemModel* model() const;
+
+    [[nodiscard]] MediaPlayListProxyModel* playList() const;
+
+    [[nodiscard]] QSize thumbnailSize() const;
+
+    [[nodiscard]] int prefetchMargin() const;
+
+Q_SIGNALS:
+
+    void modelChanged();
+
+    void playListChanged();
+
+    void thumbnailSizeChanged();
+
+    void prefetchMarginChanged();
+
+public Q_SLOTS:
+
+    void setModel(QAbstractItemModel *model);
+
+    void setPlayList(MediaPlayListProxyModel *playList);
+
+    void setThumbnailSize(const QSize &size);
+
+    void setPrefetchMargin(int margin);
+
+    /**
+     * Prefetch the covers of the visible rows, then of up to prefetchMargin
+     * rows before and after them, nearest rows first.
+     */
+    void prefetchRows(int firstVisibleRow, int lastVisibleRow);
+
+    void cancel();
+
+private Q_SLOTS:
+
+    void nextTrackChanged(const QPersistentModelIndex &nextTrack);
+
+private:
+
+    void prefetchImages(const QVariantList &imageUrls);
+
+    QPointer<QAbstractItemModel> mModel;
+
+    QPointer<MediaPlayListProxyModel> mPlayList;
+
+    QSize mThumbnailSize;
+
+    int mPrefetchMargin = 40;
+
+    std::atomic<int> mGeneration{0};
+
+    QThreadPool mThreadPool;
+
+};
+
+#endif // COVERPREFETCHER_H
@@ -7,6 +7,7 @@
 #include "databaseinterface.h"
 
 #include "databaseLogging.h"
+#include "performancecounters.h"
 
 #include <KI18n/KLocalizedString>
 
@@ -26,6 +27,118 @@
 #include <QDebug>
 
 #include <algorithm>
+#include <cmath>
+#include <tuple>
+
+/**
+ * Number of rows handled by one statement when inserting or removing a batch
+ * of tracks. It keeps the bound values below the SQLite limit of host parameters.
+ */
+static const int BatchChunkSize = 200;
+
+/**
+ * Half-life in days of a play in the play score of a track.
+ */
+static const double PlayScoreHalfLife = 30.;
+
+/**
+ * Weight of a play in the play score of a track, in base 2 logarithm: it
+ * grows by one each PlayScoreHalfLife days.
+ */
+static double playScoreWeight(qint64 playDate)
+{
+    return static_cast<double>(playDate) / (PlayScoreHalfLife * 24. * 3600. * 1000.);
+}
+
+/**
+ * Add a play at playDate to the play score of a track, null when the track
+ * has never been played. The score is the base 2 logarithm of the sum of the
+ * weights of all plays. Comparing two scores gives the same order as comparing
+ * their exponentially decayed play counts at any later date, so that the
+ * scores can be indexed and never need to be recomputed.
+ */
+static double addPlayToScore(const QVariant &playScore, qint64 playDate)
+{
+    const auto newWeight = playScoreWeight(playDate);
+
+    if (playScore.isNull()) {
+        return newWeight;
+    }
+
+    const auto oldScore = playScore.toDouble();
+
+    return std::max(oldScore, newWeight) + std::log2(1. + std::exp2(-std::abs(oldScore - newWeight)));
+}
+
+/**
+ * Build the statement flagging the preferred copy of the tracks with the same
+ * identity as the row rowName, the new or old row of a trigger, or of all
+ * tracks when it is empty. The preferred copy has the lowest priority among
+ * the tracks with the same title and the same artist, album, album artist and
+ * album path when they are known. Only the tracks whose flag changes are
+ * written.
+ */
+static QString updatePreferredTracksText(const QString &rowName)
+{
+    auto result = QStringLiteral("UPDATE `Tracks` "
+                                 "SET `IsPreferred` = NOT `IsPreferred` "
+                                 "WHERE "
+                                 "`IsPreferred` IS NOT (`Priority` = ("
+                                 "     SELECT "
+                                 "     MIN(tracks2.`Priority`) "
+                                 "     FROM "
+                                 "     `Tracks` tracks2 "
+                                 "     WHERE "
+                                 "     `Tracks`.`Title` = tracks2.`Title` AND "
+                                 "     (`Tracks`.`ArtistName` IS NULL OR `Tracks`.`ArtistName` = tracks2.`ArtistName`) AND "
+                                 "     (`Tracks`.`AlbumTitle` IS NULL OR `Tracks`.`AlbumTitle` = tracks2.`AlbumTitle`) AND "
+                                 "     (`Tracks`.`AlbumArtistName` IS NULL OR `Tracks`.`AlbumArtistName` = tracks2.`AlbumArtistName`) AND "
+                                 "     (`Tracks`.`AlbumPath` IS NULL OR `Tracks`.`AlbumPath` = tracks2.`AlbumPath`)"
+                                 "))");
+
+    // the row is only part of the group of the tracks whose known identity matches its own
+    if (!rowName.isEmpty()) {
+        result += QStringLiteral(" AND "
+                                 "`Title` = %1.`Title` AND "
+                                 "(`ArtistName` IS NULL OR `ArtistName` = %1.`ArtistName`) AND "
+                                 "(`AlbumTitle` IS NULL OR `AlbumTitle` = %1.`AlbumTitle`) AND "
+                                 "(`AlbumArtistName` IS NULL OR `AlbumArtistName` = %1.`AlbumArtistName`) AND "
+                                 "(`AlbumPath` IS NULL OR `AlbumPath` = %1.`AlbumPath`)").arg(rowName);
+    }
+
+    return result;
+}
+
+/**
+ * Build the full-text query matching each word of searchText in the given
+ * column filter of the TracksSearch index. Words without any letter or digit
+ * are left out.
+ *
+ * With the trigram tokenizer, each word matches anywhere in a value, like the
+ * regular expression of the views. It cannot match words shorter than three
+ * characters and the text is then left to the views. With the older word
+ * tokenizer, each word only matches the start of a word of a value.
+ */
+static QString searchIndexMatchText(const QString &searchText, const QString &columnFilter, bool isTrigramIndex)
+{
+    auto allWords = QStringList{};
+
+    const auto words = searchText.simplified().split(QLatin1Char(' '), Qt::SkipEmptyParts);
+    for (auto oneWord : words) {
+        if (std::none_of(oneWord.cbegin(), oneWord.cend(), [](QChar oneCharacter) {return oneCharacter.isLetterOrNumber();})) {
+            continue;
+        }
+
+        if (isTrigramIndex && oneWord.size() < 3) {
+            return {};
+        }
+
+        oneWord.replace(QLatin1Char('"'), QStringLiteral("\"\""));
+        allWords.push_back(columnFilter + QStringLiteral("\"") + oneWord + (isTrigramIndex ? QStringLiteral("\"") : QStringLiteral("\"*")));
+    }
+
+    return allWords.join(QStringLiteral(" AND "));
+}
 
 class DatabaseInterfacePrivate
 {
@@ -43,8 +156,9 @@ public:
           mSelectAllAlbumsFromArtistQuery(mTracksDatabase), mSelectAllArtistsQuery(mTracksDatabase),
           mInsertArtistsQuery(mTracksDatabase), mSelectArtistByNameQuery(mTracksDatabase),
           mSelectArtistQuery(mTracksDatabase), mUpdateTrackStatistics(mTracksDatabase),
-          mRemoveTrackQuery(mTracksDatabase), mRemoveAlbumQuery(mTracksDatabase),
+          mRemoveAlbumQuery(mTracksDatabase),
           mRemoveArtistQuery(mTracksDatabase), mSelectAllTracksQuery(mTracksDatabase),
+          mSelectTracksCountQuery(mTracksDatabase),
           mSelectAllRadiosQuery(mTracksDatabase),
           mInsertTrackMapping(mTracksDatabase), mUpdateTrackFirstPlayStatistics(mTracksDatabase),
           mInsertMusicSource(mTracksDatabase), mSelectMusicSource(mTracksDatabase),
@@ -53,7 +167,7 @@ public:
           mSelectRadioIdFromHttpAddress(mTracksDatabase),
           mUpdateAlbumArtUriFromAlbumIdQuery(mTracksDatabase), mSelectTracksMappingPriorityByTrackId(mTracksDatabase),
           mSelectAlbumIdsFromArtist(mTracksDatabase), mSelectAllTrackFilesQuery(mTracksDatabase),
-          mRemoveTracksMappingFromSource(mTracksDatabase), mRemoveTracksMapping(mTracksDatabase),
+          mRemoveTracksMappingFromSource(mTracksDatabase), mSelectArtistIsUsedQuery(mTracksDatabase),
           mSelectTracksWithoutMappingQuery(mTracksDatabase), mSelectAlbumIdFromTitleAndArtistQuery(mTracksDatabase),
           mSelectAlbumIdFromTitleWithoutArtistQuery(mTracksDatabase),
           mSelectTrackIdFromTitleAlbumTrackDiscNumberQuery(mTracksDatabase), mSelectAlbumArtUriFromAlbumIdQuery(mTracksDatabase),
@@ -74,13 +188,20 @@ public:
           mQueryMaximumGenreIdQuery(mTracksDatabase), mSelectAllArtistsWithGenreFilterQuery(mTracksDatabase),
           mSelectAllAlbumsShortWithGenreArtistFilterQuery(mTracksDatabase), mSelectAllAlbumsShortWithArtistFilterQuery(mTracksDatabase),
           mSelectAllRecentlyPlayedTracksQuery(mTracksDatabase), mSelectAllFrequentlyPlayedTracksQuery(mTracksDatabase),
+          mSelectFrequentlyPlayedArtistTracksQuery(mTracksDatabase), mSelectFrequentlyPlayedAlbumTracksQuery(mTracksDatabase),
+          mSelectFrequentlyPlayedGenreTracksQuery(mTracksDatabase),
+          mSelectTrackPlayScoreQuery(mTracksDatabase),
           mClearTracksDataTable(mTracksDatabase), mClearTracksTable(mTracksDatabase),
           mClearAlbumsTable(mTracksDatabase), mClearArtistsTable(mTracksDatabase),
           mClearComposerTable(mTracksDatabase), mClearGenreTable(mTracksDatabase), mClearLyricistTable(mTracksDatabase),
           mArtistMatchGenreQuery(mTracksDatabase), mSelectTrackIdQuery(mTracksDatabase),
           mInsertRadioQuery(mTracksDatabase), mDeleteRadioQuery(mTracksDatabase),
           mSelectTrackFromIdAndUrlQuery(mTracksDatabase),
-          mUpdateDatabaseVersionQuery(mTracksDatabase), mSelectDatabaseVersionQuery(mTracksDatabase)
+          mSelectAllDirectoriesFingerprintsQuery(mTracksDatabase), mInsertDirectoryFingerprintQuery(mTracksDatabase),
+          mRemoveDirectoryFingerprintQuery(mTracksDatabase), mClearScannedDirectoriesTable(mTracksDatabase),
+          mUpdateDatabaseVersionQuery(mTracksDatabase), mSelectDatabaseVersionQuery(mTracksDatabase),
+          mSearchTracksQuery(mTracksDatabase), mSearchAlbumsQuery(mTracksDatabase),
+          mSearchArtistsQuery(mTracksDatabase), mSearchGenresQuery(mTracksDatabase)
     {
     }
 
@@ -122,14 +243,26 @@ public:
 
     QSqlQuery mUpdateTrackStatistics;
 
-    QSqlQuery mRemoveTrackQuery;
-
     QSqlQuery mRemoveAlbumQuery;
 
     QSqlQuery mRemoveArtistQuery;
 
     QSqlQuery mSelectAllTracksQuery;
 
+    QSqlQuery mSelectTracksCountQuery;
+
+    /**
+     * Queries reading the pages of tracks, keyed by their text. There is one
+     * for each sort role and order read by the views.
+     */
+    QHash<QString, QSqlQuery> mSelectTracksPageQueries;
+
+    /**
+     * Columns and joined tables read by the queries of all the tracks, the
+     * queries of the pages add their own condition and order.
+     */
+    QString mSelectAllTracksColumnsText;
+
     QSqlQuery mSelectAllRadiosQuery;
 
     QSqlQuery mInsertTrackMapping;
@@ -160,7 +293,7 @@ public:
 
     QSqlQuery mRemoveTracksMappingFromSource;
 
-    QSqlQuery mRemoveTracksMapping;
+    QSqlQuery mSelectArtistIsUsedQuery;
 
     QSqlQuery mSelectTracksWithoutMappingQuery;
 
@@ -238,6 +371,14 @@ public:
 
     QSqlQuery mSelectAllFrequentlyPlayedTracksQuery;
 
+    QSqlQuery mSelectFrequentlyPlayedArtistTracksQuery;
+
+    QSqlQuery mSelectFrequentlyPlayedAlbumTracksQuery;
+
+    QSqlQuery mSelectFrequentlyPlayedGenreTracksQuery;
+
+    QSqlQuery mSelectTrackPlayScoreQuery;
+
     QSqlQuery mClearTracksDataTable;
 
     QSqlQuery mClearTracksTable;
@@ -262,10 +403,26 @@ public:
 
     QSqlQuery mSelectTrackFromIdAndUrlQuery;
 
+    QSqlQuery mSelectAllDirectoriesFingerprintsQuery;
+
+    QSqlQuery mInsertDirectoryFingerprintQuery;
+
+    QSqlQuery mRemoveDirectoryFingerprintQuery;
+
+    QSqlQuery mClearScannedDirectoriesTable;
+
     QSqlQuery mUpdateDatabaseVersionQuery;
 
     QSqlQuery mSelectDatabaseVersionQuery;
 
+    QSqlQuery mSearchTracksQuery;
+
+    QSqlQuery mSearchAlbumsQuery;
+
+    QSqlQuery mSearchArtistsQuery;
+
+    QSqlQuery mSearchGenresQuery;
+
     QSet<qulonglong> mModifiedTrackIds;
 
     QSet<qulonglong> mModifiedAlbumIds;
@@ -278,6 +435,71 @@ public:
 
     QSet<QPair<qulonglong, QString>> mInsertedArtists;
 
+    QHash<QString, qulonglong> mBatchArtistIds;
+
+    QHash<QString, qulonglong> mBatchGenreIds;
+
+    QHash<QString, qulonglong> mBatchComposerIds;
+
+    QHash<QString, qulonglong> mBatchLyricistIds;
+
+    QHash<QString, qulonglong> mBatchTracksMapping;
+
+    /**
+     * Files whose origin was inserted by the current batch, with an up to date modification time.
+     */
+    QSet<QString> mBatchNewFileNames;
+
+    /**
+     * Fields compared by the duplicate check of a new track to give it a priority.
+     */
+    struct BatchTrackIdentity
+    {
+        int mPriority = 1;
+        QVariant mArtist;
+        QVariant mAlbum;
+        QVariant mAlbumArtist;
+        QVariant mAlbumPath;
+        QVariant mTrackNumber;
+        QVariant mDiscNumber;
+    };
+
+    /**
+     * Tracks sharing a title with the new tracks of a batch, including the ones inserted by the batch.
+     */
+    QMultiHash<QString, BatchTrackIdentity> mBatchTracksByTitle;
+
+    /**
+     * New track of a batch waiting for the next multi-row insertion.
+     */
+    struct BatchPendingTrack
+    {
+        DataTypes::TrackDataType mTrack;
+        QVariantList mValues;
+        QString mTrackPath;
+        qulonglong mTrackId = 0;
+        qulonglong mAlbumId = 0;
+    };
+
+    QVector<BatchPendingTrack> mBatchPendingTracks;
+
+    /**
+     * Albums found or inserted during a batch, by title, album artist and path,
+     * so that the other tracks of an album do not look for it again.
+     */
+    QHash<QStringList, qulonglong> mBatchAlbumIds;
+
+    QVector<std::function<void()>> mPendingNotifications;
+
+    /**
+     * Columns and joins read by buildTrackDataFromDatabaseRecord, to be completed by a WHERE clause.
+     */
+    QString mSelectFullTracksText;
+
+    bool mIsInTransaction = false;
+
+    bool mIsBatchInsertion = false;
+
     qulonglong mAlbumId = 1;
 
     qulonglong mArtistId = 1;
@@ -296,6 +518,10 @@ public:
 
     bool mIsInBadState = false;
 
+    bool mHasSearchIndex = false;
+
+    bool mSearchIndexIsTrigram = false;
+
 };
 
 DatabaseInterface::DatabaseInterface(QObject *parent) : QObject(parent), d(nullptr)
@@ -315,10 +541,11 @@ void DatabaseInterface::init(const QString &dbName, const QString &databaseFileN
 
     if (!databaseFileName.isEmpty()) {
         tracksDatabase.setDatabaseName(QStringLiteral("file:") + databaseFileName);
+        tracksDatabase.setConnectOptions(QStringLiteral("foreign_keys = ON;QSQLITE_OPEN_URI;QSQLITE_BUSY_TIMEOUT=500000"));
     } else {
         tracksDatabase.setDatabaseName(QStringLiteral("file:memdb1?mode=memory"));
+        tracksDatabase.setConnectOptions(QStringLiteral("foreign_keys = ON;locking_mode = EXCLUSIVE;QSQLITE_OPEN_URI;QSQLITE_BUSY_TIMEOUT=500000"));
     }
-    tracksDatabase.setConnectOptions(QStringLiteral("foreign_keys = ON;locking_mode = EXCLUSIVE;QSQLITE_OPEN_URI;QSQLITE_BUSY_TIMEOUT=500000"));
 
     auto result = tracksDatabase.open();
     if (result) {
@@ -330,6 +557,12 @@ void DatabaseInterface::init(const QString &dbName, const QString &databaseFileN
 
     tracksDatabase.exec(QStringLiteral("PRAGMA foreign_keys = ON;"));
 
+    if (!databaseFileName.isEmpty()) {
+        // readers opened with initReadOnly() do not wait for the commits of this connection
+        tracksDatabase.exec(QStringLiteral("PRAGMA journal_mode = WAL;"));
+        tracksDatabase.exec(QStringLiteral("PRAGMA synchronous = NORMAL;"));
+    }
+
     d = std::make_unique<DatabaseInterfacePrivate>(tracksDatabase);
 
     initDatabase();
@@ -340,6 +573,25 @@ void DatabaseInterface::init(const QString &dbName, const QString &databaseFileN
     }
 }
 
+void DatabaseInterface::initReadOnly(const QString &dbName, const QString &databaseFileName)
+{
+    QSqlDatabase tracksDatabase = QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), dbName);
+
+    tracksDatabase.setDatabaseName(QStringLiteral("file:") + databaseFileName);
+    tracksDatabase.setConnectOptions(QStringLiteral("QSQLITE_OPEN_READONLY;QSQLITE_OPEN_URI;QSQLITE_BUSY_TIMEOUT=500000"));
+
+    auto result = tracksDatabase.open();
+    if (result) {
+        qCDebug(orgKdeElisaDatabase) << "read only database open" << dbName;
+    } else {
+        qCDebug(orgKdeElisaDatabase) << "read only database not open" << dbName;
+    }
+
+    d = std::make_unique<DatabaseInterfacePrivate>(tracksDatabase);
+
+    initRequest();
+}
+
 qulonglong DatabaseInterface::albumIdFromTitleAndArtist(const QString &title, const QString &artist, const QString &albumPath)
 {
     auto result = qulonglong{0};
@@ -359,9 +611,9 @@ qulonglong DatabaseInterface::albumIdFromTitleAndArtist(const QString &title, co
     return result;
 }
 
-DataTypes::ListTrackDataType DatabaseInterface::allTracksData()
+DataTypes::ListTrackRecord DatabaseInterface::allTracksData()
 {
-    auto result = DataTypes::ListTrackDataType{};
+    auto result = DataTypes::ListTrackRecord{};
 
     if (!d) {
         return result;
@@ -382,6 +634,265 @@ DataTypes::ListTrackDataType DatabaseInterface::allTracksData()
     return result;
 }
 
+/**
+ * Expression ordering the pages of tracks for a sort role. The text values
+ * are compared without case and the missing ones sort first.
+ */
+static QString trackSortKeyText(int sortRole)
+{
+    switch (sortRole)
+    {
+    case DataTypes::AlbumRole:
+        return QStringLiteral("IFNULL(tracks.`AlbumTitle`, '') COLLATE NOCASE");
+    case DataTypes::ArtistRole:
+        return QStringLiteral("IFNULL(tracks.`ArtistName`, '') COLLATE NOCASE");
+    case DataTypes::GenreRole:
+        return QStringLiteral("IFNULL(tracks.`Genre`, '') COLLATE NOCASE");
+    case DataTypes::ComposerRole:
+        return QStringLiteral("IFNULL(tracks.`Composer`, '') COLLATE NOCASE");
+    case DataTypes::LyricistRole:
+        return QStringLiteral("IFNULL(tracks.`Lyricist`, '') COLLATE NOCASE");
+    case DataTypes::YearRole:
+        return QStringLiteral("IFNULL(tracks.`Year`, 0)");
+    case DataTypes::DurationRole:
+        return QStringLiteral("tracks.`Duration`");
+    default:
+        return QStringLiteral("tracks.`Title` COLLATE NOCASE");
+    }
+}
+
+QVariant DatabaseInterface::trackSortKey(const DataTypes::TrackRecord &track, int sortRole)
+{
+    switch (sortRole)
+    {
+    case DataTypes::AlbumRole:
+        return track.album();
+    case DataTypes::ArtistRole:
+        return track.artist();
+    case DataTypes::GenreRole:
+        return track.genre();
+    case DataTypes::ComposerRole:
+        return track.composer();
+    case DataTypes::LyricistRole:
+        return track.lyricist();
+    case DataTypes::YearRole:
+        return track.year();
+    case DataTypes::DurationRole:
+        return track.duration().msecsSinceStartOfDay();
+    default:
+        return track.title();
+    }
+}
+
+QSqlQuery *DatabaseInterface::tracksPageQuery(int sortRole, Qt::SortOrder sortOrder, bool isAfterSortKey)
+{
+    const auto sortKeyText = trackSortKeyText(sortRole);
+    const auto sortOrderText = (sortOrder == Qt::AscendingOrder ? QStringLiteral("ASC") : QStringLiteral("DESC"));
+
+    auto selectTracksPageText = d->mSelectAllTracksColumnsText + QStringLiteral("WHERE "
+                                                                                "tracks.`IsPreferred` = 1 ");
+
+    // the page continues after the last track of the previous one without counting the rows before it
+    if (isAfterSortKey) {
+        selectTracksPageText += QStringLiteral("AND (") + sortKeyText + QStringLiteral(", tracks.`ID`) ") +
+                (sortOrder == Qt::AscendingOrder ? QStringLiteral(">") : QStringLiteral("<")) +
+                QStringLiteral(" (:afterSortKey, :afterDatabaseId) ");
+    }
+
+    selectTracksPageText += QStringLiteral("ORDER BY ") + sortKeyText + QStringLiteral(" ") + sortOrderText +
+            QStringLiteral(", tracks.`ID` ") + sortOrderText + QStringLiteral(" "
+                                                                               "LIMIT :maximumResults OFFSET :offset");
+
+    auto itQuery = d->mSelectTracksPageQueries.find(selectTracksPageText);
+    if (itQuery != d->mSelectTracksPageQueries.end()) {
+        return &itQuery.value();
+    }
+
+    auto selectTracksPageQuery = QSqlQuery{d->mTracksDatabase};
+
+    if (!prepareQuery(selectTracksPageQuery, selectTracksPageText)) {
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::tracksPageQuery" << selectTracksPageQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::tracksPageQuery" << selectTracksPageQuery.lastError();
+
+        Q_EMIT databaseError();
+
+        return nullptr;
+    }
+
+    return &d->mSelectTracksPageQueries.insert(selectTracksPageText, selectTracksPageQuery).value();
+}
+
+DataTypes::ListTrackRecord DatabaseInterface::tracksDataPage(int sortRole, Qt::SortOrder sortOrder,
+                                                             const QVariant &afterSortKey, qulonglong afterDatabaseId,
+                                                             int offset, int count)
+{
+    auto result = DataTypes::ListTrackRecord{};
+
+    if (!d) {
+        return result;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    const auto isAfterSortKey = (afterDatabaseId != 0);
+    auto selectTracksPageQuery = tracksPageQuery(sortRole, sortOrder, isAfterSortKey);
+
+    if (!selectTracksPageQuery) {
+        finishTransaction();
+
+        return result;
+    }
+
+    if (isAfterSortKey) {
+        selectTracksPageQuery->bindValue(QStringLiteral(":afterSortKey"), afterSortKey);
+        selectTracksPageQuery->bindValue(QStringLiteral(":afterDatabaseId"), afterDatabaseId);
+        selectTracksPageQuery->bindValue(QStringLiteral(":offset"), 0);
+    } else {
+        selectTracksPageQuery->bindValue(QStringLiteral(":offset"), offset);
+    }
+    selectTracksPageQuery->bindValue(QStringLiteral(":maximumResults"), count);
+
+    auto queryResult = execQuery(*selectTracksPageQuery);
+
+    if (!queryResult || !selectTracksPageQuery->isSelect() || !selectTracksPageQuery->isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::tracksDataPage" << selectTracksPageQuery->lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::tracksDataPage" << selectTracksPageQuery->boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::tracksDataPage" << selectTracksPageQuery->lastError();
+
+        selectTracksPageQuery->finish();
+
+        finishTransaction();
+
+        return result;
+    }
+
+    if (count > 0) {
+        result.reserve(count);
+    }
+    while(selectTracksPageQuery->next()) {
+        const auto &currentRecord = selectTracksPageQuery->record();
+
+        result.push_back(buildTrackRecordFromDatabaseRecord(currentRecord));
+    }
+
+    selectTracksPageQuery->finish();
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    return result;
+}
+
+int DatabaseInterface::tracksCount()
+{
+    auto result = 0;
+
+    if (!d) {
+        return result;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    auto queryResult = execQuery(d->mSelectTracksCountQuery);
+
+    if (!queryResult || !d->mSelectTracksCountQuery.isSelect() || !d->mSelectTracksCountQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::tracksCount" << d->mSelectTracksCountQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::tracksCount" << d->mSelectTracksCountQuery.lastError();
+
+        d->mSelectTracksCountQuery.finish();
+
+        finishTransaction();
+
+        return result;
+    }
+
+    if (d->mSelectTracksCountQuery.next()) {
+        result = d->mSelectTracksCountQuery.record().value(0).toInt();
+    }
+
+    d->mSelectTracksCountQuery.finish();
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    return result;
+}
+
+QHash<QString, QStringList> DatabaseInterface::readQueriesPlans()
+{
+    auto result = QHash<QString, QStringList>{};
+
+    if (!d) {
+        return result;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    const auto plannedQueries = QList<std::tuple<QString, const QSqlQuery*, QVariantMap>>{
+            {QStringLiteral("tracksDataPage"), tracksPageQuery(DataTypes::TitleRole, Qt::AscendingOrder, true),
+             {{QStringLiteral(":afterSortKey"), QString{}}, {QStringLiteral(":afterDatabaseId"), 0},
+              {QStringLiteral(":maximumResults"), 1}, {QStringLiteral(":offset"), 0}}},
+            {QStringLiteral("tracksCount"), &d->mSelectTracksCountQuery, {}},
+            {QStringLiteral("frequentlyPlayedTracksData"), &d->mSelectAllFrequentlyPlayedTracksQuery,
+             {{QStringLiteral(":maximumResults"), 1}}},
+    };
+
+    for (const auto &[queryName, oneQuery, boundValues] : plannedQueries) {
+        if (!oneQuery) {
+            continue;
+        }
+
+        QSqlQuery planQuery(d->mTracksDatabase);
+
+        if (!planQuery.prepare(QStringLiteral("EXPLAIN QUERY PLAN ") + oneQuery->lastQuery())) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::readQueriesPlans" << planQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::readQueriesPlans" << planQuery.lastError();
+
+            continue;
+        }
+
+        for (auto itValue = boundValues.cbegin(); itValue != boundValues.cend(); ++itValue) {
+            planQuery.bindValue(itValue.key(), itValue.value());
+        }
+
+        if (!planQuery.exec()) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::readQueriesPlans" << planQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::readQueriesPlans" << planQuery.lastError();
+
+            continue;
+        }
+
+        auto &queryPlan = result[queryName];
+        while (planQuery.next()) {
+            queryPlan.push_back(planQuery.value(3).toString());
+        }
+    }
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    return result;
+}
+
 DataTypes::ListRadioDataType DatabaseInterface::allRadiosData()
 {
     auto result = DataTypes::ListRadioDataType{};
@@ -405,9 +916,9 @@ DataTypes::ListRadioDataType DatabaseInterface::allRadiosData()
     return result;
 }
 
-DataTypes::ListTrackDataType DatabaseInterface::recentlyPlayedTracksData(int count)
+DataTypes::ListTrackRecord DatabaseInterface::recentlyPlayedTracksData(int count)
 {
-    auto result = DataTypes::ListTrackDataType{};
+    auto result = DataTypes::ListTrackRecord{};
 
     if (!d) {
         return result;
@@ -428,9 +939,9 @@ DataTypes::ListTrackDataType DatabaseInterface::recentlyPlayedTracksData(int cou
     return result;
 }
 
-DataTypes::ListTrackDataType DatabaseInterface::frequentlyPlayedTracksData(int count)
+DataTypes::ListTrackRecord DatabaseInterface::frequentlyPlayedTracksData(int count)
 {
-    auto result = DataTypes::ListTrackDataType{};
+    auto result = DataTypes::ListTrackRecord{};
 
     if (!d) {
         return result;
@@ -451,6 +962,52 @@ DataTypes::ListTrackDataType DatabaseInterface::frequentlyPlayedTracksData(int c
     return result;
 }
 
+DataTypes::ListTrackRecord DatabaseInterface::frequentlyPlayedTracksData(ElisaUtils::PlayListEntryType filterType, const QVariant &filter, int count)
+{
+    auto result = DataTypes::ListTrackRecord{};
+
+    if (!d) {
+        return result;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    result = internalFrequentlyPlayedTracksData(filterType, filter, count);
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    return result;
+}
+
+std::optional<QVector<qulonglong>> DatabaseInterface::searchData(ElisaUtils::PlayListEntryType dataType, const QString &searchText)
+{
+    auto result = std::optional<QVector<qulonglong>>{};
+
+    if (!d || !d->mHasSearchIndex) {
+        return result;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    result = internalSearchData(dataType, searchText);
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    return result;
+}
+
 DataTypes::ListAlbumDataType DatabaseInterface::allAlbumsData()
 {
     auto result = DataTypes::ListAlbumDataType{};
@@ -873,9 +1430,77 @@ qulonglong DatabaseInterface::trackIdFromTitleAlbumTrackDiscNumber(const QString
     return result;
 }
 
-qulonglong DatabaseInterface::trackIdFromFileName(const QUrl &fileName)
+DataTypes::ListTrackDataType DatabaseInterface::tracksDataFromTitleAlbumTrackDiscNumber(const DataTypes::ListTrackDataType &tracks)
 {
-    auto result = qulonglong(0);
+    auto result = DataTypes::ListTrackDataType{};
+
+    if (!d) {
+        return result;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    auto allTitles = QStringList{};
+    auto knownTitles = QSet<QString>{};
+    for (const auto &oneTrack : tracks) {
+        if (!knownTitles.contains(oneTrack.title())) {
+            knownTitles.insert(oneTrack.title());
+            allTitles.push_back(oneTrack.title());
+        }
+    }
+
+    auto candidateTracks = QMultiHash<QString, DataTypes::TrackDataType>{};
+    if (!batchSelectTracksFromTitles(allTitles, candidateTracks)) {
+        finishTransaction();
+
+        return result;
+    }
+
+    result.reserve(tracks.size());
+    for (const auto &oneTrack : tracks) {
+        auto trackData = DataTypes::TrackDataType{};
+
+        for (auto itCandidate = candidateTracks.constFind(oneTrack.title());
+             itCandidate != candidateTracks.cend() && itCandidate.key() == oneTrack.title(); ++itCandidate) {
+            const auto &oneCandidate = itCandidate.value();
+
+            if (!oneCandidate.hasArtist() || oneCandidate.artist() != oneTrack.artist()) {
+                continue;
+            }
+
+            if (oneCandidate.hasAlbum() != oneTrack.hasAlbum() || oneCandidate.album() != oneTrack.album()) {
+                continue;
+            }
+
+            if (oneCandidate.hasTrackNumber() != oneTrack.hasTrackNumber() || oneCandidate.trackNumber() != oneTrack.trackNumber()) {
+                continue;
+            }
+
+            if (oneCandidate.hasDiscNumber() != oneTrack.hasDiscNumber() || oneCandidate.discNumber() != oneTrack.discNumber()) {
+                continue;
+            }
+
+            trackData = oneCandidate;
+            break;
+        }
+
+        result.push_back(trackData);
+    }
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    return result;
+}
+
+qulonglong DatabaseInterface::trackIdFromFileName(const QUrl &fileName)
+{
+    auto result = qulonglong(0);
 
     if (!d) {
         return result;
@@ -931,6 +1556,10 @@ void DatabaseInterface::askRestoredTracks()
         return;
     }
 
+    auto allDirectories = internalAllDirectoriesFingerprints();
+
+    Q_EMIT restoredDirectoriesFingerprints(allDirectories);
+
     auto result = internalAllFileName();
 
     Q_EMIT restoredTracks(result);
@@ -950,14 +1579,19 @@ void DatabaseInterface::trackHasStartedPlaying(const QUrl &fileName, const QDate
 
     updateTrackStatistics(fileName, time);
     auto trackId = internalTrackIdFromFileName(fileName);
+    auto modifiedTrack = DataTypes::TrackDataType{};
     if (trackId != 0) {
-        Q_EMIT trackModified(internalOneTrackPartialData(trackId));
+        modifiedTrack = internalOneTrackPartialData(trackId);
     }
 
     transactionResult = finishTransaction();
     if (!transactionResult) {
         return;
     }
+
+    if (trackId != 0) {
+        Q_EMIT trackModified(modifiedTrack);
+    }
 }
 
 void DatabaseInterface::clearData()
@@ -1051,6 +1685,18 @@ void DatabaseInterface::clearData()
 
     d->mClearArtistsTable.finish();
 
+    queryResult = execQuery(d->mClearScannedDirectoriesTable);
+
+    if (!queryResult || !d->mClearScannedDirectoriesTable.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearScannedDirectoriesTable.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearScannedDirectoriesTable.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearScannedDirectoriesTable.lastError();
+    }
+
+    d->mClearScannedDirectoriesTable.finish();
+
     transactionResult = finishTransaction();
     if (!transactionResult) {
         return;
@@ -1082,6 +1728,11 @@ void DatabaseInterface::recordModifiedAlbum(qulonglong albumId)
 void DatabaseInterface::insertTracksList(const DataTypes::ListTrackDataType &tracks, const QHash<QString, QUrl> &covers)
 {
     qCDebug(orgKdeElisaDatabase()) << "DatabaseInterface::insertTracksList" << tracks.count();
+
+    auto insertTimer = PerformanceCounters::ScopedTimer{PerformanceCounters::InsertTracksListNanoseconds};
+    PerformanceCounters::add(PerformanceCounters::InsertTracksListCalls, 1);
+    PerformanceCounters::add(PerformanceCounters::InsertedTracks, tracks.count());
+
     if (d->mStopRequest == 1) {
         Q_EMIT finishInsertingTracksList();
         return;
@@ -1095,6 +1746,8 @@ void DatabaseInterface::insertTracksList(const DataTypes::ListTrackDataType &tra
 
     initChangesTrackers();
 
+    prepareBatchInsertion(tracks);
+
     for(const auto &oneTrack : tracks) {
         switch (oneTrack.elementType())
         {
@@ -1123,6 +1776,8 @@ void DatabaseInterface::insertTracksList(const DataTypes::ListTrackDataType &tra
         }
 
         if (d->mStopRequest == 1) {
+            batchInsertPendingTracks(covers);
+            clearBatchInsertion();
             transactionResult = finishTransaction();
             if (!transactionResult) {
                 Q_EMIT finishInsertingTracksList();
@@ -1133,26 +1788,50 @@ void DatabaseInterface::insertTracksList(const DataTypes::ListTrackDataType &tra
         }
     }
 
-    if (!d->mInsertedArtists.isEmpty()) {
-        DataTypes::ListArtistDataType newArtists;
+    batchInsertPendingTracks(covers);
+    clearBatchInsertion();
 
-        for (auto newArtistData : qAsConst(d->mInsertedArtists)) {
-            newArtists.push_back({{DataTypes::DatabaseIdRole, newArtistData.first},
-                                  {DataTypes::TitleRole, newArtistData.second},
-                                  {DataTypes::ElementTypeRole, ElisaUtils::Artist}});
-        }
-        qCInfo(orgKdeElisaDatabase) << "artistsAdded" << newArtists.size();
-        Q_EMIT artistsAdded(newArtists);
+    DataTypes::ListArtistDataType newArtists;
+
+    for (auto newArtistData : qAsConst(d->mInsertedArtists)) {
+        newArtists.push_back({{DataTypes::DatabaseIdRole, newArtistData.first},
+                              {DataTypes::TitleRole, newArtistData.second},
+                              {DataTypes::ElementTypeRole, ElisaUtils::Artist}});
     }
 
-    if (!d->mInsertedAlbums.isEmpty()) {
-        DataTypes::ListAlbumDataType newAlbums;
+    DataTypes::ListAlbumDataType newAlbums;
 
-        for (auto albumId : qAsConst(d->mInsertedAlbums)) {
-            d->mModifiedAlbumIds.remove(albumId);
-            newAlbums.push_back(internalOneAlbumPartialData(albumId));
-        }
+    for (auto albumId : qAsConst(d->mInsertedAlbums)) {
+        d->mModifiedAlbumIds.remove(albumId);
+        newAlbums.push_back(internalOneAlbumPartialData(albumId));
+    }
+
+    DataTypes::ListTrackRecord newTracks;
+
+    for (auto trackId : qAsConst(d->mInsertedTracks)) {
+        newTracks.push_back(internalOneTrackRecord(trackId));
+        d->mModifiedTrackIds.remove(trackId);
+    }
+
+    DataTypes::ListTrackDataType modifiedTracks;
+
+    for (auto trackId : qAsConst(d->mModifiedTrackIds)) {
+        modifiedTracks.push_back(internalOneTrackPartialData(trackId));
+    }
+
+    // views read the database through their own connections: changes are only notified once they are committed
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        Q_EMIT finishInsertingTracksList();
+        return;
+    }
 
+    if (!newArtists.isEmpty()) {
+        qCInfo(orgKdeElisaDatabase) << "artistsAdded" << newArtists.size();
+        Q_EMIT artistsAdded(newArtists);
+    }
+
+    if (!newAlbums.isEmpty()) {
         qCInfo(orgKdeElisaDatabase) << "albumsAdded" << newAlbums.size();
         Q_EMIT albumsAdded(newAlbums);
     }
@@ -1161,27 +1840,15 @@ void DatabaseInterface::insertTracksList(const DataTypes::ListTrackDataType &tra
         Q_EMIT albumModified({{DataTypes::DatabaseIdRole, albumId}}, albumId);
     }
 
-    if (!d->mInsertedTracks.isEmpty()) {
-        DataTypes::ListTrackDataType newTracks;
-
-        for (auto trackId : qAsConst(d->mInsertedTracks)) {
-            newTracks.push_back(internalOneTrackPartialData(trackId));
-            d->mModifiedTrackIds.remove(trackId);
-        }
-
+    if (!newTracks.isEmpty()) {
         qCInfo(orgKdeElisaDatabase) << "tracksAdded" << newTracks.size();
         Q_EMIT tracksAdded(newTracks);
     }
 
-    for (auto trackId : qAsConst(d->mModifiedTrackIds)) {
-        Q_EMIT trackModified(internalOneTrackPartialData(trackId));
+    for (const auto &oneModifiedTrack : qAsConst(modifiedTracks)) {
+        Q_EMIT trackModified(oneModifiedTrack);
     }
 
-    transactionResult = finishTransaction();
-    if (!transactionResult) {
-        Q_EMIT finishInsertingTracksList();
-        return;
-    }
     Q_EMIT finishInsertingTracksList();
 }
 
@@ -1197,14 +1864,11 @@ void DatabaseInterface::removeTracksList(const QList<QUrl> &removedTracks)
 
     internalRemoveTracksList(removedTracks);
 
-    if (!d->mInsertedArtists.isEmpty()) {
-        DataTypes::ListArtistDataType newArtists;
-        for (auto newArtistData : qAsConst(d->mInsertedArtists)) {
-            newArtists.push_back({{DataTypes::DatabaseIdRole, newArtistData.first},
-                                  {DataTypes::TitleRole, newArtistData.second},
-                                  {DataTypes::ElementTypeRole, ElisaUtils::Artist}});
-        }
-        Q_EMIT artistsAdded(newArtists);
+    DataTypes::ListArtistDataType newArtists;
+    for (auto newArtistData : qAsConst(d->mInsertedArtists)) {
+        newArtists.push_back({{DataTypes::DatabaseIdRole, newArtistData.first},
+                              {DataTypes::TitleRole, newArtistData.second},
+                              {DataTypes::ElementTypeRole, ElisaUtils::Artist}});
     }
 
     transactionResult = finishTransaction();
@@ -1213,9 +1877,98 @@ void DatabaseInterface::removeTracksList(const QList<QUrl> &removedTracks)
         return;
     }
 
+    if (!newArtists.isEmpty()) {
+        Q_EMIT artistsAdded(newArtists);
+    }
+
     Q_EMIT finishRemovingTracksList();
 }
 
+void DatabaseInterface::updateDirectoriesFingerprints(const DataTypes::DirectoryFingerprints &scannedDirectories)
+{
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    for (auto itDirectory = scannedDirectories.begin(); itDirectory != scannedDirectories.end(); ++itDirectory) {
+        d->mInsertDirectoryFingerprintQuery.bindValue(QStringLiteral(":directoryPath"), itDirectory.key());
+        d->mInsertDirectoryFingerprintQuery.bindValue(QStringLiteral(":parentPath"), itDirectory->mParentDirectory);
+        d->mInsertDirectoryFingerprintQuery.bindValue(QStringLiteral(":modificationTime"), itDirectory->mModificationTime);
+        d->mInsertDirectoryFingerprintQuery.bindValue(QStringLiteral(":entriesCount"), itDirectory->mEntriesCount);
+
+        auto queryResult = execQuery(d->mInsertDirectoryFingerprintQuery);
+
+        if (!queryResult || !d->mInsertDirectoryFingerprintQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::updateDirectoriesFingerprints" << d->mInsertDirectoryFingerprintQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::updateDirectoriesFingerprints" << d->mInsertDirectoryFingerprintQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::updateDirectoriesFingerprints" << d->mInsertDirectoryFingerprintQuery.lastError();
+        }
+
+        d->mInsertDirectoryFingerprintQuery.finish();
+    }
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return;
+    }
+}
+
+void DatabaseInterface::removeDirectoriesFingerprints(const QList<QUrl> &removedDirectories)
+{
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    for (const auto &oneDirectory : removedDirectories) {
+        d->mRemoveDirectoryFingerprintQuery.bindValue(QStringLiteral(":directoryPath"), oneDirectory);
+
+        auto queryResult = execQuery(d->mRemoveDirectoryFingerprintQuery);
+
+        if (!queryResult || !d->mRemoveDirectoryFingerprintQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeDirectoriesFingerprints" << d->mRemoveDirectoryFingerprintQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeDirectoriesFingerprints" << d->mRemoveDirectoryFingerprintQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeDirectoriesFingerprints" << d->mRemoveDirectoryFingerprintQuery.lastError();
+        }
+
+        d->mRemoveDirectoryFingerprintQuery.finish();
+    }
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return;
+    }
+}
+
+void DatabaseInterface::removeAllDirectoriesFingerprints()
+{
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    auto queryResult = execQuery(d->mClearScannedDirectoriesTable);
+
+    if (!queryResult || !d->mClearScannedDirectoriesTable.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeAllDirectoriesFingerprints" << d->mClearScannedDirectoriesTable.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeAllDirectoriesFingerprints" << d->mClearScannedDirectoriesTable.lastError();
+    }
+
+    d->mClearScannedDirectoriesTable.finish();
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return;
+    }
+}
+
 bool DatabaseInterface::startTransaction()
 {
     auto result = false;
@@ -1227,6 +1980,8 @@ bool DatabaseInterface::startTransaction()
         return result;
     }
 
+    d->mIsInTransaction = true;
+
     result = true;
 
     return result;
@@ -1238,12 +1993,19 @@ bool DatabaseInterface::finishTransaction()
 
     auto transactionResult = d->mTracksDatabase.commit();
 
+    d->mIsInTransaction = false;
+    const auto pendingNotifications = std::exchange(d->mPendingNotifications, {});
+
     if (!transactionResult) {
         qCDebug(orgKdeElisaDatabase) << "commit failed" << d->mTracksDatabase.lastError() << d->mTracksDatabase.lastError().nativeErrorCode();
 
         return result;
     }
 
+    for (const auto &oneNotification : pendingNotifications) {
+        oneNotification();
+    }
+
     result = true;
 
     return result;
@@ -1255,6 +2017,9 @@ bool DatabaseInterface::rollBackTransaction()
 
     auto transactionResult = d->mTracksDatabase.rollback();
 
+    d->mIsInTransaction = false;
+    d->mPendingNotifications.clear();
+
     if (!transactionResult) {
         qCDebug(orgKdeElisaDatabase) << "commit failed" << d->mTracksDatabase.lastError() << d->mTracksDatabase.lastError().nativeErrorCode();
 
@@ -1266,6 +2031,16 @@ bool DatabaseInterface::rollBackTransaction()
     return result;
 }
 
+void DatabaseInterface::notifyAfterCommit(std::function<void()> notification)
+{
+    if (!d->mIsInTransaction) {
+        notification();
+        return;
+    }
+
+    d->mPendingNotifications.push_back(std::move(notification));
+}
+
 void DatabaseInterface::initDatabase()
 {
     auto listTables = d->mTracksDatabase.tables();
@@ -3114,94 +3889,340 @@ void DatabaseInterface::upgradeDatabaseV15()
 
 void DatabaseInterface::upgradeDatabaseV16()
 {
+    qCInfo(orgKdeElisaDatabase) << "begin update to v16 of database schema";
+
+    QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+    const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE IF NOT EXISTS `ScannedDirectories` ("
+                                                               "`DirectoryPath` VARCHAR(1024) PRIMARY KEY NOT NULL, "
+                                                               "`ParentPath` VARCHAR(1024), "
+                                                               "`ModificationTime` DATETIME NOT NULL, "
+                                                               "`EntriesCount` INTEGER NOT NULL)"));
+
+    if (!result) {
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV16" << createSchemaQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV16" << createSchemaQuery.lastError();
 
+        Q_EMIT databaseError();
+    }
+
+    qCInfo(orgKdeElisaDatabase) << "finished update to v16 of database schema";
 }
 
-void DatabaseInterface::checkDatabaseSchema()
+void DatabaseInterface::upgradeDatabaseV17()
 {
-    checkAlbumsTableSchema();
-    if (d->mIsInBadState)
-    {
-        resetDatabase();
-        return;
-    }
+    qCInfo(orgKdeElisaDatabase) << "begin update to v17 of database schema";
 
-    checkArtistsTableSchema();
-    if (d->mIsInBadState)
     {
-        resetDatabase();
-        return;
-    }
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
 
-    checkComposerTableSchema();
-    if (d->mIsInBadState)
-    {
-        resetDatabase();
-        return;
-    }
+        // the trigram tokenizer matches any part of a value, like the regular expression of the views,
+        // SQLite older than 3.34 only has the word tokenizer that matches the start of the words
+        auto result = createSchemaQuery.exec(QStringLiteral("CREATE VIRTUAL TABLE IF NOT EXISTS `TracksSearch` USING fts5("
+                                                            "`Title`, `ArtistName`, `AlbumTitle`, `AlbumArtistName`, `Genre`, "
+                                                            "content='Tracks', content_rowid='ID', tokenize='trigram')"));
 
-    checkGenreTableSchema();
-    if (d->mIsInBadState)
-    {
-        resetDatabase();
-        return;
-    }
+        if (!result) {
+            result = createSchemaQuery.exec(QStringLiteral("CREATE VIRTUAL TABLE IF NOT EXISTS `TracksSearch` USING fts5("
+                                                           "`Title`, `ArtistName`, `AlbumTitle`, `AlbumArtistName`, `Genre`, "
+                                                           "content='Tracks', content_rowid='ID', prefix='1 2 3')"));
+        }
 
-    checkLyricistTableSchema();
-    if (d->mIsInBadState)
-    {
-        resetDatabase();
-        return;
-    }
+        // the search index is optional, the views filter their data themselves when SQLite is built without FTS5
+        if (!result) {
+            qCInfo(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV17" << "no full-text search index" << createSchemaQuery.lastError();
 
-    checkTracksTableSchema();
-    if (d->mIsInBadState)
-    {
-        resetDatabase();
-        return;
-    }
+            qCInfo(orgKdeElisaDatabase) << "finished update to v17 of database schema";
 
-    checkTracksDataTableSchema();
-    if (d->mIsInBadState)
-    {
-        resetDatabase();
-        return;
+            return;
+        }
     }
-}
 
-void DatabaseInterface::checkAlbumsTableSchema()
-{
-    auto fieldsList = QStringList{QStringLiteral("ID"), QStringLiteral("Title"),
-                                  QStringLiteral("ArtistName"), QStringLiteral("AlbumPath"),
-                                  QStringLiteral("CoverFileName")};
+    const auto searchQueries = QStringList{
+            QStringLiteral("CREATE TRIGGER IF NOT EXISTS `TracksSearchInsert` AFTER INSERT ON `Tracks` BEGIN "
+                           "INSERT INTO `TracksSearch`(`rowid`, `Title`, `ArtistName`, `AlbumTitle`, `AlbumArtistName`, `Genre`) "
+                           "VALUES (new.`ID`, new.`Title`, new.`ArtistName`, new.`AlbumTitle`, new.`AlbumArtistName`, new.`Genre`); "
+                           "END"),
+            QStringLiteral("CREATE TRIGGER IF NOT EXISTS `TracksSearchDelete` AFTER DELETE ON `Tracks` BEGIN "
+                           "INSERT INTO `TracksSearch`(`TracksSearch`, `rowid`, `Title`, `ArtistName`, `AlbumTitle`, `AlbumArtistName`, `Genre`) "
+                           "VALUES ('delete', old.`ID`, old.`Title`, old.`ArtistName`, old.`AlbumTitle`, old.`AlbumArtistName`, old.`Genre`); "
+                           "END"),
+            QStringLiteral("CREATE TRIGGER IF NOT EXISTS `TracksSearchUpdate` "
+                           "AFTER UPDATE OF `Title`, `ArtistName`, `AlbumTitle`, `AlbumArtistName`, `Genre` ON `Tracks` BEGIN "
+                           "INSERT INTO `TracksSearch`(`TracksSearch`, `rowid`, `Title`, `ArtistName`, `AlbumTitle`, `AlbumArtistName`, `Genre`) "
+                           "VALUES ('delete', old.`ID`, old.`Title`, old.`ArtistName`, old.`AlbumTitle`, old.`AlbumArtistName`, old.`Genre`); "
+                           "INSERT INTO `TracksSearch`(`rowid`, `Title`, `ArtistName`, `AlbumTitle`, `AlbumArtistName`, `Genre`) "
+                           "VALUES (new.`ID`, new.`Title`, new.`ArtistName`, new.`AlbumTitle`, new.`AlbumArtistName`, new.`Genre`); "
+                           "END"),
+            QStringLiteral("INSERT INTO `TracksSearch`(`TracksSearch`) VALUES ('rebuild')"),
+    };
+
+    for (const auto &oneQuery : searchQueries) {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
 
-    genericCheckTable(QStringLiteral("Albums"), fieldsList);
-}
+        const auto &result = createSchemaQuery.exec(oneQuery);
 
-void DatabaseInterface::checkArtistsTableSchema()
-{
-    auto fieldsList = QStringList{QStringLiteral("ID"), QStringLiteral("Name")};
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV17" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV17" << createSchemaQuery.lastError();
 
-    genericCheckTable(QStringLiteral("Artists"), fieldsList);
+            Q_EMIT databaseError();
+        }
+    }
+
+    qCInfo(orgKdeElisaDatabase) << "finished update to v17 of database schema";
 }
 
-void DatabaseInterface::checkComposerTableSchema()
+void DatabaseInterface::upgradeDatabaseV18()
 {
-    auto fieldsList = QStringList{QStringLiteral("ID"), QStringLiteral("Name")};
+    qCInfo(orgKdeElisaDatabase) << "begin update to v18 of database schema";
+
+    // the triggers keep the flag up to date, the read queries only filter on it
+    const auto preferredTracksQueries = QStringList{
+            QStringLiteral("ALTER TABLE `Tracks` ADD COLUMN `IsPreferred` INTEGER NOT NULL DEFAULT 1"),
+            updatePreferredTracksText({}),
+            QStringLiteral("CREATE INDEX IF NOT EXISTS `TracksPreferredIndex` ON `Tracks` (`ID`) WHERE `IsPreferred` = 1"),
+            QStringLiteral("CREATE TRIGGER IF NOT EXISTS `TracksPreferredInsert` AFTER INSERT ON `Tracks` BEGIN ") +
+            updatePreferredTracksText(QStringLiteral("new")) + QStringLiteral("; END"),
+            QStringLiteral("CREATE TRIGGER IF NOT EXISTS `TracksPreferredDelete` AFTER DELETE ON `Tracks` BEGIN ") +
+            updatePreferredTracksText(QStringLiteral("old")) + QStringLiteral("; END"),
+            QStringLiteral("CREATE TRIGGER IF NOT EXISTS `TracksPreferredUpdate` "
+                           "AFTER UPDATE OF `Priority`, `Title`, `ArtistName`, `AlbumTitle`, `AlbumArtistName`, `AlbumPath` ON `Tracks` BEGIN ") +
+            updatePreferredTracksText(QStringLiteral("old")) + QStringLiteral("; ") +
+            updatePreferredTracksText(QStringLiteral("new")) + QStringLiteral("; END"),
+    };
+
+    for (const auto &oneQuery : preferredTracksQueries) {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
 
-    genericCheckTable(QStringLiteral("Composer"), fieldsList);
-}
+        const auto &result = createSchemaQuery.exec(oneQuery);
 
-void DatabaseInterface::checkGenreTableSchema()
-{
-    auto fieldsList = QStringList{QStringLiteral("ID"), QStringLiteral("Name")};
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV18" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV18" << createSchemaQuery.lastError();
 
-    genericCheckTable(QStringLiteral("Genre"), fieldsList);
+            Q_EMIT databaseError();
+        }
+    }
+
+    qCInfo(orgKdeElisaDatabase) << "finished update to v18 of database schema";
 }
 
-void DatabaseInterface::checkLyricistTableSchema()
+void DatabaseInterface::upgradeDatabaseV19()
 {
-    auto fieldsList = QStringList{QStringLiteral("ID"), QStringLiteral("Name")};
+    qCInfo(orgKdeElisaDatabase) << "begin update to v19 of database schema";
+
+    {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        const auto &result = createSchemaQuery.exec(QStringLiteral("ALTER TABLE `TracksData` ADD COLUMN `PlayScore` REAL"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV19" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV19" << createSchemaQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        // only the count and the first and last dates of the past plays are known:
+        // they are all counted at the middle of their period, a missing last play
+        // date falls back to the first play date and then to the import date
+        QSqlQuery selectPlayedTracksQuery(d->mTracksDatabase);
+
+        auto result = selectPlayedTracksQuery.exec(QStringLiteral("SELECT "
+                                                                  "`FileName`, "
+                                                                  "`PlayCounter`, "
+                                                                  "(COALESCE(`FirstPlayDate`, `LastPlayDate`, `ImportDate`) + "
+                                                                  "COALESCE(`LastPlayDate`, `FirstPlayDate`, `ImportDate`)) / 2 "
+                                                                  "FROM `TracksData` "
+                                                                  "WHERE "
+                                                                  "`PlayCounter` > 0"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV19" << selectPlayedTracksQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV19" << selectPlayedTracksQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+
+        auto playScores = QVector<std::pair<QString, double>>{};
+        while (selectPlayedTracksQuery.next()) {
+            const auto playCounter = selectPlayedTracksQuery.value(1).toInt();
+            const auto playDate = selectPlayedTracksQuery.value(2).toLongLong();
+
+            playScores.push_back({selectPlayedTracksQuery.value(0).toString(),
+                                  std::log2(static_cast<double>(playCounter)) + playScoreWeight(playDate)});
+        }
+
+        selectPlayedTracksQuery.finish();
+
+        QSqlQuery updatePlayScoreQuery(d->mTracksDatabase);
+
+        result = updatePlayScoreQuery.prepare(QStringLiteral("UPDATE `TracksData` "
+                                                             "SET `PlayScore` = :playScore "
+                                                             "WHERE `FileName` = :fileName"));
+
+        for (const auto &[fileName, playScore] : qAsConst(playScores)) {
+            if (!result) {
+                break;
+            }
+
+            updatePlayScoreQuery.bindValue(QStringLiteral(":fileName"), fileName);
+            updatePlayScoreQuery.bindValue(QStringLiteral(":playScore"), playScore);
+
+            result = updatePlayScoreQuery.exec();
+        }
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV19" << updatePlayScoreQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV19" << updatePlayScoreQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createTrackIndex(d->mTracksDatabase);
+
+        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                  "IF NOT EXISTS "
+                                                                  "`TracksDataPlayScoreIndex` ON `TracksData` "
+                                                                  "(`PlayScore`)"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV19" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV19" << createTrackIndex.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    qCInfo(orgKdeElisaDatabase) << "finished update to v19 of database schema";
+}
+
+void DatabaseInterface::upgradeDatabaseV20()
+{
+    qCInfo(orgKdeElisaDatabase) << "begin update to v20 of database schema";
+
+    {
+        QSqlQuery createTrackIndex(d->mTracksDatabase);
+
+        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                  "IF NOT EXISTS "
+                                                                  "`TracksTitleSortIndex` ON `Tracks` "
+                                                                  "(`Title` COLLATE NOCASE, `ID`) "
+                                                                  "WHERE `IsPreferred` = 1"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV20" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV20" << createTrackIndex.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    qCInfo(orgKdeElisaDatabase) << "finished update to v20 of database schema";
+}
+
+void DatabaseInterface::upgradeDatabaseV21()
+{
+
+}
+
+void DatabaseInterface::checkDatabaseSchema()
+{
+    checkAlbumsTableSchema();
+    if (d->mIsInBadState)
+    {
+        resetDatabase();
+        return;
+    }
+
+    checkArtistsTableSchema();
+    if (d->mIsInBadState)
+    {
+        resetDatabase();
+        return;
+    }
+
+    checkComposerTableSchema();
+    if (d->mIsInBadState)
+    {
+        resetDatabase();
+        return;
+    }
+
+    checkGenreTableSchema();
+    if (d->mIsInBadState)
+    {
+        resetDatabase();
+        return;
+    }
+
+    checkLyricistTableSchema();
+    if (d->mIsInBadState)
+    {
+        resetDatabase();
+        return;
+    }
+
+    checkTracksTableSchema();
+    if (d->mIsInBadState)
+    {
+        resetDatabase();
+        return;
+    }
+
+    checkTracksDataTableSchema();
+    if (d->mIsInBadState)
+    {
+        resetDatabase();
+        return;
+    }
+
+    checkScannedDirectoriesTableSchema();
+    if (d->mIsInBadState)
+    {
+        resetDatabase();
+        return;
+    }
+}
+
+void DatabaseInterface::checkAlbumsTableSchema()
+{
+    auto fieldsList = QStringList{QStringLiteral("ID"), QStringLiteral("Title"),
+                                  QStringLiteral("ArtistName"), QStringLiteral("AlbumPath"),
+                                  QStringLiteral("CoverFileName")};
+
+    genericCheckTable(QStringLiteral("Albums"), fieldsList);
+}
+
+void DatabaseInterface::checkArtistsTableSchema()
+{
+    auto fieldsList = QStringList{QStringLiteral("ID"), QStringLiteral("Name")};
+
+    genericCheckTable(QStringLiteral("Artists"), fieldsList);
+}
+
+void DatabaseInterface::checkComposerTableSchema()
+{
+    auto fieldsList = QStringList{QStringLiteral("ID"), QStringLiteral("Name")};
+
+    genericCheckTable(QStringLiteral("Composer"), fieldsList);
+}
+
+void DatabaseInterface::checkGenreTableSchema()
+{
+    auto fieldsList = QStringList{QStringLiteral("ID"), QStringLiteral("Name")};
+
+    genericCheckTable(QStringLiteral("Genre"), fieldsList);
+}
+
+void DatabaseInterface::checkLyricistTableSchema()
+{
+    auto fieldsList = QStringList{QStringLiteral("ID"), QStringLiteral("Name")};
 
     genericCheckTable(QStringLiteral("Lyricist"), fieldsList);
 }
@@ -3218,7 +4239,7 @@ void DatabaseInterface::checkTracksTableSchema()
                                   QStringLiteral("Lyricist"), QStringLiteral("Comment"),
                                   QStringLiteral("Year"), QStringLiteral("Channels"),
                                   QStringLiteral("BitRate"), QStringLiteral("SampleRate"),
-                                  QStringLiteral("HasEmbeddedCover")};
+                                  QStringLiteral("HasEmbeddedCover"), QStringLiteral("IsPreferred")};
 
     genericCheckTable(QStringLiteral("Tracks"), fieldsList);
 }
@@ -3227,11 +4248,20 @@ void DatabaseInterface::checkTracksDataTableSchema()
 {
     auto fieldsList = QStringList{QStringLiteral("FileName"), QStringLiteral("FileModifiedTime"),
                                   QStringLiteral("ImportDate"), QStringLiteral("FirstPlayDate"),
-                                  QStringLiteral("LastPlayDate"), QStringLiteral("PlayCounter")};
+                                  QStringLiteral("LastPlayDate"), QStringLiteral("PlayCounter"),
+                                  QStringLiteral("PlayScore")};
 
     genericCheckTable(QStringLiteral("TracksData"), fieldsList);
 }
 
+void DatabaseInterface::checkScannedDirectoriesTableSchema()
+{
+    auto fieldsList = QStringList{QStringLiteral("DirectoryPath"), QStringLiteral("ParentPath"),
+                                  QStringLiteral("ModificationTime"), QStringLiteral("EntriesCount")};
+
+    genericCheckTable(QStringLiteral("ScannedDirectories"), fieldsList);
+}
+
 void DatabaseInterface::genericCheckTable(const QString &tableName, const QStringList &expectedColumns)
 {
     auto columnsList = d->mTracksDatabase.record(tableName);
@@ -3322,208 +4352,954 @@ void DatabaseInterface::manageNewDatabaseVersion()
         }
     }
 
-    int version = versionBegin;
-    for (; version-1 != DatabaseInterface::V16; version++) {
-        callUpgradeFunctionForVersion(static_cast<DatabaseVersion>(version));
-    }
+    int version = versionBegin;
+    for (; version-1 != DatabaseInterface::V21; version++) {
+        callUpgradeFunctionForVersion(static_cast<DatabaseVersion>(version));
+    }
+
+    if (version-1 != versionBegin) {
+        dropTable(QStringLiteral("DROP TABLE DatabaseVersionV9"));
+        dropTable(QStringLiteral("DROP TABLE DatabaseVersionV11"));
+        dropTable(QStringLiteral("DROP TABLE DatabaseVersionV12"));
+        dropTable(QStringLiteral("DROP TABLE DatabaseVersionV13"));
+        dropTable(QStringLiteral("DROP TABLE DatabaseVersionV14"));
+    }
+
+    setDatabaseVersionInTable(DatabaseInterface::V21);
+
+    checkDatabaseSchema();
+}
+
+void DatabaseInterface::dropTable(const QString &query)
+{
+    QSqlQuery dropQueryQuery(d->mTracksDatabase);
+
+    const auto &result = dropQueryQuery.exec(query);
+
+    if (!result) {
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::dropTable" << dropQueryQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::dropTable" << dropQueryQuery.lastError();
+
+        Q_EMIT databaseError();
+    }
+}
+
+void DatabaseInterface::setDatabaseVersionInTable(int version)
+{
+    d->mUpdateDatabaseVersionQuery.bindValue(QStringLiteral(":version"), version);
+
+    auto queryResult = execQuery(d->mUpdateDatabaseVersionQuery);
+
+    if (!queryResult) {
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::setDatabaseVersionInTable" << d->mUpdateDatabaseVersionQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::setDatabaseVersionInTable" << d->mUpdateDatabaseVersionQuery.lastError();
+
+        Q_EMIT databaseError();
+    }
+}
+
+void DatabaseInterface::createDatabaseVersionTable()
+{
+    qCInfo(orgKdeElisaDatabase) << "begin creation of DatabaseVersion table";
+    QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+    const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `DatabaseVersion` (`Version` INTEGER PRIMARY KEY NOT NULL default 0)"));
+
+    if (!result) {
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::createDatabaseVersionTable" << createSchemaQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::createDatabaseVersionTable" << createSchemaQuery.lastError();
+
+        Q_EMIT databaseError();
+    }
+
+    const auto resultInsert = createSchemaQuery.exec(QStringLiteral("INSERT INTO `DatabaseVersion` VALUES (0)"));
+    if (!resultInsert) {
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::createDatabaseVersionTable" << createSchemaQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::createDatabaseVersionTable" << createSchemaQuery.lastError();
+
+        Q_EMIT databaseError();
+    }
+}
+
+void DatabaseInterface::manageNewDatabaseVersionInitRequests()
+{
+    {
+        auto  initDatabaseVersionQuery = QStringLiteral("UPDATE `DatabaseVersion` set `Version` = :version ");
+
+        auto result = prepareQuery(d->mUpdateDatabaseVersionQuery, initDatabaseVersionQuery);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::manageNewDatabaseVersionInitRequests" << d->mUpdateDatabaseVersionQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::manageNewDatabaseVersionInitRequests" << d->mUpdateDatabaseVersionQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto  selectDatabaseVersionQuery = QStringLiteral("SELECT versionTable.`Version` FROM `DatabaseVersion` versionTable");
+
+        auto result = prepareQuery(d->mSelectDatabaseVersionQuery, selectDatabaseVersionQuery);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::manageNewDatabaseVersionInitRequests" << d->mSelectDatabaseVersionQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::manageNewDatabaseVersionInitRequests" << d->mSelectDatabaseVersionQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+}
+
+void DatabaseInterface::callUpgradeFunctionForVersion(DatabaseVersion databaseVersion)
+{
+    switch(databaseVersion)
+    {
+    case DatabaseInterface::V9:
+        upgradeDatabaseV9();
+        break;
+    case DatabaseInterface::V11:
+        upgradeDatabaseV11();
+        break;
+    case DatabaseInterface::V12:
+        upgradeDatabaseV12();
+        break;
+    case DatabaseInterface::V13:
+        upgradeDatabaseV13();
+        break;
+    case DatabaseInterface::V14:
+        upgradeDatabaseV14();
+        break;
+    case DatabaseInterface::V15:
+        upgradeDatabaseV15();
+        break;
+    case DatabaseInterface::V16:
+        upgradeDatabaseV16();
+        break;
+    case DatabaseInterface::V17:
+        upgradeDatabaseV17();
+        break;
+    case DatabaseInterface::V18:
+        upgradeDatabaseV18();
+        break;
+    case DatabaseInterface::V19:
+        upgradeDatabaseV19();
+        break;
+    case DatabaseInterface::V20:
+        upgradeDatabaseV20();
+        break;
+    case DatabaseInterface::V21:
+        upgradeDatabaseV21();
+        break;
+    }
+}
+
+void DatabaseInterface::internalInsertOneTrack(const DataTypes::TrackDataType &oneTrack, const QHash<QString, QUrl> &covers)
+{
+    if (d->mIsBatchInsertion) {
+        const auto fileName = oneTrack.resourceURI().toString();
+        const auto existingTrackId = d->mBatchTracksMapping.value(fileName);
+
+        if (existingTrackId != 0) {
+            updateTrackOrigin(oneTrack.resourceURI(), oneTrack.fileModificationTime());
+        }
+
+        bool isInserted = false;
+
+        const auto insertedTrackId = internalInsertTrack(oneTrack, covers, isInserted);
+
+        if (isInserted && insertedTrackId != 0) {
+            d->mInsertedTracks.insert(insertedTrackId);
+
+            if (!oneTrack.title().isEmpty()) {
+                d->mBatchTracksMapping[fileName] = insertedTrackId;
+            }
+        }
+
+        return;
+    }
+
+    d->mSelectTracksMapping.bindValue(QStringLiteral(":fileName"), oneTrack.resourceURI());
+
+    auto result = execQuery(d->mSelectTracksMapping);
+
+    if (!result || !d->mSelectTracksMapping.isSelect() || !d->mSelectTracksMapping.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertTracksList" << d->mSelectTracksMapping.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertTracksList" << d->mSelectTracksMapping.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertTracksList" << d->mSelectTracksMapping.lastError();
+
+        d->mSelectTracksMapping.finish();
+
+        rollBackTransaction();
+        Q_EMIT finishInsertingTracksList();
+        return;
+    }
+
+    bool isNewTrack = !d->mSelectTracksMapping.next();
+
+    if (isNewTrack) {
+        insertTrackOrigin(oneTrack.resourceURI(), oneTrack.fileModificationTime(),
+                          QDateTime::currentDateTime());
+    } else if (!d->mSelectTracksMapping.record().value(0).isNull() && d->mSelectTracksMapping.record().value(0).toULongLong() != 0) {
+        updateTrackOrigin(oneTrack.resourceURI(), oneTrack.fileModificationTime());
+    }
+
+    d->mSelectTracksMapping.finish();
+
+    bool isInserted = false;
+
+    const auto insertedTrackId = internalInsertTrack(oneTrack, covers, isInserted);
+
+    if (isInserted && insertedTrackId != 0) {
+        d->mInsertedTracks.insert(insertedTrackId);
+    }
+}
+
+void DatabaseInterface::internalInsertOneRadio(const DataTypes::TrackDataType &oneTrack)
+{
+    QSqlQuery query = d->mUpdateRadioQuery;
+
+    if (!oneTrack.hasDatabaseId()) {
+        query = d->mInsertRadioQuery;
+    }
+
+    query.bindValue(QStringLiteral(":httpAddress"), oneTrack.resourceURI());
+    query.bindValue(QStringLiteral(":radioId"), oneTrack.databaseId());
+    query.bindValue(QStringLiteral(":title"), oneTrack.title());
+    query.bindValue(QStringLiteral(":comment"), oneTrack.comment());
+    query.bindValue(QStringLiteral(":trackRating"), oneTrack.rating());
+    query.bindValue(QStringLiteral(":imageAddress"), oneTrack.albumCover());
+
+    auto result = execQuery(query);
+
+    if (!result || !query.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertTracksList" << query.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertTracksList" << query.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertTracksList" << query.lastError();
+    } else {
+        if (!oneTrack.hasDatabaseId()) {
+            auto radio = internalOneRadioPartialData(internalRadioIdFromHttpAddress(oneTrack.resourceURI().toString()));
+
+            notifyAfterCommit([this, radio]() {Q_EMIT radioAdded(radio);});
+        } else {
+            auto radio = internalOneRadioPartialData(oneTrack.databaseId());
+
+            notifyAfterCommit([this, radio]() {Q_EMIT radioModified(radio);});
+        }
+    }
+
+    query.finish();
+}
+
+void DatabaseInterface::prepareBatchInsertion(const DataTypes::ListTrackDataType &tracks)
+{
+    clearBatchInsertion();
+
+    auto fileNames = QStringList{};
+    auto knownFileNames = QSet<QString>{};
+    auto artistNames = QStringList{};
+    auto genreNames = QStringList{};
+    auto composerNames = QStringList{};
+    auto lyricistNames = QStringList{};
+    auto knownArtistNames = QSet<QString>{};
+    auto knownGenreNames = QSet<QString>{};
+    auto knownComposerNames = QSet<QString>{};
+    auto knownLyricistNames = QSet<QString>{};
+
+    auto addName = [](QStringList &names, QSet<QString> &knownNames, const QString &oneName) {
+        if (!oneName.isEmpty() && !knownNames.contains(oneName)) {
+            knownNames.insert(oneName);
+            names.push_back(oneName);
+        }
+    };
+
+    for (const auto &oneTrack : tracks) {
+        if (oneTrack.elementType() != ElisaUtils::Track) {
+            continue;
+        }
+
+        const auto fileName = oneTrack.resourceURI().toString();
+        if (!knownFileNames.contains(fileName)) {
+            knownFileNames.insert(fileName);
+            fileNames.push_back(fileName);
+        }
+
+        if (oneTrack.hasAlbum() && oneTrack.hasAlbumArtist()) {
+            addName(artistNames, knownArtistNames, oneTrack.albumArtist());
+        }
+
+        if (oneTrack.title().isEmpty()) {
+            continue;
+        }
+
+        if (oneTrack.hasArtist()) {
+            addName(artistNames, knownArtistNames, oneTrack.artist());
+        }
+        addName(genreNames, knownGenreNames, oneTrack.genre());
+        addName(composerNames, knownComposerNames, oneTrack.composer());
+        addName(lyricistNames, knownLyricistNames, oneTrack.lyricist());
+    }
+
+    if (fileNames.isEmpty()) {
+        return;
+    }
+
+    if (!batchSelectTracksMapping(fileNames, d->mBatchTracksMapping)) {
+        clearBatchInsertion();
+        return;
+    }
+
+    d->mIsBatchInsertion = true;
+
+    auto newTrackFiles = DataTypes::ListTrackDataType{};
+    auto newTrackTitles = QStringList{};
+    auto knownTitles = QSet<QString>{};
+    for (const auto &oneTrack : tracks) {
+        if (oneTrack.elementType() != ElisaUtils::Track) {
+            continue;
+        }
+
+        const auto fileName = oneTrack.resourceURI().toString();
+        if (!d->mBatchTracksMapping.contains(fileName)) {
+            d->mBatchTracksMapping[fileName] = 0;
+            d->mBatchNewFileNames.insert(fileName);
+            newTrackFiles.push_back(oneTrack);
+        }
+
+        if (d->mBatchTracksMapping.value(fileName) == 0) {
+            addName(newTrackTitles, knownTitles, oneTrack.title());
+        }
+    }
+
+    if (!batchInsertTracksOrigin(newTrackFiles)) {
+        clearBatchInsertion();
+        return;
+    }
+
+    if (!batchSelectTracksIdentity(newTrackTitles)) {
+        clearBatchInsertion();
+        return;
+    }
+
+    auto newArtists = QList<QPair<qulonglong, QString>>{};
+    auto newGenres = QList<QPair<qulonglong, QString>>{};
+    auto newComposers = QList<QPair<qulonglong, QString>>{};
+    auto newLyricists = QList<QPair<qulonglong, QString>>{};
+
+    auto namesResult = batchInsertNames(QStringLiteral("Artists"), artistNames, d->mBatchArtistIds, d->mArtistId, newArtists);
+    namesResult = namesResult && batchInsertNames(QStringLiteral("Genre"), genreNames, d->mBatchGenreIds, d->mGenreId, newGenres);
+    namesResult = namesResult && batchInsertNames(QStringLiteral("Composer"), composerNames, d->mBatchComposerIds, d->mComposerId, newComposers);
+    namesResult = namesResult && batchInsertNames(QStringLiteral("Lyricist"), lyricistNames, d->mBatchLyricistIds, d->mLyricistId, newLyricists);
+
+    for (const auto &oneArtist : qAsConst(newArtists)) {
+        d->mInsertedArtists.insert(oneArtist);
+    }
+
+    if (!newGenres.isEmpty()) {
+        DataTypes::ListGenreDataType addedGenres;
+
+        for (const auto &oneGenre : qAsConst(newGenres)) {
+            addedGenres.push_back({{DataTypes::DatabaseIdRole, oneGenre.first},
+                                   {DataTypes::TitleRole, oneGenre.second},
+                                   {DataTypes::ElementTypeRole, ElisaUtils::Genre}});
+        }
+
+        notifyAfterCommit([this, addedGenres]() {Q_EMIT genresAdded(addedGenres);});
+    }
+
+    if (!newComposers.isEmpty()) {
+        auto allComposers = internalAllComposersPartialData();
+        notifyAfterCommit([this, allComposers]() {Q_EMIT composersAdded(allComposers);});
+    }
+
+    if (!newLyricists.isEmpty()) {
+        auto allLyricists = internalAllLyricistsPartialData();
+        notifyAfterCommit([this, allLyricists]() {Q_EMIT lyricistsAdded(allLyricists);});
+    }
+
+    if (!namesResult) {
+        d->mIsBatchInsertion = false;
+        d->mBatchArtistIds.clear();
+        d->mBatchGenreIds.clear();
+        d->mBatchComposerIds.clear();
+        d->mBatchLyricistIds.clear();
+        return;
+    }
+
+    qCDebug(orgKdeElisaDatabase()) << "DatabaseInterface::prepareBatchInsertion" << fileNames.size() << "files"
+                                   << newTrackFiles.size() << "new files" << newArtists.size() << "new artists"
+                                   << newGenres.size() << "new genres";
+}
+
+void DatabaseInterface::clearBatchInsertion()
+{
+    d->mIsBatchInsertion = false;
+    d->mBatchArtistIds.clear();
+    d->mBatchGenreIds.clear();
+    d->mBatchComposerIds.clear();
+    d->mBatchLyricistIds.clear();
+    d->mBatchTracksMapping.clear();
+    d->mBatchNewFileNames.clear();
+    d->mBatchTracksByTitle.clear();
+    d->mBatchPendingTracks.clear();
+    d->mBatchAlbumIds.clear();
+}
+
+bool DatabaseInterface::batchSelectTracksMapping(const QStringList &fileNames, QHash<QString, qulonglong> &tracksMapping)
+{
+    for (int chunkStart = 0; chunkStart < fileNames.size(); chunkStart += BatchChunkSize) {
+        const auto chunkSize = std::min(BatchChunkSize, fileNames.size() - chunkStart);
+
+        auto selectTracksMappingText = QStringLiteral("SELECT "
+                                                      "trackData.`FileName`, "
+                                                      "track.`ID` "
+                                                      "FROM "
+                                                      "`TracksData` trackData "
+                                                      "LEFT JOIN "
+                                                      "`Tracks` track "
+                                                      "ON "
+                                                      "track.`FileName` = trackData.`FileName` "
+                                                      "WHERE "
+                                                      "trackData.`FileName` IN (?");
+        for (int i = 1; i < chunkSize; ++i) {
+            selectTracksMappingText += QStringLiteral(", ?");
+        }
+        selectTracksMappingText += QStringLiteral(")");
+
+        QSqlQuery selectTracksMappingQuery(d->mTracksDatabase);
+        if (!prepareQuery(selectTracksMappingQuery, selectTracksMappingText)) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksMapping" << selectTracksMappingQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksMapping" << selectTracksMappingQuery.lastError();
+
+            Q_EMIT databaseError();
+
+            return false;
+        }
+
+        for (int i = chunkStart; i < chunkStart + chunkSize; ++i) {
+            selectTracksMappingQuery.addBindValue(fileNames[i]);
+        }
+
+        auto result = execQuery(selectTracksMappingQuery);
+
+        if (!result || !selectTracksMappingQuery.isSelect() || !selectTracksMappingQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksMapping" << selectTracksMappingQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksMapping" << selectTracksMappingQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksMapping" << selectTracksMappingQuery.lastError();
+
+            return false;
+        }
+
+        while (selectTracksMappingQuery.next()) {
+            const auto &currentRecord = selectTracksMappingQuery.record();
+
+            tracksMapping[currentRecord.value(0).toString()] = currentRecord.value(1).toULongLong();
+        }
+
+        selectTracksMappingQuery.finish();
+    }
+
+    return true;
+}
+
+bool DatabaseInterface::batchSelectTracksFromIds(const QList<qulonglong> &trackIds, QHash<qulonglong, DataTypes::TrackDataType> &tracks)
+{
+    for (int chunkStart = 0; chunkStart < trackIds.size(); chunkStart += BatchChunkSize) {
+        const auto chunkSize = std::min(BatchChunkSize, trackIds.size() - chunkStart);
+
+        auto selectTracksText = QString(d->mSelectFullTracksText +
+                                        QStringLiteral("WHERE "
+                                                       "tracksMapping.`FileName` = tracks.`FileName` AND "
+                                                       "tracks.`ID` IN (?"));
+        for (int i = 1; i < chunkSize; ++i) {
+            selectTracksText += QStringLiteral(", ?");
+        }
+        selectTracksText += QStringLiteral(")");
+
+        QSqlQuery selectTracksQuery(d->mTracksDatabase);
+        if (!prepareQuery(selectTracksQuery, selectTracksText)) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksFromIds" << selectTracksQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksFromIds" << selectTracksQuery.lastError();
+
+            Q_EMIT databaseError();
+
+            return false;
+        }
+
+        for (int i = chunkStart; i < chunkStart + chunkSize; ++i) {
+            selectTracksQuery.addBindValue(trackIds[i]);
+        }
+
+        auto result = execQuery(selectTracksQuery);
+
+        if (!result || !selectTracksQuery.isSelect() || !selectTracksQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksFromIds" << selectTracksQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksFromIds" << selectTracksQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksFromIds" << selectTracksQuery.lastError();
+
+            return false;
+        }
+
+        while (selectTracksQuery.next()) {
+            const auto &oneTrack = buildTrackDataFromDatabaseRecord(selectTracksQuery.record());
+
+            tracks[oneTrack.databaseId()] = oneTrack;
+        }
+
+        selectTracksQuery.finish();
+    }
+
+    return true;
+}
+
+bool DatabaseInterface::batchSelectTracksFromTitles(const QStringList &titles, QMultiHash<QString, DataTypes::TrackDataType> &tracks)
+{
+    for (int chunkStart = 0; chunkStart < titles.size(); chunkStart += BatchChunkSize) {
+        const auto chunkSize = std::min(BatchChunkSize, titles.size() - chunkStart);
+
+        auto selectTracksText = QString(d->mSelectFullTracksText +
+                                        QStringLiteral("WHERE "
+                                                       "tracksMapping.`FileName` = tracks.`FileName` AND "
+                                                       "tracks.`Title` IN (?"));
+        for (int i = 1; i < chunkSize; ++i) {
+            selectTracksText += QStringLiteral(", ?");
+        }
+        selectTracksText += QStringLiteral(")");
+
+        QSqlQuery selectTracksQuery(d->mTracksDatabase);
+        if (!prepareQuery(selectTracksQuery, selectTracksText)) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksFromTitles" << selectTracksQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksFromTitles" << selectTracksQuery.lastError();
+
+            Q_EMIT databaseError();
+
+            return false;
+        }
+
+        for (int i = chunkStart; i < chunkStart + chunkSize; ++i) {
+            selectTracksQuery.addBindValue(titles[i]);
+        }
+
+        auto result = execQuery(selectTracksQuery);
+
+        if (!result || !selectTracksQuery.isSelect() || !selectTracksQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksFromTitles" << selectTracksQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksFromTitles" << selectTracksQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksFromTitles" << selectTracksQuery.lastError();
+
+            return false;
+        }
+
+        while (selectTracksQuery.next()) {
+            const auto &oneTrack = buildTrackDataFromDatabaseRecord(selectTracksQuery.record());
+
+            tracks.insert(oneTrack.title(), oneTrack);
+        }
+
+        selectTracksQuery.finish();
+    }
+
+    return true;
+}
+
+bool DatabaseInterface::batchDeleteRows(const QString &tableName, const QString &columnName, const QVariantList &values)
+{
+    for (int chunkStart = 0; chunkStart < values.size(); chunkStart += BatchChunkSize) {
+        const auto chunkSize = std::min(BatchChunkSize, values.size() - chunkStart);
+
+        auto deleteRowsText = QStringLiteral("DELETE FROM `%1` WHERE `%2` IN (?").arg(tableName, columnName);
+        for (int i = 1; i < chunkSize; ++i) {
+            deleteRowsText += QStringLiteral(", ?");
+        }
+        deleteRowsText += QStringLiteral(")");
+
+        QSqlQuery deleteRowsQuery(d->mTracksDatabase);
+        if (!prepareQuery(deleteRowsQuery, deleteRowsText)) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchDeleteRows" << deleteRowsQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchDeleteRows" << deleteRowsQuery.lastError();
+
+            Q_EMIT databaseError();
+
+            return false;
+        }
+
+        for (int i = chunkStart; i < chunkStart + chunkSize; ++i) {
+            deleteRowsQuery.addBindValue(values[i]);
+        }
+
+        auto result = execQuery(deleteRowsQuery);
+
+        if (!result || !deleteRowsQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchDeleteRows" << deleteRowsQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchDeleteRows" << deleteRowsQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchDeleteRows" << deleteRowsQuery.lastError();
+
+            return false;
+        }
+
+        deleteRowsQuery.finish();
+    }
+
+    return true;
+}
+
+bool DatabaseInterface::batchInsertTracksOrigin(const DataTypes::ListTrackDataType &newTracks)
+{
+    const auto importDate = QDateTime::currentDateTime().toMSecsSinceEpoch();
+
+    for (int chunkStart = 0; chunkStart < newTracks.size(); chunkStart += BatchChunkSize) {
+        const auto chunkSize = std::min(BatchChunkSize, newTracks.size() - chunkStart);
+
+        auto insertTracksOriginText = QStringLiteral("INSERT INTO "
+                                                     "`TracksData` "
+                                                     "(`FileName`, "
+                                                     "`FileModifiedTime`, "
+                                                     "`ImportDate`, "
+                                                     "`PlayCounter`) "
+                                                     "VALUES (?, ?, ?, 0)");
+        for (int i = 1; i < chunkSize; ++i) {
+            insertTracksOriginText += QStringLiteral(", (?, ?, ?, 0)");
+        }
+
+        QSqlQuery insertTracksOriginQuery(d->mTracksDatabase);
+        if (!prepareQuery(insertTracksOriginQuery, insertTracksOriginText)) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertTracksOrigin" << insertTracksOriginQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertTracksOrigin" << insertTracksOriginQuery.lastError();
+
+            Q_EMIT databaseError();
+
+            return false;
+        }
+
+        for (int i = chunkStart; i < chunkStart + chunkSize; ++i) {
+            insertTracksOriginQuery.addBindValue(newTracks[i].resourceURI().toString());
+            insertTracksOriginQuery.addBindValue(newTracks[i].fileModificationTime());
+            insertTracksOriginQuery.addBindValue(importDate);
+        }
+
+        auto result = execQuery(insertTracksOriginQuery);
+
+        if (!result || !insertTracksOriginQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertTracksOrigin" << insertTracksOriginQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertTracksOrigin" << insertTracksOriginQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertTracksOrigin" << insertTracksOriginQuery.lastError();
+
+            return false;
+        }
+
+        insertTracksOriginQuery.finish();
+    }
+
+    return true;
+}
+
+bool DatabaseInterface::batchInsertNames(const QString &tableName, const QStringList &names, QHash<QString, qulonglong> &ids,
+                                         qulonglong &nextId, QList<QPair<qulonglong, QString>> &newNames)
+{
+    for (int chunkStart = 0; chunkStart < names.size(); chunkStart += BatchChunkSize) {
+        const auto chunkSize = std::min(BatchChunkSize, names.size() - chunkStart);
+
+        auto selectNamesText = QStringLiteral("SELECT `ID`, `Name` FROM `%1` WHERE `Name` IN (?").arg(tableName);
+        for (int i = 1; i < chunkSize; ++i) {
+            selectNamesText += QStringLiteral(", ?");
+        }
+        selectNamesText += QStringLiteral(")");
+
+        QSqlQuery selectNamesQuery(d->mTracksDatabase);
+        if (!prepareQuery(selectNamesQuery, selectNamesText)) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertNames" << selectNamesQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertNames" << selectNamesQuery.lastError();
+
+            Q_EMIT databaseError();
+
+            return false;
+        }
+
+        for (int i = chunkStart; i < chunkStart + chunkSize; ++i) {
+            selectNamesQuery.addBindValue(names[i]);
+        }
+
+        auto result = execQuery(selectNamesQuery);
+
+        if (!result || !selectNamesQuery.isSelect() || !selectNamesQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertNames" << selectNamesQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertNames" << selectNamesQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertNames" << selectNamesQuery.lastError();
+
+            return false;
+        }
 
-    if (version-1 != versionBegin) {
-        dropTable(QStringLiteral("DROP TABLE DatabaseVersionV9"));
-        dropTable(QStringLiteral("DROP TABLE DatabaseVersionV11"));
-        dropTable(QStringLiteral("DROP TABLE DatabaseVersionV12"));
-        dropTable(QStringLiteral("DROP TABLE DatabaseVersionV13"));
-        dropTable(QStringLiteral("DROP TABLE DatabaseVersionV14"));
-    }
+        while (selectNamesQuery.next()) {
+            const auto &currentRecord = selectNamesQuery.record();
 
-    setDatabaseVersionInTable(DatabaseInterface::V16);
+            ids[currentRecord.value(1).toString()] = currentRecord.value(0).toULongLong();
+        }
 
-    checkDatabaseSchema();
-}
+        selectNamesQuery.finish();
 
-void DatabaseInterface::dropTable(const QString &query)
-{
-    QSqlQuery dropQueryQuery(d->mTracksDatabase);
+        auto missingNames = QList<QPair<qulonglong, QString>>{};
+        for (int i = chunkStart; i < chunkStart + chunkSize; ++i) {
+            if (!ids.contains(names[i])) {
+                missingNames.push_back({nextId + missingNames.size(), names[i]});
+            }
+        }
 
-    const auto &result = dropQueryQuery.exec(query);
+        if (missingNames.isEmpty()) {
+            continue;
+        }
 
-    if (!result) {
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::dropTable" << dropQueryQuery.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::dropTable" << dropQueryQuery.lastError();
+        auto insertNamesText = QStringLiteral("INSERT INTO `%1` (`ID`, `Name`) VALUES (?, ?)").arg(tableName);
+        for (int i = 1; i < missingNames.size(); ++i) {
+            insertNamesText += QStringLiteral(", (?, ?)");
+        }
 
-        Q_EMIT databaseError();
-    }
-}
+        QSqlQuery insertNamesQuery(d->mTracksDatabase);
+        if (!prepareQuery(insertNamesQuery, insertNamesText)) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertNames" << insertNamesQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertNames" << insertNamesQuery.lastError();
 
-void DatabaseInterface::setDatabaseVersionInTable(int version)
-{
-    d->mUpdateDatabaseVersionQuery.bindValue(QStringLiteral(":version"), version);
+            Q_EMIT databaseError();
 
-    auto queryResult = execQuery(d->mUpdateDatabaseVersionQuery);
+            return false;
+        }
 
-    if (!queryResult) {
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::setDatabaseVersionInTable" << d->mUpdateDatabaseVersionQuery.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::setDatabaseVersionInTable" << d->mUpdateDatabaseVersionQuery.lastError();
+        for (const auto &oneName : qAsConst(missingNames)) {
+            insertNamesQuery.addBindValue(oneName.first);
+            insertNamesQuery.addBindValue(oneName.second);
+        }
 
-        Q_EMIT databaseError();
-    }
-}
+        result = execQuery(insertNamesQuery);
 
-void DatabaseInterface::createDatabaseVersionTable()
-{
-    qCInfo(orgKdeElisaDatabase) << "begin creation of DatabaseVersion table";
-    QSqlQuery createSchemaQuery(d->mTracksDatabase);
+        if (!result || !insertNamesQuery.isActive()) {
+            Q_EMIT databaseError();
 
-    const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `DatabaseVersion` (`Version` INTEGER PRIMARY KEY NOT NULL default 0)"));
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertNames" << insertNamesQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertNames" << insertNamesQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertNames" << insertNamesQuery.lastError();
 
-    if (!result) {
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::createDatabaseVersionTable" << createSchemaQuery.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::createDatabaseVersionTable" << createSchemaQuery.lastError();
+            return false;
+        }
 
-        Q_EMIT databaseError();
-    }
+        insertNamesQuery.finish();
 
-    const auto resultInsert = createSchemaQuery.exec(QStringLiteral("INSERT INTO `DatabaseVersion` VALUES (0)"));
-    if (!resultInsert) {
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::createDatabaseVersionTable" << createSchemaQuery.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::createDatabaseVersionTable" << createSchemaQuery.lastError();
+        for (const auto &oneName : qAsConst(missingNames)) {
+            ids[oneName.second] = oneName.first;
+            newNames.push_back(oneName);
+        }
 
-        Q_EMIT databaseError();
+        nextId += missingNames.size();
     }
+
+    return true;
 }
 
-void DatabaseInterface::manageNewDatabaseVersionInitRequests()
+bool DatabaseInterface::batchSelectTracksIdentity(const QStringList &titles)
 {
-    {
-        auto  initDatabaseVersionQuery = QStringLiteral("UPDATE `DatabaseVersion` set `Version` = :version ");
+    for (int chunkStart = 0; chunkStart < titles.size(); chunkStart += BatchChunkSize) {
+        const auto chunkSize = std::min(BatchChunkSize, titles.size() - chunkStart);
 
-        auto result = prepareQuery(d->mUpdateDatabaseVersionQuery, initDatabaseVersionQuery);
+        auto selectTracksText = QStringLiteral("SELECT "
+                                               "tracks.`Title`, "
+                                               "tracks.`Priority`, "
+                                               "tracks.`ArtistName`, "
+                                               "tracks.`AlbumTitle`, "
+                                               "tracks.`AlbumArtistName`, "
+                                               "tracks.`AlbumPath`, "
+                                               "tracks.`TrackNumber`, "
+                                               "tracks.`DiscNumber` "
+                                               "FROM "
+                                               "`Tracks` tracks "
+                                               "WHERE "
+                                               "tracks.`Title` IN (?");
+        for (int i = 1; i < chunkSize; ++i) {
+            selectTracksText += QStringLiteral(", ?");
+        }
+        selectTracksText += QStringLiteral(")");
 
-        if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::manageNewDatabaseVersionInitRequests" << d->mUpdateDatabaseVersionQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::manageNewDatabaseVersionInitRequests" << d->mUpdateDatabaseVersionQuery.lastError();
+        QSqlQuery selectTracksQuery(d->mTracksDatabase);
+        if (!prepareQuery(selectTracksQuery, selectTracksText)) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksIdentity" << selectTracksQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksIdentity" << selectTracksQuery.lastError();
 
             Q_EMIT databaseError();
-        }
-    }
 
-    {
-        auto  selectDatabaseVersionQuery = QStringLiteral("SELECT versionTable.`Version` FROM `DatabaseVersion` versionTable");
+            return false;
+        }
 
-        auto result = prepareQuery(d->mSelectDatabaseVersionQuery, selectDatabaseVersionQuery);
+        for (int i = chunkStart; i < chunkStart + chunkSize; ++i) {
+            selectTracksQuery.addBindValue(titles[i]);
+        }
 
-        if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::manageNewDatabaseVersionInitRequests" << d->mSelectDatabaseVersionQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::manageNewDatabaseVersionInitRequests" << d->mSelectDatabaseVersionQuery.lastError();
+        auto result = execQuery(selectTracksQuery);
 
+        if (!result || !selectTracksQuery.isSelect() || !selectTracksQuery.isActive()) {
             Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksIdentity" << selectTracksQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksIdentity" << selectTracksQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchSelectTracksIdentity" << selectTracksQuery.lastError();
+
+            return false;
+        }
+
+        while (selectTracksQuery.next()) {
+            const auto &currentRecord = selectTracksQuery.record();
+
+            d->mBatchTracksByTitle.insert(currentRecord.value(0).toString(),
+                                          {currentRecord.value(1).toInt(), currentRecord.value(2), currentRecord.value(3),
+                                           currentRecord.value(4), currentRecord.value(5), currentRecord.value(6),
+                                           currentRecord.value(7)});
         }
+
+        selectTracksQuery.finish();
     }
+
+    return true;
 }
 
-void DatabaseInterface::callUpgradeFunctionForVersion(DatabaseVersion databaseVersion)
+int DatabaseInterface::batchTrackPriority(const DataTypes::TrackDataType &oneTrack, const QString &trackPath) const
 {
-    switch(databaseVersion)
-    {
-    case DatabaseInterface::V9:
-        upgradeDatabaseV9();
-        break;
-    case DatabaseInterface::V11:
-        upgradeDatabaseV11();
-        break;
-    case DatabaseInterface::V12:
-        upgradeDatabaseV12();
-        break;
-    case DatabaseInterface::V13:
-        upgradeDatabaseV13();
-        break;
-    case DatabaseInterface::V14:
-        upgradeDatabaseV14();
-        break;
-    case DatabaseInterface::V15:
-        upgradeDatabaseV15();
-        break;
-    case DatabaseInterface::V16:
-        upgradeDatabaseV16();
-        break;
+    // same rules as mSelectTrackIdFromTitleAlbumTrackDiscNumberQuery: a NULL column matches any value
+    auto isSameValue = [](const QVariant &storedValue, const QVariant &value) {
+        return storedValue.isNull() || (!value.isNull() && storedValue.toString() == value.toString());
+    };
+
+    const auto sameTitleTracks = d->mBatchTracksByTitle.values(oneTrack.title());
+
+    auto isDuplicate = [&](int priority) {
+        return std::any_of(sameTitleTracks.begin(), sameTitleTracks.end(), [&](const auto &oneIdentity) {
+            return oneIdentity.mPriority == priority &&
+                    isSameValue(oneIdentity.mArtist, oneTrack.artist()) &&
+                    isSameValue(oneIdentity.mAlbum, oneTrack.album()) &&
+                    isSameValue(oneIdentity.mAlbumArtist, oneTrack.albumArtist()) &&
+                    isSameValue(oneIdentity.mAlbumPath, trackPath) &&
+                    isSameValue(oneIdentity.mTrackNumber, oneTrack.trackNumber()) &&
+                    isSameValue(oneIdentity.mDiscNumber, oneTrack.discNumber());
+        });
+    };
+
+    int priority = 1;
+    while (isDuplicate(priority)) {
+        ++priority;
     }
+
+    return priority;
 }
 
-void DatabaseInterface::internalInsertOneTrack(const DataTypes::TrackDataType &oneTrack, const QHash<QString, QUrl> &covers)
+bool DatabaseInterface::batchInsertPendingTracks(const QHash<QString, QUrl> &covers)
 {
-    d->mSelectTracksMapping.bindValue(QStringLiteral(":fileName"), oneTrack.resourceURI());
-
-    auto result = execQuery(d->mSelectTracksMapping);
+    if (d->mBatchPendingTracks.isEmpty()) {
+        return true;
+    }
+
+    const auto pendingTracks = d->mBatchPendingTracks;
+    d->mBatchPendingTracks.clear();
+
+    const auto columnsCount = pendingTracks.first().mValues.size();
+
+    auto oneRowText = QStringLiteral("(?");
+    for (int i = 1; i < columnsCount; ++i) {
+        oneRowText += QStringLiteral(", ?");
+    }
+    oneRowText += QStringLiteral(")");
+
+    auto insertTracksText = QStringLiteral("INSERT INTO `Tracks` "
+                                           "("
+                                           "`ID`, "
+                                           "`FileName`, "
+                                           "`Priority`, "
+                                           "`Title`, "
+                                           "`ArtistName`, "
+                                           "`AlbumTitle`, "
+                                           "`AlbumArtistName`, "
+                                           "`AlbumPath`, "
+                                           "`Genre`, "
+                                           "`Composer`, "
+                                           "`Lyricist`, "
+                                           "`Comment`, "
+                                           "`TrackNumber`, "
+                                           "`DiscNumber`, "
+                                           "`Channels`, "
+                                           "`BitRate`, "
+                                           "`SampleRate`, "
+                                           "`Year`,  "
+                                           "`Duration`, "
+                                           "`Rating`, "
+                                           "`HasEmbeddedCover`) "
+                                           "VALUES ") + oneRowText;
+    for (int i = 1; i < pendingTracks.size(); ++i) {
+        insertTracksText += QStringLiteral(", ") + oneRowText;
+    }
+
+    QSqlQuery insertTracksQuery(d->mTracksDatabase);
+    if (!prepareQuery(insertTracksQuery, insertTracksText)) {
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertPendingTracks" << insertTracksQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertPendingTracks" << insertTracksQuery.lastError();
 
-    if (!result || !d->mSelectTracksMapping.isSelect() || !d->mSelectTracksMapping.isActive()) {
         Q_EMIT databaseError();
 
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertTracksList" << d->mSelectTracksMapping.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertTracksList" << d->mSelectTracksMapping.boundValues();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertTracksList" << d->mSelectTracksMapping.lastError();
-
-        d->mSelectTracksMapping.finish();
-
-        rollBackTransaction();
-        Q_EMIT finishInsertingTracksList();
-        return;
+        return false;
     }
 
-    bool isNewTrack = !d->mSelectTracksMapping.next();
-
-    if (isNewTrack) {
-        insertTrackOrigin(oneTrack.resourceURI(), oneTrack.fileModificationTime(),
-                          QDateTime::currentDateTime());
-    } else if (!d->mSelectTracksMapping.record().value(0).isNull() && d->mSelectTracksMapping.record().value(0).toULongLong() != 0) {
-        updateTrackOrigin(oneTrack.resourceURI(), oneTrack.fileModificationTime());
+    for (const auto &onePendingTrack : pendingTracks) {
+        for (const auto &oneValue : onePendingTrack.mValues) {
+            insertTracksQuery.addBindValue(oneValue);
+        }
     }
 
-    d->mSelectTracksMapping.finish();
-
-    bool isInserted = false;
-
-    const auto insertedTrackId = internalInsertTrack(oneTrack, covers, isInserted);
+    auto result = execQuery(insertTracksQuery);
 
-    if (isInserted && insertedTrackId != 0) {
-        d->mInsertedTracks.insert(insertedTrackId);
-    }
-}
+    if (!result || !insertTracksQuery.isActive()) {
+        Q_EMIT databaseError();
 
-void DatabaseInterface::internalInsertOneRadio(const DataTypes::TrackDataType &oneTrack)
-{
-    QSqlQuery query = d->mUpdateRadioQuery;
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertPendingTracks" << insertTracksQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertPendingTracks" << insertTracksQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertPendingTracks" << insertTracksQuery.lastError();
 
-    if (!oneTrack.hasDatabaseId()) {
-        query = d->mInsertRadioQuery;
+        return false;
     }
 
-    query.bindValue(QStringLiteral(":httpAddress"), oneTrack.resourceURI());
-    query.bindValue(QStringLiteral(":radioId"), oneTrack.databaseId());
-    query.bindValue(QStringLiteral(":title"), oneTrack.title());
-    query.bindValue(QStringLiteral(":comment"), oneTrack.comment());
-    query.bindValue(QStringLiteral(":trackRating"), oneTrack.rating());
-    query.bindValue(QStringLiteral(":imageAddress"), oneTrack.albumCover());
-
-    auto result = execQuery(query);
+    insertTracksQuery.finish();
 
-    if (!result || !query.isActive()) {
-        Q_EMIT databaseError();
+    qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::batchInsertPendingTracks" << pendingTracks.size() << "tracks inserted";
 
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertTracksList" << query.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertTracksList" << query.boundValues();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertTracksList" << query.lastError();
-    } else {
-        if (!oneTrack.hasDatabaseId()) {
-            auto radio = internalOneRadioPartialData(internalRadioIdFromHttpAddress(oneTrack.resourceURI().toString()));
+    for (const auto &onePendingTrack : pendingTracks) {
+        const auto &oneTrack = onePendingTrack.mTrack;
+        const auto fileName = oneTrack.resourceURI().toString();
 
-            Q_EMIT radioAdded(radio);
-        } else {
-            auto radio = internalOneRadioPartialData(oneTrack.databaseId());
+        if (!d->mBatchNewFileNames.contains(fileName)) {
+            updateTrackOrigin(oneTrack.resourceURI(), oneTrack.fileModificationTime());
+        }
 
-            Q_EMIT radioModified(radio);
+        if (onePendingTrack.mAlbumId != 0) {
+            if (updateAlbumFromId(onePendingTrack.mAlbumId, covers[fileName], oneTrack, onePendingTrack.mTrackPath)) {
+                auto modifiedTracks = fetchTrackIds(onePendingTrack.mAlbumId);
+                for (auto oneModifiedTrack : modifiedTracks) {
+                    if (oneModifiedTrack != onePendingTrack.mTrackId) {
+                        recordModifiedTrack(oneModifiedTrack);
+                    }
+                }
+            }
+            recordModifiedAlbum(onePendingTrack.mAlbumId);
         }
     }
 
-    query.finish();
+    return true;
 }
 
 void DatabaseInterface::initRequest()
@@ -3936,159 +5712,168 @@ void DatabaseInterface::initRequest()
         }
     }
 
-    {
-        auto selectAllComposersWithFilterText = QStringLiteral("SELECT `ID`, "
-                                                               "`Name` "
-                                                               "FROM `Artists` "
-                                                               "ORDER BY `Name` COLLATE NOCASE");
+    {
+        auto selectAllComposersWithFilterText = QStringLiteral("SELECT `ID`, "
+                                                               "`Name` "
+                                                               "FROM `Artists` "
+                                                               "ORDER BY `Name` COLLATE NOCASE");
+
+        auto result = prepareQuery(d->mSelectAllComposersQuery, selectAllComposersWithFilterText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllComposersQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllComposersQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto selectAllLyricistsWithFilterText = QStringLiteral("SELECT `ID`, "
+                                                               "`Name` "
+                                                               "FROM `Lyricist` "
+                                                               "ORDER BY `Name` COLLATE NOCASE");
+
+        auto result = prepareQuery(d->mSelectAllLyricistsQuery, selectAllLyricistsWithFilterText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllLyricistsQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllLyricistsQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto selectAllTracksColumnsText = QStringLiteral("SELECT "
+                                                         "tracks.`ID`, "
+                                                         "tracks.`Title`, "
+                                                         "album.`ID`, "
+                                                         "tracks.`ArtistName`, "
+                                                         "( "
+                                                         "SELECT "
+                                                         "COUNT(DISTINCT tracksFromAlbum1.`ArtistName`) "
+                                                         "FROM "
+                                                         "`Tracks` tracksFromAlbum1 "
+                                                         "WHERE "
+                                                         "tracksFromAlbum1.`AlbumTitle` = album.`Title` AND "
+                                                         "(tracksFromAlbum1.`AlbumArtistName` = album.`ArtistName` OR "
+                                                         "(tracksFromAlbum1.`AlbumArtistName` IS NULL AND "
+                                                         "album.`ArtistName` IS NULL "
+                                                         ") "
+                                                         ") AND "
+                                                         "tracksFromAlbum1.`AlbumPath` = album.`AlbumPath` "
+                                                         ") AS ArtistsCount, "
+                                                         "( "
+                                                         "SELECT "
+                                                         "GROUP_CONCAT(tracksFromAlbum2.`ArtistName`) "
+                                                         "FROM "
+                                                         "`Tracks` tracksFromAlbum2 "
+                                                         "WHERE "
+                                                         "tracksFromAlbum2.`AlbumTitle` = album.`Title` AND "
+                                                         "(tracksFromAlbum2.`AlbumArtistName` = album.`ArtistName` OR "
+                                                         "(tracksFromAlbum2.`AlbumArtistName` IS NULL AND "
+                                                         "album.`ArtistName` IS NULL "
+                                                         ") "
+                                                         ") AND "
+                                                         "tracksFromAlbum2.`AlbumPath` = album.`AlbumPath` "
+                                                         ") AS AllArtists, "
+                                                         "tracks.`AlbumArtistName`, "
+                                                         "tracksMapping.`FileName`, "
+                                                         "tracksMapping.`FileModifiedTime`, "
+                                                         "tracks.`TrackNumber`, "
+                                                         "tracks.`DiscNumber`, "
+                                                         "tracks.`Duration`, "
+                                                         "tracks.`AlbumTitle`, "
+                                                         "tracks.`Rating`, "
+                                                         "album.`CoverFileName`, "
+                                                         "("
+                                                         "SELECT "
+                                                         "COUNT(DISTINCT tracks2.DiscNumber) <= 1 "
+                                                         "FROM "
+                                                         "`Tracks` tracks2 "
+                                                         "WHERE "
+                                                         "tracks2.`AlbumTitle` = album.`Title` AND "
+                                                         "(tracks2.`AlbumArtistName` = album.`ArtistName` OR "
+                                                         "(tracks2.`AlbumArtistName` IS NULL AND "
+                                                         "album.`ArtistName` IS NULL"
+                                                         ")"
+                                                         ") AND "
+                                                         "tracks2.`AlbumPath` = album.`AlbumPath` "
+                                                         ") as `IsSingleDiscAlbum`, "
+                                                         "trackGenre.`Name`, "
+                                                         "trackComposer.`Name`, "
+                                                         "trackLyricist.`Name`, "
+                                                         "tracks.`Comment`, "
+                                                         "tracks.`Year`, "
+                                                         "tracks.`Channels`, "
+                                                         "tracks.`BitRate`, "
+                                                         "tracks.`SampleRate`, "
+                                                         "tracks.`HasEmbeddedCover`, "
+                                                         "tracksMapping.`ImportDate`, "
+                                                         "tracksMapping.`FirstPlayDate`, "
+                                                         "tracksMapping.`LastPlayDate`, "
+                                                         "tracksMapping.`PlayCounter`, "
+                                                         "tracksMapping.`PlayCounter` / (strftime('%s', 'now') - tracksMapping.`FirstPlayDate`) as PlayFrequency, "
+                                                         "( "
+                                                         "SELECT tracksCover.`FileName` "
+                                                         "FROM "
+                                                         "`Tracks` tracksCover "
+                                                         "WHERE "
+                                                         "tracksCover.`HasEmbeddedCover` = 1 AND "
+                                                         "tracksCover.`AlbumTitle` = album.`Title` AND "
+                                                         "(tracksCover.`AlbumArtistName` = album.`ArtistName` OR "
+                                                         "(tracksCover.`AlbumArtistName` IS NULL AND "
+                                                         "album.`ArtistName` IS NULL "
+                                                         ") "
+                                                         ") AND "
+                                                         "tracksCover.`AlbumPath` = album.`AlbumPath` "
+                                                         ") as EmbeddedCover "
+                                                         "FROM "
+                                                         "`TracksData` tracksMapping "
+                                                         "LEFT JOIN "
+                                                         "`Tracks` tracks "
+                                                         "ON "
+                                                         "tracksMapping.`FileName` = tracks.`FileName` "
+                                                         "LEFT JOIN "
+                                                         "`Albums` album "
+                                                         "ON "
+                                                         "tracks.`AlbumTitle` = album.`Title` AND "
+                                                         "(tracks.`AlbumArtistName` = album.`ArtistName` OR tracks.`AlbumArtistName` IS NULL ) AND "
+                                                         "tracks.`AlbumPath` = album.`AlbumPath` "
+                                                         "LEFT JOIN `Genre` trackGenre ON trackGenre.`Name` = tracks.`Genre` "
+                                                         "LEFT JOIN `Composer` trackComposer ON trackComposer.`Name` = tracks.`Composer` "
+                                                         "LEFT JOIN `Lyricist` trackLyricist ON trackLyricist.`Name` = tracks.`Lyricist` ");
+
+        auto selectAllTracksText = selectAllTracksColumnsText + QStringLiteral("WHERE "
+                                                                               "tracks.`Title` IS NULL OR "
+                                                                               "tracks.`IsPreferred` = 1 ");
 
-        auto result = prepareQuery(d->mSelectAllComposersQuery, selectAllComposersWithFilterText);
+        auto result = prepareQuery(d->mSelectAllTracksQuery, selectAllTracksText);
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllComposersQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllComposersQuery.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllTracksQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllTracksQuery.lastError();
 
             Q_EMIT databaseError();
         }
-    }
-
-    {
-        auto selectAllLyricistsWithFilterText = QStringLiteral("SELECT `ID`, "
-                                                               "`Name` "
-                                                               "FROM `Lyricist` "
-                                                               "ORDER BY `Name` COLLATE NOCASE");
 
-        auto result = prepareQuery(d->mSelectAllLyricistsQuery, selectAllLyricistsWithFilterText);
-
-        if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllLyricistsQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllLyricistsQuery.lastError();
-
-            Q_EMIT databaseError();
-        }
+        d->mSelectAllTracksColumnsText = selectAllTracksColumnsText;
+        d->mSelectTracksPageQueries.clear();
     }
 
     {
-        auto selectAllTracksText = QStringLiteral("SELECT "
-                                                  "tracks.`ID`, "
-                                                  "tracks.`Title`, "
-                                                  "album.`ID`, "
-                                                  "tracks.`ArtistName`, "
-                                                  "( "
-                                                  "SELECT "
-                                                  "COUNT(DISTINCT tracksFromAlbum1.`ArtistName`) "
-                                                  "FROM "
-                                                  "`Tracks` tracksFromAlbum1 "
-                                                  "WHERE "
-                                                  "tracksFromAlbum1.`AlbumTitle` = album.`Title` AND "
-                                                  "(tracksFromAlbum1.`AlbumArtistName` = album.`ArtistName` OR "
-                                                  "(tracksFromAlbum1.`AlbumArtistName` IS NULL AND "
-                                                  "album.`ArtistName` IS NULL "
-                                                  ") "
-                                                  ") AND "
-                                                  "tracksFromAlbum1.`AlbumPath` = album.`AlbumPath` "
-                                                  ") AS ArtistsCount, "
-                                                  "( "
-                                                  "SELECT "
-                                                  "GROUP_CONCAT(tracksFromAlbum2.`ArtistName`) "
-                                                  "FROM "
-                                                  "`Tracks` tracksFromAlbum2 "
-                                                  "WHERE "
-                                                  "tracksFromAlbum2.`AlbumTitle` = album.`Title` AND "
-                                                  "(tracksFromAlbum2.`AlbumArtistName` = album.`ArtistName` OR "
-                                                  "(tracksFromAlbum2.`AlbumArtistName` IS NULL AND "
-                                                  "album.`ArtistName` IS NULL "
-                                                  ") "
-                                                  ") AND "
-                                                  "tracksFromAlbum2.`AlbumPath` = album.`AlbumPath` "
-                                                  ") AS AllArtists, "
-                                                  "tracks.`AlbumArtistName`, "
-                                                  "tracksMapping.`FileName`, "
-                                                  "tracksMapping.`FileModifiedTime`, "
-                                                  "tracks.`TrackNumber`, "
-                                                  "tracks.`DiscNumber`, "
-                                                  "tracks.`Duration`, "
-                                                  "tracks.`AlbumTitle`, "
-                                                  "tracks.`Rating`, "
-                                                  "album.`CoverFileName`, "
-                                                  "("
-                                                  "SELECT "
-                                                  "COUNT(DISTINCT tracks2.DiscNumber) <= 1 "
-                                                  "FROM "
-                                                  "`Tracks` tracks2 "
-                                                  "WHERE "
-                                                  "tracks2.`AlbumTitle` = album.`Title` AND "
-                                                  "(tracks2.`AlbumArtistName` = album.`ArtistName` OR "
-                                                  "(tracks2.`AlbumArtistName` IS NULL AND "
-                                                  "album.`ArtistName` IS NULL"
-                                                  ")"
-                                                  ") AND "
-                                                  "tracks2.`AlbumPath` = album.`AlbumPath` "
-                                                  ") as `IsSingleDiscAlbum`, "
-                                                  "trackGenre.`Name`, "
-                                                  "trackComposer.`Name`, "
-                                                  "trackLyricist.`Name`, "
-                                                  "tracks.`Comment`, "
-                                                  "tracks.`Year`, "
-                                                  "tracks.`Channels`, "
-                                                  "tracks.`BitRate`, "
-                                                  "tracks.`SampleRate`, "
-                                                  "tracks.`HasEmbeddedCover`, "
-                                                  "tracksMapping.`ImportDate`, "
-                                                  "tracksMapping.`FirstPlayDate`, "
-                                                  "tracksMapping.`LastPlayDate`, "
-                                                  "tracksMapping.`PlayCounter`, "
-                                                  "tracksMapping.`PlayCounter` / (strftime('%s', 'now') - tracksMapping.`FirstPlayDate`) as PlayFrequency, "
-                                                  "( "
-                                                  "SELECT tracksCover.`FileName` "
-                                                  "FROM "
-                                                  "`Tracks` tracksCover "
-                                                  "WHERE "
-                                                  "tracksCover.`HasEmbeddedCover` = 1 AND "
-                                                  "tracksCover.`AlbumTitle` = album.`Title` AND "
-                                                  "(tracksCover.`AlbumArtistName` = album.`ArtistName` OR "
-                                                  "(tracksCover.`AlbumArtistName` IS NULL AND "
-                                                  "album.`ArtistName` IS NULL "
-                                                  ") "
-                                                  ") AND "
-                                                  "tracksCover.`AlbumPath` = album.`AlbumPath` "
-                                                  ") as EmbeddedCover "
-                                                  "FROM "
-                                                  "`TracksData` tracksMapping "
-                                                  "LEFT JOIN "
-                                                  "`Tracks` tracks "
-                                                  "ON "
-                                                  "tracksMapping.`FileName` = tracks.`FileName` "
-                                                  "LEFT JOIN "
-                                                  "`Albums` album "
-                                                  "ON "
-                                                  "tracks.`AlbumTitle` = album.`Title` AND "
-                                                  "(tracks.`AlbumArtistName` = album.`ArtistName` OR tracks.`AlbumArtistName` IS NULL ) AND "
-                                                  "tracks.`AlbumPath` = album.`AlbumPath` "
-                                                  "LEFT JOIN `Genre` trackGenre ON trackGenre.`Name` = tracks.`Genre` "
-                                                  "LEFT JOIN `Composer` trackComposer ON trackComposer.`Name` = tracks.`Composer` "
-                                                  "LEFT JOIN `Lyricist` trackLyricist ON trackLyricist.`Name` = tracks.`Lyricist` "
-                                                  "WHERE "
-                                                  "tracks.`Title` IS NULL OR "
-                                                  "tracks.`Priority` = ("
-                                                  "     SELECT "
-                                                  "     MIN(`Priority`) "
-                                                  "     FROM "
-                                                  "     `Tracks` tracks2 "
-                                                  "     WHERE "
-                                                  "     tracks.`Title` = tracks2.`Title` AND "
-                                                  "     (tracks.`ArtistName` IS NULL OR tracks.`ArtistName` = tracks2.`ArtistName`) AND "
-                                                  "     (tracks.`AlbumTitle` IS NULL OR tracks.`AlbumTitle` = tracks2.`AlbumTitle`) AND "
-                                                  "     (tracks.`AlbumArtistName` IS NULL OR tracks.`AlbumArtistName` = tracks2.`AlbumArtistName`) AND "
-                                                  "     (tracks.`AlbumPath` IS NULL OR tracks.`AlbumPath` = tracks2.`AlbumPath`)"
-                                                  ")"
-                                                  "");
+        auto selectTracksCountText = QStringLiteral("SELECT COUNT(*) "
+                                                    "FROM "
+                                                    "`Tracks` tracks "
+                                                    "WHERE "
+                                                    "tracks.`IsPreferred` = 1 ");
 
-        auto result = prepareQuery(d->mSelectAllTracksQuery, selectAllTracksText);
+        auto result = prepareQuery(d->mSelectTracksCountQuery, selectTracksCountText);
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllTracksQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllTracksQuery.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksCountQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksCountQuery.lastError();
 
             Q_EMIT databaseError();
         }
@@ -4218,18 +6003,7 @@ void DatabaseInterface::initRequest()
                                                   "WHERE "
                                                   "tracksMapping.`FileName` = tracks.`FileName` AND "
                                                   "tracksMapping.`PlayCounter` > 0 AND "
-                                                  "tracks.`Priority` = ("
-                                                  "     SELECT "
-                                                  "     MIN(`Priority`) "
-                                                  "     FROM "
-                                                  "     `Tracks` tracks2 "
-                                                  "     WHERE "
-                                                  "     tracks.`Title` = tracks2.`Title` AND "
-                                                  "     (tracks.`ArtistName` IS NULL OR tracks.`ArtistName` = tracks2.`ArtistName`) AND "
-                                                  "     (tracks.`AlbumTitle` IS NULL OR tracks.`AlbumTitle` = tracks2.`AlbumTitle`) AND "
-                                                  "     (tracks.`AlbumArtistName` IS NULL OR tracks.`AlbumArtistName` = tracks2.`AlbumArtistName`) AND "
-                                                  "     (tracks.`AlbumPath` IS NULL OR tracks.`AlbumPath` = tracks2.`AlbumPath`)"
-                                                  ")"
+                                                  "tracks.`IsPreferred` = 1 "
                                                   "ORDER BY tracksMapping.`LastPlayDate` DESC "
                                                   "LIMIT :maximumResults");
 
@@ -4244,6 +6018,7 @@ void DatabaseInterface::initRequest()
     }
 
     {
+        // the play scores are ranked through their index, each filtered query only adds its condition
         auto selectAllTracksText = QStringLiteral("SELECT "
                                                   "tracks.`ID`, "
                                                   "tracks.`Title`, "
@@ -4342,23 +6117,13 @@ void DatabaseInterface::initRequest()
                                                   "LEFT JOIN `Lyricist` trackLyricist ON trackLyricist.`Name` = tracks.`Lyricist` "
                                                   "WHERE "
                                                   "tracksMapping.`FileName` = tracks.`FileName` AND "
-                                                  "tracksMapping.`PlayCounter` > 0 AND "
-                                                  "tracks.`Priority` = ("
-                                                  "     SELECT "
-                                                  "     MIN(`Priority`) "
-                                                  "     FROM "
-                                                  "     `Tracks` tracks2 "
-                                                  "     WHERE "
-                                                  "     tracks.`Title` = tracks2.`Title` AND "
-                                                  "     (tracks.`ArtistName` IS NULL OR tracks.`ArtistName` = tracks2.`ArtistName`) AND "
-                                                  "     (tracks.`AlbumTitle` IS NULL OR tracks.`AlbumTitle` = tracks2.`AlbumTitle`) AND "
-                                                  "     (tracks.`AlbumArtistName` IS NULL OR tracks.`AlbumArtistName` = tracks2.`AlbumArtistName`) AND "
-                                                  "     (tracks.`AlbumPath` IS NULL OR tracks.`AlbumPath` = tracks2.`AlbumPath`)"
-                                                  ")"
-                                                  "ORDER BY CAST(tracksMapping.`PlayCounter` AS REAL) / ((CAST(strftime('%s','now') as INTEGER) - CAST(tracksMapping.`FirstPlayDate` / 1000 as INTEGER)) / CAST(1000 AS REAL)) DESC "
-                                                  "LIMIT :maximumResults");
+                                                  "tracksMapping.`PlayScore` IS NOT NULL AND "
+                                                  "tracks.`IsPreferred` = 1 ");
 
-        auto result = prepareQuery(d->mSelectAllFrequentlyPlayedTracksQuery, selectAllTracksText);
+        const auto frequentlyPlayedOrderText = QStringLiteral("ORDER BY tracksMapping.`PlayScore` DESC "
+                                                              "LIMIT :maximumResults");
+
+        auto result = prepareQuery(d->mSelectAllFrequentlyPlayedTracksQuery, selectAllTracksText + frequentlyPlayedOrderText);
 
         if (!result) {
             qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllFrequentlyPlayedTracksQuery.lastQuery();
@@ -4366,6 +6131,36 @@ void DatabaseInterface::initRequest()
 
             Q_EMIT databaseError();
         }
+
+        result = prepareQuery(d->mSelectFrequentlyPlayedArtistTracksQuery, selectAllTracksText +
+                              QStringLiteral("AND tracks.`ArtistName` = :artistName ") + frequentlyPlayedOrderText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectFrequentlyPlayedArtistTracksQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectFrequentlyPlayedArtistTracksQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+
+        result = prepareQuery(d->mSelectFrequentlyPlayedAlbumTracksQuery, selectAllTracksText +
+                              QStringLiteral("AND album.`ID` = :albumId ") + frequentlyPlayedOrderText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectFrequentlyPlayedAlbumTracksQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectFrequentlyPlayedAlbumTracksQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+
+        result = prepareQuery(d->mSelectFrequentlyPlayedGenreTracksQuery, selectAllTracksText +
+                              QStringLiteral("AND tracks.`Genre` = :genre ") + frequentlyPlayedOrderText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectFrequentlyPlayedGenreTracksQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectFrequentlyPlayedGenreTracksQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
     }
 
     {
@@ -4736,18 +6531,7 @@ void DatabaseInterface::initRequest()
                                                    "WHERE "
                                                    "tracksMapping.`FileName` = tracks.`FileName` AND "
                                                    "album.`ID` = :albumId AND "
-                                                   "tracks.`Priority` = ("
-                                                   "     SELECT "
-                                                   "     MIN(`Priority`) "
-                                                   "     FROM "
-                                                   "     `Tracks` tracks2 "
-                                                   "     WHERE "
-                                                   "     tracks.`Title` = tracks2.`Title` AND "
-                                                   "     (tracks.`ArtistName` IS NULL OR tracks.`ArtistName` = tracks2.`ArtistName`) AND "
-                                                   "     (tracks.`AlbumTitle` IS NULL OR tracks.`AlbumTitle` = tracks2.`AlbumTitle`) AND "
-                                                   "     (tracks.`AlbumArtistName` IS NULL OR tracks.`AlbumArtistName` = tracks2.`AlbumArtistName`) AND "
-                                                   "     (tracks.`AlbumPath` IS NULL OR tracks.`AlbumPath` = tracks2.`AlbumPath`)"
-                                                   ")"
+                                                   "tracks.`IsPreferred` = 1 "
                                                    "ORDER BY tracks.`DiscNumber` ASC, "
                                                    "tracks.`TrackNumber` ASC");
 
@@ -4777,18 +6561,7 @@ void DatabaseInterface::initRequest()
                                                    "WHERE "
                                                    "tracksMapping.`FileName` = tracks.`FileName` AND "
                                                    "album.`ID` = :albumId AND "
-                                                   "tracks.`Priority` = ("
-                                                   "     SELECT "
-                                                   "     MIN(`Priority`) "
-                                                   "     FROM "
-                                                   "     `Tracks` tracks2 "
-                                                   "     WHERE "
-                                                   "     tracks.`Title` = tracks2.`Title` AND "
-                                                   "     (tracks.`ArtistName` IS NULL OR tracks.`ArtistName` = tracks2.`ArtistName`) AND "
-                                                   "     (tracks.`AlbumTitle` IS NULL OR tracks.`AlbumTitle` = tracks2.`AlbumTitle`) AND "
-                                                   "     (tracks.`AlbumArtistName` IS NULL OR tracks.`AlbumArtistName` = tracks2.`AlbumArtistName`) AND "
-                                                   "     (tracks.`AlbumPath` IS NULL OR tracks.`AlbumPath` = tracks2.`AlbumPath`)"
-                                                   ")"
+                                                   "tracks.`IsPreferred` = 1 "
                                                    "ORDER BY tracks.`DiscNumber` ASC, "
                                                    "tracks.`TrackNumber` ASC");
 
@@ -4802,107 +6575,108 @@ void DatabaseInterface::initRequest()
         }
     }
 
-    {
-        auto selectTrackFromIdQueryText = QStringLiteral("SELECT "
-                                                         "tracks.`Id`, "
-                                                         "tracks.`Title`, "
-                                                         "album.`ID`, "
-                                                         "tracks.`ArtistName`, "
-                                                         "( "
-                                                         "SELECT "
-                                                         "COUNT(DISTINCT tracksFromAlbum1.`ArtistName`) "
-                                                         "FROM "
-                                                         "`Tracks` tracksFromAlbum1 "
-                                                         "WHERE "
-                                                         "tracksFromAlbum1.`AlbumTitle` = album.`Title` AND "
-                                                         "(tracksFromAlbum1.`AlbumArtistName` = album.`ArtistName` OR "
-                                                         "(tracksFromAlbum1.`AlbumArtistName` IS NULL AND "
-                                                         "album.`ArtistName` IS NULL "
-                                                         ") "
-                                                         ") AND "
-                                                         "tracksFromAlbum1.`AlbumPath` = album.`AlbumPath` "
-                                                         ") AS ArtistsCount, "
-                                                         "( "
-                                                         "SELECT "
-                                                         "GROUP_CONCAT(tracksFromAlbum2.`ArtistName`) "
-                                                         "FROM "
-                                                         "`Tracks` tracksFromAlbum2 "
-                                                         "WHERE "
-                                                         "tracksFromAlbum2.`AlbumTitle` = album.`Title` AND "
-                                                         "(tracksFromAlbum2.`AlbumArtistName` = album.`ArtistName` OR "
-                                                         "(tracksFromAlbum2.`AlbumArtistName` IS NULL AND "
-                                                         "album.`ArtistName` IS NULL "
-                                                         ") "
-                                                         ") AND "
-                                                         "tracksFromAlbum2.`AlbumPath` = album.`AlbumPath` "
-                                                         ") AS AllArtists, "
-                                                         "tracks.`AlbumArtistName`, "
-                                                         "tracksMapping.`FileName`, "
-                                                         "tracksMapping.`FileModifiedTime`, "
-                                                         "tracks.`TrackNumber`, "
-                                                         "tracks.`DiscNumber`, "
-                                                         "tracks.`Duration`, "
-                                                         "tracks.`AlbumTitle`, "
-                                                         "tracks.`Rating`, "
-                                                         "album.`CoverFileName`, "
-                                                         "("
-                                                         "SELECT "
-                                                         "COUNT(DISTINCT tracks2.DiscNumber) <= 1 "
-                                                         "FROM "
-                                                         "`Tracks` tracks2 "
-                                                         "WHERE "
-                                                         "tracks2.`AlbumTitle` = album.`Title` AND "
-                                                         "(tracks2.`AlbumArtistName` = album.`ArtistName` OR "
-                                                         "(tracks2.`AlbumArtistName` IS NULL AND "
-                                                         "album.`ArtistName` IS NULL"
-                                                         ")"
-                                                         ") AND "
-                                                         "tracks2.`AlbumPath` = album.`AlbumPath` "
-                                                         ") as `IsSingleDiscAlbum`, "
-                                                         "trackGenre.`Name`, "
-                                                         "trackComposer.`Name`, "
-                                                         "trackLyricist.`Name`, "
-                                                         "tracks.`Comment`, "
-                                                         "tracks.`Year`, "
-                                                         "tracks.`Channels`, "
-                                                         "tracks.`BitRate`, "
-                                                         "tracks.`SampleRate`, "
-                                                         "tracks.`HasEmbeddedCover`, "
-                                                         "tracksMapping.`ImportDate`, "
-                                                         "tracksMapping.`FirstPlayDate`, "
-                                                         "tracksMapping.`LastPlayDate`, "
-                                                         "tracksMapping.`PlayCounter`, "
-                                                         "tracksMapping.`PlayCounter` / (strftime('%s', 'now') - tracksMapping.`FirstPlayDate`) as PlayFrequency, "
-                                                         "( "
-                                                         "SELECT tracksCover.`FileName` "
-                                                         "FROM "
-                                                         "`Tracks` tracksCover "
-                                                         "WHERE "
-                                                         "tracksCover.`HasEmbeddedCover` = 1 AND "
-                                                         "tracksCover.`AlbumTitle` = album.`Title` AND "
-                                                         "(tracksCover.`AlbumArtistName` = album.`ArtistName` OR "
-                                                         "(tracksCover.`AlbumArtistName` IS NULL AND "
-                                                         "album.`ArtistName` IS NULL "
-                                                         ") "
-                                                         ") AND "
-                                                         "tracksCover.`AlbumPath` = album.`AlbumPath` "
-                                                         ") as EmbeddedCover "
-                                                         "FROM "
-                                                         "`Tracks` tracks, "
-                                                         "`TracksData` tracksMapping "
-                                                         "LEFT JOIN "
-                                                         "`Albums` album "
-                                                         "ON "
-                                                         "tracks.`AlbumTitle` = album.`Title` AND "
-                                                         "(tracks.`AlbumArtistName` = album.`ArtistName` OR tracks.`AlbumArtistName` IS NULL ) AND "
-                                                         "tracks.`AlbumPath` = album.`AlbumPath` "
-                                                         "LEFT JOIN `Composer` trackComposer ON trackComposer.`Name` = tracks.`Composer` "
-                                                         "LEFT JOIN `Lyricist` trackLyricist ON trackLyricist.`Name` = tracks.`Lyricist` "
-                                                         "LEFT JOIN `Genre` trackGenre ON trackGenre.`Name` = tracks.`Genre` "
-                                                         "WHERE "
-                                                         "tracks.`ID` = :trackId AND "
-                                                         "tracksMapping.`FileName` = tracks.`FileName`"
-                                                         "");
+    {
+        d->mSelectFullTracksText = QStringLiteral("SELECT "
+                                                  "tracks.`Id`, "
+                                                  "tracks.`Title`, "
+                                                  "album.`ID`, "
+                                                  "tracks.`ArtistName`, "
+                                                  "( "
+                                                  "SELECT "
+                                                  "COUNT(DISTINCT tracksFromAlbum1.`ArtistName`) "
+                                                  "FROM "
+                                                  "`Tracks` tracksFromAlbum1 "
+                                                  "WHERE "
+                                                  "tracksFromAlbum1.`AlbumTitle` = album.`Title` AND "
+                                                  "(tracksFromAlbum1.`AlbumArtistName` = album.`ArtistName` OR "
+                                                  "(tracksFromAlbum1.`AlbumArtistName` IS NULL AND "
+                                                  "album.`ArtistName` IS NULL "
+                                                  ") "
+                                                  ") AND "
+                                                  "tracksFromAlbum1.`AlbumPath` = album.`AlbumPath` "
+                                                  ") AS ArtistsCount, "
+                                                  "( "
+                                                  "SELECT "
+                                                  "GROUP_CONCAT(tracksFromAlbum2.`ArtistName`) "
+                                                  "FROM "
+                                                  "`Tracks` tracksFromAlbum2 "
+                                                  "WHERE "
+                                                  "tracksFromAlbum2.`AlbumTitle` = album.`Title` AND "
+                                                  "(tracksFromAlbum2.`AlbumArtistName` = album.`ArtistName` OR "
+                                                  "(tracksFromAlbum2.`AlbumArtistName` IS NULL AND "
+                                                  "album.`ArtistName` IS NULL "
+                                                  ") "
+                                                  ") AND "
+                                                  "tracksFromAlbum2.`AlbumPath` = album.`AlbumPath` "
+                                                  ") AS AllArtists, "
+                                                  "tracks.`AlbumArtistName`, "
+                                                  "tracksMapping.`FileName`, "
+                                                  "tracksMapping.`FileModifiedTime`, "
+                                                  "tracks.`TrackNumber`, "
+                                                  "tracks.`DiscNumber`, "
+                                                  "tracks.`Duration`, "
+                                                  "tracks.`AlbumTitle`, "
+                                                  "tracks.`Rating`, "
+                                                  "album.`CoverFileName`, "
+                                                  "("
+                                                  "SELECT "
+                                                  "COUNT(DISTINCT tracks2.DiscNumber) <= 1 "
+                                                  "FROM "
+                                                  "`Tracks` tracks2 "
+                                                  "WHERE "
+                                                  "tracks2.`AlbumTitle` = album.`Title` AND "
+                                                  "(tracks2.`AlbumArtistName` = album.`ArtistName` OR "
+                                                  "(tracks2.`AlbumArtistName` IS NULL AND "
+                                                  "album.`ArtistName` IS NULL"
+                                                  ")"
+                                                  ") AND "
+                                                  "tracks2.`AlbumPath` = album.`AlbumPath` "
+                                                  ") as `IsSingleDiscAlbum`, "
+                                                  "trackGenre.`Name`, "
+                                                  "trackComposer.`Name`, "
+                                                  "trackLyricist.`Name`, "
+                                                  "tracks.`Comment`, "
+                                                  "tracks.`Year`, "
+                                                  "tracks.`Channels`, "
+                                                  "tracks.`BitRate`, "
+                                                  "tracks.`SampleRate`, "
+                                                  "tracks.`HasEmbeddedCover`, "
+                                                  "tracksMapping.`ImportDate`, "
+                                                  "tracksMapping.`FirstPlayDate`, "
+                                                  "tracksMapping.`LastPlayDate`, "
+                                                  "tracksMapping.`PlayCounter`, "
+                                                  "tracksMapping.`PlayCounter` / (strftime('%s', 'now') - tracksMapping.`FirstPlayDate`) as PlayFrequency, "
+                                                  "( "
+                                                  "SELECT tracksCover.`FileName` "
+                                                  "FROM "
+                                                  "`Tracks` tracksCover "
+                                                  "WHERE "
+                                                  "tracksCover.`HasEmbeddedCover` = 1 AND "
+                                                  "tracksCover.`AlbumTitle` = album.`Title` AND "
+                                                  "(tracksCover.`AlbumArtistName` = album.`ArtistName` OR "
+                                                  "(tracksCover.`AlbumArtistName` IS NULL AND "
+                                                  "album.`ArtistName` IS NULL "
+                                                  ") "
+                                                  ") AND "
+                                                  "tracksCover.`AlbumPath` = album.`AlbumPath` "
+                                                  ") as EmbeddedCover "
+                                                  "FROM "
+                                                  "`Tracks` tracks, "
+                                                  "`TracksData` tracksMapping "
+                                                  "LEFT JOIN "
+                                                  "`Albums` album "
+                                                  "ON "
+                                                  "tracks.`AlbumTitle` = album.`Title` AND "
+                                                  "(tracks.`AlbumArtistName` = album.`ArtistName` OR tracks.`AlbumArtistName` IS NULL ) AND "
+                                                  "tracks.`AlbumPath` = album.`AlbumPath` "
+                                                  "LEFT JOIN `Composer` trackComposer ON trackComposer.`Name` = tracks.`Composer` "
+                                                  "LEFT JOIN `Lyricist` trackLyricist ON trackLyricist.`Name` = tracks.`Lyricist` "
+                                                  "LEFT JOIN `Genre` trackGenre ON trackGenre.`Name` = tracks.`Genre` ");
+
+        auto selectTrackFromIdQueryText = QString(d->mSelectFullTracksText +
+                                                  QStringLiteral("WHERE "
+                                                                 "tracks.`ID` = :trackId AND "
+                                                                 "tracksMapping.`FileName` = tracks.`FileName`"));
 
         auto result = prepareQuery(d->mSelectTrackFromIdQuery, selectTrackFromIdQueryText);
 
@@ -5308,14 +7082,15 @@ void DatabaseInterface::initRequest()
     }
 
     {
-        auto removeTracksMappingQueryText = QStringLiteral("DELETE FROM `TracksData` "
-                                                           "WHERE `FileName` = :fileName");
+        auto selectArtistIsUsedQueryText = QStringLiteral("SELECT "
+                                                          "EXISTS (SELECT 1 FROM `Tracks` WHERE `ArtistName` = :trackArtistName) OR "
+                                                          "EXISTS (SELECT 1 FROM `Albums` WHERE `ArtistName` = :albumArtistName)");
 
-        auto result = prepareQuery(d->mRemoveTracksMapping, removeTracksMappingQueryText);
+        auto result = prepareQuery(d->mSelectArtistIsUsedQuery, selectArtistIsUsedQueryText);
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mRemoveTracksMapping.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mRemoveTracksMapping.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectArtistIsUsedQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectArtistIsUsedQuery.lastError();
 
             Q_EMIT databaseError();
         }
@@ -5535,6 +7310,67 @@ void DatabaseInterface::initRequest()
         }
     }
 
+    {
+        auto selectAllDirectoriesFingerprintsQueryText = QStringLiteral("SELECT "
+                                                                        "directories.`DirectoryPath`, "
+                                                                        "directories.`ParentPath`, "
+                                                                        "directories.`ModificationTime`, "
+                                                                        "directories.`EntriesCount` "
+                                                                        "FROM "
+                                                                        "`ScannedDirectories` directories");
+
+        auto result = prepareQuery(d->mSelectAllDirectoriesFingerprintsQuery, selectAllDirectoriesFingerprintsQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllDirectoriesFingerprintsQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllDirectoriesFingerprintsQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto insertDirectoryFingerprintQueryText = QStringLiteral("INSERT OR REPLACE INTO `ScannedDirectories` "
+                                                                  "(`DirectoryPath`, `ParentPath`, `ModificationTime`, `EntriesCount`) "
+                                                                  "VALUES (:directoryPath, :parentPath, :modificationTime, :entriesCount)");
+
+        auto result = prepareQuery(d->mInsertDirectoryFingerprintQuery, insertDirectoryFingerprintQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mInsertDirectoryFingerprintQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mInsertDirectoryFingerprintQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto removeDirectoryFingerprintQueryText = QStringLiteral("DELETE FROM `ScannedDirectories` "
+                                                                  "WHERE `DirectoryPath` = :directoryPath");
+
+        auto result = prepareQuery(d->mRemoveDirectoryFingerprintQuery, removeDirectoryFingerprintQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mRemoveDirectoryFingerprintQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mRemoveDirectoryFingerprintQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto clearScannedDirectoriesTableText = QStringLiteral("DELETE FROM `ScannedDirectories`");
+
+        auto result = prepareQuery(d->mClearScannedDirectoriesTable, clearScannedDirectoriesTableText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mClearScannedDirectoriesTable.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mClearScannedDirectoriesTable.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
     {
         auto insertMusicSourceQueryText = QStringLiteral("INSERT OR IGNORE INTO `DiscoverSource` (`ID`, `Name`) "
                                                          "VALUES (:discoverId, :name)");
@@ -5577,18 +7413,7 @@ void DatabaseInterface::initRequest()
                                                    "(tracks.`AlbumPath` = album.`AlbumPath` OR tracks.`AlbumPath` IS NULL ) AND "
                                                    "tracks.`ArtistName` = :artist AND "
                                                    "tracksMapping.`FileName` = tracks.`FileName` AND "
-                                                   "tracks.`Priority` = ("
-                                                   "     SELECT "
-                                                   "     MIN(`Priority`) "
-                                                   "     FROM "
-                                                   "     `Tracks` tracks2 "
-                                                   "     WHERE "
-                                                   "     tracks.`Title` = tracks2.`Title` AND "
-                                                   "     (tracks.`ArtistName` IS NULL OR tracks.`ArtistName` = tracks2.`ArtistName`) AND "
-                                                   "     (tracks.`AlbumTitle` IS NULL OR tracks.`AlbumTitle` = tracks2.`AlbumTitle`) AND "
-                                                   "     (tracks.`AlbumArtistName` IS NULL OR tracks.`AlbumArtistName` = tracks2.`AlbumArtistName`) AND "
-                                                   "     (tracks.`AlbumPath` IS NULL OR tracks.`AlbumPath` = tracks2.`AlbumPath`)"
-                                                   ")"
+                                                   "tracks.`IsPreferred` = 1 "
                                                    "");
 
         auto result = prepareQuery(d->mSelectTrackIdFromTitleAlbumIdArtistQuery, selectTrackQueryText);
@@ -6062,18 +7887,7 @@ void DatabaseInterface::initRequest()
                                                               "WHERE "
                                                               "tracks.`ArtistName` = :artistName AND "
                                                               "tracksMapping.`FileName` = tracks.`FileName` AND "
-                                                              "tracks.`Priority` = ("
-                                                              "     SELECT "
-                                                              "     MIN(`Priority`) "
-                                                              "     FROM "
-                                                              "     `Tracks` tracks2 "
-                                                              "     WHERE "
-                                                              "     tracks.`Title` = tracks2.`Title` AND "
-                                                              "     (tracks.`ArtistName` IS NULL OR tracks.`ArtistName` = tracks2.`ArtistName`) AND "
-                                                              "     (tracks.`AlbumTitle` IS NULL OR tracks.`AlbumTitle` = tracks2.`AlbumTitle`) AND "
-                                                              "     (tracks.`AlbumArtistName` IS NULL OR tracks.`AlbumArtistName` = tracks2.`AlbumArtistName`) AND "
-                                                              "     (tracks.`AlbumPath` IS NULL OR tracks.`AlbumPath` = tracks2.`AlbumPath`)"
-                                                              ")"
+                                                              "tracks.`IsPreferred` = 1 "
                                                               "ORDER BY "
                                                               "album.`Title` ASC, "
                                                               "tracks.`DiscNumber` ASC, "
@@ -6191,18 +8005,7 @@ void DatabaseInterface::initRequest()
                                                              "WHERE "
                                                              "tracks.`Genre` = :genre AND "
                                                              "tracksMapping.`FileName` = tracks.`FileName` AND "
-                                                             "tracks.`Priority` = ("
-                                                             "     SELECT "
-                                                             "     MIN(`Priority`) "
-                                                             "     FROM "
-                                                             "     `Tracks` tracks2 "
-                                                             "     WHERE "
-                                                             "     tracks.`Title` = tracks2.`Title` AND "
-                                                             "     (tracks.`ArtistName` IS NULL OR tracks.`ArtistName` = tracks2.`ArtistName`) AND "
-                                                             "     (tracks.`AlbumTitle` IS NULL OR tracks.`AlbumTitle` = tracks2.`AlbumTitle`) AND "
-                                                             "     (tracks.`AlbumArtistName` IS NULL OR tracks.`AlbumArtistName` = tracks2.`AlbumArtistName`) AND "
-                                                             "     (tracks.`AlbumPath` IS NULL OR tracks.`AlbumPath` = tracks2.`AlbumPath`)"
-                                                             ")"
+                                                             "tracks.`IsPreferred` = 1 "
                                                              "ORDER BY "
                                                              "album.`Title` ASC, "
                                                              "tracks.`DiscNumber` ASC, "
@@ -6259,7 +8062,8 @@ void DatabaseInterface::initRequest()
         auto updateTrackStatisticsQueryText = QStringLiteral("UPDATE `TracksData` "
                                                              "SET "
                                                              "`LastPlayDate` = :playDate, "
-                                                             "`PlayCounter` = `PlayCounter` + 1 "
+                                                             "`PlayCounter` = `PlayCounter` + 1, "
+                                                             "`PlayScore` = :playScore "
                                                              "WHERE "
                                                              "`FileName` = :fileName");
 
@@ -6273,6 +8077,23 @@ void DatabaseInterface::initRequest()
         }
     }
 
+    {
+        auto selectTrackPlayScoreQueryText = QStringLiteral("SELECT "
+                                                            "`PlayScore` "
+                                                            "FROM `TracksData` "
+                                                            "WHERE "
+                                                            "`FileName` = :fileName");
+
+        auto result = prepareQuery(d->mSelectTrackPlayScoreQuery, selectTrackPlayScoreQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTrackPlayScoreQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTrackPlayScoreQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
     {
         auto updateTrackFirstPlayStatisticsQueryText = QStringLiteral("UPDATE `TracksData` "
                                                                       "SET "
@@ -6338,21 +8159,6 @@ void DatabaseInterface::initRequest()
         }
     }
 
-    {
-        auto removeTrackQueryText = QStringLiteral("DELETE FROM `Tracks` "
-                                                   "WHERE "
-                                                   "`ID` = :trackId");
-
-        auto result = prepareQuery(d->mRemoveTrackQuery, removeTrackQueryText);
-
-        if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mRemoveTrackQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mRemoveTrackQuery.lastError();
-
-            Q_EMIT databaseError();
-        }
-    }
-
     {
         auto removeAlbumQueryText = QStringLiteral("DELETE FROM `Albums` "
                                                    "WHERE "
@@ -6383,6 +8189,115 @@ void DatabaseInterface::initRequest()
         }
     }
 
+    d->mHasSearchIndex = d->mTracksDatabase.tables().contains(QStringLiteral("TracksSearch"));
+
+    if (d->mHasSearchIndex) {
+        QSqlQuery searchIndexQuery(d->mTracksDatabase);
+
+        const auto result = searchIndexQuery.exec(QStringLiteral("SELECT `sql` FROM `sqlite_master` WHERE `name` = 'TracksSearch'"));
+
+        d->mSearchIndexIsTrigram = result && searchIndexQuery.next() &&
+                searchIndexQuery.value(0).toString().contains(QStringLiteral("trigram"));
+    }
+
+    if (d->mHasSearchIndex) {
+        auto searchTracksQueryText = QStringLiteral("SELECT "
+                                                    "`TracksSearch`.`rowid` "
+                                                    "FROM "
+                                                    "`TracksSearch` "
+                                                    "WHERE "
+                                                    "`TracksSearch` MATCH :searchText "
+                                                    "ORDER BY `TracksSearch`.`rank`");
+
+        auto result = prepareQuery(d->mSearchTracksQuery, searchTracksQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSearchTracksQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSearchTracksQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+
+        auto searchAlbumsQueryText = QStringLiteral("SELECT "
+                                                    "album.`ID` "
+                                                    "FROM "
+                                                    "`TracksSearch` "
+                                                    "JOIN `Tracks` tracks ON tracks.`ID` = `TracksSearch`.`rowid` "
+                                                    "JOIN `Albums` album ON "
+                                                    "album.`Title` = tracks.`AlbumTitle` AND "
+                                                    "(album.`ArtistName` = tracks.`AlbumArtistName` OR "
+                                                    "(album.`ArtistName` IS NULL AND "
+                                                    "tracks.`AlbumArtistName` IS NULL"
+                                                    ")"
+                                                    ") AND "
+                                                    "album.`AlbumPath` = tracks.`AlbumPath` "
+                                                    "WHERE "
+                                                    "`TracksSearch` MATCH :searchText "
+                                                    "GROUP BY album.`ID` "
+                                                    "ORDER BY MIN(`TracksSearch`.`rank`)");
+
+        result = prepareQuery(d->mSearchAlbumsQuery, searchAlbumsQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSearchAlbumsQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSearchAlbumsQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+
+        auto searchArtistsQueryText = QStringLiteral("SELECT "
+                                                     "matches.`ID` "
+                                                     "FROM "
+                                                     "("
+                                                     "SELECT artists.`ID`, `TracksSearch`.`rank` as Rank "
+                                                     "FROM "
+                                                     "`TracksSearch` "
+                                                     "JOIN `Tracks` tracks ON tracks.`ID` = `TracksSearch`.`rowid` "
+                                                     "JOIN `Artists` artists ON artists.`Name` = tracks.`ArtistName` "
+                                                     "WHERE "
+                                                     "`TracksSearch` MATCH :artistSearchText "
+                                                     "UNION ALL "
+                                                     "SELECT artists.`ID`, `TracksSearch`.`rank` as Rank "
+                                                     "FROM "
+                                                     "`TracksSearch` "
+                                                     "JOIN `Tracks` tracks ON tracks.`ID` = `TracksSearch`.`rowid` "
+                                                     "JOIN `Artists` artists ON artists.`Name` = tracks.`AlbumArtistName` "
+                                                     "WHERE "
+                                                     "`TracksSearch` MATCH :albumArtistSearchText "
+                                                     ") matches "
+                                                     "GROUP BY matches.`ID` "
+                                                     "ORDER BY MIN(matches.Rank)");
+
+        result = prepareQuery(d->mSearchArtistsQuery, searchArtistsQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSearchArtistsQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSearchArtistsQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+
+        auto searchGenresQueryText = QStringLiteral("SELECT "
+                                                    "genres.`ID` "
+                                                    "FROM "
+                                                    "`TracksSearch` "
+                                                    "JOIN `Tracks` tracks ON tracks.`ID` = `TracksSearch`.`rowid` "
+                                                    "JOIN `Genre` genres ON genres.`Name` = tracks.`Genre` "
+                                                    "WHERE "
+                                                    "`TracksSearch` MATCH :searchText "
+                                                    "GROUP BY genres.`ID` "
+                                                    "ORDER BY MIN(`TracksSearch`.`rank`)");
+
+        result = prepareQuery(d->mSearchGenresQuery, searchGenresQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSearchGenresQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSearchGenresQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
     finishTransaction();
 
     d->mInitFinished = true;
@@ -6398,31 +8313,44 @@ qulonglong DatabaseInterface::insertAlbum(const QString &title, const QString &a
         return result;
     }
 
-    d->mSelectAlbumIdFromTitleAndArtistQuery.bindValue(QStringLiteral(":title"), title);
-    d->mSelectAlbumIdFromTitleAndArtistQuery.bindValue(QStringLiteral(":albumPath"), trackPath);
-    d->mSelectAlbumIdFromTitleAndArtistQuery.bindValue(QStringLiteral(":artistName"), albumArtist);
+    const auto albumKey = QStringList{title, albumArtist, trackPath};
 
-    auto queryResult = execQuery(d->mSelectAlbumIdFromTitleAndArtistQuery);
+    if (d->mIsBatchInsertion) {
+        result = d->mBatchAlbumIds.value(albumKey);
+    }
 
-    if (!queryResult || !d->mSelectAlbumIdFromTitleAndArtistQuery.isSelect() || !d->mSelectAlbumIdFromTitleAndArtistQuery.isActive()) {
-        Q_EMIT databaseError();
+    if (result == 0) {
+        d->mSelectAlbumIdFromTitleAndArtistQuery.bindValue(QStringLiteral(":title"), title);
+        d->mSelectAlbumIdFromTitleAndArtistQuery.bindValue(QStringLiteral(":albumPath"), trackPath);
+        d->mSelectAlbumIdFromTitleAndArtistQuery.bindValue(QStringLiteral(":artistName"), albumArtist);
 
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertAlbum" << d->mSelectAlbumIdFromTitleAndArtistQuery.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertAlbum" << d->mSelectAlbumIdFromTitleAndArtistQuery.boundValues();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertAlbum" << d->mSelectAlbumIdFromTitleAndArtistQuery.lastError();
+        auto queryResult = execQuery(d->mSelectAlbumIdFromTitleAndArtistQuery);
 
-        d->mSelectAlbumIdFromTitleAndArtistQuery.finish();
+        if (!queryResult || !d->mSelectAlbumIdFromTitleAndArtistQuery.isSelect() || !d->mSelectAlbumIdFromTitleAndArtistQuery.isActive()) {
+            Q_EMIT databaseError();
 
-        return result;
-    }
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertAlbum" << d->mSelectAlbumIdFromTitleAndArtistQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertAlbum" << d->mSelectAlbumIdFromTitleAndArtistQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertAlbum" << d->mSelectAlbumIdFromTitleAndArtistQuery.lastError();
+
+            d->mSelectAlbumIdFromTitleAndArtistQuery.finish();
+
+            return result;
+        }
 
-    if (d->mSelectAlbumIdFromTitleAndArtistQuery.next()) {
-        result = d->mSelectAlbumIdFromTitleAndArtistQuery.record().value(0).toULongLong();
+        if (d->mSelectAlbumIdFromTitleAndArtistQuery.next()) {
+            result = d->mSelectAlbumIdFromTitleAndArtistQuery.record().value(0).toULongLong();
+        }
 
         d->mSelectAlbumIdFromTitleAndArtistQuery.finish();
 
+        if (result != 0 && d->mIsBatchInsertion) {
+            d->mBatchAlbumIds[albumKey] = result;
+        }
+    }
+
+    if (result != 0) {
         if (!albumArtist.isEmpty()) {
-            const auto similarAlbum = internalOneAlbumPartialData(result);
             updateAlbumArtist(result, title, trackPath, albumArtist);
             if (updateAlbumCover(result, albumArtURI)) {
                 recordModifiedAlbum(result);
@@ -6432,8 +8360,6 @@ qulonglong DatabaseInterface::insertAlbum(const QString &title, const QString &a
         return result;
     }
 
-    d->mSelectAlbumIdFromTitleAndArtistQuery.finish();
-
     d->mInsertAlbumQuery.bindValue(QStringLiteral(":albumId"), d->mAlbumId);
     d->mInsertAlbumQuery.bindValue(QStringLiteral(":title"), title);
     if (!albumArtist.isEmpty()) {
@@ -6445,7 +8371,7 @@ qulonglong DatabaseInterface::insertAlbum(const QString &title, const QString &a
     d->mInsertAlbumQuery.bindValue(QStringLiteral(":albumPath"), trackPath);
     d->mInsertAlbumQuery.bindValue(QStringLiteral(":coverFileName"), albumArtURI);
 
-    queryResult = execQuery(d->mInsertAlbumQuery);
+    auto queryResult = execQuery(d->mInsertAlbumQuery);
 
     if (!queryResult || !d->mInsertAlbumQuery.isActive()) {
         Q_EMIT databaseError();
@@ -6467,6 +8393,10 @@ qulonglong DatabaseInterface::insertAlbum(const QString &title, const QString &a
 
     d->mInsertedAlbums.insert(result);
 
+    if (d->mIsBatchInsertion) {
+        d->mBatchAlbumIds[albumKey] = result;
+    }
+
     return result;
 }
 
@@ -6494,6 +8424,10 @@ qulonglong DatabaseInterface::insertArtist(const QString &name)
         return result;
     }
 
+    if (const auto batchId = d->mBatchArtistIds.constFind(name); batchId != d->mBatchArtistIds.constEnd()) {
+        return batchId.value();
+    }
+
     d->mSelectArtistByNameQuery.bindValue(QStringLiteral(":name"), name);
 
     auto queryResult = execQuery(d->mSelectArtistByNameQuery);
@@ -6556,6 +8490,10 @@ qulonglong DatabaseInterface::insertComposer(const QString &name)
         return result;
     }
 
+    if (const auto batchId = d->mBatchComposerIds.constFind(name); batchId != d->mBatchComposerIds.constEnd()) {
+        return batchId.value();
+    }
+
     d->mSelectComposerByNameQuery.bindValue(QStringLiteral(":name"), name);
 
     auto queryResult = execQuery(d->mSelectComposerByNameQuery);
@@ -6606,7 +8544,8 @@ qulonglong DatabaseInterface::insertComposer(const QString &name)
 
     d->mInsertComposerQuery.finish();
 
-    Q_EMIT composersAdded(internalAllComposersPartialData());
+    auto allComposers = internalAllComposersPartialData();
+    notifyAfterCommit([this, allComposers]() {Q_EMIT composersAdded(allComposers);});
 
     return result;
 }
@@ -6619,6 +8558,10 @@ qulonglong DatabaseInterface::insertGenre(const QString &name)
         return result;
     }
 
+    if (const auto batchId = d->mBatchGenreIds.constFind(name); batchId != d->mBatchGenreIds.constEnd()) {
+        return batchId.value();
+    }
+
     d->mSelectGenreByNameQuery.bindValue(QStringLiteral(":name"), name);
 
     auto queryResult = execQuery(d->mSelectGenreByNameQuery);
@@ -6668,9 +8611,11 @@ qulonglong DatabaseInterface::insertGenre(const QString &name)
 
     d->mInsertGenreQuery.finish();
 
-    Q_EMIT genresAdded({{{DataTypes::DatabaseIdRole, result},
-                         {DataTypes::TitleRole, name},
-                         {DataTypes::ElementTypeRole, ElisaUtils::Genre}}});
+    notifyAfterCommit([this, result, name]() {
+        Q_EMIT genresAdded({{{DataTypes::DatabaseIdRole, result},
+                             {DataTypes::TitleRole, name},
+                             {DataTypes::ElementTypeRole, ElisaUtils::Genre}}});
+    });
 
     return result;
 }
@@ -6749,9 +8694,15 @@ qulonglong DatabaseInterface::internalInsertTrack(const DataTypes::TrackDataType
                                trackPath, oneTrack.hasEmbeddedCover() ? QUrl{} : albumCover);
 
     auto oldAlbumId = albumId;
-    auto existingTrackId = internalTrackIdFromFileName(oneTrack.resourceURI());
+    auto existingTrackId = (d->mIsBatchInsertion ? d->mBatchTracksMapping.value(oneTrack.resourceURI().toString()) :
+                                                   internalTrackIdFromFileName(oneTrack.resourceURI()));
     bool isModifiedTrack = (existingTrackId != 0);
 
+    if (isModifiedTrack && !oneTrack.title().isEmpty() && d->mIsBatchInsertion) {
+        // the pending tracks may belong to the albums counted below
+        batchInsertPendingTracks(covers);
+    }
+
     if (isModifiedTrack && !oneTrack.title().isEmpty()) {
         resultId = existingTrackId;
 
@@ -6846,7 +8797,7 @@ qulonglong DatabaseInterface::internalInsertTrack(const DataTypes::TrackDataType
                 }
             } else {
                 removeAlbumInDatabase(oldAlbumId);
-                Q_EMIT albumRemoved(oldAlbumId);
+                notifyAfterCommit([this, oldAlbumId]() {Q_EMIT albumRemoved(oldAlbumId);});
             }
         }
 
@@ -6861,95 +8812,72 @@ qulonglong DatabaseInterface::internalInsertTrack(const DataTypes::TrackDataType
     }
 
     int priority = 1;
-    while(true) {
-        auto otherTrackId = getDuplicateTrackIdFromTitleAlbumTrackDiscNumber(oneTrack.title(), oneTrack.artist(), oneTrack.album(),
-                                                                             oneTrack.albumArtist(), trackPath, oneTrack.trackNumber(),
-                                                                             oneTrack.discNumber(), priority);
+    if (d->mIsBatchInsertion) {
+        priority = batchTrackPriority(oneTrack, trackPath);
+    } else {
+        while(true) {
+            auto otherTrackId = getDuplicateTrackIdFromTitleAlbumTrackDiscNumber(oneTrack.title(), oneTrack.artist(), oneTrack.album(),
+                                                                                 oneTrack.albumArtist(), trackPath, oneTrack.trackNumber(),
+                                                                                 oneTrack.discNumber(), priority);
 
-        if (otherTrackId) {
-            ++priority;
-        } else {
-            break;
+            if (otherTrackId) {
+                ++priority;
+            } else {
+                break;
+            }
         }
     }
 
     resultId = existingTrackId;
 
     if (!oneTrack.title().isEmpty()) {
-        d->mInsertTrackQuery.bindValue(QStringLiteral(":trackId"), existingTrackId);
-        d->mInsertTrackQuery.bindValue(QStringLiteral(":fileName"), oneTrack.resourceURI());
-        d->mInsertTrackQuery.bindValue(QStringLiteral(":priority"), priority);
-        d->mInsertTrackQuery.bindValue(QStringLiteral(":title"), oneTrack.title());
+        // values of the columns of mInsertTrackQuery, in order
+        auto trackValues = QVariantList{};
+        trackValues.reserve(21);
+        trackValues.push_back(existingTrackId);
+        trackValues.push_back(oneTrack.resourceURI());
+        trackValues.push_back(priority);
+        trackValues.push_back(oneTrack.title());
         if (oneTrack.hasArtist()) {
             insertArtist(oneTrack.artist());
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":artistName"), oneTrack.artist());
-        } else {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":artistName"), {});
-        }
-        if (oneTrack.hasAlbum()) {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":albumTitle"), oneTrack.album());
-        } else {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":albumTitle"), {});
-        }
-        if (oneTrack.hasAlbumArtist()) {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":albumArtistName"), oneTrack.albumArtist());
-        } else {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":albumArtistName"), {});
-        }
-        d->mInsertTrackQuery.bindValue(QStringLiteral(":albumPath"), trackPath);
-        if (oneTrack.hasTrackNumber()) {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":trackNumber"), oneTrack.trackNumber());
-        } else {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":trackNumber"), {});
-        }
-        if (oneTrack.hasDiscNumber()) {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":discNumber"), oneTrack.discNumber());
-        } else {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":discNumber"), {});
-        }
-        d->mInsertTrackQuery.bindValue(QStringLiteral(":trackDuration"), QVariant::fromValue<qlonglong>(oneTrack.duration().msecsSinceStartOfDay()));
-        d->mInsertTrackQuery.bindValue(QStringLiteral(":trackRating"), oneTrack.rating());
-        if (insertGenre(oneTrack.genre()) != 0) {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":genre"), oneTrack.genre());
-        } else {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":genre"), {});
-        }
-        if (insertComposer(oneTrack.composer()) != 0) {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":composer"), oneTrack.composer());
-        } else {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":composer"), {});
-        }
-        if (insertLyricist(oneTrack.lyricist()) != 0) {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":lyricist"), oneTrack.lyricist());
-        } else {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":lyricist"), {});
-        }
-        if (oneTrack.hasComment()) {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":comment"), oneTrack.comment());
+            trackValues.push_back(oneTrack.artist());
         } else {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":comment"), {});
-        }
-        if (oneTrack.hasYear()) {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":year"), oneTrack.year());
-        } else {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":year"), {});
-        }
-        if (oneTrack.hasChannels()) {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":channels"), oneTrack.channels());
-        } else {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":channels"), {});
-        }
-        if (oneTrack.hasBitRate()) {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":bitRate"), oneTrack.bitRate());
-        } else {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":bitRate"), {});
+            trackValues.push_back({});
+        }
+        trackValues.push_back(oneTrack.hasAlbum() ? QVariant{oneTrack.album()} : QVariant{});
+        trackValues.push_back(oneTrack.hasAlbumArtist() ? QVariant{oneTrack.albumArtist()} : QVariant{});
+        trackValues.push_back(trackPath);
+        trackValues.push_back(insertGenre(oneTrack.genre()) != 0 ? QVariant{oneTrack.genre()} : QVariant{});
+        trackValues.push_back(insertComposer(oneTrack.composer()) != 0 ? QVariant{oneTrack.composer()} : QVariant{});
+        trackValues.push_back(insertLyricist(oneTrack.lyricist()) != 0 ? QVariant{oneTrack.lyricist()} : QVariant{});
+        trackValues.push_back(oneTrack.hasComment() ? QVariant{oneTrack.comment()} : QVariant{});
+        trackValues.push_back(oneTrack.hasTrackNumber() ? QVariant{oneTrack.trackNumber()} : QVariant{});
+        trackValues.push_back(oneTrack.hasDiscNumber() ? QVariant{oneTrack.discNumber()} : QVariant{});
+        trackValues.push_back(oneTrack.hasChannels() ? QVariant{oneTrack.channels()} : QVariant{});
+        trackValues.push_back(oneTrack.hasBitRate() ? QVariant{oneTrack.bitRate()} : QVariant{});
+        trackValues.push_back(oneTrack.hasSampleRate() ? QVariant{oneTrack.sampleRate()} : QVariant{});
+        trackValues.push_back(oneTrack.hasYear() ? QVariant{oneTrack.year()} : QVariant{});
+        trackValues.push_back(QVariant::fromValue<qlonglong>(oneTrack.duration().msecsSinceStartOfDay()));
+        trackValues.push_back(oneTrack.rating());
+        trackValues.push_back(oneTrack.hasEmbeddedCover());
+
+        if (d->mIsBatchInsertion) {
+            d->mBatchTracksByTitle.insert(oneTrack.title(), {priority, trackValues[4], trackValues[5], trackValues[6],
+                                                             trackValues[7], trackValues[12], trackValues[13]});
+            d->mBatchPendingTracks.push_back({oneTrack, trackValues, trackPath, resultId, albumId});
+
+            ++d->mTrackId;
+
+            if (d->mBatchPendingTracks.size() >= BatchChunkSize) {
+                batchInsertPendingTracks(covers);
+            }
+
+            return resultId;
         }
-        if (oneTrack.hasSampleRate()) {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":sampleRate"), oneTrack.sampleRate());
-        } else {
-            d->mInsertTrackQuery.bindValue(QStringLiteral(":sampleRate"), {});
+
+        for (int i = 0; i < trackValues.size(); ++i) {
+            d->mInsertTrackQuery.bindValue(i, trackValues[i]);
         }
-        d->mInsertTrackQuery.bindValue(QStringLiteral(":hasEmbeddedCover"), oneTrack.hasEmbeddedCover());
 
         auto result = execQuery(d->mInsertTrackQuery);
         qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalInsertTrack" << oneTrack << "is inserted";
@@ -7085,6 +9013,86 @@ DataTypes::TrackDataType DatabaseInterface::buildTrackDataFromDatabaseRecord(con
     return result;
 }
 
+DataTypes::TrackRecord DatabaseInterface::buildTrackRecordFromDatabaseRecord(const QSqlRecord &trackRecord) const
+{
+    DataTypes::TrackRecord result;
+
+    result.setDatabaseId(trackRecord.value(0).toULongLong());
+    result.setTitle(trackRecord.value(1).toString());
+    if (!trackRecord.value(12).isNull()) {
+        result.setAlbum(trackRecord.value(12).toString());
+        result.setAlbumId(trackRecord.value(2).toULongLong());
+    }
+    if (!trackRecord.value(3).isNull()) {
+        result.setArtist(trackRecord.value(3).toString());
+    }
+
+    if (!trackRecord.value(6).isNull()) {
+        result.setIsValidAlbumArtist(true);
+        result.setAlbumArtist(trackRecord.value(6).toString());
+    } else {
+        result.setIsValidAlbumArtist(false);
+        if (trackRecord.value(4).toInt() == 1) {
+            result.setAlbumArtist(trackRecord.value(3).toString());
+        } else if (trackRecord.value(4).toInt() > 1) {
+            result.setAlbumArtist(i18n("Various Artists"));
+        }
+    }
+
+    result.setResourceURI(trackRecord.value(7).toUrl());
+    if (!trackRecord.value(9).isNull()) {
+        result.setTrackNumber(trackRecord.value(9).toInt());
+    }
+    if (!trackRecord.value(10).isNull()) {
+        result.setDiscNumber(trackRecord.value(10).toInt());
+    }
+    result.setDuration(QTime::fromMSecsSinceStartOfDay(trackRecord.value(11).toInt()));
+    result.setRating(trackRecord.value(13).toInt());
+    if (!trackRecord.value(14).toString().isEmpty()) {
+        result.setAlbumCover(QUrl(trackRecord.value(14).toString()));
+    } else if (!trackRecord.value(30).toString().isEmpty()) {
+        result.setAlbumCover(QUrl{QLatin1String("image://cover/") + trackRecord.value(30).toUrl().toLocalFile()});
+    }
+    result.setIsSingleDiscAlbum(trackRecord.value(15).toBool());
+    if (!trackRecord.value(16).isNull()) {
+        result.setGenre(trackRecord.value(16).toString());
+    }
+    if (!trackRecord.value(17).isNull()) {
+        result.setComposer(trackRecord.value(17).toString());
+    }
+    if (!trackRecord.value(18).isNull()) {
+        result.setLyricist(trackRecord.value(18).toString());
+    }
+    if (!trackRecord.value(19).isNull()) {
+        result.setComment(trackRecord.value(19).toString());
+    }
+    if (!trackRecord.value(20).isNull()) {
+        result.setYear(trackRecord.value(20).toInt());
+    }
+    if (!trackRecord.value(21).isNull()) {
+        result.setChannels(trackRecord.value(21).toInt());
+    }
+    if (!trackRecord.value(22).isNull()) {
+        result.setBitRate(trackRecord.value(22).toInt());
+    }
+    if (!trackRecord.value(23).isNull()) {
+        result.setSampleRate(trackRecord.value(23).toInt());
+    }
+    result.setHasEmbeddedCover(trackRecord.value(24).toBool());
+    result.setFileModificationTime(trackRecord.value(8).toDateTime());
+    if (!trackRecord.value(26).isNull()) {
+        result.setFirstPlayDate(trackRecord.value(26).toLongLong());
+    }
+    if (!trackRecord.value(27).isNull()) {
+        result.setLastPlayDate(trackRecord.value(27).toLongLong());
+    }
+    result.setPlayCounter(trackRecord.value(28).toInt());
+    result.setPlayFrequency(trackRecord.value(29).toDouble());
+    result.setElementType(ElisaUtils::Track);
+
+    return result;
+}
+
 DataTypes::TrackDataType DatabaseInterface::buildRadioDataFromDatabaseRecord(const QSqlRecord &trackRecord) const
 {
     DataTypes::TrackDataType result;
@@ -7107,77 +9115,148 @@ DataTypes::TrackDataType DatabaseInterface::buildRadioDataFromDatabaseRecord(con
 
 void DatabaseInterface::internalRemoveTracksList(const QList<QUrl> &removedTracks)
 {
-    QSet<qulonglong> modifiedAlbums;
-
     QUrl::FormattingOptions currentOptions = QUrl::PreferLocalFile |
             QUrl::RemoveAuthority | QUrl::RemoveFilename | QUrl::RemoveFragment |
             QUrl::RemovePassword | QUrl::RemovePort | QUrl::RemoveQuery |
             QUrl::RemoveScheme | QUrl::RemoveUserInfo;
 
+    auto removedFileNames = QStringList{};
+    auto removedFileNamesValues = QVariantList{};
+    removedFileNames.reserve(removedTracks.size());
+    removedFileNamesValues.reserve(removedTracks.size());
     for (const auto &removedTrackFileName : removedTracks) {
-        auto removedTrackId = internalTrackIdFromFileName(removedTrackFileName);
+        removedFileNames.push_back(removedTrackFileName.toString());
+        removedFileNamesValues.push_back(removedFileNames.last());
+    }
+
+    auto removedTracksMapping = QHash<QString, qulonglong>{};
+    if (!batchSelectTracksMapping(removedFileNames, removedTracksMapping)) {
+        return;
+    }
 
-        Q_EMIT trackRemoved(removedTrackId);
+    auto removedTrackIds = QList<qulonglong>{};
+    auto knownTrackIds = QSet<qulonglong>{};
+    for (const auto &removedFileName : qAsConst(removedFileNames)) {
+        const auto removedTrackId = removedTracksMapping.value(removedFileName);
+        if (removedTrackId != 0 && !knownTrackIds.contains(removedTrackId)) {
+            knownTrackIds.insert(removedTrackId);
+            removedTrackIds.push_back(removedTrackId);
+        }
+    }
+
+    auto allRemovedTracks = QHash<qulonglong, DataTypes::TrackDataType>{};
+    if (!batchSelectTracksFromIds(removedTrackIds, allRemovedTracks)) {
+        return;
+    }
+
+    auto removedTrackIdsValues = QVariantList{};
+    auto modifiedAlbums = QList<qulonglong>{};
+    auto lastTrackFromAlbum = QHash<qulonglong, DataTypes::TrackDataType>{};
+    auto albumIdsCache = QHash<QStringList, qulonglong>{};
+    auto modifiedArtists = QStringList{};
+    auto knownArtists = QSet<QString>{};
 
-        auto oneRemovedTrack = internalTrackFromDatabaseId(removedTrackId);
+    for (const auto removedTrackId : qAsConst(removedTrackIds)) {
+        const auto &oneRemovedTrack = allRemovedTracks[removedTrackId];
 
-        removeTrackInDatabase(removedTrackId);
+        removedTrackIdsValues.push_back(removedTrackId);
 
         const auto &trackPath = oneRemovedTrack.resourceURI().toString(currentOptions);
-        const auto &modifiedAlbumId = internalAlbumIdFromTitleAndArtist(oneRemovedTrack.album(), oneRemovedTrack.albumArtist(), trackPath);
-        const auto &allTracksFromArtist = internalTracksFromAuthor(oneRemovedTrack.artist());
-        const auto &allAlbumsFromArtist = internalAlbumIdsFromAuthor(oneRemovedTrack.artist());
-        const auto &removedArtistId = internalArtistIdFromName(oneRemovedTrack.artist());
+        const auto albumKey = QStringList{oneRemovedTrack.album(), oneRemovedTrack.albumArtist(), trackPath};
+        auto itAlbumId = albumIdsCache.find(albumKey);
+        if (itAlbumId == albumIdsCache.end()) {
+            itAlbumId = albumIdsCache.insert(albumKey, internalAlbumIdFromTitleAndArtist(oneRemovedTrack.album(), oneRemovedTrack.albumArtist(), trackPath));
+        }
 
+        const auto modifiedAlbumId = itAlbumId.value();
         if (modifiedAlbumId) {
-            recordModifiedAlbum(modifiedAlbumId);
-            modifiedAlbums.insert(modifiedAlbumId);
-            updateAlbumFromId(modifiedAlbumId, oneRemovedTrack.albumCover(), oneRemovedTrack, trackPath);
+            if (!lastTrackFromAlbum.contains(modifiedAlbumId)) {
+                modifiedAlbums.push_back(modifiedAlbumId);
+            }
+            lastTrackFromAlbum[modifiedAlbumId] = oneRemovedTrack;
         }
 
-        if (removedArtistId != 0 && allTracksFromArtist.isEmpty() && allAlbumsFromArtist.isEmpty()) {
-            removeArtistInDatabase(removedArtistId);
-            Q_EMIT artistRemoved(removedArtistId);
+        if (!knownArtists.contains(oneRemovedTrack.artist())) {
+            knownArtists.insert(oneRemovedTrack.artist());
+            modifiedArtists.push_back(oneRemovedTrack.artist());
         }
+    }
 
-        d->mRemoveTracksMapping.bindValue(QStringLiteral(":fileName"), removedTrackFileName.toString());
-
-        auto result = execQuery(d->mRemoveTracksMapping);
-
-        if (!result || !d->mRemoveTracksMapping.isActive()) {
-            Q_EMIT databaseError();
+    notifyAfterCommit([this, removedTrackIds]() {
+        for (const auto removedTrackId : removedTrackIds) {
+            Q_EMIT trackRemoved(removedTrackId);
+        }
+    });
 
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalRemoveTracksList" << d->mRemoveTracksMapping.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalRemoveTracksList" << d->mRemoveTracksMapping.boundValues();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalRemoveTracksList" << d->mRemoveTracksMapping.lastError();
+    batchDeleteRows(QStringLiteral("Tracks"), QStringLiteral("ID"), removedTrackIdsValues);
 
-            continue;
-        }
+    for (const auto modifiedAlbumId : qAsConst(modifiedAlbums)) {
+        const auto &lastRemovedTrack = lastTrackFromAlbum[modifiedAlbumId];
 
-        d->mRemoveTracksMapping.finish();
+        recordModifiedAlbum(modifiedAlbumId);
+        updateAlbumFromId(modifiedAlbumId, lastRemovedTrack.albumCover(), lastRemovedTrack,
+                          lastRemovedTrack.resourceURI().toString(currentOptions));
     }
 
-    for (auto modifiedAlbumId : modifiedAlbums) {
+    batchDeleteRows(QStringLiteral("TracksData"), QStringLiteral("FileName"), removedFileNamesValues);
+
+    for (const auto modifiedAlbumId : qAsConst(modifiedAlbums)) {
         const auto &modifiedAlbumData = internalOneAlbumPartialData(modifiedAlbumId);
 
         auto tracksCount = fetchTrackIds(modifiedAlbumId).count();
 
         if (!modifiedAlbumData.isEmpty() && tracksCount) {
-            Q_EMIT albumModified({{DataTypes::DatabaseIdRole, modifiedAlbumId}}, modifiedAlbumId);
+            notifyAfterCommit([this, modifiedAlbumId]() {Q_EMIT albumModified({{DataTypes::DatabaseIdRole, modifiedAlbumId}}, modifiedAlbumId);});
         } else {
             removeAlbumInDatabase(modifiedAlbumId);
-            Q_EMIT albumRemoved(modifiedAlbumId);
-
-            const auto &allTracksFromArtist = internalTracksFromAuthor(modifiedAlbumData[DataTypes::AlbumDataType::key_type::ArtistRole].toString());
-            const auto &allAlbumsFromArtist = internalAlbumIdsFromAuthor(modifiedAlbumData[DataTypes::AlbumDataType::key_type::ArtistRole].toString());
-            const auto &removedArtistId = internalArtistIdFromName(modifiedAlbumData[DataTypes::AlbumDataType::key_type::ArtistRole].toString());
+            notifyAfterCommit([this, modifiedAlbumId]() {Q_EMIT albumRemoved(modifiedAlbumId);});
 
-            if (removedArtistId != 0 && allTracksFromArtist.isEmpty() && allAlbumsFromArtist.isEmpty()) {
-                removeArtistInDatabase(removedArtistId);
-                Q_EMIT artistRemoved(removedArtistId);
+            const auto &albumArtist = modifiedAlbumData[DataTypes::AlbumDataType::key_type::ArtistRole].toString();
+            if (!knownArtists.contains(albumArtist)) {
+                knownArtists.insert(albumArtist);
+                modifiedArtists.push_back(albumArtist);
             }
         }
     }
+
+    for (const auto &modifiedArtist : qAsConst(modifiedArtists)) {
+        const auto removedArtistId = internalArtistIdFromName(modifiedArtist);
+
+        if (removedArtistId != 0 && !isArtistUsed(modifiedArtist)) {
+            removeArtistInDatabase(removedArtistId);
+            notifyAfterCommit([this, removedArtistId]() {Q_EMIT artistRemoved(removedArtistId);});
+        }
+    }
+}
+
+bool DatabaseInterface::isArtistUsed(const QString &artistName)
+{
+    auto result = true;
+
+    d->mSelectArtistIsUsedQuery.bindValue(QStringLiteral(":trackArtistName"), artistName);
+    d->mSelectArtistIsUsedQuery.bindValue(QStringLiteral(":albumArtistName"), artistName);
+
+    auto queryResult = execQuery(d->mSelectArtistIsUsedQuery);
+
+    if (!queryResult || !d->mSelectArtistIsUsedQuery.isSelect() || !d->mSelectArtistIsUsedQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::isArtistUsed" << d->mSelectArtistIsUsedQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::isArtistUsed" << d->mSelectArtistIsUsedQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::isArtistUsed" << d->mSelectArtistIsUsedQuery.lastError();
+
+        d->mSelectArtistIsUsedQuery.finish();
+
+        return result;
+    }
+
+    if (d->mSelectArtistIsUsedQuery.next()) {
+        result = d->mSelectArtistIsUsedQuery.record().value(0).toBool();
+    }
+
+    d->mSelectArtistIsUsedQuery.finish();
+
+    return result;
 }
 
 QUrl DatabaseInterface::internalAlbumArtUriFromAlbumId(qulonglong albumId)
@@ -7282,6 +9361,10 @@ qulonglong DatabaseInterface::insertLyricist(const QString &name)
         return result;
     }
 
+    if (const auto batchId = d->mBatchLyricistIds.constFind(name); batchId != d->mBatchLyricistIds.constEnd()) {
+        return batchId.value();
+    }
+
     d->mSelectLyricistByNameQuery.bindValue(QStringLiteral(":name"), name);
 
     auto queryResult = execQuery(d->mSelectLyricistByNameQuery);
@@ -7331,7 +9414,8 @@ qulonglong DatabaseInterface::insertLyricist(const QString &name)
 
     d->mInsertLyricistQuery.finish();
 
-    Q_EMIT lyricistsAdded(internalAllLyricistsPartialData());
+    auto allLyricists = internalAllLyricistsPartialData();
+    notifyAfterCommit([this, allLyricists]() {Q_EMIT lyricistsAdded(allLyricists);});
 
     return result;
 }
@@ -7366,6 +9450,38 @@ QHash<QUrl, QDateTime> DatabaseInterface::internalAllFileName()
     return allFileNames;
 }
 
+DataTypes::DirectoryFingerprints DatabaseInterface::internalAllDirectoriesFingerprints()
+{
+    auto allDirectories = DataTypes::DirectoryFingerprints{};
+
+    auto queryResult = execQuery(d->mSelectAllDirectoriesFingerprintsQuery);
+
+    if (!queryResult || !d->mSelectAllDirectoriesFingerprintsQuery.isSelect() || !d->mSelectAllDirectoriesFingerprintsQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalAllDirectoriesFingerprints" << d->mSelectAllDirectoriesFingerprintsQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalAllDirectoriesFingerprints" << d->mSelectAllDirectoriesFingerprintsQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalAllDirectoriesFingerprints" << d->mSelectAllDirectoriesFingerprintsQuery.lastError();
+
+        d->mSelectAllDirectoriesFingerprintsQuery.finish();
+
+        return allDirectories;
+    }
+
+    while(d->mSelectAllDirectoriesFingerprintsQuery.next()) {
+        const auto &currentRecord = d->mSelectAllDirectoriesFingerprintsQuery.record();
+
+        auto &oneDirectory = allDirectories[currentRecord.value(0).toUrl()];
+        oneDirectory.mParentDirectory = currentRecord.value(1).toUrl();
+        oneDirectory.mModificationTime = currentRecord.value(2).toDateTime();
+        oneDirectory.mEntriesCount = currentRecord.value(3).toInt();
+    }
+
+    d->mSelectAllDirectoriesFingerprintsQuery.finish();
+
+    return allDirectories;
+}
+
 qulonglong DatabaseInterface::internalArtistIdFromName(const QString &name)
 {
     auto result = qulonglong(0);
@@ -7403,23 +9519,6 @@ qulonglong DatabaseInterface::internalArtistIdFromName(const QString &name)
     return result;
 }
 
-void DatabaseInterface::removeTrackInDatabase(qulonglong trackId)
-{
-    d->mRemoveTrackQuery.bindValue(QStringLiteral(":trackId"), trackId);
-
-    auto result = execQuery(d->mRemoveTrackQuery);
-
-    if (!result || !d->mRemoveTrackQuery.isActive()) {
-        Q_EMIT databaseError();
-
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeTrackInDatabase" << d->mRemoveTrackQuery.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeTrackInDatabase" << d->mRemoveTrackQuery.boundValues();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeTrackInDatabase" << d->mRemoveTrackQuery.lastError();
-    }
-
-    d->mRemoveTrackQuery.finish();
-}
-
 void DatabaseInterface::updateTrackInDatabase(const DataTypes::TrackDataType &oneTrack, const QString &albumPath)
 {
     d->mUpdateTrackQuery.bindValue(QStringLiteral(":fileName"), oneTrack.resourceURI());
@@ -7535,7 +9634,7 @@ void DatabaseInterface::removeRadio(qulonglong radioId)
         qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::updateTrackInDatabase" << query.boundValues();
         qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::updateTrackInDatabase" << query.lastError();
     }else{
-        Q_EMIT radioRemoved(radioId);
+        notifyAfterCommit([this, radioId]() {Q_EMIT radioRemoved(radioId);});
     }
 
     query.finish();
@@ -7556,6 +9655,14 @@ void DatabaseInterface::removeAlbumInDatabase(qulonglong albumId)
     }
 
     d->mRemoveAlbumQuery.finish();
+
+    for (auto itAlbum = d->mBatchAlbumIds.begin(); itAlbum != d->mBatchAlbumIds.end(); ) {
+        if (itAlbum.value() == albumId) {
+            itAlbum = d->mBatchAlbumIds.erase(itAlbum);
+        } else {
+            ++itAlbum;
+        }
+    }
 }
 
 void DatabaseInterface::removeArtistInDatabase(qulonglong artistId)
@@ -8161,9 +10268,9 @@ DataTypes::ArtistDataType DatabaseInterface::internalOneArtistPartialData(qulong
     return result;
 }
 
-DataTypes::ListTrackDataType DatabaseInterface::internalAllTracksPartialData()
+DataTypes::ListTrackRecord DatabaseInterface::internalAllTracksPartialData()
 {
-    auto result = DataTypes::ListTrackDataType{};
+    auto result = DataTypes::ListTrackRecord{};
 
     if (!internalGenericPartialData(d->mSelectAllTracksQuery)) {
         return result;
@@ -8172,7 +10279,7 @@ DataTypes::ListTrackDataType DatabaseInterface::internalAllTracksPartialData()
     while(d->mSelectAllTracksQuery.next()) {
         const auto &currentRecord = d->mSelectAllTracksQuery.record();
 
-        auto newData = buildTrackDataFromDatabaseRecord(currentRecord);
+        auto newData = buildTrackRecordFromDatabaseRecord(currentRecord);
 
         result.push_back(newData);
     }
@@ -8203,9 +10310,9 @@ DataTypes::ListRadioDataType DatabaseInterface::internalAllRadiosPartialData()
     return result;
 }
 
-DataTypes::ListTrackDataType DatabaseInterface::internalRecentlyPlayedTracksData(int count)
+DataTypes::ListTrackRecord DatabaseInterface::internalRecentlyPlayedTracksData(int count)
 {
-    auto result = DataTypes::ListTrackDataType{};
+    auto result = DataTypes::ListTrackRecord{};
 
     d->mSelectAllRecentlyPlayedTracksQuery.bindValue(QStringLiteral(":maximumResults"), count);
 
@@ -8216,7 +10323,7 @@ DataTypes::ListTrackDataType DatabaseInterface::internalRecentlyPlayedTracksData
     while(d->mSelectAllRecentlyPlayedTracksQuery.next()) {
         const auto &currentRecord = d->mSelectAllRecentlyPlayedTracksQuery.record();
 
-        auto newData = buildTrackDataFromDatabaseRecord(currentRecord);
+        auto newData = buildTrackRecordFromDatabaseRecord(currentRecord);
 
         result.push_back(newData);
     }
@@ -8226,9 +10333,9 @@ DataTypes::ListTrackDataType DatabaseInterface::internalRecentlyPlayedTracksData
     return result;
 }
 
-DataTypes::ListTrackDataType DatabaseInterface::internalFrequentlyPlayedTracksData(int count)
+DataTypes::ListTrackRecord DatabaseInterface::internalFrequentlyPlayedTracksData(int count)
 {
-    auto result = DataTypes::ListTrackDataType{};
+    auto result = DataTypes::ListTrackRecord{};
 
     d->mSelectAllFrequentlyPlayedTracksQuery.bindValue(QStringLiteral(":maximumResults"), count);
 
@@ -8239,7 +10346,7 @@ DataTypes::ListTrackDataType DatabaseInterface::internalFrequentlyPlayedTracksDa
     while(d->mSelectAllFrequentlyPlayedTracksQuery.next()) {
         const auto &currentRecord = d->mSelectAllFrequentlyPlayedTracksQuery.record();
 
-        auto newData = buildTrackDataFromDatabaseRecord(currentRecord);
+        auto newData = buildTrackRecordFromDatabaseRecord(currentRecord);
 
         result.push_back(newData);
     }
@@ -8249,6 +10356,127 @@ DataTypes::ListTrackDataType DatabaseInterface::internalFrequentlyPlayedTracksDa
     return result;
 }
 
+DataTypes::ListTrackRecord DatabaseInterface::internalFrequentlyPlayedTracksData(ElisaUtils::PlayListEntryType filterType, const QVariant &filter, int count)
+{
+    auto result = DataTypes::ListTrackRecord{};
+
+    QSqlQuery *frequentlyPlayedQuery = nullptr;
+
+    switch (filterType)
+    {
+    case ElisaUtils::Artist:
+        frequentlyPlayedQuery = &d->mSelectFrequentlyPlayedArtistTracksQuery;
+        frequentlyPlayedQuery->bindValue(QStringLiteral(":artistName"), filter.toString());
+        break;
+    case ElisaUtils::Album:
+        frequentlyPlayedQuery = &d->mSelectFrequentlyPlayedAlbumTracksQuery;
+        frequentlyPlayedQuery->bindValue(QStringLiteral(":albumId"), filter.toULongLong());
+        break;
+    case ElisaUtils::Genre:
+        frequentlyPlayedQuery = &d->mSelectFrequentlyPlayedGenreTracksQuery;
+        frequentlyPlayedQuery->bindValue(QStringLiteral(":genre"), filter.toString());
+        break;
+    case ElisaUtils::Track:
+    case ElisaUtils::Composer:
+    case ElisaUtils::Lyricist:
+    case ElisaUtils::FileName:
+    case ElisaUtils::Unknown:
+    case ElisaUtils::Radio:
+    case ElisaUtils::Container:
+        return result;
+    }
+
+    frequentlyPlayedQuery->bindValue(QStringLiteral(":maximumResults"), count);
+
+    if (!internalGenericPartialData(*frequentlyPlayedQuery)) {
+        return result;
+    }
+
+    while(frequentlyPlayedQuery->next()) {
+        const auto &currentRecord = frequentlyPlayedQuery->record();
+
+        auto newData = buildTrackRecordFromDatabaseRecord(currentRecord);
+
+        result.push_back(newData);
+    }
+
+    frequentlyPlayedQuery->finish();
+
+    return result;
+}
+
+std::optional<QVector<qulonglong>> DatabaseInterface::internalSearchData(ElisaUtils::PlayListEntryType dataType, const QString &searchText)
+{
+    auto result = std::optional<QVector<qulonglong>>{};
+
+    QSqlQuery *searchQuery = nullptr;
+    auto matchText = QString{};
+
+    switch (dataType)
+    {
+    case ElisaUtils::Track:
+        searchQuery = &d->mSearchTracksQuery;
+        matchText = searchIndexMatchText(searchText, {}, d->mSearchIndexIsTrigram);
+        searchQuery->bindValue(QStringLiteral(":searchText"), matchText);
+        break;
+    case ElisaUtils::Album:
+        searchQuery = &d->mSearchAlbumsQuery;
+        matchText = searchIndexMatchText(searchText, QStringLiteral("{AlbumTitle AlbumArtistName ArtistName} : "), d->mSearchIndexIsTrigram);
+        searchQuery->bindValue(QStringLiteral(":searchText"), matchText);
+        break;
+    case ElisaUtils::Artist:
+        searchQuery = &d->mSearchArtistsQuery;
+        matchText = searchIndexMatchText(searchText, QStringLiteral("{ArtistName} : "), d->mSearchIndexIsTrigram);
+        searchQuery->bindValue(QStringLiteral(":artistSearchText"), matchText);
+        searchQuery->bindValue(QStringLiteral(":albumArtistSearchText"), searchIndexMatchText(searchText, QStringLiteral("{AlbumArtistName} : "), d->mSearchIndexIsTrigram));
+        break;
+    case ElisaUtils::Genre:
+        searchQuery = &d->mSearchGenresQuery;
+        matchText = searchIndexMatchText(searchText, QStringLiteral("{Genre} : "), d->mSearchIndexIsTrigram);
+        searchQuery->bindValue(QStringLiteral(":searchText"), matchText);
+        break;
+    case ElisaUtils::Composer:
+    case ElisaUtils::Lyricist:
+    case ElisaUtils::Radio:
+    case ElisaUtils::FileName:
+    case ElisaUtils::Container:
+    case ElisaUtils::Unknown:
+        break;
+    }
+
+    if (!searchQuery || matchText.isEmpty()) {
+        return result;
+    }
+
+    // the text comes from the user, an invalid search is not a database error
+    auto queryResult = execQuery(*searchQuery);
+
+    if (!queryResult || !searchQuery->isSelect() || !searchQuery->isActive()) {
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalSearchData" << searchQuery->lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalSearchData" << searchQuery->boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalSearchData" << searchQuery->lastError();
+
+        searchQuery->finish();
+
+        return result;
+    }
+
+    auto matchingIds = QVector<qulonglong>{};
+
+    while (searchQuery->next()) {
+        matchingIds.push_back(searchQuery->record().value(0).toULongLong());
+    }
+
+    searchQuery->finish();
+
+    // the index does not match everything the regular expression of the views matches, they search by themselves
+    if (!matchingIds.isEmpty()) {
+        result = std::move(matchingIds);
+    }
+
+    return result;
+}
+
 DataTypes::TrackDataType DatabaseInterface::internalOneTrackPartialData(qulonglong databaseId)
 {
     auto result = DataTypes::TrackDataType{};
@@ -8270,6 +10498,27 @@ DataTypes::TrackDataType DatabaseInterface::internalOneTrackPartialData(qulonglo
     return result;
 }
 
+DataTypes::TrackRecord DatabaseInterface::internalOneTrackRecord(qulonglong databaseId)
+{
+    auto result = DataTypes::TrackRecord{};
+
+    d->mSelectTrackFromIdQuery.bindValue(QStringLiteral(":trackId"), databaseId);
+
+    if (!internalGenericPartialData(d->mSelectTrackFromIdQuery)) {
+        return result;
+    }
+
+    if (d->mSelectTrackFromIdQuery.next()) {
+        const auto &currentRecord = d->mSelectTrackFromIdQuery.record();
+
+        result = buildTrackRecordFromDatabaseRecord(currentRecord);
+    }
+
+    d->mSelectTrackFromIdQuery.finish();
+
+    return result;
+}
+
 DataTypes::TrackDataType DatabaseInterface::internalOneTrackPartialDataByIdAndUrl(qulonglong databaseId, const QUrl &trackUrl)
 {
     auto result = DataTypes::TrackDataType{};
@@ -8403,6 +10652,8 @@ bool DatabaseInterface::execQuery(QSqlQuery &query)
 
     auto result = query.exec();
 
+    PerformanceCounters::add(PerformanceCounters::ExecutedQueries, 1);
+
 #if !defined NDEBUG
     if (timer.nsecsElapsed() > 10000000) {
         qCDebug(orgKdeElisaDatabase) << "[[" << timer.nsecsElapsed() << "]]" << query.lastQuery();
@@ -8491,10 +10742,37 @@ bool DatabaseInterface::updateAlbumCover(qulonglong albumId, const QUrl &albumAr
 
 void DatabaseInterface::updateTrackStatistics(const QUrl &fileName, const QDateTime &time)
 {
+    d->mSelectTrackPlayScoreQuery.bindValue(QStringLiteral(":fileName"), fileName);
+
+    auto queryResult = execQuery(d->mSelectTrackPlayScoreQuery);
+
+    if (!queryResult || !d->mSelectTrackPlayScoreQuery.isSelect() || !d->mSelectTrackPlayScoreQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::updateTrackStatistics" << d->mSelectTrackPlayScoreQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::updateTrackStatistics" << d->mSelectTrackPlayScoreQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::updateTrackStatistics" << d->mSelectTrackPlayScoreQuery.lastError();
+
+        d->mSelectTrackPlayScoreQuery.finish();
+
+        return;
+    }
+
+    if (!d->mSelectTrackPlayScoreQuery.next()) {
+        d->mSelectTrackPlayScoreQuery.finish();
+
+        return;
+    }
+
+    const auto playScore = addPlayToScore(d->mSelectTrackPlayScoreQuery.record().value(0), time.toMSecsSinceEpoch());
+
+    d->mSelectTrackPlayScoreQuery.finish();
+
     d->mUpdateTrackStatistics.bindValue(QStringLiteral(":fileName"), fileName);
     d->mUpdateTrackStatistics.bindValue(QStringLiteral(":playDate"), time.toMSecsSinceEpoch());
+    d->mUpdateTrackStatistics.bindValue(QStringLiteral(":playScore"), playScore);
 
-    auto queryResult = execQuery(d->mUpdateTrackStatistics);
+    queryResult = execQuery(d->mUpdateTrackStatistics);
 
     if (!queryResult || !d->mUpdateTrackStatistics.isActive()) {
         Q_EMIT databaseError();
@@ -14,11 +14,14 @@
 
 #include <QObject>
 #include <QString>
+#include <QStringList>
 #include <QHash>
 #include <QList>
+#include <QVector>
 #include <QUrl>
 #include <QDateTime>
 
+#include <functional>
 #include <memory>
 #include <optional>
 
@@ -39,7 +42,12 @@ public:
         V13 = 13,
         V14 = 14,
         V15 = 15,
-        V16 = 16, //Does not exist yet, for testing purpose only.
+        V16 = 16,
+        V17 = 17,
+        V18 = 18,
+        V19 = 19,
+        V20 = 20,
+        V21 = 21, //Does not exist yet, for testing purpose only.
     };
 
     explicit DatabaseInterface(QObject *parent = nullptr);
@@ -48,15 +56,61 @@ public:
 
     Q_INVOKABLE void init(const QString &dbName, const QString &databaseFileName = {});
 
+    /**
+     * Open a read only connection to a database file already initialized by
+     * another instance with init(). Only the data accessors can be used.
+     */
+    Q_INVOKABLE void initReadOnly(const QString &dbName, const QString &databaseFileName);
+
     qulonglong albumIdFromTitleAndArtist(const QString &title, const QString &artist, const QString &albumPath);
 
-    DataTypes::ListTrackDataType allTracksData();
+    DataTypes::ListTrackRecord allTracksData();
+
+    /**
+     * Return at most count tracks ordered by the value of sortRole and then by
+     * database id. The page starts after the track afterDatabaseId of sort key
+     * afterSortKey when afterDatabaseId is not 0, otherwise after the first
+     * offset tracks. A negative count returns all the following tracks.
+     */
+    DataTypes::ListTrackRecord tracksDataPage(int sortRole, Qt::SortOrder sortOrder,
+                                              const QVariant &afterSortKey, qulonglong afterDatabaseId,
+                                              int offset, int count);
+
+    /**
+     * Sort key of track in the pages read by tracksDataPage for sortRole.
+     */
+    static QVariant trackSortKey(const DataTypes::TrackRecord &track, int sortRole);
+
+    int tracksCount();
+
+    /**
+     * Steps of the plans of the queries reading the tracks, keyed by the name
+     * of the method running them. Allows to check that they use the indexes.
+     */
+    QHash<QString, QStringList> readQueriesPlans();
 
     DataTypes::ListRadioDataType allRadiosData();
 
-    DataTypes::ListTrackDataType recentlyPlayedTracksData(int count);
+    DataTypes::ListTrackRecord recentlyPlayedTracksData(int count);
 
-    DataTypes::ListTrackDataType frequentlyPlayedTracksData(int count);
+    DataTypes::ListTrackRecord frequentlyPlayedTracksData(int count);
+
+    /**
+     * The count most frequently played tracks of the artist, album or genre
+     * identified by filter: an artist name, an album database id or a genre name.
+     */
+    DataTypes::ListTrackRecord frequentlyPlayedTracksData(ElisaUtils::PlayListEntryType filterType, const QVariant &filter, int count);
+
+    /**
+     * Database ids of the entries of dataType matching each word of searchText,
+     * most relevant first. Tracks are searched by title, artist, album, album
+     * artist and genre, the other types by their own names. With SQLite 3.34
+     * or later a word matches any part of a value, otherwise only the start of
+     * a word. Returns no value when the database has no search index, when the
+     * index cannot search searchText or when it finds nothing: the caller then
+     * filters the entries itself.
+     */
+    std::optional<QVector<qulonglong>> searchData(ElisaUtils::PlayListEntryType dataType, const QString &searchText);
 
     DataTypes::ListAlbumDataType allAlbumsData();
 
@@ -92,6 +146,12 @@ public:
 
     qulonglong trackIdFromTitleAlbumTrackDiscNumber(const QString &title, const QString &artist, const std::optional<QString> &album, std::optional<int> trackNumber, std::optional<int> discNumber);
 
+    /**
+     * Resolve many tracks known by their title, artist, album, track and disc numbers at once.
+     * The result has one entry per requested track. Tracks that are not in the database give an empty entry.
+     */
+    DataTypes::ListTrackDataType tracksDataFromTitleAlbumTrackDiscNumber(const DataTypes::ListTrackDataType &tracks);
+
     qulonglong trackIdFromFileName(const QUrl &fileName);
 
     qulonglong radioIdFromFileName(const QUrl &fileName);
@@ -108,7 +168,7 @@ Q_SIGNALS:
 
     void albumsAdded(const DataTypes::ListAlbumDataType &newAlbums);
 
-    void tracksAdded(const DataTypes::ListTrackDataType &allTracks);
+    void tracksAdded(const DataTypes::ListTrackRecord &allTracks);
 
     void genresAdded(const DataTypes::ListGenreDataType &allGenres);
 
@@ -128,6 +188,8 @@ Q_SIGNALS:
 
     void restoredTracks(const QHash<QUrl, QDateTime> &allFiles);
 
+    void restoredDirectoriesFingerprints(const DataTypes::DirectoryFingerprints &allDirectories);
+
     void cleanedDatabase();
 
     void finishInsertingTracksList();
@@ -148,6 +210,12 @@ public Q_SLOTS:
 
     void askRestoredTracks();
 
+    void updateDirectoriesFingerprints(const DataTypes::DirectoryFingerprints &scannedDirectories);
+
+    void removeDirectoriesFingerprints(const QList<QUrl> &removedDirectories);
+
+    void removeAllDirectoriesFingerprints();
+
     void trackHasStartedPlaying(const QUrl &fileName, const QDateTime &time);
 
     void clearData();
@@ -163,6 +231,31 @@ private:
 
     void initChangesTrackers();
 
+    void prepareBatchInsertion(const DataTypes::ListTrackDataType &tracks);
+
+    void clearBatchInsertion();
+
+    bool batchSelectTracksMapping(const QStringList &fileNames, QHash<QString, qulonglong> &tracksMapping);
+
+    bool batchSelectTracksFromIds(const QList<qulonglong> &trackIds, QHash<qulonglong, DataTypes::TrackDataType> &tracks);
+
+    bool batchSelectTracksFromTitles(const QStringList &titles, QMultiHash<QString, DataTypes::TrackDataType> &tracks);
+
+    bool batchDeleteRows(const QString &tableName, const QString &columnName, const QVariantList &values);
+
+    bool isArtistUsed(const QString &artistName);
+
+    bool batchInsertTracksOrigin(const DataTypes::ListTrackDataType &newTracks);
+
+    bool batchInsertNames(const QString &tableName, const QStringList &names, QHash<QString, qulonglong> &ids,
+                          qulonglong &nextId, QList<QPair<qulonglong, QString>> &newNames);
+
+    bool batchSelectTracksIdentity(const QStringList &titles);
+
+    [[nodiscard]] int batchTrackPriority(const DataTypes::TrackDataType &oneTrack, const QString &trackPath) const;
+
+    bool batchInsertPendingTracks(const QHash<QString, QUrl> &covers);
+
     void recordModifiedTrack(qulonglong trackId);
 
     void recordModifiedAlbum(qulonglong albumId);
@@ -173,6 +266,12 @@ private:
 
     bool rollBackTransaction();
 
+    /**
+     * Views read through their own connections: a change notified before the
+     * commit of the transaction that made it would be read as missing.
+     */
+    void notifyAfterCommit(std::function<void()> notification);
+
     QList<qulonglong> fetchTrackIds(qulonglong albumId);
 
     qulonglong internalAlbumIdFromTitleAndArtist(const QString &title, const QString &artist, const QString &albumPath);
@@ -212,8 +311,6 @@ private:
 
     qulonglong insertGenre(const QString &name);
 
-    void removeTrackInDatabase(qulonglong trackId);
-
     void updateTrackInDatabase(const DataTypes::TrackDataType &oneTrack, const QString &albumPath);
 
     void removeAlbumInDatabase(qulonglong albumId);
@@ -233,6 +330,8 @@ private:
 
     [[nodiscard]] DataTypes::TrackDataType buildTrackDataFromDatabaseRecord(const QSqlRecord &trackRecord) const;
 
+    [[nodiscard]] DataTypes::TrackRecord buildTrackRecordFromDatabaseRecord(const QSqlRecord &trackRecord) const;
+
     [[nodiscard]] DataTypes::TrackDataType buildRadioDataFromDatabaseRecord(const QSqlRecord &trackRecord) const;
 
     void internalRemoveTracksList(const QList<QUrl> &removedTracks);
@@ -249,8 +348,15 @@ private:
 
     QHash<QUrl, QDateTime> internalAllFileName();
 
+    DataTypes::DirectoryFingerprints internalAllDirectoriesFingerprints();
+
     bool internalGenericPartialData(QSqlQuery &query);
 
+    /**
+     * Query reading one page of tracks, prepared once for each sort.
+     */
+    QSqlQuery *tracksPageQuery(int sortRole, Qt::SortOrder sortOrder, bool isAfterSortKey);
+
     DataTypes::ListArtistDataType internalAllArtistsPartialData(QSqlQuery &artistsQuery);
 
     DataTypes::ListAlbumDataType internalAllAlbumsPartialData(QSqlQuery &query);
@@ -259,16 +365,22 @@ private:
 
     DataTypes::ArtistDataType internalOneArtistPartialData(qulonglong databaseId);
 
-    DataTypes::ListTrackDataType internalAllTracksPartialData();
+    DataTypes::ListTrackRecord internalAllTracksPartialData();
 
     DataTypes::ListRadioDataType internalAllRadiosPartialData();
 
-    DataTypes::ListTrackDataType internalRecentlyPlayedTracksData(int count);
+    DataTypes::ListTrackRecord internalRecentlyPlayedTracksData(int count);
 
-    DataTypes::ListTrackDataType internalFrequentlyPlayedTracksData(int count);
+    DataTypes::ListTrackRecord internalFrequentlyPlayedTracksData(int count);
+
+    DataTypes::ListTrackRecord internalFrequentlyPlayedTracksData(ElisaUtils::PlayListEntryType filterType, const QVariant &filter, int count);
+
+    std::optional<QVector<qulonglong>> internalSearchData(ElisaUtils::PlayListEntryType dataType, const QString &searchText);
 
     DataTypes::TrackDataType internalOneTrackPartialData(qulonglong databaseId);
 
+    DataTypes::TrackRecord internalOneTrackRecord(qulonglong databaseId);
+
     DataTypes::TrackDataType internalOneTrackPartialDataByIdAndUrl(qulonglong databaseId, const QUrl &trackUrl);
 
     DataTypes::TrackDataType internalOneRadioPartialData(qulonglong databaseId);
@@ -306,6 +418,16 @@ private:
 
     void upgradeDatabaseV16();
 
+    void upgradeDatabaseV17();
+
+    void upgradeDatabaseV18();
+
+    void upgradeDatabaseV19();
+
+    void upgradeDatabaseV20();
+
+    void upgradeDatabaseV21();
+
     void checkDatabaseSchema();
 
     void checkAlbumsTableSchema();
@@ -322,6 +444,8 @@ private:
 
     void checkTracksDataTableSchema();
 
+    void checkScannedDirectoriesTableSchema();
+
     void genericCheckTable(const QString &tableName, const QStringList &expectedColumns);
 
     void resetDatabase();
@@ -19,6 +19,8 @@
 #include <QUrl>
 #include <QDateTime>
 #include <QMap>
+#include <QVector>
+#include <QHash>
 
 class ELISALIB_EXPORT DataTypes : public QObject
 {
@@ -326,6 +328,811 @@ public:
 
     using ListRadioDataType = QList<TrackDataType>;
 
+    /**
+     * Typed storage for one track, used by the models and the play list holding many tracks.
+     *
+     * The roles read by the views are typed members flagged in a presence bitmask,
+     * the rare roles go to an overflow map. The QMap based TrackDataType is only
+     * built when the data is given to QML or to a caller still using it.
+     */
+    class TrackRecord
+    {
+    public:
+
+        TrackRecord() = default;
+
+        explicit TrackRecord(const TrackDataType &trackData)
+        {
+            for (auto itData = trackData.cbegin(); itData != trackData.cend(); ++itData) {
+                insert(itData.key(), itData.value());
+            }
+        }
+
+        [[nodiscard]] TrackDataType toTrackDataType() const
+        {
+            TrackDataType result;
+
+            static_cast<DataType&>(result) = mOtherRoles;
+            for (auto role : FieldRoles) {
+                if (hasField(role)) {
+                    result[role] = value(role);
+                }
+            }
+
+            return result;
+        }
+
+        [[nodiscard]] bool isEmpty() const
+        {
+            return !mPresentFields && mOtherRoles.isEmpty();
+        }
+
+        [[nodiscard]] bool contains(ColumnsRoles role) const
+        {
+            if (fieldFromRole(role) == -1) {
+                return mOtherRoles.contains(role);
+            }
+
+            return hasField(role);
+        }
+
+        [[nodiscard]] QVariant value(ColumnsRoles role) const
+        {
+            if (fieldFromRole(role) == -1) {
+                return mOtherRoles.value(role);
+            }
+
+            if (!hasField(role)) {
+                return {};
+            }
+
+            switch (role)
+            {
+            case TitleRole:
+                return mTitle;
+            case ArtistRole:
+                return mArtist;
+            case AlbumRole:
+                return mAlbum;
+            case AlbumArtistRole:
+                return mAlbumArtist;
+            case IsValidAlbumArtistRole:
+                return mIsValidAlbumArtist;
+            case TrackNumberRole:
+                return mTrackNumber;
+            case DiscNumberRole:
+                return mDiscNumber;
+            case DurationRole:
+                return mDuration;
+            case RatingRole:
+                return mRating;
+            case GenreRole:
+                return mGenre;
+            case ComposerRole:
+                return mComposer;
+            case LyricistRole:
+                return mLyricist;
+            case CommentRole:
+                return mComment;
+            case YearRole:
+                return mYear;
+            case ChannelsRole:
+                return mChannels;
+            case BitRateRole:
+                return mBitRate;
+            case SampleRateRole:
+                return mSampleRate;
+            case ResourceRole:
+                return mResourceURI;
+            case DatabaseIdRole:
+                return mDatabaseId;
+            case AlbumIdRole:
+                return mAlbumId;
+            case ImageUrlRole:
+                return mAlbumCover;
+            case IsSingleDiscAlbumRole:
+                return mIsSingleDiscAlbum;
+            case HasEmbeddedCover:
+                return mHasEmbeddedCover;
+            case FileModificationTime:
+                return mFileModificationTime;
+            case FirstPlayDate:
+                return mFirstPlayDate;
+            case LastPlayDate:
+                return mLastPlayDate;
+            case PlayCounter:
+                return mPlayCounter;
+            case PlayFrequency:
+                return mPlayFrequency;
+            case ElementTypeRole:
+                return QVariant::fromValue(mElementType);
+            default:
+                return {};
+            }
+        }
+
+        [[nodiscard]] QVariant operator[](ColumnsRoles role) const
+        {
+            return value(role);
+        }
+
+        /**
+         * Store a value coming from a QVariant, converted to the type of the member holding the role.
+         */
+        void insert(ColumnsRoles role, const QVariant &value)
+        {
+            switch (role)
+            {
+            case TitleRole:
+                setTitle(value.toString());
+                break;
+            case ArtistRole:
+                setArtist(value.toString());
+                break;
+            case AlbumRole:
+                setAlbum(value.toString());
+                break;
+            case AlbumArtistRole:
+                setAlbumArtist(value.toString());
+                break;
+            case IsValidAlbumArtistRole:
+                setIsValidAlbumArtist(value.toBool());
+                break;
+            case TrackNumberRole:
+                setTrackNumber(value.toInt());
+                break;
+            case DiscNumberRole:
+                setDiscNumber(value.toInt());
+                break;
+            case DurationRole:
+                setDuration(value.toTime());
+                break;
+            case RatingRole:
+                setRating(value.toInt());
+                break;
+            case GenreRole:
+                setGenre(value.toString());
+                break;
+            case ComposerRole:
+                setComposer(value.toString());
+                break;
+            case LyricistRole:
+                setLyricist(value.toString());
+                break;
+            case CommentRole:
+                setComment(value.toString());
+                break;
+            case YearRole:
+                setYear(value.toInt());
+                break;
+            case ChannelsRole:
+                setChannels(value.toInt());
+                break;
+            case BitRateRole:
+                setBitRate(value.toInt());
+                break;
+            case SampleRateRole:
+                setSampleRate(value.toInt());
+                break;
+            case ResourceRole:
+                setResourceURI(value.toUrl());
+                break;
+            case DatabaseIdRole:
+                setDatabaseId(value.toULongLong());
+                break;
+            case AlbumIdRole:
+                setAlbumId(value.toULongLong());
+                break;
+            case ImageUrlRole:
+                setAlbumCover(value.toUrl());
+                break;
+            case IsSingleDiscAlbumRole:
+                setIsSingleDiscAlbum(value.toBool());
+                break;
+            case HasEmbeddedCover:
+                setHasEmbeddedCover(value.toBool());
+                break;
+            case FileModificationTime:
+                setFileModificationTime(value.toDateTime());
+                break;
+            case FirstPlayDate:
+                setFirstPlayDate(playDateFromVariant(value));
+                break;
+            case LastPlayDate:
+                setLastPlayDate(playDateFromVariant(value));
+                break;
+            case PlayCounter:
+                setPlayCounter(value.toInt());
+                break;
+            case PlayFrequency:
+                setPlayFrequency(value.toDouble());
+                break;
+            case ElementTypeRole:
+                setElementType(value.value<ElisaUtils::PlayListEntryType>());
+                break;
+            default:
+                mOtherRoles[role] = value;
+                break;
+            }
+        }
+
+        [[nodiscard]] bool isValid() const
+        {
+            return !isEmpty() && duration().isValid();
+        }
+
+        [[nodiscard]] bool hasDatabaseId() const
+        {
+            return hasField(DatabaseIdRole);
+        }
+
+        [[nodiscard]] qulonglong databaseId() const
+        {
+            return mDatabaseId;
+        }
+
+        void setDatabaseId(qulonglong databaseId)
+        {
+            mDatabaseId = databaseId;
+            setField(DatabaseIdRole);
+        }
+
+        [[nodiscard]] bool hasElementType() const
+        {
+            return hasField(ElementTypeRole);
+        }
+
+        [[nodiscard]] ElisaUtils::PlayListEntryType elementType() const
+        {
+            return mElementType;
+        }
+
+        void setElementType(ElisaUtils::PlayListEntryType elementType)
+        {
+            mElementType = elementType;
+            setField(ElementTypeRole);
+        }
+
+        [[nodiscard]] QString title() const
+        {
+            return mTitle;
+        }
+
+        void setTitle(const QString &title)
+        {
+            mTitle = title;
+            setField(TitleRole);
+        }
+
+        [[nodiscard]] QString artist() const
+        {
+            return mArtist;
+        }
+
+        [[nodiscard]] bool hasArtist() const
+        {
+            return hasField(ArtistRole);
+        }
+
+        void setArtist(const QString &artist)
+        {
+            mArtist = artist;
+            setField(ArtistRole);
+        }
+
+        [[nodiscard]] qulonglong albumId() const
+        {
+            return mAlbumId;
+        }
+
+        void setAlbumId(qulonglong albumId)
+        {
+            mAlbumId = albumId;
+            setField(AlbumIdRole);
+        }
+
+        [[nodiscard]] QString album() const
+        {
+            return mAlbum;
+        }
+
+        [[nodiscard]] bool hasAlbum() const
+        {
+            return hasField(AlbumRole);
+        }
+
+        void setAlbum(const QString &album)
+        {
+            mAlbum = album;
+            setField(AlbumRole);
+        }
+
+        [[nodiscard]] QString albumArtist() const
+        {
+            return mAlbumArtist;
+        }
+
+        [[nodiscard]] bool hasAlbumArtist() const
+        {
+            return hasField(AlbumArtistRole);
+        }
+
+        void setAlbumArtist(const QString &albumArtist)
+        {
+            mAlbumArtist = albumArtist;
+            setField(AlbumArtistRole);
+        }
+
+        [[nodiscard]] bool isValidAlbumArtist() const
+        {
+            return mIsValidAlbumArtist;
+        }
+
+        void setIsValidAlbumArtist(bool isValidAlbumArtist)
+        {
+            mIsValidAlbumArtist = isValidAlbumArtist;
+            setField(IsValidAlbumArtistRole);
+        }
+
+        [[nodiscard]] int trackNumber() const
+        {
+            return mTrackNumber;
+        }
+
+        [[nodiscard]] bool hasTrackNumber() const
+        {
+            return hasField(TrackNumberRole);
+        }
+
+        void setTrackNumber(int trackNumber)
+        {
+            mTrackNumber = trackNumber;
+            setField(TrackNumberRole);
+        }
+
+        [[nodiscard]] int discNumber() const
+        {
+            return mDiscNumber;
+        }
+
+        [[nodiscard]] bool hasDiscNumber() const
+        {
+            return hasField(DiscNumberRole);
+        }
+
+        void setDiscNumber(int discNumber)
+        {
+            mDiscNumber = discNumber;
+            setField(DiscNumberRole);
+        }
+
+        [[nodiscard]] QTime duration() const
+        {
+            return mDuration;
+        }
+
+        void setDuration(QTime duration)
+        {
+            mDuration = duration;
+            setField(DurationRole);
+        }
+
+        [[nodiscard]] QUrl resourceURI() const
+        {
+            return mResourceURI;
+        }
+
+        void setResourceURI(const QUrl &resourceURI)
+        {
+            mResourceURI = resourceURI;
+            setField(ResourceRole);
+        }
+
+        [[nodiscard]] QUrl albumCover() const
+        {
+            return mAlbumCover;
+        }
+
+        void setAlbumCover(const QUrl &albumCover)
+        {
+            mAlbumCover = albumCover;
+            setField(ImageUrlRole);
+        }
+
+        [[nodiscard]] bool isSingleDiscAlbum() const
+        {
+            return mIsSingleDiscAlbum;
+        }
+
+        void setIsSingleDiscAlbum(bool isSingleDiscAlbum)
+        {
+            mIsSingleDiscAlbum = isSingleDiscAlbum;
+            setField(IsSingleDiscAlbumRole);
+        }
+
+        [[nodiscard]] int rating() const
+        {
+            return mRating;
+        }
+
+        void setRating(int rating)
+        {
+            mRating = rating;
+            setField(RatingRole);
+        }
+
+        [[nodiscard]] QString genre() const
+        {
+            return mGenre;
+        }
+
+        [[nodiscard]] bool hasGenre() const
+        {
+            return hasField(GenreRole);
+        }
+
+        void setGenre(const QString &genre)
+        {
+            mGenre = genre;
+            setField(GenreRole);
+        }
+
+        [[nodiscard]] QString composer() const
+        {
+            return mComposer;
+        }
+
+        [[nodiscard]] bool hasComposer() const
+        {
+            return hasField(ComposerRole);
+        }
+
+        void setComposer(const QString &composer)
+        {
+            mComposer = composer;
+            setField(ComposerRole);
+        }
+
+        [[nodiscard]] QString lyricist() const
+        {
+            return mLyricist;
+        }
+
+        [[nodiscard]] bool hasLyricist() const
+        {
+            return hasField(LyricistRole);
+        }
+
+        void setLyricist(const QString &lyricist)
+        {
+            mLyricist = lyricist;
+            setField(LyricistRole);
+        }
+
+        [[nodiscard]] QString comment() const
+        {
+            return mComment;
+        }
+
+        [[nodiscard]] bool hasComment() const
+        {
+            return hasField(CommentRole);
+        }
+
+        void setComment(const QString &comment)
+        {
+            mComment = comment;
+            setField(CommentRole);
+        }
+
+        [[nodiscard]] int year() const
+        {
+            return mYear;
+        }
+
+        [[nodiscard]] bool hasYear() const
+        {
+            return hasField(YearRole);
+        }
+
+        void setYear(int year)
+        {
+            mYear = year;
+            setField(YearRole);
+        }
+
+        [[nodiscard]] int channels() const
+        {
+            return mChannels;
+        }
+
+        [[nodiscard]] bool hasChannels() const
+        {
+            return hasField(ChannelsRole);
+        }
+
+        void setChannels(int channels)
+        {
+            mChannels = channels;
+            setField(ChannelsRole);
+        }
+
+        [[nodiscard]] int bitRate() const
+        {
+            return mBitRate;
+        }
+
+        [[nodiscard]] bool hasBitRate() const
+        {
+            return hasField(BitRateRole);
+        }
+
+        void setBitRate(int bitRate)
+        {
+            mBitRate = bitRate;
+            setField(BitRateRole);
+        }
+
+        [[nodiscard]] int sampleRate() const
+        {
+            return mSampleRate;
+        }
+
+        [[nodiscard]] bool hasSampleRate() const
+        {
+            return hasField(SampleRateRole);
+        }
+
+        void setSampleRate(int sampleRate)
+        {
+            mSampleRate = sampleRate;
+            setField(SampleRateRole);
+        }
+
+        [[nodiscard]] bool hasEmbeddedCover() const
+        {
+            return mHasEmbeddedCover;
+        }
+
+        void setHasEmbeddedCover(bool hasEmbeddedCover)
+        {
+            mHasEmbeddedCover = hasEmbeddedCover;
+            setField(HasEmbeddedCover);
+        }
+
+        [[nodiscard]] QDateTime fileModificationTime() const
+        {
+            return mFileModificationTime;
+        }
+
+        void setFileModificationTime(const QDateTime &fileModificationTime)
+        {
+            mFileModificationTime = fileModificationTime;
+            setField(FileModificationTime);
+        }
+
+        /**
+         * Play dates are kept as in the database, in milliseconds since the epoch.
+         */
+        void setFirstPlayDate(qint64 firstPlayDate)
+        {
+            mFirstPlayDate = firstPlayDate;
+            setField(FirstPlayDate);
+        }
+
+        void setLastPlayDate(qint64 lastPlayDate)
+        {
+            mLastPlayDate = lastPlayDate;
+            setField(LastPlayDate);
+        }
+
+        [[nodiscard]] int playCounter() const
+        {
+            return mPlayCounter;
+        }
+
+        void setPlayCounter(int playCounter)
+        {
+            mPlayCounter = playCounter;
+            setField(PlayCounter);
+        }
+
+        [[nodiscard]] double playFrequency() const
+        {
+            return mPlayFrequency;
+        }
+
+        void setPlayFrequency(double playFrequency)
+        {
+            mPlayFrequency = playFrequency;
+            setField(PlayFrequency);
+        }
+
+        [[nodiscard]] QString lyrics() const
+        {
+            return mOtherRoles.value(LyricsRole).toString();
+        }
+
+        [[nodiscard]] bool hasLyrics() const
+        {
+            return mOtherRoles.contains(LyricsRole);
+        }
+
+    private:
+
+        static constexpr ColumnsRoles FieldRoles[] = {
+            TitleRole, ArtistRole, AlbumRole, AlbumArtistRole, IsValidAlbumArtistRole,
+            TrackNumberRole, DiscNumberRole, DurationRole, RatingRole, GenreRole,
+            ComposerRole, LyricistRole, CommentRole, YearRole, ChannelsRole,
+            BitRateRole, SampleRateRole, ResourceRole, DatabaseIdRole, AlbumIdRole,
+            ImageUrlRole, IsSingleDiscAlbumRole, HasEmbeddedCover, FileModificationTime, FirstPlayDate,
+            LastPlayDate, PlayCounter, PlayFrequency, ElementTypeRole,
+        };
+
+        static constexpr int fieldFromRole(ColumnsRoles role)
+        {
+            switch (role)
+            {
+            case TitleRole:
+                return 0;
+            case ArtistRole:
+                return 1;
+            case AlbumRole:
+                return 2;
+            case AlbumArtistRole:
+                return 3;
+            case IsValidAlbumArtistRole:
+                return 4;
+            case TrackNumberRole:
+                return 5;
+            case DiscNumberRole:
+                return 6;
+            case DurationRole:
+                return 7;
+            case RatingRole:
+                return 8;
+            case GenreRole:
+                return 9;
+            case ComposerRole:
+                return 10;
+            case LyricistRole:
+                return 11;
+            case CommentRole:
+                return 12;
+            case YearRole:
+                return 13;
+            case ChannelsRole:
+                return 14;
+            case BitRateRole:
+                return 15;
+            case SampleRateRole:
+                return 16;
+            case ResourceRole:
+                return 17;
+            case DatabaseIdRole:
+                return 18;
+            case AlbumIdRole:
+                return 19;
+            case ImageUrlRole:
+                return 20;
+            case IsSingleDiscAlbumRole:
+                return 21;
+            case HasEmbeddedCover:
+                return 22;
+            case FileModificationTime:
+                return 23;
+            case FirstPlayDate:
+                return 24;
+            case LastPlayDate:
+                return 25;
+            case PlayCounter:
+                return 26;
+            case PlayFrequency:
+                return 27;
+            case ElementTypeRole:
+                return 28;
+            default:
+                return -1;
+            }
+        }
+
+        static qint64 playDateFromVariant(const QVariant &value)
+        {
+            if (value.type() == QVariant::DateTime) {
+                return value.toDateTime().toMSecsSinceEpoch();
+            }
+
+            return value.toLongLong();
+        }
+
+        [[nodiscard]] bool hasField(ColumnsRoles role) const
+        {
+            return mPresentFields & (1u << fieldFromRole(role));
+        }
+
+        void setField(ColumnsRoles role)
+        {
+            mPresentFields |= (1u << fieldFromRole(role));
+        }
+
+        QString mTitle;
+
+        QString mArtist;
+
+        QString mAlbum;
+
+        QString mAlbumArtist;
+
+        QString mGenre;
+
+        QString mComposer;
+
+        QString mLyricist;
+
+        QString mComment;
+
+        QUrl mResourceURI;
+
+        QUrl mAlbumCover;
+
+        QDateTime mFileModificationTime;
+
+        QTime mDuration;
+
+        qulonglong mDatabaseId = 0;
+
+        qulonglong mAlbumId = 0;
+
+        qint64 mFirstPlayDate = 0;
+
+        qint64 mLastPlayDate = 0;
+
+        double mPlayFrequency = 0.;
+
+        int mTrackNumber = 0;
+
+        int mDiscNumber = 0;
+
+        int mRating = 0;
+
+        int mYear = 0;
+
+        int mChannels = 0;
+
+        int mBitRate = 0;
+
+        int mSampleRate = 0;
+
+        int mPlayCounter = 0;
+
+        ElisaUtils::PlayListEntryType mElementType = ElisaUtils::Unknown;
+
+        quint32 mPresentFields = 0;
+
+        bool mIsValidAlbumArtist = false;
+
+        bool mIsSingleDiscAlbum = false;
+
+        bool mHasEmbeddedCover = false;
+
+        DataType mOtherRoles;
+
+    };
+
+    using ListTrackRecord = QVector<TrackRecord>;
+
+    [[nodiscard]] static ListTrackRecord toListTrackRecord(const ListTrackDataType &tracks)
+    {
+        auto result = ListTrackRecord{};
+
+        result.reserve(tracks.size());
+        for (const auto &oneTrack : tracks) {
+            result.push_back(TrackRecord{oneTrack});
+        }
+
+        return result;
+    }
+
     class AlbumDataType : public MusicDataType
     {
     public:
@@ -407,11 +1214,31 @@ public:
 
     using ListGenreDataType = QList<GenreDataType>;
 
+    /**
+     * State of a directory when its content was last scanned. A directory with
+     * an identical fingerprint can be skipped at the next startup.
+     */
+    class DirectoryFingerprint
+    {
+    public:
+
+        QUrl mParentDirectory;
+
+        QDateTime mModificationTime;
+
+        int mEntriesCount = 0;
+
+    };
+
+    using DirectoryFingerprints = QHash<QUrl, DirectoryFingerprint>;
+
     using EntryData = std::tuple<MusicDataType, QString, QUrl>;
     using EntryDataList = QList<EntryData>;
 
 };
 
+Q_DECLARE_TYPEINFO(DataTypes::TrackRecord, Q_MOVABLE_TYPE);
+
 Q_DECLARE_METATYPE(DataTypes::MusicDataType)
 Q_DECLARE_METATYPE(DataTypes::TrackDataType)
 Q_DECLARE_METATYPE(DataTypes::AlbumDataType)
@@ -419,6 +1246,7 @@ Q_DECLARE_METATYPE(DataTypes::ArtistDataType)
 Q_DECLARE_METATYPE(DataTypes::GenreDataType)
 
 Q_DECLARE_METATYPE(DataTypes::ListTrackDataType)
+Q_DECLARE_METATYPE(DataTypes::ListTrackRecord)
 Q_DECLARE_METATYPE(DataTypes::ListAlbumDataType)
 Q_DECLARE_METATYPE(DataTypes::ListArtistDataType)
 Q_DECLARE_METATYPE(DataTypes::ListGenreDataType)
@@ -426,4 +1254,6 @@ Q_DECLARE_METATYPE(DataTypes::ListGenreDataType)
 Q_DECLARE_METATYPE(DataTypes::EntryData)
 Q_DECLARE_METATYPE(DataTypes::EntryDataList)
 
+Q_DECLARE_METATYPE(DataTypes::DirectoryFingerprints)
+
 #endif // DATATYPES_H
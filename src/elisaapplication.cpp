@@ -48,6 +48,7 @@
 #include <QUrl>
 #include <QFileInfo>
 #include <QDir>
+#include <QStandardPaths>
 #include <QFileSystemWatcher>
 #include <QKeyEvent>
 #include <QDebug>
@@ -408,6 +409,11 @@ void ElisaApplication::initializeModels()
 
     d->mMediaPlayListProxyModel = std::make_unique<MediaPlayListProxyModel>();
     d->mMediaPlayListProxyModel->setPlayListModel(d->mMediaPlayList.get());
+
+    const auto sessionDirectory = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    if (QDir{}.mkpath(sessionDirectory)) {
+        d->mMediaPlayListProxyModel->setSessionFileName(sessionDirectory + QStringLiteral("/playListSession.bin"));
+    }
     Q_EMIT mediaPlayListProxyModelChanged();
 
     d->mMusicManager->setElisaApplication(this);
@@ -448,6 +454,7 @@ void ElisaApplication::initializePlayer()
 
     QObject::connect(d->mAudioControl.get(), &ManageAudioPlayer::sourceInError, d->mMusicManager.get(), &MusicListenersManager::playBackError);
     QObject::connect(d->mAudioControl.get(), &ManageAudioPlayer::playerSourceChanged, d->mAudioWrapper.get(), &AudioWrapper::setSource);
+    QObject::connect(d->mAudioControl.get(), &ManageAudioPlayer::playerNextSourceChanged, d->mAudioWrapper.get(), &AudioWrapper::setNextSource);
     QObject::connect(d->mAudioControl.get(), &ManageAudioPlayer::startedPlayingTrack,
                      d->mMusicManager->viewDatabase(), &DatabaseInterface::trackHasStartedPlaying);
     QObject::connect(d->mAudioControl.get(), &ManageAudioPlayer::updateData, d->mMediaPlayList.get(), &MediaPlayList::setData);
@@ -455,6 +462,7 @@ void ElisaApplication::initializePlayer()
     QObject::connect(d->mMediaPlayListProxyModel.get(), &MediaPlayListProxyModel::ensurePlay, d->mAudioControl.get(), &ManageAudioPlayer::ensurePlay);
     QObject::connect(d->mMediaPlayListProxyModel.get(), &MediaPlayListProxyModel::playListFinished, d->mAudioControl.get(), &ManageAudioPlayer::playListFinished);
     QObject::connect(d->mMediaPlayListProxyModel.get(), &MediaPlayListProxyModel::currentTrackChanged, d->mAudioControl.get(), &ManageAudioPlayer::setCurrentTrack);
+    QObject::connect(d->mMediaPlayListProxyModel.get(), &MediaPlayListProxyModel::nextTrackChanged, d->mAudioControl.get(), &ManageAudioPlayer::setNextTrack);
     QObject::connect(d->mMediaPlayListProxyModel.get(), &MediaPlayListProxyModel::clearPlayListPlayer, d->mAudioControl.get(), &ManageAudioPlayer::saveForUndoClearPlaylist);
     QObject::connect(d->mMediaPlayListProxyModel.get(), &MediaPlayListProxyModel::undoClearPlayListPlayer, d->mAudioControl.get(), &ManageAudioPlayer::restoreForUndoClearPlaylist);
     QObject::connect(d->mMediaPlayListProxyModel.get(), &MediaPlayListProxyModel::seek, d->mAudioWrapper.get(), &AudioWrapper::seek);
@@ -467,6 +475,7 @@ void ElisaApplication::initializePlayer()
     QObject::connect(d->mAudioWrapper.get(), &AudioWrapper::seekableChanged, d->mAudioControl.get(), &ManageAudioPlayer::setPlayerIsSeekable);
     QObject::connect(d->mAudioWrapper.get(), &AudioWrapper::positionChanged, d->mAudioControl.get(), &ManageAudioPlayer::setPlayerPosition);
     QObject::connect(d->mAudioWrapper.get(), &AudioWrapper::currentPlayingForRadiosChanged, d->mAudioControl.get(), &ManageAudioPlayer::setCurrentPlayingForRadios);
+    QObject::connect(d->mAudioWrapper.get(), &AudioWrapper::switchedToNextSource, d->mAudioControl.get(), &ManageAudioPlayer::playerSwitchedToNextSource);
 
     QObject::connect(d->mMediaPlayListProxyModel.get(), &MediaPlayListProxyModel::currentTrackChanged, d->mPlayerControl.get(), &ManageMediaPlayerControl::setCurrentTrack);
     QObject::connect(d->mMediaPlayListProxyModel.get(), &MediaPlayListProxyModel::previousTrackChanged, d->mPlayerControl.get(), &ManageMediaPlayerControl::setPreviousTrack);
@@ -8,11 +8,15 @@
 
 #include "musiclistenersmanager.h"
 #include "elisaimportapplication.h"
+#include "elisaimportbenchmark.h"
 #include "elisa_settings.h"
 
 #include <QCoreApplication>
 #include <QCommandLineParser>
 #include <QStandardPaths>
+#include <QJsonDocument>
+#include <QFile>
+#include <QTextStream>
 
 int main(int argc, char *argv[])
 {
@@ -25,12 +29,69 @@ int main(int argc, char *argv[])
     qRegisterMetaType<QMap<QString,int>>("QMap<QString,int>");
     qRegisterMetaType<QHash<QUrl,QDateTime>>("QHash<QUrl,QDateTime>");
     qRegisterMetaType<DataTypes::ListTrackDataType>("DataTypes::ListTrackDataType");
+    qRegisterMetaType<DataTypes::ListTrackRecord>("DataTypes::ListTrackRecord");
+    qRegisterMetaType<DataTypes::DirectoryFingerprints>("DataTypes::DirectoryFingerprints");
 
     QCommandLineParser parser;
     parser.addHelpOption();
     parser.addVersionOption();
+
+    const auto benchmarkOption = QCommandLineOption{QStringLiteral("benchmark"),
+            QStringLiteral("Measure a cold import, a rescan without changes and a rescan after adding files. "
+                           "Uses a separate configuration and database.")};
+    const auto libraryOption = QCommandLineOption{QStringLiteral("library"),
+            QStringLiteral("Music library to import in benchmark mode. The rescan after adding files is only done with a generated library."),
+            QStringLiteral("directory")};
+    const auto generateOption = QCommandLineOption{QStringLiteral("generate"),
+            QStringLiteral("Number of tagged audio files to generate when no library is given."),
+            QStringLiteral("count"), QStringLiteral("1000")};
+    const auto outputOption = QCommandLineOption{QStringLiteral("output"),
+            QStringLiteral("Write the JSON metrics of the benchmark to this file instead of the standard output."),
+            QStringLiteral("file")};
+    auto benchmarkImportOption = QCommandLineOption{QStringLiteral("benchmark-import"),
+            QStringLiteral("Import the library once and print the JSON metrics."),
+            QStringLiteral("directory")};
+    benchmarkImportOption.setFlags(QCommandLineOption::HiddenFromHelp);
+
+    parser.addOptions({benchmarkOption, libraryOption, generateOption, outputOption, benchmarkImportOption});
     parser.process(app);
 
+    if (parser.isSet(benchmarkImportOption)) {
+        QStandardPaths::setTestModeEnabled(true);
+
+        const auto importMetrics = ElisaImportBenchmark::importLibrary(parser.value(benchmarkImportOption));
+
+        QTextStream output(stdout);
+        output << QJsonDocument{importMetrics}.toJson(QJsonDocument::Compact) << Qt::endl;
+
+        return importMetrics.contains(QStringLiteral("failed")) ? 1 : 0;
+    }
+
+    if (parser.isSet(benchmarkOption)) {
+        QStandardPaths::setTestModeEnabled(true);
+
+        ElisaImportBenchmark benchmark(QCoreApplication::applicationFilePath(), parser.value(libraryOption),
+                                       parser.value(generateOption).toInt());
+        const auto allMetrics = benchmark.run();
+        if (allMetrics.isEmpty()) {
+            return 1;
+        }
+
+        QFile outputFile;
+        if (parser.isSet(outputOption)) {
+            outputFile.setFileName(parser.value(outputOption));
+            if (!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+                return 1;
+            }
+        } else if (!outputFile.open(stdout, QIODevice::WriteOnly)) {
+            return 1;
+        }
+
+        outputFile.write(allMetrics);
+
+        return 0;
+    }
+
     auto configurationFileName = QStandardPaths::writableLocation(QStandardPaths::ConfigLocation);
     configurationFileName += QStringLiteral("/elisarc");
     Elisa::ElisaConfiguration::instance(configurationFileName);
@@ -40,6 +101,8 @@ int main(int argc, char *argv[])
     MusicListenersManager myMusicManager;
     ElisaImportApplication myApplication;
 
+    QObject::connect(&myMusicManager, &MusicListenersManager::fileSystemIndexingStatistics,
+            &myApplication, &ElisaImportApplication::indexingStatistics);
     QObject::connect(&myMusicManager, &MusicListenersManager::indexerBusyChanged,
             &myApplication, &ElisaImportApplication::indexingChanged);
 
@@ -7,6 +7,7 @@
 #include "elisaimportapplication.h"
 
 #include <QCoreApplication>
+#include <QTextStream>
 
 ElisaImportApplication::ElisaImportApplication(QObject *parent) : QObject(parent)
 {
@@ -23,5 +24,14 @@ void ElisaImportApplication::indexingChanged()
     }
 }
 
+void ElisaImportApplication::indexingStatistics(int scannedDirectoriesCount, int skippedDirectoriesCount, int skippedFilesCount)
+{
+    QTextStream output(stdout);
+
+    output << "scanned directories: " << scannedDirectoriesCount << Qt::endl;
+    output << "skipped unchanged directories: " << skippedDirectoriesCount << Qt::endl;
+    output << "skipped unchanged files: " << skippedFilesCount << Qt::endl;
+}
+
 
 #include "moc_elisaimportapplication.cpp"
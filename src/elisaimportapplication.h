@@ -21,6 +21,8 @@ public Q_SLOTS:
 
     void indexingChanged();
 
+    void indexingStatistics(int scannedDirectoriesCount, int skippedDirectoriesCount, int skippedFilesCount);
+
 };
 
 #endif // ELISAIMPORTAPPLICATION_H
@@ -0,0 +1,332 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "elisaimportbenchmark.h"
+
+#include "musiclistenersmanager.h"
+#include "databaseinterface.h"
+#include "performancecounters.h"
+#include "elisa_settings.h"
+
+#include <QCoreApplication>
+#include <QEventLoop>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <QProcess>
+#include <QStandardPaths>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QDebug>
+
+#include <utility>
+#include <algorithm>
+
+#if defined Q_OS_UNIX
+#include <sys/resource.h>
+#endif
+
+/**
+ * Number of tracks of each generated album. Albums are grouped by five for each artist.
+ */
+static const int GeneratedTracksPerAlbum = 10;
+
+static const int GeneratedAlbumsPerArtist = 5;
+
+/**
+ * One MPEG-1 layer III frame at 128 kbit/s and 44.1 kHz is 417 bytes long.
+ */
+static const int MpegFrameSize = 417;
+
+static const int MpegFramesCount = 40;
+
+/**
+ * An import still running after this delay is reported as failed instead of blocking the benchmark.
+ */
+static const int ImportTimeoutMilliseconds = 30 * 60 * 1000;
+
+static QByteArray id3TextFrame(const char *frameId, const QString &text)
+{
+    const auto frameData = QByteArray(1, '\0') + text.toLatin1();
+
+    auto frame = QByteArray{frameId};
+    frame.append(static_cast<char>((frameData.size() >> 24) & 0xff));
+    frame.append(static_cast<char>((frameData.size() >> 16) & 0xff));
+    frame.append(static_cast<char>((frameData.size() >> 8) & 0xff));
+    frame.append(static_cast<char>(frameData.size() & 0xff));
+    frame.append(2, '\0');
+    frame.append(frameData);
+
+    return frame;
+}
+
+static bool writeSyntheticTrack(const QString &libraryPath, int trackIndex, const QString &title)
+{
+    const auto albumIndex = trackIndex / GeneratedTracksPerAlbum;
+    const auto artistIndex = albumIndex / GeneratedAlbumsPerArtist;
+    const auto artistName = QStringLiteral("Artist %1").arg(artistIndex);
+    const auto albumName = QStringLiteral("Album %1").arg(albumIndex);
+    const auto albumPath = QStringLiteral("%1/%2/%3").arg(libraryPath, artistName, albumName);
+
+    if (!QDir{}.mkpath(albumPath)) {
+        return false;
+    }
+
+    auto frames = QByteArray{};
+    frames.append(id3TextFrame("TIT2", title));
+    frames.append(id3TextFrame("TPE1", artistName));
+    frames.append(id3TextFrame("TPE2", artistName));
+    frames.append(id3TextFrame("TALB", albumName));
+    frames.append(id3TextFrame("TRCK", QString::number(trackIndex % GeneratedTracksPerAlbum + 1)));
+    frames.append(id3TextFrame("TPOS", QStringLiteral("1")));
+    frames.append(id3TextFrame("TCON", QStringLiteral("Genre %1").arg(artistIndex % 10)));
+
+    auto fileContent = QByteArray{"ID3"};
+    fileContent.append('\3');
+    fileContent.append(2, '\0');
+    fileContent.append(static_cast<char>((frames.size() >> 21) & 0x7f));
+    fileContent.append(static_cast<char>((frames.size() >> 14) & 0x7f));
+    fileContent.append(static_cast<char>((frames.size() >> 7) & 0x7f));
+    fileContent.append(static_cast<char>(frames.size() & 0x7f));
+    fileContent.append(frames);
+
+    auto mpegFrame = QByteArray{"\xff\xfb\x90\x64", 4};
+    mpegFrame.append(MpegFrameSize - mpegFrame.size(), '\0');
+    for (int i = 0; i < MpegFramesCount; ++i) {
+        fileContent.append(mpegFrame);
+    }
+
+    QFile trackFile(QStringLiteral("%1/%2 - %3.mp3").arg(albumPath).arg(trackIndex, 6, 10, QLatin1Char('0')).arg(title));
+    if (!trackFile.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+
+    return trackFile.write(fileContent) == fileContent.size();
+}
+
+static qint64 peakResidentSetSize()
+{
+#if defined Q_OS_UNIX
+    auto usage = rusage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined Q_OS_MACOS
+        return usage.ru_maxrss / 1024;
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+#endif
+
+    return -1;
+}
+
+ElisaImportBenchmark::ElisaImportBenchmark(QString program, QString libraryPath, int generatedFilesCount)
+    : mProgram(std::move(program)), mLibraryPath(std::move(libraryPath)), mGeneratedFilesCount(generatedFilesCount)
+{
+}
+
+QByteArray ElisaImportBenchmark::run()
+{
+    if (mLibraryPath.isEmpty() && !generateLibrary()) {
+        qWarning() << "ElisaImportBenchmark::run" << "cannot generate the music library";
+        return {};
+    }
+
+    const auto databaseFileName = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + QStringLiteral("/elisaDatabase.db");
+    for (const auto &oneSuffix : {QStringLiteral(""), QStringLiteral("-wal"), QStringLiteral("-shm")}) {
+        QFile::remove(databaseFileName + oneSuffix);
+    }
+
+    auto allPhases = QJsonArray{};
+
+    allPhases.push_back(runPhase(QStringLiteral("cold")));
+    allPhases.push_back(runPhase(QStringLiteral("warm")));
+
+    if (mGeneratedLibrary) {
+        if (addIncrementalChanges()) {
+            allPhases.push_back(runPhase(QStringLiteral("incremental")));
+        } else {
+            qWarning() << "ElisaImportBenchmark::run" << "cannot modify the music library";
+        }
+    }
+
+    auto result = QJsonObject{};
+    result[QStringLiteral("libraryPath")] = mLibraryPath;
+    result[QStringLiteral("generatedLibrary")] = static_cast<bool>(mGeneratedLibrary);
+    result[QStringLiteral("phases")] = allPhases;
+
+    return QJsonDocument{result}.toJson();
+}
+
+QJsonObject ElisaImportBenchmark::importLibrary(const QString &libraryPath)
+{
+    auto configurationFileName = QStandardPaths::writableLocation(QStandardPaths::ConfigLocation);
+    configurationFileName += QStringLiteral("/elisarc");
+    Elisa::ElisaConfiguration::instance(configurationFileName);
+    Elisa::ElisaConfiguration::self()->load();
+    Elisa::ElisaConfiguration::setRootPath({libraryPath});
+    Elisa::ElisaConfiguration::setForceUsageOfFastFileSearch(false);
+    Elisa::ElisaConfiguration::self()->save();
+
+    PerformanceCounters::reset();
+
+    auto scannedDirectories = 0;
+    auto skippedDirectories = 0;
+    auto skippedFiles = 0;
+    auto indexerWasBusy = false;
+    auto elapsedTime = qint64{0};
+    auto failureReason = QString{};
+
+    QEventLoop importLoop;
+    QElapsedTimer importTimer;
+    importTimer.start();
+
+    QTimer timeoutTimer;
+    timeoutTimer.setSingleShot(true);
+    timeoutTimer.setInterval(ImportTimeoutMilliseconds);
+
+    QObject::connect(&timeoutTimer, &QTimer::timeout,
+                     &importLoop, [&]() {
+        failureReason = QStringLiteral("timeout");
+        importLoop.quit();
+    });
+
+    MusicListenersManager myMusicManager;
+
+    QObject::connect(myMusicManager.viewDatabase(), &DatabaseInterface::databaseError,
+                     &importLoop, [&]() {
+        failureReason = QStringLiteral("databaseError");
+        importLoop.quit();
+    });
+
+    QObject::connect(&myMusicManager, &MusicListenersManager::fileSystemIndexingStatistics,
+                     &importLoop, [&](int scannedDirectoriesCount, int skippedDirectoriesCount, int skippedFilesCount) {
+        scannedDirectories = scannedDirectoriesCount;
+        skippedDirectories = skippedDirectoriesCount;
+        skippedFiles = skippedFilesCount;
+    });
+
+    QObject::connect(&myMusicManager, &MusicListenersManager::indexerBusyChanged,
+                     &importLoop, [&]() {
+        if (myMusicManager.indexerBusy()) {
+            indexerWasBusy = true;
+            return;
+        }
+
+        if (!indexerWasBusy) {
+            return;
+        }
+
+        // wait for the tracks already sent to the database
+        QMetaObject::invokeMethod(myMusicManager.viewDatabase(), []() {}, Qt::BlockingQueuedConnection);
+
+        elapsedTime = importTimer.nsecsElapsed();
+        importLoop.quit();
+    });
+
+    timeoutTimer.start();
+    importLoop.exec();
+
+    auto result = QJsonObject{};
+    if (!failureReason.isEmpty()) {
+        qWarning() << "ElisaImportBenchmark::importLibrary" << "import failed" << failureReason;
+
+        elapsedTime = importTimer.nsecsElapsed();
+        result[QStringLiteral("failed")] = true;
+        result[QStringLiteral("failureReason")] = failureReason;
+    }
+    result[QStringLiteral("elapsedMilliseconds")] = elapsedTime / 1000000.;
+    result[QStringLiteral("scannedFiles")] = PerformanceCounters::value(PerformanceCounters::ScannedFiles);
+    result[QStringLiteral("scanFileMilliseconds")] = PerformanceCounters::value(PerformanceCounters::ScanFileNanoseconds) / 1000000.;
+    result[QStringLiteral("insertTracksListCalls")] = PerformanceCounters::value(PerformanceCounters::InsertTracksListCalls);
+    result[QStringLiteral("insertedTracks")] = PerformanceCounters::value(PerformanceCounters::InsertedTracks);
+    result[QStringLiteral("insertTracksListMilliseconds")] = PerformanceCounters::value(PerformanceCounters::InsertTracksListNanoseconds) / 1000000.;
+    result[QStringLiteral("sqlStatements")] = PerformanceCounters::value(PerformanceCounters::ExecutedQueries);
+    result[QStringLiteral("scannedDirectories")] = scannedDirectories;
+    result[QStringLiteral("skippedDirectories")] = skippedDirectories;
+    result[QStringLiteral("skippedFiles")] = skippedFiles;
+    result[QStringLiteral("peakResidentSetSizeKiB")] = peakResidentSetSize();
+
+    return result;
+}
+
+bool ElisaImportBenchmark::generateLibrary()
+{
+    mGeneratedLibrary = std::make_unique<QTemporaryDir>();
+    if (!mGeneratedLibrary->isValid()) {
+        return false;
+    }
+
+    mLibraryPath = mGeneratedLibrary->path();
+
+    for (int i = 0; i < mGeneratedFilesCount; ++i) {
+        if (!writeSyntheticTrack(mLibraryPath, i, QStringLiteral("Track %1").arg(i))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool ElisaImportBenchmark::addIncrementalChanges()
+{
+    // one percent of new tracks, spread over the existing albums and one new album
+    const auto newFilesCount = std::max(1, mGeneratedFilesCount / 100);
+    const auto albumsCount = std::max(1, mGeneratedFilesCount / GeneratedTracksPerAlbum);
+
+    for (int i = 0; i < newFilesCount; ++i) {
+        const auto trackIndex = (i < newFilesCount / 2 ?
+                                     (i * albumsCount / std::max(1, newFilesCount / 2)) * GeneratedTracksPerAlbum :
+                                     albumsCount * GeneratedTracksPerAlbum + i);
+        if (!writeSyntheticTrack(mLibraryPath, trackIndex, QStringLiteral("New Track %1").arg(i))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+QJsonObject ElisaImportBenchmark::runPhase(const QString &phaseName)
+{
+    qInfo() << "ElisaImportBenchmark::runPhase" << phaseName;
+
+    const auto filesCount = libraryFilesCount();
+
+    QProcess importProcess;
+    importProcess.setProcessChannelMode(QProcess::ForwardedErrorChannel);
+    importProcess.start(mProgram, {QStringLiteral("--benchmark-import"), mLibraryPath});
+    importProcess.waitForFinished(-1);
+
+    auto result = QJsonDocument::fromJson(importProcess.readAllStandardOutput()).object();
+
+    if (importProcess.exitStatus() != QProcess::NormalExit || importProcess.exitCode() != 0 || result.isEmpty()) {
+        qWarning() << "ElisaImportBenchmark::runPhase" << phaseName << "failed" << importProcess.errorString();
+        result[QStringLiteral("failed")] = true;
+    }
+
+    const auto elapsedMilliseconds = result[QStringLiteral("elapsedMilliseconds")].toDouble();
+
+    result[QStringLiteral("phase")] = phaseName;
+    result[QStringLiteral("libraryFiles")] = filesCount;
+    result[QStringLiteral("filesPerSecond")] = (elapsedMilliseconds > 0 ? filesCount * 1000. / elapsedMilliseconds : 0.);
+
+    return result;
+}
+
+int ElisaImportBenchmark::libraryFilesCount() const
+{
+    auto result = 0;
+
+    QDirIterator libraryIterator(mLibraryPath, QDir::Files, QDirIterator::Subdirectories);
+    while (libraryIterator.hasNext()) {
+        libraryIterator.next();
+        ++result;
+    }
+
+    return result;
+}
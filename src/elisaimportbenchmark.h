@@ -0,0 +1,64 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef ELISAIMPORTBENCHMARK_H
+#define ELISAIMPORTBENCHMARK_H
+
+#include <QString>
+#include <QJsonObject>
+#include <QTemporaryDir>
+
+#include <memory>
+
+/**
+ * Measure the throughput of the local file indexer.
+ *
+ * The benchmark runs three imports of the same music library: a cold import
+ * into an empty database, a rescan without any change and a rescan after some
+ * files have been added. Each import runs in its own elisaImport process so
+ * that the peak memory usage is measured per import. All files are created in
+ * the test locations of QStandardPaths.
+ */
+class ElisaImportBenchmark
+{
+public:
+
+    ElisaImportBenchmark(QString program, QString libraryPath, int generatedFilesCount);
+
+    /**
+     * Run the three imports and return the metrics as a JSON document.
+     */
+    [[nodiscard]] QByteArray run();
+
+    /**
+     * Import the library once in the current process and return the metrics
+     * of this import. Used by the processes started by run(). A failed import,
+     * on a database error or after a timeout, is flagged with the failed and
+     * failureReason keys.
+     */
+    static QJsonObject importLibrary(const QString &libraryPath);
+
+private:
+
+    bool generateLibrary();
+
+    bool addIncrementalChanges();
+
+    [[nodiscard]] QJsonObject runPhase(const QString &phaseName);
+
+    [[nodiscard]] int libraryFilesCount() const;
+
+    QString mProgram;
+
+    QString mLibraryPath;
+
+    int mGeneratedFilesCount = 0;
+
+    std::unique_ptr<QTemporaryDir> mGeneratedLibrary;
+
+};
+
+#endif // ELISAIMPORTBENCHMARK_H
@@ -35,6 +35,7 @@
 #include "mediaplaylistproxymodel.h"
 #include "managemediaplayercontrol.h"
 #include "manageheaderbar.h"
+#include "coverprefetcher.h"
 #include "manageaudioplayer.h"
 #include "musiclistenersmanager.h"
 #include "trackslistener.h"
@@ -118,6 +119,7 @@ void ElisaQmlTestPlugin::registerTypes(const char *uri)
     qmlRegisterType<MediaPlayListProxyModel>(uri, 1, 0, "MediaPlayListProxyModel");
     qmlRegisterType<ManageMediaPlayerControl>(uri, 1, 0, "ManageMediaPlayerControl");
     qmlRegisterType<ManageHeaderBar>(uri, 1, 0, "ManageHeaderBar");
+    qmlRegisterType<CoverPrefetcher>(uri, 1, 0, "CoverPrefetcher");
     qmlRegisterType<ManageAudioPlayer>(uri, 1, 0, "ManageAudioPlayer");
     qmlRegisterType<ProgressIndicator>(uri, 1, 0, "ProgressIndicator");
     qmlRegisterType<MusicListenersManager>(uri, 1, 0, "MusicListenersManager");
@@ -154,17 +156,21 @@ void ElisaQmlTestPlugin::registerTypes(const char *uri)
     qRegisterMetaType<QVector<qulonglong>>("QVector<qulonglong>");
     qRegisterMetaType<QHash<qulonglong,int>>("QHash<qulonglong,int>");
     qRegisterMetaType<DataTypes::ListTrackDataType>("DataTypes::ListTrackDataType");
+    qRegisterMetaType<DataTypes::ListTrackRecord>("DataTypes::ListTrackRecord");
     qRegisterMetaType<DataTypes::ListRadioDataType>("DataTypes::ListRadioDataType");
     qRegisterMetaType<DataTypes::ListAlbumDataType>("DataTypes::ListAlbumDataType");
     qRegisterMetaType<DataTypes::ListArtistDataType>("DataTypes::ListArtistDataType");
     qRegisterMetaType<DataTypes::ListGenreDataType>("DataTypes::ListGenreDataType");
     qRegisterMetaType<ModelDataLoader::ListTrackDataType>("ModelDataLoader::ListTrackDataType");
+    qRegisterMetaType<ModelDataLoader::ListTrackRecord>("ModelDataLoader::ListTrackRecord");
     qRegisterMetaType<ModelDataLoader::ListRadioDataType>("ModelDataLoader::ListRadioDataType");
     qRegisterMetaType<ModelDataLoader::ListAlbumDataType>("ModelDataLoader::ListAlbumDataType");
     qRegisterMetaType<ModelDataLoader::ListArtistDataType>("ModelDataLoader::ListArtistDataType");
     qRegisterMetaType<ModelDataLoader::ListGenreDataType>("ModelDataLoader::ListGenreDataType");
     qRegisterMetaType<ModelDataLoader::AlbumDataType>("ModelDataLoader::AlbumDataType");
     qRegisterMetaType<TracksListener::ListTrackDataType>("TracksListener::ListTrackDataType");
+    qRegisterMetaType<TracksListener::ListTrackRecord>("TracksListener::ListTrackRecord");
+    qRegisterMetaType<MediaPlayList::ListTrackDataType>("MediaPlayList::ListTrackDataType");
     qRegisterMetaType<QMap<QString, int>>();
     qRegisterMetaType<QAction*>();
     qRegisterMetaType<QMap<QString,int>>("QMap<QString,int>");
@@ -173,6 +179,7 @@ void ElisaQmlTestPlugin::registerTypes(const char *uri)
     qRegisterMetaType<ElisaUtils::PlayListEntryType>("ElisaUtils::PlayListEntryType");
     qRegisterMetaType<DataTypes::EntryData>("DataTypes::EntryData");
     qRegisterMetaType<DataTypes::EntryDataList>("DataTypes::EntryDataList");
+    qRegisterMetaType<DataTypes::DirectoryFingerprints>("DataTypes::DirectoryFingerprints");
     qRegisterMetaType<ElisaUtils::FilterType>("ElisaUtils::FilterType");
     qRegisterMetaType<DataTypes::TrackDataType>("DataTypes::TrackDataType");
     qRegisterMetaType<DataTypes::AlbumDataType>("DataTypes::AlbumDataType");
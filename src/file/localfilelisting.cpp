@@ -64,6 +64,8 @@ void LocalFileListing::triggerRefreshOfContent()
 
     checkFilesToRemove();
 
+    reportIndexingStatistics();
+
     if (!waitEndTrackRemoval()) {
         Q_EMIT indexingFinished();
     }
@@ -93,5 +95,17 @@ DataTypes::TrackDataType LocalFileListing::scanOneFile(const QUrl &scanFile, con
     return trackData;
 }
 
+DataTypes::TrackDataType LocalFileListing::extractTrackMetadata(FileScanner &scanner, const QUrl &scanFile, const QFileInfo &scanFileInfo) const
+{
+    auto trackData = scanner.scanOneBalooFile(scanFile, scanFileInfo);
+
+    if (!trackData.isValid()) {
+        qCDebug(orgKdeElisaIndexer()) << "LocalFileListing::extractTrackMetadata" << scanFile << "falling back to plain file metadata analysis";
+        trackData = AbstractFileListing::extractTrackMetadata(scanner, scanFile, scanFileInfo);
+    }
+
+    return trackData;
+}
+
 
 #include "moc_localfilelisting.cpp"
@@ -37,6 +37,8 @@ private:
 
     DataTypes::TrackDataType scanOneFile(const QUrl &scanFile, const QFileInfo &scanFileInfo, FileSystemWatchingModes watchForFileSystemChanges) override;
 
+    [[nodiscard]] DataTypes::TrackDataType extractTrackMetadata(FileScanner &scanner, const QUrl &scanFile, const QFileInfo &scanFileInfo) const override;
+
     std::unique_ptr<LocalFileListingPrivate> d;
 
 };
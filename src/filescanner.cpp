@@ -10,6 +10,8 @@
 
 #include "abstractfile/indexercommon.h"
 
+#include "performancecounters.h"
+
 #if defined KF5FileMetaData_FOUND && KF5FileMetaData_FOUND
 
 #include <KFileMetaData/ExtractorCollection>
@@ -32,6 +34,9 @@
 #include <QDir>
 #include <QHash>
 #include <QMimeDatabase>
+#include <QRegularExpression>
+
+#include <algorithm>
 
 class FileScannerPrivate
 {
@@ -80,10 +85,42 @@ public:
         ,QStringLiteral("*[Cc]over*.jpg")
         ,QStringLiteral("*[Cc]over*.png")
     };
+
+    QList<QRegularExpression> mCoverFileExpressions;
+
+    QHash<QString, QUrl> mDirectoryCoverFiles;
 };
 
+static QRegularExpression coverFileExpression(const QString &pattern)
+{
+    // same matching as the name filters of QDir
+    return QRegularExpression{QRegularExpression::wildcardToRegularExpression(pattern), QRegularExpression::CaseInsensitiveOption};
+}
+
+static QString findCoverFileName(const QList<QRegularExpression> &expressions, const QStringList &fileNames)
+{
+    auto result = QString{};
+
+    for (const auto &oneFileName : fileNames) {
+        const auto isCoverFile = std::any_of(expressions.begin(), expressions.end(), [&oneFileName](const auto &oneExpression) {
+            return oneExpression.match(oneFileName).hasMatch();
+        });
+
+        // QDir sorts the files by name and ignores the case
+        if (isCoverFile && (result.isEmpty() || oneFileName.compare(result, Qt::CaseInsensitive) < 0)) {
+            result = oneFileName;
+        }
+    }
+
+    return result;
+}
+
 FileScanner::FileScanner() : d(std::make_unique<FileScannerPrivate>())
 {
+    d->mCoverFileExpressions.reserve(d->constSearchStrings.size());
+    for (const auto &onePattern : d->constSearchStrings) {
+        d->mCoverFileExpressions.push_back(coverFileExpression(onePattern));
+    }
 }
 
 bool FileScanner::shouldScanFile(const QString &scanFile)
@@ -96,6 +133,9 @@ FileScanner::~FileScanner() = default;
 
 DataTypes::TrackDataType FileScanner::scanOneFile(const QUrl &scanFile, const QFileInfo &scanFileInfo)
 {
+    auto scanTimer = PerformanceCounters::ScopedTimer{PerformanceCounters::ScanFileNanoseconds};
+    PerformanceCounters::add(PerformanceCounters::ScannedFiles, 1);
+
     DataTypes::TrackDataType newTrack;
 
     if (!scanFile.isLocalFile() && !scanFile.scheme().isEmpty()) {
@@ -252,29 +292,63 @@ void FileScanner::scanProperties(const QString &localFileName, DataTypes::TrackD
 #endif
 }
 
+/**
+ * Key of a directory in the cache of cover files. The listing, the scanner and the file system
+ * watcher do not all use the same form of a path, so the key is the canonical path when the
+ * directory exists.
+ */
+static QString directoryCoverKey(const QString &directoryPath)
+{
+    const QFileInfo directoryInfo(directoryPath);
+
+    auto result = directoryInfo.canonicalFilePath();
+    if (result.isEmpty()) {
+        result = QDir::cleanPath(directoryInfo.absoluteFilePath());
+    }
+
+    return result;
+}
+
 QUrl FileScanner::searchForCoverFile(const QString &localFileName)
 {
-    const QFileInfo trackFilePath(localFileName);
-    QDir trackFileDir = trackFilePath.absoluteDir();
-    trackFileDir.setFilter(QDir::Files);
-    trackFileDir.setNameFilters(d->constSearchStrings);
-    QFileInfoList coverFiles = trackFileDir.entryInfoList();
-    if (coverFiles.isEmpty()) {
+    const auto directoryPath = QFileInfo(localFileName).absolutePath();
+
+    auto itCoverFile = d->mDirectoryCoverFiles.constFind(directoryCoverKey(directoryPath));
+    if (itCoverFile == d->mDirectoryCoverFiles.constEnd()) {
+        updateDirectoryCoverFile(directoryPath, QDir(directoryPath).entryList(QDir::Files));
+        itCoverFile = d->mDirectoryCoverFiles.constFind(directoryCoverKey(directoryPath));
+    }
+
+    return itCoverFile.value();
+}
+
+void FileScanner::updateDirectoryCoverFile(const QString &directoryPath, const QStringList &fileNames)
+{
+    const QDir trackFileDir(directoryPath);
+
+    auto coverFileName = findCoverFileName(d->mCoverFileExpressions, fileNames);
+    if (coverFileName.isEmpty()) {
         const QString dirNamePattern = QLatin1String("*") + trackFileDir.dirName() + QLatin1String("*");
         const QString dirNameNoSpaces = QLatin1String("*") + trackFileDir.dirName().remove(QLatin1Char(' ')) + QLatin1String("*");
-        const QStringList filters = {
-            dirNamePattern + QStringLiteral(".jpg"),
-            dirNamePattern + QStringLiteral(".png"),
-            dirNameNoSpaces + QStringLiteral(".jpg"),
-            dirNameNoSpaces + QStringLiteral(".png")
+        const QList<QRegularExpression> expressions = {
+            coverFileExpression(dirNamePattern + QStringLiteral(".jpg")),
+            coverFileExpression(dirNamePattern + QStringLiteral(".png")),
+            coverFileExpression(dirNameNoSpaces + QStringLiteral(".jpg")),
+            coverFileExpression(dirNameNoSpaces + QStringLiteral(".png"))
         };
-        trackFileDir.setNameFilters(filters);
-        coverFiles = trackFileDir.entryInfoList();
+        coverFileName = findCoverFileName(expressions, fileNames);
     }
-    if (coverFiles.isEmpty()) {
-        return QUrl();
+
+    if (coverFileName.isEmpty()) {
+        d->mDirectoryCoverFiles[directoryCoverKey(directoryPath)] = QUrl();
+    } else {
+        d->mDirectoryCoverFiles[directoryCoverKey(directoryPath)] = QUrl::fromLocalFile(trackFileDir.absoluteFilePath(coverFileName));
     }
-    return QUrl::fromLocalFile(coverFiles.first().absoluteFilePath());
+}
+
+void FileScanner::invalidateDirectoryCoverFile(const QString &directoryPath)
+{
+    d->mDirectoryCoverFiles.remove(directoryCoverKey(directoryPath));
 }
 
 bool FileScanner::checkEmbeddedCoverImage(const QString &localFileName)
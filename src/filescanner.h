@@ -33,8 +33,20 @@ public:
 
     DataTypes::TrackDataType scanOneBalooFile(const QUrl &scanFile, const QFileInfo &scanFileInfo);
 
+    /**
+     * Return the cover file in the directory of localFileName. The result is
+     * cached for each directory, the directory is only listed on a cache miss.
+     */
     QUrl searchForCoverFile(const QString &localFileName);
 
+    /**
+     * Find the cover file of a directory from the names of its files, as
+     * already listed by the caller, and cache it.
+     */
+    void updateDirectoryCoverFile(const QString &directoryPath, const QStringList &fileNames);
+
+    void invalidateDirectoryCoverFile(const QString &directoryPath);
+
 private:
 
     void scanProperties(const QString &localFileName, DataTypes::TrackDataType &trackData);
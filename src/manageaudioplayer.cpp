@@ -15,6 +15,8 @@
 #include <QTimer>
 #include <QDateTime>
 
+#include <utility>
+
 ManageAudioPlayer::ManageAudioPlayer(QObject *parent) : QObject(parent)
 {
 
@@ -146,6 +148,28 @@ void ManageAudioPlayer::setCurrentTrack(const QPersistentModelIndex &currentTrac
         Q_EMIT currentTrackChanged();
     }
 
+    if (!mSwitchedSource.isEmpty()) {
+        const auto switchedSource = std::exchange(mSwitchedSource, QUrl{});
+
+        if (mCurrentTrack.isValid() && mCurrentTrack.data(mUrlRole).toUrl() == switchedSource) {
+            mOldPlayerSource = mCurrentTrack.data(mUrlRole);
+
+            if (mPlayListModel) {
+                if (mOldCurrentTrack.isValid() && mOldCurrentTrack != mCurrentTrack) {
+                    mPlayListModel->setData(mOldCurrentTrack, MediaPlayList::NotPlaying, mIsPlayingRole);
+                }
+                mPlayListModel->setData(mCurrentTrack, MediaPlayList::IsPlaying, mIsPlayingRole);
+            }
+
+            Q_EMIT startedPlayingTrack(switchedSource, QDateTime::currentDateTime());
+
+            // the prepared source has been consumed by the player
+            Q_EMIT playerNextSourceChanged(mNextTrack.data(mUrlRole).toUrl());
+
+            return;
+        }
+    }
+
     switch (mPlayerPlaybackState) {
     case QMediaPlayer::StoppedState:
         Q_EMIT playerSourceChanged(mCurrentTrack.data(mUrlRole).toUrl());
@@ -161,6 +185,21 @@ void ManageAudioPlayer::setCurrentTrack(const QPersistentModelIndex &currentTrac
     }
 }
 
+void ManageAudioPlayer::setNextTrack(const QPersistentModelIndex &nextTrack)
+{
+    mNextTrack = nextTrack;
+
+    Q_EMIT playerNextSourceChanged(mNextTrack.data(mUrlRole).toUrl());
+}
+
+void ManageAudioPlayer::playerSwitchedToNextSource(const QUrl &source)
+{
+    qCDebug(orgKdeElisaPlayer()) << "ManageAudioPlayer::playerSwitchedToNextSource" << source;
+
+    mSwitchedSource = source;
+    triggerSkipNextTrack();
+}
+
 void ManageAudioPlayer::saveForUndoClearPlaylist(){
     mUndoPlayingState = mPlayingState;
 
@@ -450,6 +489,11 @@ void ManageAudioPlayer::playListFinished()
 
 void ManageAudioPlayer::tracksDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles)
 {
+    if (mNextTrack.isValid() && mNextTrack.row() >= topLeft.row() && mNextTrack.row() <= bottomRight.row() &&
+            (roles.isEmpty() || roles.contains(mUrlRole))) {
+        Q_EMIT playerNextSourceChanged(mNextTrack.data(mUrlRole).toUrl());
+    }
+
     if (!mCurrentTrack.isValid()) {
         return;
     }
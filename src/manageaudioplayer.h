@@ -146,6 +146,8 @@ Q_SIGNALS:
 
     void playerSourceChanged(const QUrl &url);
 
+    void playerNextSourceChanged(const QUrl &url);
+
     void urlRoleChanged();
 
     void isPlayingRoleChanged();
@@ -198,6 +200,15 @@ public Q_SLOTS:
 
     void setCurrentTrack(const QPersistentModelIndex &currentTrack);
 
+    void setNextTrack(const QPersistentModelIndex &nextTrack);
+
+    /**
+     * The audio player has started the next source it had prepared without
+     * going through the stopped state. The play list is moved to the next
+     * track and the player is left playing.
+     */
+    void playerSwitchedToNextSource(const QUrl &source);
+
     void saveForUndoClearPlaylist();
 
     void restoreForUndoClearPlaylist();
@@ -264,6 +275,10 @@ private:
 
     QPersistentModelIndex mOldCurrentTrack;
 
+    QPersistentModelIndex mNextTrack;
+
+    QUrl mSwitchedSource;
+
     QAbstractItemModel *mPlayListModel = nullptr;
 
     int mTitleRole = Qt::DisplayRole;
@@ -12,6 +12,7 @@
 #include <QUrl>
 #include <QPersistentModelIndex>
 #include <QList>
+#include <QMultiHash>
 #include <QMediaPlaylist>
 #include <QFileInfo>
 #include <QJsonArray>
@@ -21,16 +22,171 @@
 
 #include <algorithm>
 
+class PlayListEntryKey
+{
+public:
+
+    bool operator==(const PlayListEntryKey &other) const
+    {
+        return mTitle == other.mTitle && mArtist == other.mArtist && mAlbum == other.mAlbum &&
+                mTrackNumber == other.mTrackNumber && mDiscNumber == other.mDiscNumber;
+    }
+
+    QString mTitle;
+
+    QString mArtist;
+
+    QString mAlbum;
+
+    int mTrackNumber = 0;
+
+    int mDiscNumber = 0;
+
+};
+
+static uint qHash(const PlayListEntryKey &key, uint seed = 0)
+{
+    seed = qHash(key.mTitle, seed);
+    seed = qHash(key.mArtist, seed);
+    seed = qHash(key.mAlbum, seed);
+    seed = qHash(key.mTrackNumber, seed);
+    return qHash(key.mDiscNumber, seed);
+}
+
 class MediaPlayListPrivate
 {
 public:
 
+    /**
+     * Rows of the playlist are indexed by database id, by resource url and,
+     * for entries waiting to be resolved, by title, artist, album, track and
+     * disc numbers. The indexes are rebuilt on first use after rows have been
+     * inserted, removed or moved.
+     */
+    void buildIndexes();
+
+    void invalidateIndexes();
+
+    void addRowToIndexes(int row);
+
+    void removeRowFromIndexes(int row);
+
+    [[nodiscard]] QList<int> candidateRows(const DataTypes::TrackDataType &track);
+
     QList<MediaPlayListEntry> mData;
 
-    QList<DataTypes::TrackDataType> mTrackData;
+    DataTypes::ListTrackRecord mTrackData;
+
+    QMultiHash<qulonglong, int> mRowsFromId;
+
+    QMultiHash<QUrl, int> mRowsFromUrl;
+
+    QMultiHash<PlayListEntryKey, int> mRowsFromKey;
+
+    bool mIndexesAreValid = false;
 
 };
 
+static PlayListEntryKey keyFromEntry(const MediaPlayListEntry &entry)
+{
+    return {entry.mTitle.toString(), entry.mArtist.toString(), entry.mAlbum.toString(),
+                entry.mTrackNumber.toInt(), entry.mDiscNumber.toInt()};
+}
+
+void MediaPlayListPrivate::buildIndexes()
+{
+    if (mIndexesAreValid) {
+        return;
+    }
+
+    mRowsFromId.clear();
+    mRowsFromUrl.clear();
+    mRowsFromKey.clear();
+
+    mIndexesAreValid = true;
+
+    for (int row = 0; row < mData.size(); ++row) {
+        addRowToIndexes(row);
+    }
+}
+
+void MediaPlayListPrivate::invalidateIndexes()
+{
+    mIndexesAreValid = false;
+}
+
+void MediaPlayListPrivate::addRowToIndexes(int row)
+{
+    if (!mIndexesAreValid) {
+        return;
+    }
+
+    const auto &oneEntry = mData[row];
+
+    if (oneEntry.mId != 0) {
+        mRowsFromId.insert(oneEntry.mId, row);
+    }
+
+    if (oneEntry.mEntryType == ElisaUtils::Artist) {
+        return;
+    }
+
+    if (oneEntry.mTrackUrl.toUrl().isValid()) {
+        mRowsFromUrl.insert(oneEntry.mTrackUrl.toUrl(), row);
+    } else if (!oneEntry.mIsValid && oneEntry.mEntryType != ElisaUtils::Radio && !oneEntry.mTrackUrl.isValid()) {
+        mRowsFromKey.insert(keyFromEntry(oneEntry), row);
+    }
+}
+
+void MediaPlayListPrivate::removeRowFromIndexes(int row)
+{
+    if (!mIndexesAreValid) {
+        return;
+    }
+
+    const auto &oneEntry = mData[row];
+
+    if (oneEntry.mId != 0) {
+        mRowsFromId.remove(oneEntry.mId, row);
+    }
+
+    if (oneEntry.mEntryType == ElisaUtils::Artist) {
+        return;
+    }
+
+    if (oneEntry.mTrackUrl.toUrl().isValid()) {
+        mRowsFromUrl.remove(oneEntry.mTrackUrl.toUrl(), row);
+    } else if (!oneEntry.mIsValid && oneEntry.mEntryType != ElisaUtils::Radio && !oneEntry.mTrackUrl.isValid()) {
+        mRowsFromKey.remove(keyFromEntry(oneEntry), row);
+    }
+}
+
+QList<int> MediaPlayListPrivate::candidateRows(const DataTypes::TrackDataType &track)
+{
+    buildIndexes();
+
+    auto result = QList<int>{};
+
+    if (track.databaseId() != 0) {
+        result.append(mRowsFromId.values(track.databaseId()));
+    }
+
+    if (track.resourceURI().isValid()) {
+        result.append(mRowsFromUrl.values(track.resourceURI()));
+    }
+
+    if (track.find(DataTypes::TitleRole) != track.end() && track.hasArtist() && track.hasAlbum() && track.hasTrackNumber() && track.hasDiscNumber()) {
+        result.append(mRowsFromKey.values({track.title(), track.artist(), track.album(), track.trackNumber(), track.discNumber()}));
+    } else {
+        result.append(mRowsFromKey.values());
+    }
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+
+    return result;
+}
+
 MediaPlayList::MediaPlayList(QObject *parent) : QAbstractListModel(parent), d(new MediaPlayListPrivate)
 {
 }
@@ -107,7 +263,7 @@ QVariant MediaPlayList::data(const QModelIndex &index, int role) const
             break;
         case ColumnsRoles::StringDurationRole:
         {
-            QTime trackDuration = d->mTrackData[index.row()][TrackDataType::key_type::DurationRole].toTime();
+            QTime trackDuration = d->mTrackData[index.row()].duration();
             if (trackDuration.hour() == 0) {
                 result = trackDuration.toString(QStringLiteral("mm:ss"));
             } else {
@@ -116,18 +272,17 @@ QVariant MediaPlayList::data(const QModelIndex &index, int role) const
             break;
         }
         case ColumnsRoles::AlbumSectionRole:
-            result = QJsonDocument{QJsonArray{d->mTrackData[index.row()][TrackDataType::key_type::AlbumRole].toString(),
-                    d->mTrackData[index.row()][TrackDataType::key_type::AlbumArtistRole].toString(),
-                    d->mTrackData[index.row()][TrackDataType::key_type::ImageUrlRole].toUrl().toString()}}.toJson();
+            result = QJsonDocument{QJsonArray{d->mTrackData[index.row()].album(),
+                    d->mTrackData[index.row()].albumArtist(),
+                    d->mTrackData[index.row()].albumCover().toString()}}.toJson();
             break;
         case ColumnsRoles::TitleRole:
         {
             const auto &trackData = d->mTrackData[index.row()];
-            auto titleData = trackData[TrackDataType::key_type::TitleRole];
-            if (titleData.toString().isEmpty()) {
-                result = trackData[TrackDataType::key_type::ResourceRole].toUrl().fileName();
+            if (trackData.title().isEmpty()) {
+                result = trackData.resourceURI().fileName();
             } else {
-                result = titleData;
+                result = trackData.title();
             }
             break;
         }
@@ -154,13 +309,7 @@ QVariant MediaPlayList::data(const QModelIndex &index, int role) const
             break;
         default:
             const auto &trackData = d->mTrackData[index.row()];
-            auto roleEnum = static_cast<TrackDataType::key_type>(role);
-            auto itData = trackData.find(roleEnum);
-            if (itData != trackData.end()) {
-                result = itData.value();
-            } else {
-                result = {};
-            }
+            result = trackData.value(static_cast<TrackDataType::key_type>(role));
         }
     } else {
         switch(role)
@@ -244,8 +393,10 @@ bool MediaPlayList::setData(const QModelIndex &index, const QVariant &value, int
     case ColumnsRoles::TitleRole:
     {
         modelModified = true;
+        d->removeRowFromIndexes(index.row());
         d->mData[index.row()].mTitle = value;
-        d->mTrackData[index.row()][static_cast<TrackDataType::key_type>(role)] = value;
+        d->addRowToIndexes(index.row());
+        d->mTrackData[index.row()].insert(static_cast<TrackDataType::key_type>(role), value);
         Q_EMIT dataChanged(index, index, {role});
 
         break;
@@ -253,8 +404,10 @@ bool MediaPlayList::setData(const QModelIndex &index, const QVariant &value, int
     case ColumnsRoles::ArtistRole:
     {
         modelModified = true;
+        d->removeRowFromIndexes(index.row());
         d->mData[index.row()].mArtist = value;
-        d->mTrackData[index.row()][static_cast<TrackDataType::key_type>(role)] = value;
+        d->addRowToIndexes(index.row());
+        d->mTrackData[index.row()].insert(static_cast<TrackDataType::key_type>(role), value);
         Q_EMIT dataChanged(index, index, {role});
 
         break;
@@ -268,6 +421,8 @@ bool MediaPlayList::setData(const QModelIndex &index, const QVariant &value, int
 
 bool MediaPlayList::removeRows(int row, int count, const QModelIndex &parent)
 {
+    d->invalidateIndexes();
+
     beginRemoveRows(parent, row, row + count - 1);
 
     for (int i = row, cpt = 0; cpt < count; ++i, ++cpt) {
@@ -289,6 +444,8 @@ bool MediaPlayList::moveRows(const QModelIndex &sourceParent, int sourceRow, int
         return false;
     }
 
+    d->invalidateIndexes();
+
     for (auto cptItem = 0; cptItem < count; ++cptItem) {
         if (sourceRow < destinationChild) {
             d->mData.move(sourceRow, destinationChild - 1);
@@ -306,11 +463,9 @@ bool MediaPlayList::moveRows(const QModelIndex &sourceParent, int sourceRow, int
 
 void MediaPlayList::enqueueRestoredEntries(const QVariantList &newEntries)
 {
-    if (newEntries.isEmpty()) {
-        return;
-    }
+    auto restoredEntries = QList<MediaPlayListEntry>{};
+    restoredEntries.reserve(newEntries.size());
 
-    beginInsertRows(QModelIndex(), d->mData.size(), d->mData.size() + newEntries.size() - 1);
     for (auto &oneData : newEntries) {
         auto trackData = oneData.toStringList();
         if (trackData.size() != 7 && trackData.size() != 8) {
@@ -329,8 +484,50 @@ void MediaPlayList::enqueueRestoredEntries(const QVariantList &newEntries)
         }
 
         auto mEntryType = static_cast<ElisaUtils::PlayListEntryType>(trackData[6].toInt());
-        auto newEntry = MediaPlayListEntry({restoredId, restoredTitle, restoredArtist, restoredAlbum, restoredFileUrl, restoredTrackNumber, restoredDiscNumber, mEntryType});
+        restoredEntries.push_back({restoredId, restoredTitle, restoredArtist, restoredAlbum, restoredFileUrl, restoredTrackNumber, restoredDiscNumber, mEntryType});
+    }
+
+    restoreEntries(restoredEntries);
+}
+
+void MediaPlayList::enqueueSnapshotEntries(const QList<PlayListSnapshot::Entry> &newEntries)
+{
+    auto restoredEntries = QList<MediaPlayListEntry>{};
+    restoredEntries.reserve(newEntries.size());
+
+    for (const auto &oneEntry : newEntries) {
+        auto restoredFileUrl = QVariant{};
+        if (!oneEntry.mTrackUrl.isEmpty()) {
+            restoredFileUrl = QUrl{oneEntry.mTrackUrl};
+        }
+        auto restoredTrackNumber = QVariant{};
+        if (oneEntry.mTrackNumber) {
+            restoredTrackNumber = oneEntry.mTrackNumber.value();
+        }
+        auto restoredDiscNumber = QVariant{};
+        if (oneEntry.mDiscNumber) {
+            restoredDiscNumber = oneEntry.mDiscNumber.value();
+        }
+
+        restoredEntries.push_back({oneEntry.mDatabaseId, oneEntry.mTitle, oneEntry.mArtist, oneEntry.mAlbum, restoredFileUrl,
+                                   restoredTrackNumber, restoredDiscNumber, oneEntry.mEntryType});
+    }
 
+    restoreEntries(restoredEntries);
+}
+
+void MediaPlayList::restoreEntries(const QList<MediaPlayListEntry> &newEntries)
+{
+    if (newEntries.isEmpty()) {
+        return;
+    }
+
+    d->invalidateIndexes();
+
+    auto tracksByName = ListTrackDataType{};
+
+    beginInsertRows(QModelIndex(), d->mData.size(), d->mData.size() + newEntries.size() - 1);
+    for (const auto &newEntry : newEntries) {
         d->mData.push_back(newEntry);
         d->mTrackData.push_back({});
 
@@ -349,20 +546,38 @@ void MediaPlayList::enqueueRestoredEntries(const QVariantList &newEntries)
                 d->mData.last().mIsValid = true;
             }
         } else {
-            Q_EMIT newTrackByNameInList(newEntry.mTitle,
-                                        newEntry.mArtist,
-                                        newEntry.mAlbum,
-                                        newEntry.mTrackNumber,
-                                        newEntry.mDiscNumber);
+            auto oneTrack = TrackDataType{};
+            oneTrack[DataTypes::TitleRole] = newEntry.mTitle.toString();
+            oneTrack[DataTypes::ArtistRole] = newEntry.mArtist.toString();
+            if (!newEntry.mAlbum.toString().isEmpty()) {
+                oneTrack[DataTypes::AlbumRole] = newEntry.mAlbum.toString();
+            }
+            auto trackNumberIsValid = bool{};
+            const auto trackNumberValue = newEntry.mTrackNumber.toInt(&trackNumberIsValid);
+            if (trackNumberIsValid) {
+                oneTrack[DataTypes::TrackNumberRole] = trackNumberValue;
+            }
+            auto discNumberIsValid = bool{};
+            const auto discNumberValue = newEntry.mDiscNumber.toInt(&discNumberIsValid);
+            if (discNumberIsValid) {
+                oneTrack[DataTypes::DiscNumberRole] = discNumberValue;
+            }
+            tracksByName.push_back(oneTrack);
         }
     }
     endInsertRows();
+
+    if (!tracksByName.isEmpty()) {
+        Q_EMIT newTracksByNameInList(tracksByName);
+    }
 }
 
 void MediaPlayList::enqueueFilesList(const DataTypes::EntryDataList &newEntries)
 {
     qCDebug(orgKdeElisaPlayList()) << "MediaPlayList::enqueueFilesList";
 
+    d->invalidateIndexes();
+
     beginInsertRows(QModelIndex(), d->mData.size(), d->mData.size() + newEntries.size() - 1);
     for (const auto &oneTrackUrl : newEntries) {
         const auto &trackUrl = std::get<2>(oneTrackUrl);
@@ -370,16 +585,18 @@ void MediaPlayList::enqueueFilesList(const DataTypes::EntryDataList &newEntries)
         newEntry.mEntryType = ElisaUtils::FileName;
         d->mData.push_back(newEntry);
         if (trackUrl.isValid()) {
+            auto newTrackData = DataTypes::TrackRecord{};
+            newTrackData.setResourceURI(trackUrl);
             if (trackUrl.isLocalFile()) {
-                d->mTrackData.push_back({{DataTypes::ColumnsRoles::ResourceRole, trackUrl}});
+                d->mTrackData.push_back(newTrackData);
                 auto entryString =  trackUrl.toLocalFile();
                 QFileInfo newTrackFile(entryString);
                 if (newTrackFile.exists()) {
                     d->mData.last().mIsValid = true;
                 }
             } else {
-                d->mTrackData.push_back({{DataTypes::ColumnsRoles::ResourceRole, trackUrl},
-                                         {DataTypes::ColumnsRoles::TitleRole, trackUrl.fileName()}});
+                newTrackData.setTitle(trackUrl.fileName());
+                d->mTrackData.push_back(newTrackData);
                 d->mData.last().mIsValid = true;
             }
             Q_EMIT newUrlInList(trackUrl, newEntry.mEntryType);
@@ -393,6 +610,8 @@ void MediaPlayList::enqueueFilesList(const DataTypes::EntryDataList &newEntries)
 void MediaPlayList::enqueueOneEntry(const DataTypes::EntryData &entryData)
 {
     if (!std::get<0>(entryData).isEmpty() || !std::get<1>(entryData).isEmpty() || !std::get<2>(entryData).isEmpty()) {
+        d->invalidateIndexes();
+
         beginInsertRows(QModelIndex(), d->mData.size(), d->mData.size());
         if (!std::get<0>(entryData).databaseId() && std::get<2>(entryData).isValid()) {
             auto newEntry = MediaPlayListEntry{std::get<2>(entryData)};
@@ -408,7 +627,7 @@ void MediaPlayList::enqueueOneEntry(const DataTypes::EntryData &entryData)
             {
             case ElisaUtils::Track:
             case ElisaUtils::Radio:
-                d->mTrackData.push_back(static_cast<const DataTypes::TrackDataType&>(data));
+                d->mTrackData.push_back(DataTypes::TrackRecord{static_cast<const DataTypes::TrackDataType&>(data)});
                 break;
             default:
                 d->mTrackData.push_back({});
@@ -427,6 +646,8 @@ void MediaPlayList::enqueueMultipleEntries(const DataTypes::EntryDataList &entri
 {
     qCDebug(orgKdeElisaPlayList()) << "MediaPlayList::enqueueMultipleEntries" << entriesData.size();
 
+    d->invalidateIndexes();
+
     beginInsertRows(QModelIndex(), d->mData.size(), d->mData.size() + entriesData.size() - 1);
     for (const auto &entryData : entriesData) {
         qCDebug(orgKdeElisaPlayList()) << "MediaPlayList::enqueueMultipleEntries" << std::get<0>(entryData);
@@ -444,7 +665,7 @@ void MediaPlayList::enqueueMultipleEntries(const DataTypes::EntryDataList &entri
             case ElisaUtils::Track:
             case ElisaUtils::Radio:
             case ElisaUtils::FileName:
-                d->mTrackData.push_back(static_cast<const DataTypes::TrackDataType&>(data));
+                d->mTrackData.push_back(DataTypes::TrackRecord{static_cast<const DataTypes::TrackDataType&>(data)});
                 break;
             default:
                 d->mTrackData.push_back({});
@@ -468,6 +689,8 @@ void MediaPlayList::clearPlayList()
         return;
     }
 
+    d->invalidateIndexes();
+
     beginRemoveRows({}, 0, d->mData.count() - 1);
     d->mData.clear();
     d->mTrackData.clear();
@@ -511,6 +734,69 @@ QVariantList MediaPlayList::getEntriesForRestore() const
     return result;
 }
 
+MediaPlayList::SnapshotSource MediaPlayList::snapshotSource() const
+{
+    return {d->mData, d->mTrackData};
+}
+
+QList<PlayListSnapshot::Entry> MediaPlayList::getEntriesForSnapshot() const
+{
+    return getEntriesForSnapshot(snapshotSource());
+}
+
+QList<PlayListSnapshot::Entry> MediaPlayList::getEntriesForSnapshot(const SnapshotSource &source)
+{
+    auto result = QList<PlayListSnapshot::Entry>{};
+    result.reserve(source.mData.size());
+
+    for (int trackIndex = 0; trackIndex < source.mData.size(); ++trackIndex) {
+        const auto &oneEntry = source.mData[trackIndex];
+        const auto &oneTrack = source.mTrackData[trackIndex];
+
+        auto snapshotEntry = PlayListSnapshot::Entry{};
+        snapshotEntry.mEntryType = oneEntry.mEntryType;
+
+        if (oneEntry.mIsValid) {
+            snapshotEntry.mDatabaseId = oneTrack.databaseId();
+            snapshotEntry.mTitle = oneTrack.title();
+            snapshotEntry.mArtist = oneTrack.artist();
+            if (oneTrack.hasAlbum()) {
+                snapshotEntry.mAlbum = oneTrack.album();
+            }
+            if (oneTrack.hasTrackNumber()) {
+                snapshotEntry.mTrackNumber = oneTrack.trackNumber();
+            }
+            if (oneTrack.hasDiscNumber()) {
+                snapshotEntry.mDiscNumber = oneTrack.discNumber();
+            }
+            snapshotEntry.mTrackUrl = oneTrack.resourceURI().toString();
+        } else if (oneTrack.isEmpty() && oneEntry.mEntryType != ElisaUtils::Artist) {
+            // restored entries not yet confirmed by the database are kept as they were saved
+            snapshotEntry.mDatabaseId = oneEntry.mId;
+            snapshotEntry.mTitle = oneEntry.mTitle.toString();
+            snapshotEntry.mArtist = oneEntry.mArtist.toString();
+            snapshotEntry.mAlbum = oneEntry.mAlbum.toString();
+            auto trackNumberIsValid = bool{};
+            const auto trackNumberValue = oneEntry.mTrackNumber.toInt(&trackNumberIsValid);
+            if (trackNumberIsValid) {
+                snapshotEntry.mTrackNumber = trackNumberValue;
+            }
+            auto discNumberIsValid = bool{};
+            const auto discNumberValue = oneEntry.mDiscNumber.toInt(&discNumberIsValid);
+            if (discNumberIsValid) {
+                snapshotEntry.mDiscNumber = discNumberValue;
+            }
+            snapshotEntry.mTrackUrl = oneEntry.mTrackUrl.toUrl().toString();
+        } else {
+            continue;
+        }
+
+        result.push_back(std::move(snapshotEntry));
+    }
+
+    return result;
+}
+
 void MediaPlayList::tracksListAdded(qulonglong newDatabaseId,
                                     const QString &entryTitle,
                                     ElisaUtils::PlayListEntryType databaseIdType,
@@ -521,8 +807,22 @@ void MediaPlayList::tracksListAdded(qulonglong newDatabaseId,
         return;
     }
 
-    for (int playListIndex = 0; playListIndex < d->mData.size(); ++playListIndex) {
-        auto &oneEntry = d->mData[playListIndex];
+    auto matchingRows = QList<int>{};
+    if (newDatabaseId != 0) {
+        d->buildIndexes();
+        matchingRows = d->mRowsFromId.values(newDatabaseId);
+        std::sort(matchingRows.begin(), matchingRows.end());
+    } else {
+        matchingRows.reserve(d->mData.size());
+        for (int playListIndex = 0; playListIndex < d->mData.size(); ++playListIndex) {
+            matchingRows.push_back(playListIndex);
+        }
+    }
+
+    auto insertedRowsCount = 0;
+    for (const auto oneRow : matchingRows) {
+        const auto playListIndex = oneRow + insertedRowsCount;
+        const auto &oneEntry = d->mData[playListIndex];
         if (oneEntry.mEntryType != databaseIdType) {
             continue;
         }
@@ -535,6 +835,8 @@ void MediaPlayList::tracksListAdded(qulonglong newDatabaseId,
             continue;
         }
 
+        d->invalidateIndexes();
+
         beginRemoveRows(QModelIndex(),playListIndex,playListIndex);
         d->mData.removeAt(playListIndex);
         d->mTrackData.removeAt(playListIndex);
@@ -545,9 +847,11 @@ void MediaPlayList::tracksListAdded(qulonglong newDatabaseId,
             auto newEntry = MediaPlayListEntry{tracks[trackIndex]};
             newEntry.mEntryType = ElisaUtils::Track;
             d->mData.insert(playListIndex + trackIndex, newEntry);
-            d->mTrackData.insert(playListIndex + trackIndex, tracks[trackIndex]);
+            d->mTrackData.insert(playListIndex + trackIndex, DataTypes::TrackRecord{tracks[trackIndex]});
         }
         endInsertRows();
+
+        insertedRowsCount += tracks.size() - 1;
     }
 }
 
@@ -555,105 +859,145 @@ void MediaPlayList::trackChanged(const TrackDataType &track)
 {
     qCDebug(orgKdeElisaPlayList()) << "MediaPlayList::trackChanged" << track[DataTypes::TitleRole];
 
-    for (int i = 0; i < d->mData.size(); ++i) {
-        auto &oneEntry = d->mData[i];
+    const auto candidateRows = d->candidateRows(track);
+    for (const auto oneRow : candidateRows) {
+        if (updateEntryFromTrack(oneRow, track)) {
+            break;
+        }
+    }
+}
 
-        if (oneEntry.mEntryType != ElisaUtils::Artist && oneEntry.mIsValid) {
-            if (oneEntry.mTrackUrl.toUrl().isValid() && track.resourceURI() != oneEntry.mTrackUrl.toUrl()) {
-                continue;
-            }
+void MediaPlayList::tracksChanged(const ListTrackDataType &tracks)
+{
+    qCDebug(orgKdeElisaPlayList()) << "MediaPlayList::tracksChanged" << tracks.size();
 
-            if (!oneEntry.mTrackUrl.toUrl().isValid() && (oneEntry.mId == 0 || track.databaseId() != oneEntry.mId)) {
-                continue;
-            }
+    for (const auto &oneTrack : tracks) {
+        trackChanged(oneTrack);
+    }
+}
 
-            const auto &trackData = d->mTrackData[i];
+bool MediaPlayList::updateEntryFromTrack(int playListIndex, const TrackDataType &track)
+{
+    auto &oneEntry = d->mData[playListIndex];
 
-            if (!trackData.empty()) {
-                bool sameData = true;
-                for (auto oneKeyIterator = track.constKeyValueBegin(); oneKeyIterator != track.constKeyValueEnd(); ++oneKeyIterator) {
-                    if (trackData[(*oneKeyIterator).first] != (*oneKeyIterator).second) {
-                        sameData = false;
-                        break;
-                    }
-                }
-                if (sameData) {
-                    continue;
-                }
-            }
+    if (oneEntry.mEntryType != ElisaUtils::Artist && oneEntry.mIsValid) {
+        if (oneEntry.mTrackUrl.toUrl().isValid() && track.resourceURI() != oneEntry.mTrackUrl.toUrl()) {
+            return false;
+        }
 
-            d->mTrackData[i] = track;
+        if (!oneEntry.mTrackUrl.toUrl().isValid() && (oneEntry.mId == 0 || track.databaseId() != oneEntry.mId)) {
+            return false;
+        }
 
-            Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
-            continue;
-        } else if (oneEntry.mEntryType == ElisaUtils::Radio ) {
-            if (track.databaseId() != oneEntry.mId) {
-                continue;
+        const auto &trackData = d->mTrackData[playListIndex];
+
+        auto newTrackData = DataTypes::TrackRecord{track};
+
+        if (!trackData.isEmpty()) {
+            bool sameData = true;
+            for (auto oneKeyIterator = track.constKeyValueBegin(); oneKeyIterator != track.constKeyValueEnd(); ++oneKeyIterator) {
+                if (trackData[(*oneKeyIterator).first] != newTrackData[(*oneKeyIterator).first]) {
+                    sameData = false;
+                    break;
+                }
+            }
+            if (sameData) {
+                return false;
             }
+        }
 
-            d->mTrackData[i] = track;
-            oneEntry.mId = track.databaseId();
-            oneEntry.mIsValid = true;
+        d->mTrackData[playListIndex] = std::move(newTrackData);
 
-            Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
+        Q_EMIT dataChanged(index(playListIndex, 0), index(playListIndex, 0), {});
+        return false;
+    } else if (oneEntry.mEntryType == ElisaUtils::Radio ) {
+        if (track.databaseId() != oneEntry.mId) {
+            return false;
+        }
 
-            break;
-        } else if (oneEntry.mEntryType != ElisaUtils::Artist && !oneEntry.mIsValid && !oneEntry.mTrackUrl.isValid()) {
-            if (track.find(TrackDataType::key_type::TitleRole) != track.end() &&
-                    track.title() != oneEntry.mTitle) {
-                continue;
-            }
+        d->removeRowFromIndexes(playListIndex);
+        d->mTrackData[playListIndex] = DataTypes::TrackRecord{track};
+        oneEntry.mId = track.databaseId();
+        oneEntry.mIsValid = true;
+        d->addRowToIndexes(playListIndex);
 
-            if (track.find(TrackDataType::key_type::AlbumRole) != track.end() &&
-                    track.album() != oneEntry.mAlbum) {
-                continue;
-            }
+        Q_EMIT dataChanged(index(playListIndex, 0), index(playListIndex, 0), {});
 
-            if (track.find(TrackDataType::key_type::TrackNumberRole) != track.end() &&
-                    track.trackNumber() != oneEntry.mTrackNumber) {
-                continue;
-            }
+        return true;
+    } else if (oneEntry.mEntryType != ElisaUtils::Artist && !oneEntry.mIsValid && !oneEntry.mTrackUrl.isValid()) {
+        if (track.find(TrackDataType::key_type::TitleRole) != track.end() &&
+                track.title() != oneEntry.mTitle) {
+            return false;
+        }
 
-            if (track.find(TrackDataType::key_type::DiscNumberRole) != track.end() &&
-                    track.discNumber() != oneEntry.mDiscNumber) {
-                continue;
-            }
+        if (track.find(TrackDataType::key_type::ArtistRole) != track.end() &&
+                track.artist() != oneEntry.mArtist) {
+            return false;
+        }
+
+        if (track.find(TrackDataType::key_type::AlbumRole) != track.end() &&
+                track.album() != oneEntry.mAlbum) {
+            return false;
+        }
 
-            d->mTrackData[i] = track;
-            oneEntry.mId = track.databaseId();
-            oneEntry.mIsValid = true;
+        if (track.find(TrackDataType::key_type::TrackNumberRole) != track.end() &&
+                track.trackNumber() != oneEntry.mTrackNumber) {
+            return false;
+        }
 
-            Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
+        if (track.find(TrackDataType::key_type::DiscNumberRole) != track.end() &&
+                track.discNumber() != oneEntry.mDiscNumber) {
+            return false;
+        }
 
-            break;
-        } else if (oneEntry.mEntryType != ElisaUtils::Artist && !oneEntry.mIsValid && oneEntry.mTrackUrl.isValid()) {
-            if (track.resourceURI() != oneEntry.mTrackUrl) {
-                continue;
-            }
+        d->removeRowFromIndexes(playListIndex);
+        d->mTrackData[playListIndex] = DataTypes::TrackRecord{track};
+        oneEntry.mId = track.databaseId();
+        oneEntry.mIsValid = true;
+        d->addRowToIndexes(playListIndex);
 
-            d->mTrackData[i] = track;
-            oneEntry.mId = track.databaseId();
-            oneEntry.mIsValid = true;
+        Q_EMIT dataChanged(index(playListIndex, 0), index(playListIndex, 0), {});
 
-            Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
-            break;
+        return true;
+    } else if (oneEntry.mEntryType != ElisaUtils::Artist && !oneEntry.mIsValid && oneEntry.mTrackUrl.isValid()) {
+        if (track.resourceURI() != oneEntry.mTrackUrl) {
+            return false;
         }
+
+        d->removeRowFromIndexes(playListIndex);
+        d->mTrackData[playListIndex] = DataTypes::TrackRecord{track};
+        oneEntry.mId = track.databaseId();
+        oneEntry.mIsValid = true;
+        d->addRowToIndexes(playListIndex);
+
+        Q_EMIT dataChanged(index(playListIndex, 0), index(playListIndex, 0), {});
+
+        return true;
     }
+
+    return false;
 }
 
 void MediaPlayList::trackRemoved(qulonglong trackId)
 {
-    for (int i = 0; i < d->mData.size(); ++i) {
+    d->buildIndexes();
+
+    auto matchingRows = d->mRowsFromId.values(trackId);
+    std::sort(matchingRows.begin(), matchingRows.end());
+
+    for (const auto i : matchingRows) {
         auto &oneEntry = d->mData[i];
 
         if (oneEntry.mIsValid) {
             if (oneEntry.mId == trackId) {
+                d->removeRowFromIndexes(i);
                 oneEntry.mIsValid = false;
                 oneEntry.mTitle = d->mTrackData[i].title();
                 oneEntry.mArtist = d->mTrackData[i].artist();
                 oneEntry.mAlbum = d->mTrackData[i].album();
                 oneEntry.mTrackNumber = d->mTrackData[i].trackNumber();
                 oneEntry.mDiscNumber = d->mTrackData[i].discNumber();
+                d->addRowToIndexes(i);
 
                 Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
 
@@ -672,7 +1016,9 @@ void MediaPlayList::trackInError(const QUrl &sourceInError, QMediaPlayer::Error
             const auto &oneTrackData = d->mTrackData.at(i);
 
             if (oneTrackData.resourceURI() == sourceInError) {
+                d->removeRowFromIndexes(i);
                 oneTrack.mIsValid = false;
+                d->addRowToIndexes(i);
                 Q_EMIT dataChanged(index(i, 0), index(i, 0), {ColumnsRoles::IsValidRole});
             }
         }
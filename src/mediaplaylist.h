@@ -11,6 +11,7 @@
 
 #include "elisautils.h"
 #include "datatypes.h"
+#include "playlistsnapshot.h"
 
 #include <QAbstractListModel>
 #include <QMediaPlayer>
@@ -117,9 +118,26 @@ public:
 
     [[nodiscard]] QVariantList getEntriesForRestore() const;
 
+    void enqueueSnapshotEntries(const QList<PlayListSnapshot::Entry> &newEntries);
+
+    class SnapshotSource;
+
+    /**
+     * Shallow copy of the entries of the play list. It shares its data with the play list until the next
+     * modification, so taking it does not copy the entries, and it can be read from another thread.
+     */
+    [[nodiscard]] SnapshotSource snapshotSource() const;
+
+    /**
+     * Entries to store in a play list snapshot. Restored entries that are not yet confirmed by the database are kept.
+     */
+    [[nodiscard]] QList<PlayListSnapshot::Entry> getEntriesForSnapshot() const;
+
+    [[nodiscard]] static QList<PlayListSnapshot::Entry> getEntriesForSnapshot(const SnapshotSource &source);
+
 Q_SIGNALS:
 
-    void newTrackByNameInList(const QVariant &title, const QVariant &artist, const QVariant &album, const QVariant &trackNumber, const QVariant &discNumber);
+    void newTracksByNameInList(const MediaPlayList::ListTrackDataType &tracks);
 
     void newEntryInList(qulonglong newDatabaseId,
                         const QString &entryTitle,
@@ -137,6 +155,8 @@ public Q_SLOTS:
 
     void trackChanged(const MediaPlayList::TrackDataType &track);
 
+    void tracksChanged(const MediaPlayList::ListTrackDataType &tracks);
+
     void trackRemoved(qulonglong trackId);
 
     void trackInError(const QUrl &sourceInError, QMediaPlayer::Error playerError);
@@ -149,6 +169,15 @@ public Q_SLOTS:
 
 private:
 
+    void restoreEntries(const QList<MediaPlayListEntry> &newEntries);
+
+    /**
+     * Update one entry of the playlist with the data of a track.
+     *
+     * @return true when no other entry should be updated with this track
+     */
+    bool updateEntryFromTrack(int playListIndex, const MediaPlayList::TrackDataType &track);
+
     std::unique_ptr<MediaPlayListPrivate> d;
 };
 
@@ -219,6 +248,16 @@ public:
 
 };
 
+class MediaPlayList::SnapshotSource
+{
+public:
+
+    QList<MediaPlayListEntry> mData;
+
+    DataTypes::ListTrackRecord mTrackData;
+
+};
+
 QDebug operator<<(const QDebug &stream, const MediaPlayListEntry &data);
 
 
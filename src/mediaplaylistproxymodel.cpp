@@ -9,6 +9,7 @@
 #include "mediaplaylistproxymodel.h"
 #include "mediaplaylist.h"
 #include "playListLogging.h"
+#include "playlistsnapshot.h"
 #include <QItemSelection>
 #include <QList>
 #include <QMediaPlaylist>
@@ -17,6 +18,9 @@
 #include <QFileInfo>
 #include <QDir>
 #include <QMimeDatabase>
+#include <QTimer>
+#include <QThreadPool>
+#include <QtConcurrent>
 
 #include <algorithm>
 
@@ -52,6 +56,12 @@ public:
 
     bool mShufflePlayList = false;
 
+    QString mSessionFileName;
+
+    QTimer mSessionSaveTimer;
+
+    QThreadPool mSessionThreadPool;
+
 };
 
 MediaPlayListProxyModel::MediaPlayListProxyModel(QObject *parent) : QAbstractProxyModel (parent),
@@ -60,10 +70,26 @@ MediaPlayListProxyModel::MediaPlayListProxyModel(QObject *parent) : QAbstractPro
     connect(&d->mLoadPlaylist, &QMediaPlaylist::loaded, this, &MediaPlayListProxyModel::loadPlayListLoaded);
     connect(&d->mLoadPlaylist, &QMediaPlaylist::loadFailed, this, &MediaPlayListProxyModel::loadPlayListLoadFailed);
     d->mRandomGenerator.seed(static_cast<unsigned int>(QTime::currentTime().msec()));
+
+    d->mSessionSaveTimer.setSingleShot(true);
+    d->mSessionSaveTimer.setInterval(1000);
+    d->mSessionThreadPool.setMaxThreadCount(1);
+    connect(&d->mSessionSaveTimer, &QTimer::timeout, this, &MediaPlayListProxyModel::writeSessionSnapshot);
+
+    auto scheduleSessionSave = [this]() {
+        if (!d->mSessionFileName.isEmpty()) {
+            d->mSessionSaveTimer.start();
+        }
+    };
+    connect(this, &MediaPlayListProxyModel::persistentStateChanged, this, scheduleSessionSave);
+    connect(this, &MediaPlayListProxyModel::currentTrackChanged, this, scheduleSessionSave);
+    connect(this, &MediaPlayListProxyModel::dataChanged, this, scheduleSessionSave);
 }
 
 MediaPlayListProxyModel::~MediaPlayListProxyModel()
-=default;
+{
+    d->mSessionThreadPool.waitForDone();
+}
 
 QModelIndex MediaPlayListProxyModel::index(int row, int column, const QModelIndex &parent) const
 {
@@ -773,10 +799,106 @@ QVariantMap MediaPlayListProxyModel::persistentState() const
     return currentState;
 }
 
+QString MediaPlayListProxyModel::sessionFileName() const
+{
+    return d->mSessionFileName;
+}
+
+void MediaPlayListProxyModel::setSessionFileName(const QString &fileName)
+{
+    d->mSessionFileName = fileName;
+}
+
+PlayListSnapshot MediaPlayListProxyModel::currentSnapshot() const
+{
+    auto result = PlayListSnapshot{};
+
+    result.mEntries = d->mPlayListModel->getEntriesForSnapshot();
+    result.mCurrentTrack = d->mCurrentPlayListPosition;
+    result.mShufflePlayList = d->mShufflePlayList;
+    result.mRepeatMode = static_cast<int>(d->mRepeatMode);
+
+    return result;
+}
+
+void MediaPlayListProxyModel::writeSessionSnapshot()
+{
+    if (d->mSessionFileName.isEmpty() || !d->mPlayListModel) {
+        return;
+    }
+
+    auto snapshot = PlayListSnapshot{};
+    snapshot.mCurrentTrack = d->mCurrentPlayListPosition;
+    snapshot.mShufflePlayList = d->mShufflePlayList;
+    snapshot.mRepeatMode = static_cast<int>(d->mRepeatMode);
+
+    // only a shallow copy of the play list is taken here, the entries are converted on the session thread
+    QtConcurrent::run(&d->mSessionThreadPool, [snapshot, source = d->mPlayListModel->snapshotSource(), fileName = d->mSessionFileName] () mutable {
+        snapshot.mEntries = MediaPlayList::getEntriesForSnapshot(source);
+        snapshot.save(fileName);
+    });
+}
+
+bool MediaPlayListProxyModel::saveSession()
+{
+    d->mSessionSaveTimer.stop();
+    d->mSessionThreadPool.waitForDone();
+
+    if (d->mSessionFileName.isEmpty() || !d->mPlayListModel) {
+        return false;
+    }
+
+    return currentSnapshot().save(d->mSessionFileName);
+}
+
+QVariantMap MediaPlayListProxyModel::sessionPersistentState() const
+{
+    QVariantMap currentState;
+
+    currentState[QStringLiteral("playListSession")] = true;
+    currentState[QStringLiteral("currentTrack")] = d->mCurrentPlayListPosition;
+    currentState[QStringLiteral("shufflePlayList")] = d->mShufflePlayList;
+    currentState[QStringLiteral("repeatMode")] = d->mRepeatMode;
+
+    return currentState;
+}
+
+bool MediaPlayListProxyModel::restoreSession()
+{
+    if (d->mSessionFileName.isEmpty()) {
+        return false;
+    }
+
+    auto snapshot = PlayListSnapshot{};
+    if (!snapshot.load(d->mSessionFileName)) {
+        qCDebug(orgKdeElisaPlayList()) << "MediaPlayListProxyModel::restoreSession" << "cannot read" << d->mSessionFileName;
+        return false;
+    }
+
+    d->mPlayListModel->enqueueSnapshotEntries(snapshot.mEntries);
+
+    auto newIndex = index(snapshot.mCurrentTrack, 0);
+    if (newIndex.isValid() && (newIndex != d->mCurrentTrack)) {
+        d->mCurrentTrack = newIndex;
+        notifyCurrentTrackChanged();
+    }
+
+    setShufflePlayList(snapshot.mShufflePlayList);
+    setRepeatMode(static_cast<Repeat>(snapshot.mRepeatMode));
+
+    Q_EMIT persistentStateChanged();
+
+    return true;
+}
+
 void MediaPlayListProxyModel::setPersistentState(const QVariantMap &persistentStateValue)
 {
     qCDebug(orgKdeElisaPlayList()) << "MediaPlayListProxyModel::setPersistentState" << persistentStateValue;
 
+    if (persistentStateValue.value(QStringLiteral("playListSession")).toBool() && restoreSession()) {
+        return;
+    }
+
     auto playListIt = persistentStateValue.find(QStringLiteral("playList"));
     if (playListIt != persistentStateValue.end()) {
         d->mPlayListModel->enqueueRestoredEntries(playListIt.value().toList());
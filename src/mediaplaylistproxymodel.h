@@ -20,6 +20,7 @@
 
 class MediaPlayList;
 class MediaPlayListProxyModelPrivate;
+class PlayListSnapshot;
 
 class ELISALIB_EXPORT MediaPlayListProxyModel : public QAbstractProxyModel
 {
@@ -123,6 +124,14 @@ public:
 
     [[nodiscard]] QVariantMap persistentState() const;
 
+    [[nodiscard]] QString sessionFileName() const;
+
+    /**
+     * Set the file used to store a binary snapshot of the play list. The
+     * snapshot is written in the background a short time after each change.
+     */
+    void setSessionFileName(const QString &fileName);
+
     int mSeekToBeginningDelay = 2000;
 
 
@@ -169,6 +178,19 @@ public Q_SLOTS:
 
     void setPersistentState(const QVariantMap &persistentState);
 
+    /**
+     * Write the snapshot of the play list now and wait until it is written.
+     *
+     * @return false if no session file is set or if the file cannot be written
+     */
+    bool saveSession();
+
+    /**
+     * Persistent state to store with a session file: the player state without the entries of the play list.
+     * The play list is restored from the session file and the player state is still restored if it cannot be read.
+     */
+    [[nodiscard]] QVariantMap sessionPersistentState() const;
+
     void enqueueDirectory(const QUrl &fileName,
                           ElisaUtils::PlayListEntryType databaseIdType,
                           ElisaUtils::PlayListEnqueueMode enqueueMode,
@@ -244,6 +266,8 @@ private Q_SLOTS:
 
     void sourceModelReset();
 
+    void writeSessionSnapshot();
+
 private Q_SLOTS:
 
     void loadPlayListLoaded();
@@ -260,6 +284,10 @@ private:
 
     void determineAndNotifyPreviousAndNextTracks();
 
+    [[nodiscard]] PlayListSnapshot currentSnapshot() const;
+
+    bool restoreSession();
+
     std::unique_ptr<MediaPlayListProxyModelPrivate> d;
 };
 
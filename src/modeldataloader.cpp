@@ -17,6 +17,8 @@ public:
 
     DatabaseInterface *mDatabase = nullptr;
 
+    DatabaseInterface *mReadDatabase = nullptr;
+
     ElisaUtils::PlayListEntryType mModelType = ElisaUtils::Unknown;
 
     ModelDataLoader::FilterType mFilterType = ModelDataLoader::FilterType::UnknownFilter;
@@ -45,6 +47,9 @@ ModelDataLoader::~ModelDataLoader() = default;
 void ModelDataLoader::setDatabase(DatabaseInterface *database)
 {
     d->mDatabase = database;
+    if (!d->mReadDatabase) {
+        d->mReadDatabase = database;
+    }
 
     connect(database, &DatabaseInterface::genresAdded,
             this, &ModelDataLoader::genresAdded);
@@ -78,6 +83,13 @@ void ModelDataLoader::setDatabase(DatabaseInterface *database)
             this, &ModelDataLoader::clearedDatabase);
 }
 
+void ModelDataLoader::setReadDatabase(DatabaseInterface *database)
+{
+    d->mReadDatabase = database;
+
+    moveToThread(database->thread());
+}
+
 void ModelDataLoader::loadData(ElisaUtils::PlayListEntryType dataType)
 {
     if (!d->mDatabase) {
@@ -89,27 +101,59 @@ void ModelDataLoader::loadData(ElisaUtils::PlayListEntryType dataType)
     switch (dataType)
     {
     case ElisaUtils::Album:
-        Q_EMIT allAlbumsData(d->mDatabase->allAlbumsData());
+        Q_EMIT allAlbumsData(d->mReadDatabase->allAlbumsData());
         break;
     case ElisaUtils::Artist:
-        Q_EMIT allArtistsData(d->mDatabase->allArtistsData());
+        Q_EMIT allArtistsData(d->mReadDatabase->allArtistsData());
         break;
     case ElisaUtils::Composer:
         break;
     case ElisaUtils::Genre:
-        Q_EMIT allGenresData(d->mDatabase->allGenresData());
+        Q_EMIT allGenresData(d->mReadDatabase->allGenresData());
         break;
     case ElisaUtils::Lyricist:
         break;
     case ElisaUtils::Track:
-        Q_EMIT allTracksData(d->mDatabase->allTracksData());
+        Q_EMIT allTracksData(d->mReadDatabase->allTracksData());
         break;
     case ElisaUtils::FileName:
     case ElisaUtils::Unknown:
     case ElisaUtils::Container:
         break;
     case ElisaUtils::Radio:
-        Q_EMIT allRadiosData(d->mDatabase->allRadiosData());
+        Q_EMIT allRadiosData(d->mReadDatabase->allRadiosData());
+        break;
+    }
+}
+
+void ModelDataLoader::loadDataPage(ElisaUtils::PlayListEntryType dataType, int sortRole, Qt::SortOrder sortOrder, int firstRow,
+                                   const QVariant &afterSortKey, qulonglong afterDatabaseId, int count)
+{
+    if (!d->mDatabase) {
+        return;
+    }
+
+    d->mFilterType = ModelDataLoader::FilterType::NoFilter;
+
+    switch (dataType)
+    {
+    case ElisaUtils::Track:
+    {
+        const auto totalCount = (firstRow == 0 ? d->mReadDatabase->tracksCount() : -1);
+        const auto pageData = d->mReadDatabase->tracksDataPage(sortRole, sortOrder, afterSortKey, afterDatabaseId, firstRow, count);
+        const auto lastSortKey = (pageData.isEmpty() ? QVariant{} : DatabaseInterface::trackSortKey(pageData.last(), sortRole));
+        Q_EMIT tracksDataPage(pageData, sortRole, sortOrder, firstRow, lastSortKey, totalCount);
+        break;
+    }
+    case ElisaUtils::Album:
+    case ElisaUtils::Artist:
+    case ElisaUtils::Composer:
+    case ElisaUtils::Genre:
+    case ElisaUtils::Lyricist:
+    case ElisaUtils::Radio:
+    case ElisaUtils::FileName:
+    case ElisaUtils::Unknown:
+    case ElisaUtils::Container:
         break;
     }
 }
@@ -136,7 +180,7 @@ void ModelDataLoader::loadDataByAlbumId(ElisaUtils::PlayListEntryType dataType,
     case ElisaUtils::Lyricist:
         break;
     case ElisaUtils::Track:
-        Q_EMIT allTracksData(d->mDatabase->albumData(databaseId));
+        Q_EMIT allTracksData(DataTypes::toListTrackRecord(d->mReadDatabase->albumData(databaseId)));
         break;
     case ElisaUtils::FileName:
     case ElisaUtils::Unknown:
@@ -158,7 +202,7 @@ void ModelDataLoader::loadDataByGenre(ElisaUtils::PlayListEntryType dataType, co
     switch (dataType)
     {
     case ElisaUtils::Artist:
-        Q_EMIT allArtistsData(d->mDatabase->allArtistsDataByGenre(genre));
+        Q_EMIT allArtistsData(d->mReadDatabase->allArtistsDataByGenre(genre));
         break;
     case ElisaUtils::Album:
     case ElisaUtils::Composer:
@@ -185,7 +229,7 @@ void ModelDataLoader::loadDataByArtist(ElisaUtils::PlayListEntryType dataType, c
     switch (dataType)
     {
     case ElisaUtils::Album:
-        Q_EMIT allAlbumsData(d->mDatabase->allAlbumsDataByArtist(artist));
+        Q_EMIT allAlbumsData(d->mReadDatabase->allAlbumsDataByArtist(artist));
         break;
     case ElisaUtils::Artist:
     case ElisaUtils::Composer:
@@ -213,7 +257,7 @@ void ModelDataLoader::loadDataByGenreAndArtist(ElisaUtils::PlayListEntryType dat
     switch (dataType)
     {
     case ElisaUtils::Album:
-        Q_EMIT allAlbumsData(d->mDatabase->allAlbumsDataByGenreAndArtist(genre, artist));
+        Q_EMIT allAlbumsData(d->mReadDatabase->allAlbumsDataByGenreAndArtist(genre, artist));
         break;
     case ElisaUtils::Artist:
     case ElisaUtils::Composer:
@@ -241,10 +285,10 @@ void ModelDataLoader::loadDataByDatabaseIdAndUrl(ElisaUtils::PlayListEntryType d
     switch (dataType)
     {
     case ElisaUtils::Track:
-        Q_EMIT allTrackData(d->mDatabase->trackDataFromDatabaseIdAndUrl(databaseId, url));
+        Q_EMIT allTrackData(d->mReadDatabase->trackDataFromDatabaseIdAndUrl(databaseId, url));
         break;
     case ElisaUtils::Radio:
-        Q_EMIT allRadioData(d->mDatabase->radioDataFromDatabaseId(databaseId));
+        Q_EMIT allRadioData(d->mReadDatabase->radioDataFromDatabaseId(databaseId));
         break;
     case ElisaUtils::Album:
     case ElisaUtils::Artist:
@@ -271,9 +315,9 @@ void ModelDataLoader::loadDataByUrl(ElisaUtils::PlayListEntryType dataType, cons
     case ElisaUtils::FileName:
     case ElisaUtils::Track:
     {
-        auto databaseId = d->mDatabase->trackIdFromFileName(url);
+        auto databaseId = d->mReadDatabase->trackIdFromFileName(url);
         if (databaseId != 0) {
-            Q_EMIT allTrackData(d->mDatabase->trackDataFromDatabaseIdAndUrl(databaseId, url));
+            Q_EMIT allTrackData(d->mReadDatabase->trackDataFromDatabaseIdAndUrl(databaseId, url));
         } else {
             auto result = d->mFileScanner.scanOneFile(url);
             Q_EMIT allTrackData(result);
@@ -282,9 +326,9 @@ void ModelDataLoader::loadDataByUrl(ElisaUtils::PlayListEntryType dataType, cons
     }
     case ElisaUtils::Radio:
     {
-        auto databaseId = d->mDatabase->radioIdFromFileName(url);
+        auto databaseId = d->mReadDatabase->radioIdFromFileName(url);
         if (databaseId != 0) {
-            Q_EMIT allRadioData(d->mDatabase->radioDataFromDatabaseId(databaseId));
+            Q_EMIT allRadioData(d->mReadDatabase->radioDataFromDatabaseId(databaseId));
         } else {
             auto result = d->mFileScanner.scanOneFile(url);
             Q_EMIT allRadioData(result);
@@ -313,7 +357,7 @@ void ModelDataLoader::loadRecentlyPlayedData(ElisaUtils::PlayListEntryType dataT
     switch (dataType)
     {
     case ElisaUtils::Track:
-        Q_EMIT allTracksData(d->mDatabase->recentlyPlayedTracksData(50));
+        Q_EMIT allTracksData(d->mReadDatabase->recentlyPlayedTracksData(50));
         break;
     case ElisaUtils::Album:
     case ElisaUtils::Artist:
@@ -339,7 +383,7 @@ void ModelDataLoader::loadFrequentlyPlayedData(ElisaUtils::PlayListEntryType dat
     switch (dataType)
     {
     case ElisaUtils::Track:
-        Q_EMIT allTracksData(d->mDatabase->frequentlyPlayedTracksData(50));
+        Q_EMIT allTracksData(d->mReadDatabase->frequentlyPlayedTracksData(50));
         break;
     case ElisaUtils::Album:
     case ElisaUtils::Artist:
@@ -354,7 +398,45 @@ void ModelDataLoader::loadFrequentlyPlayedData(ElisaUtils::PlayListEntryType dat
     }
 }
 
-void ModelDataLoader::databaseTracksAdded(const ListTrackDataType &newData)
+void ModelDataLoader::loadFrequentlyPlayedDataWithFilter(ElisaUtils::PlayListEntryType dataType,
+                                                         ElisaUtils::PlayListEntryType filterType, const QVariant &filter)
+{
+    if (!d->mDatabase) {
+        return;
+    }
+
+    d->mFilterType = ModelDataLoader::FilterType::FilterByFrequentlyPlayed;
+
+    switch (dataType)
+    {
+    case ElisaUtils::Track:
+        Q_EMIT allTracksData(d->mReadDatabase->frequentlyPlayedTracksData(filterType, filter, 50));
+        break;
+    case ElisaUtils::Album:
+    case ElisaUtils::Artist:
+    case ElisaUtils::Composer:
+    case ElisaUtils::Genre:
+    case ElisaUtils::Lyricist:
+    case ElisaUtils::FileName:
+    case ElisaUtils::Unknown:
+    case ElisaUtils::Radio:
+    case ElisaUtils::Container:
+        break;
+    }
+}
+
+void ModelDataLoader::searchData(ElisaUtils::PlayListEntryType dataType, const QString &searchText)
+{
+    if (!d->mDatabase) {
+        return;
+    }
+
+    const auto matchingIds = d->mReadDatabase->searchData(dataType, searchText);
+
+    Q_EMIT searchResult(dataType, searchText, matchingIds.value_or(QVector<qulonglong>{}), matchingIds.has_value());
+}
+
+void ModelDataLoader::databaseTracksAdded(const ListTrackRecord &newData)
 {
     switch(d->mFilterType) {
     case ModelDataLoader::FilterType::NoFilter:
@@ -389,7 +471,7 @@ void ModelDataLoader::databaseArtistsAdded(const ListArtistDataType &newData)
     {
         auto filteredData = newData;
         auto new_end = std::remove_if(filteredData.begin(), filteredData.end(),
-                                      [&](const auto &oneArtist){return !d->mDatabase->internalArtistMatchGenre(oneArtist.databaseId(), d->mGenre);});
+                                      [&](const auto &oneArtist){return !d->mReadDatabase->internalArtistMatchGenre(oneArtist.databaseId(), d->mGenre);});
         filteredData.erase(new_end, filteredData.end());
 
         Q_EMIT artistsAdded(filteredData);
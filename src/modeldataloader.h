@@ -31,6 +31,7 @@ public:
     using ListArtistDataType = DataTypes::ListArtistDataType;
     using ListGenreDataType = DataTypes::ListGenreDataType;
     using ListTrackDataType = DataTypes::ListTrackDataType;
+    using ListTrackRecord = DataTypes::ListTrackRecord;
     using ListRadioDataType = DataTypes::ListRadioDataType;
     using TrackDataType = DataTypes::TrackDataType;
     using AlbumDataType = DataTypes::AlbumDataType;
@@ -43,6 +44,12 @@ public:
 
     void setDatabase(DatabaseInterface *database);
 
+    /**
+     * Use a read only connection for the queries and move to its thread.
+     * Must be called from the thread of this object.
+     */
+    void setReadDatabase(DatabaseInterface *database);
+
 Q_SIGNALS:
 
     void allAlbumsData(const ModelDataLoader::ListAlbumDataType &allData);
@@ -51,7 +58,14 @@ Q_SIGNALS:
 
     void allGenresData(const ModelDataLoader::ListGenreDataType &allData);
 
-    void allTracksData(const ModelDataLoader::ListTrackDataType &allData);
+    void allTracksData(const ModelDataLoader::ListTrackRecord &allData);
+
+    /**
+     * One page of tracks sorted by sortRole and starting at firstRow. lastSortKey is the sort key of its last
+     * track. totalCount is only known for the page of the first row and is -1 otherwise.
+     */
+    void tracksDataPage(const ModelDataLoader::ListTrackRecord &pageData, int sortRole, Qt::SortOrder sortOrder,
+                        int firstRow, const QVariant &lastSortKey, int totalCount);
 
     void allRadiosData(const ModelDataLoader::ListRadioDataType &radiosData);
 
@@ -63,7 +77,7 @@ Q_SIGNALS:
 
     void allRadioData(const ModelDataLoader::TrackDataType &allData);
 
-    void tracksAdded(const ModelDataLoader::ListTrackDataType &newData);
+    void tracksAdded(const ModelDataLoader::ListTrackRecord &newData);
 
     void trackModified(const ModelDataLoader::TrackDataType &modifiedTrack);
 
@@ -89,10 +103,25 @@ Q_SIGNALS:
 
     void clearedDatabase();
 
+    /**
+     * Database ids of the entries of dataType matching searchText, most
+     * relevant first. isIndexed is false when the search index cannot answer
+     * and the caller has to filter the data itself.
+     */
+    void searchResult(ElisaUtils::PlayListEntryType dataType, const QString &searchText,
+                      const QVector<qulonglong> &matchingIds, bool isIndexed);
+
 public Q_SLOTS:
 
     void loadData(ElisaUtils::PlayListEntryType dataType);
 
+    /**
+     * Read count entries from firstRow, after the entry afterDatabaseId of sort key afterSortKey when it is
+     * not 0. A negative count reads all the entries from firstRow.
+     */
+    void loadDataPage(ElisaUtils::PlayListEntryType dataType, int sortRole, Qt::SortOrder sortOrder, int firstRow,
+                      const QVariant &afterSortKey, qulonglong afterDatabaseId, int count);
+
     void loadDataByAlbumId(ElisaUtils::PlayListEntryType dataType, qulonglong databaseId);
 
     void loadDataByGenre(ElisaUtils::PlayListEntryType dataType,
@@ -114,6 +143,15 @@ public Q_SLOTS:
 
     void loadFrequentlyPlayedData(ElisaUtils::PlayListEntryType dataType);
 
+    /**
+     * Load the most frequently played tracks of the artist, album or genre
+     * identified by filter: an artist name, an album database id or a genre name.
+     */
+    void loadFrequentlyPlayedDataWithFilter(ElisaUtils::PlayListEntryType dataType,
+                                            ElisaUtils::PlayListEntryType filterType, const QVariant &filter);
+
+    void searchData(ElisaUtils::PlayListEntryType dataType, const QString &searchText);
+
     void updateFileMetaData(const DataTypes::TrackDataType &trackDataType, const QUrl &url);
 
     void updateSingleFileMetaData(const QUrl &url, DataTypes::ColumnsRoles role, const QVariant &data);
@@ -122,7 +160,7 @@ public Q_SLOTS:
 
 private Q_SLOTS:
 
-    void databaseTracksAdded(const ModelDataLoader::ListTrackDataType &newData);
+    void databaseTracksAdded(const ModelDataLoader::ListTrackRecord &newData);
 
     void databaseArtistsAdded(const ModelDataLoader::ListArtistDataType &newData);
 
@@ -8,19 +8,51 @@
 #include "abstractmediaproxymodel.h"
 
 #include "mediaplaylistproxymodel.h"
+#include "datamodel.h"
 
 #include <QWriteLocker>
 #include <QReadLocker>
 #include <QtConcurrent>
 
+#include <QTime>
+
+#include <algorithm>
+#include <utility>
+
+/**
+ * Minimum number of source rows handled by one task when computing sort keys.
+ */
+static const int SortKeysChunkSize = 4096;
+
+/**
+ * Delay in milliseconds after the last inserted rows before searching the index again.
+ */
+static const int SearchAgainDelay = 300;
+
 AbstractMediaProxyModel::AbstractMediaProxyModel(QObject *parent) : QSortFilterProxyModel(parent)
 {
     setFilterCaseSensitivity(Qt::CaseInsensitive);
     mThreadPool.setMaxThreadCount(1);
+
+    mSearchAgainTimer.setSingleShot(true);
+    mSearchAgainTimer.setInterval(SearchAgainDelay);
+    connect(&mSearchAgainTimer, &QTimer::timeout, this, [this]() {
+        if (mDataModel && mFilterByMatchingIds) {
+            mDataModel->search(mFilterText);
+        }
+    });
+
+    connect(this, &QSortFilterProxyModel::sortRoleChanged, this, [this](int newSortRole) {
+        if (sourceLoadsPages()) {
+            mDataModel->setPagesSort(newSortRole, sortOrder());
+        }
+    });
 }
 
 AbstractMediaProxyModel::~AbstractMediaProxyModel()
-= default;
+{
+    stopFilterUpdate();
+}
 
 QString AbstractMediaProxyModel::filterText() const
 {
@@ -34,37 +66,455 @@ int AbstractMediaProxyModel::filterRating() const
 
 void AbstractMediaProxyModel::setFilterText(const QString &filterText)
 {
-    QWriteLocker writeLocker(&mDataLock);
-
     if (mFilterText == filterText)
         return;
 
-    mFilterText = filterText;
+    // stop the filter update in progress before changing the filter it reads
+    ++mFilterGeneration;
+
+    const auto useSearchIndex = mDataModel && !filterText.isEmpty();
+
+    {
+        QWriteLocker writeLocker(&mDataLock);
 
-    mFilterExpression.setPattern(mFilterText);
-    mFilterExpression.setPatternOptions(QRegularExpression::CaseInsensitiveOption);
-    mFilterExpression.optimize();
+        mFilterText = filterText;
 
-    invalidate();
+        mFilterExpression.setPattern(mFilterText);
+        mFilterExpression.setPatternOptions(QRegularExpression::CaseInsensitiveOption);
+        mFilterExpression.optimize();
+
+        if (!useSearchIndex) {
+            mMatchingIds.clear();
+            mFilterByMatchingIds = false;
+        }
+    }
+
+    updatePagedLoading();
+
+    // the rows are filtered again once the search index has answered
+    if (useSearchIndex) {
+        mDataModel->search(mFilterText);
+    } else {
+        updateFilter();
+    }
 
     Q_EMIT filterTextChanged(mFilterText);
 }
 
-void AbstractMediaProxyModel::setFilterRating(int filterRating)
+void AbstractMediaProxyModel::searchResultReady(const QString &searchText, const QVector<qulonglong> &matchingIds, bool isIndexed)
 {
-    QWriteLocker writeLocker(&mDataLock);
+    // answer to a previous filter text
+    if (searchText != mFilterText) {
+        return;
+    }
+
+    ++mFilterGeneration;
+
+    {
+        QWriteLocker writeLocker(&mDataLock);
+
+        mMatchingIds = QSet<qulonglong>{matchingIds.begin(), matchingIds.end()};
+        mFilterByMatchingIds = isIndexed;
+    }
+
+    updateFilter();
+}
+
+void AbstractMediaProxyModel::dataModelRowsInserted()
+{
+    // new entries of the collection are not yet part of the matching ids, a scan inserts rows many times in a row
+    if (mFilterByMatchingIds) {
+        mSearchAgainTimer.start();
+    }
+}
+
+void AbstractMediaProxyModel::sourceModelModified()
+{
+    // the accepted rows may have moved or changed, they are all tested again by the next update
+    // and the result of an update started before this change is dropped
+    ++mFilterGeneration;
+    mAcceptedRows.clear();
+
+    if (mFilterUpdatePending) {
+        updateFilter();
+    }
+}
+
+void AbstractMediaProxyModel::sourceRowsInserted(const QModelIndex &parent, int first, int last)
+{
+    if (parent.isValid() || !hasSortKeys(last - first + 1)) {
+        mSortKeysRole = -1;
+        return;
+    }
+
+    auto newKeys = computeSortKeys(first, last);
+    mSortKeys.insert(mSortKeys.begin() + first, std::make_move_iterator(newKeys.begin()), std::make_move_iterator(newKeys.end()));
+}
+
+void AbstractMediaProxyModel::sourceRowsRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (parent.isValid() || !hasSortKeys(-(last - first + 1))) {
+        mSortKeysRole = -1;
+        return;
+    }
 
+    mSortKeys.erase(mSortKeys.begin() + first, mSortKeys.begin() + last + 1);
+}
+
+void AbstractMediaProxyModel::sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles)
+{
+    if (!roles.isEmpty() && !roles.contains(mSortKeysRole)) {
+        return;
+    }
+
+    if (topLeft.parent().isValid() || !hasSortKeys(0)) {
+        mSortKeysRole = -1;
+        return;
+    }
+
+    auto newKeys = computeSortKeys(topLeft.row(), bottomRight.row());
+    std::move(newKeys.begin(), newKeys.end(), mSortKeys.begin() + topLeft.row());
+}
+
+void AbstractMediaProxyModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    if (this->sourceModel() == sourceModel) {
+        return;
+    }
+
+    stopFilterUpdate();
+    mAcceptedRows.clear();
+    mSortKeys.clear();
+    mSortKeysRole = -1;
+
+    if (this->sourceModel()) {
+        disconnect(this->sourceModel(), nullptr, this, nullptr);
+    }
+
+    // connected before QSortFilterProxyModel to update the accepted rows and the sort keys before it uses them
+    if (sourceModel) {
+        connect(sourceModel, &QAbstractItemModel::rowsInserted,
+                this, &AbstractMediaProxyModel::sourceRowsInserted);
+        connect(sourceModel, &QAbstractItemModel::rowsRemoved,
+                this, &AbstractMediaProxyModel::sourceRowsRemoved);
+        connect(sourceModel, &QAbstractItemModel::dataChanged,
+                this, &AbstractMediaProxyModel::sourceDataChanged);
+        connect(sourceModel, &QAbstractItemModel::dataChanged,
+                this, &AbstractMediaProxyModel::sourceModelModified);
+        connect(sourceModel, &QAbstractItemModel::rowsInserted,
+                this, &AbstractMediaProxyModel::sourceModelModified);
+        connect(sourceModel, &QAbstractItemModel::rowsRemoved,
+                this, &AbstractMediaProxyModel::sourceModelModified);
+        connect(sourceModel, &QAbstractItemModel::rowsMoved,
+                this, &AbstractMediaProxyModel::sourceModelModified);
+        connect(sourceModel, &QAbstractItemModel::layoutChanged,
+                this, &AbstractMediaProxyModel::sourceModelModified);
+        connect(sourceModel, &QAbstractItemModel::modelReset,
+                this, &AbstractMediaProxyModel::sourceModelModified);
+    }
+
+    QSortFilterProxyModel::setSourceModel(sourceModel);
+
+    mDataModel = qobject_cast<DataModel*>(sourceModel);
+
+    if (mDataModel) {
+        connect(mDataModel, &DataModel::searchResultReady,
+                this, &AbstractMediaProxyModel::searchResultReady);
+        connect(mDataModel, &DataModel::rowsInserted,
+                this, &AbstractMediaProxyModel::dataModelRowsInserted);
+        connect(mDataModel, &DataModel::allPagesLoaded,
+                this, &AbstractMediaProxyModel::allPagesLoaded);
+
+        mDataModel->setPagesSort(sortRole(), sortOrder());
+        updatePagedLoading();
+
+        if (!mFilterText.isEmpty()) {
+            mDataModel->search(mFilterText);
+        }
+    }
+}
+
+void AbstractMediaProxyModel::setFilterRating(int filterRating)
+{
     if (mFilterRating == filterRating) {
         return;
     }
 
-    mFilterRating = filterRating;
+    ++mFilterGeneration;
+
+    {
+        QWriteLocker writeLocker(&mDataLock);
 
-    invalidate();
+        mFilterRating = filterRating;
+    }
+
+    updatePagedLoading();
+
+    updateFilter();
 
     Q_EMIT filterRatingChanged(filterRating);
 }
 
+bool AbstractMediaProxyModel::filterAcceptsRow(int source_row, const QModelIndex &source_parent) const
+{
+    // reading the row would load its page
+    if (sourceLoadsPages()) {
+        return true;
+    }
+
+    if (!source_parent.isValid() && source_row < mAcceptedRows.size()) {
+        return mAcceptedRows.at(source_row);
+    }
+
+    return rowMatchesFilter(filterData(source_row, source_parent));
+}
+
+AbstractMediaProxyModel::FilterData AbstractMediaProxyModel::filterData(int source_row, const QModelIndex &source_parent) const
+{
+    auto result = FilterData{};
+
+    const auto currentIndex = sourceModel()->index(source_row, 0, source_parent);
+
+    result.mDisplay = sourceModel()->data(currentIndex, Qt::DisplayRole).toString();
+    result.mArtist = sourceModel()->data(currentIndex, DataTypes::ArtistRole).toString();
+    result.mAllArtists = sourceModel()->data(currentIndex, DataTypes::AllArtistsRole).toStringList();
+    result.mDatabaseId = sourceModel()->data(currentIndex, DataTypes::DatabaseIdRole).toULongLong();
+    result.mRating = sourceModel()->data(currentIndex, DataTypes::RatingRole).toInt(&result.mHasRating);
+    result.mHighestTrackRating = sourceModel()->data(currentIndex, DataTypes::HighestTrackRating).toInt(&result.mHasHighestTrackRating);
+
+    return result;
+}
+
+bool AbstractMediaProxyModel::lessThan(const QModelIndex &source_left, const QModelIndex &source_right) const
+{
+    if (source_left.parent().isValid()) {
+        return QSortFilterProxyModel::lessThan(source_left, source_right);
+    }
+
+    if (mSortKeysRole != sortRole() || mSortCollator.caseSensitivity() != sortCaseSensitivity() || !hasSortKeys(0)) {
+        mSortKeysRole = sortRole();
+        mSortCollator.setCaseSensitivity(sortCaseSensitivity());
+        mSortKeys = computeSortKeys(0, sourceModel()->rowCount() - 1);
+    }
+
+    const auto &leftKey = mSortKeys[source_left.row()];
+    const auto &rightKey = mSortKeys[source_right.row()];
+
+    if (leftKey.mText && rightKey.mText) {
+        return leftKey.mText->compare(*rightKey.mText) < 0;
+    }
+
+    return leftKey.mNumber < rightKey.mNumber;
+}
+
+bool AbstractMediaProxyModel::hasSortKeys(int addedRowsCount) const
+{
+    return mSortKeysRole != -1 && sourceModel() &&
+            static_cast<int>(mSortKeys.size()) + addedRowsCount == sourceModel()->rowCount();
+}
+
+std::vector<AbstractMediaProxyModel::SortKey> AbstractMediaProxyModel::computeSortKeys(int firstRow, int lastRow) const
+{
+    // the source model is only read from this thread, the keys are computed in parallel
+    auto values = QVector<QVariant>{};
+    values.reserve(lastRow - firstRow + 1);
+    for (int row = firstRow; row <= lastRow; ++row) {
+        values.push_back(sourceModel()->data(sourceModel()->index(row, 0), mSortKeysRole));
+    }
+
+    // a collator is not thread safe, each task uses its own one with the settings of mSortCollator
+    const auto collatorLocale = mSortCollator.locale();
+    const auto collatorCaseSensitivity = mSortCollator.caseSensitivity();
+    const auto collatorNumericMode = mSortCollator.numericMode();
+    const auto collatorIgnorePunctuation = mSortCollator.ignorePunctuation();
+
+    auto computeKeys = [&](int firstValue, int lastValue) {
+        auto collator = QCollator{collatorLocale};
+        collator.setCaseSensitivity(collatorCaseSensitivity);
+        collator.setNumericMode(collatorNumericMode);
+        collator.setIgnorePunctuation(collatorIgnorePunctuation);
+
+        auto result = std::vector<SortKey>{};
+        result.reserve(lastValue - firstValue + 1);
+
+        for (int valueIndex = firstValue; valueIndex <= lastValue; ++valueIndex) {
+            const auto &value = values.at(valueIndex);
+
+            switch (value.type())
+            {
+            case QVariant::String:
+                result.push_back({collator.sortKey(value.toString()), 0});
+                break;
+            case QVariant::Time:
+                result.push_back({std::nullopt, value.toTime().msecsSinceStartOfDay()});
+                break;
+            default:
+                result.push_back({std::nullopt, value.toLongLong()});
+                break;
+            }
+        }
+
+        return result;
+    };
+
+    if (values.size() <= SortKeysChunkSize) {
+        return computeKeys(0, values.size() - 1);
+    }
+
+    auto chunks = QVector<QFuture<std::vector<SortKey>>>{};
+    for (int firstValue = 0; firstValue < values.size(); firstValue += SortKeysChunkSize) {
+        chunks.push_back(QtConcurrent::run(computeKeys, firstValue, std::min(firstValue + SortKeysChunkSize, values.size()) - 1));
+    }
+
+    auto result = std::vector<SortKey>{};
+    result.reserve(values.size());
+
+    for (auto &oneChunk : chunks) {
+        auto chunkKeys = oneChunk.result();
+        std::move(chunkKeys.begin(), chunkKeys.end(), std::back_inserter(result));
+    }
+
+    return result;
+}
+
+void AbstractMediaProxyModel::stopFilterUpdate()
+{
+    ++mFilterGeneration;
+    mFilterUpdatePending = false;
+
+    mThreadPool.waitForDone();
+}
+
+static bool isLiteralFilter(const QString &filterText)
+{
+    const auto specialCharacters = QStringLiteral("\\^$.|?*+()[]{}");
+
+    return std::none_of(filterText.cbegin(), filterText.cend(), [&specialCharacters](QChar oneCharacter) {
+        return specialCharacters.contains(oneCharacter);
+    });
+}
+
+AbstractMediaProxyModel::FilterChange AbstractMediaProxyModel::filterChange() const
+{
+    auto textIsNarrower = false;
+    auto textIsWider = false;
+
+    if (mAppliedFilterText.isEmpty() || mFilterText.isEmpty()) {
+        textIsNarrower = mAppliedFilterText.isEmpty();
+        textIsWider = mFilterText.isEmpty();
+    } else if (mAppliedFilterByMatchingIds == mFilterByMatchingIds &&
+               (mFilterByMatchingIds || (isLiteralFilter(mAppliedFilterText) && isLiteralFilter(mFilterText)))) {
+        // a longer text matches a subset of the entries of its prefix
+        textIsNarrower = mFilterText.startsWith(mAppliedFilterText, Qt::CaseInsensitive);
+        textIsWider = mAppliedFilterText.startsWith(mFilterText, Qt::CaseInsensitive);
+    }
+
+    if (textIsNarrower && mFilterRating >= mAppliedFilterRating) {
+        return FilterChange::Narrower;
+    }
+
+    if (textIsWider && mFilterRating <= mAppliedFilterRating) {
+        return FilterChange::Wider;
+    }
+
+    return FilterChange::Unrelated;
+}
+
+bool AbstractMediaProxyModel::sourceLoadsPages() const
+{
+    return mDataModel && mDataModel->isLoadingPages();
+}
+
+void AbstractMediaProxyModel::updatePagedLoading()
+{
+    if (!mDataModel || !mDataModel->pagedLoading()) {
+        return;
+    }
+
+    const auto isFiltered = !mFilterText.isEmpty() || mFilterRating != 0;
+
+    if (isFiltered) {
+        mDataModel->setPagedLoadingSuspended(true);
+
+        if (sortColumn() != 0) {
+            mSortKeys.clear();
+            mSortKeysRole = -1;
+            sort(0, sortOrder());
+        }
+    } else {
+        if (sortColumn() != -1) {
+            sort(-1, sortOrder());
+        }
+
+        mDataModel->setPagedLoadingSuspended(false);
+    }
+}
+
+void AbstractMediaProxyModel::updateFilter()
+{
+    if (!sourceModel() || sourceLoadsPages()) {
+        return;
+    }
+
+    const auto generation = ++mFilterGeneration;
+    const auto rowsCount = sourceModel()->rowCount();
+    const auto change = (mAcceptedRows.size() == rowsCount ? filterChange() : FilterChange::Unrelated);
+
+    mFilterUpdatePending = true;
+
+    // the source model is only read here, the pool thread tests a copy of the values of the rows
+    // and only the rows that could change state are copied
+    auto rowsData = QVector<FilterData>(rowsCount);
+    for (int row = 0; row < rowsCount; ++row) {
+        if ((change == FilterChange::Narrower && !mAcceptedRows.at(row)) ||
+            (change == FilterChange::Wider && mAcceptedRows.at(row))) {
+            continue;
+        }
+
+        rowsData[row] = filterData(row, {});
+    }
+
+    QtConcurrent::run(&mThreadPool, [this, generation, rowsCount, change, acceptedRows = mAcceptedRows, rowsData = std::move(rowsData)] () mutable {
+        QReadLocker locker(&mDataLock);
+
+        acceptedRows.resize(rowsCount);
+
+        for (int row = 0; row < rowsCount; ++row) {
+            if (mFilterGeneration.load() != generation) {
+                return;
+            }
+
+            if ((change == FilterChange::Narrower && !acceptedRows.at(row)) ||
+                (change == FilterChange::Wider && acceptedRows.at(row))) {
+                continue;
+            }
+
+            acceptedRows[row] = rowMatchesFilter(rowsData.at(row));
+        }
+
+        QMetaObject::invokeMethod(this, [this, generation, acceptedRows = std::move(acceptedRows)] () {
+            applyFilter(generation, acceptedRows);
+        }, Qt::QueuedConnection);
+    });
+}
+
+void AbstractMediaProxyModel::applyFilter(int generation, const QVector<bool> &acceptedRows)
+{
+    // the filter or the source rows have changed since this update started
+    if (generation != mFilterGeneration.load()) {
+        return;
+    }
+
+    mFilterUpdatePending = false;
+
+    mAcceptedRows = acceptedRows;
+    mAppliedFilterText = mFilterText;
+    mAppliedFilterRating = mFilterRating;
+    mAppliedFilterByMatchingIds = mFilterByMatchingIds;
+
+    invalidateFilter();
+}
+
 bool AbstractMediaProxyModel::sortedAscending() const
 {
     return sortOrder() ? false : true;
@@ -77,7 +527,14 @@ MediaPlayListProxyModel *AbstractMediaProxyModel::playList() const
 
 void AbstractMediaProxyModel::sortModel(Qt::SortOrder order)
 {
-    sort(0, order);
+    // the pages are read already sorted from the database
+    if (sourceLoadsPages()) {
+        sort(-1, order);
+        mDataModel->setPagesSort(sortRole(), order);
+    } else {
+        sort(0, order);
+    }
+
     Q_EMIT sortedAscendingChanged();
 }
 
@@ -114,6 +571,13 @@ void AbstractMediaProxyModel::genericEnqueueToPlayList(const QModelIndex &rootIn
                                                        ElisaUtils::PlayListEnqueueMode enqueueMode,
                                                        ElisaUtils::PlayListEnqueueTriggerPlay triggerPlay)
 {
+    // only the pages around the visible rows are loaded, all the tracks are read again
+    if (!rootIndex.isValid() && sourceLoadsPages()) {
+        mPendingEnqueues.push_back({enqueueMode, triggerPlay});
+        mDataModel->loadAllPages();
+        return;
+    }
+
     QtConcurrent::run(&mThreadPool, [=] () {
         QReadLocker locker(&mDataLock);
         auto allData = DataTypes::EntryDataList{};
@@ -128,6 +592,24 @@ void AbstractMediaProxyModel::genericEnqueueToPlayList(const QModelIndex &rootIn
     });
 }
 
+void AbstractMediaProxyModel::allPagesLoaded(const DataTypes::ListTrackRecord &allTracks)
+{
+    if (mPendingEnqueues.isEmpty()) {
+        return;
+    }
+
+    auto allData = DataTypes::EntryDataList{};
+    allData.reserve(allTracks.size());
+    for (const auto &oneTrack : allTracks) {
+        allData.push_back(DataTypes::EntryData{oneTrack.toTrackDataType(),
+                                               oneTrack.title().isEmpty() ? oneTrack.resourceURI().fileName() : oneTrack.title(), {}});
+    }
+
+    for (const auto &oneEnqueue : std::exchange(mPendingEnqueues, {})) {
+        Q_EMIT entriesToEnqueue(allData, oneEnqueue.first, oneEnqueue.second);
+    }
+}
+
 void AbstractMediaProxyModel::enqueueToPlayList(const QModelIndex &rootIndex)
 {
     genericEnqueueToPlayList(rootIndex, ElisaUtils::AppendPlayList, ElisaUtils::DoNotTriggerPlay);
@@ -14,11 +14,22 @@
 #include "datatypes.h"
 
 #include <QSortFilterProxyModel>
+#include <QCollator>
 #include <QRegularExpression>
 #include <QReadWriteLock>
+#include <QSet>
+#include <QStringList>
+#include <QPointer>
 #include <QThreadPool>
+#include <QTimer>
+#include <QVector>
+
+#include <atomic>
+#include <optional>
+#include <vector>
 
 class MediaPlayListProxyModel;
+class DataModel;
 
 class ELISALIB_EXPORT AbstractMediaProxyModel : public QSortFilterProxyModel
 {
@@ -55,6 +66,8 @@ public:
 
     [[nodiscard]] MediaPlayListProxyModel* playList() const;
 
+    void setSourceModel(QAbstractItemModel *sourceModel) override;
+
 public Q_SLOTS:
 
     void setFilterText(const QString &filterText);
@@ -90,7 +103,58 @@ Q_SIGNALS:
 
 protected:
 
-    [[nodiscard]] bool filterAcceptsRow(int source_row, const QModelIndex &source_parent) const override = 0;
+    /**
+     * Values of one source row read by the filter.
+     */
+    struct FilterData
+    {
+        QString mDisplay;
+
+        QString mArtist;
+
+        QStringList mAllArtists;
+
+        qulonglong mDatabaseId = 0;
+
+        int mRating = 0;
+
+        int mHighestTrackRating = 0;
+
+        bool mHasRating = false;
+
+        bool mHasHighestTrackRating = false;
+    };
+
+    /**
+     * Use the rows accepted by the last filter update when they are known.
+     */
+    [[nodiscard]] bool filterAcceptsRow(int source_row, const QModelIndex &source_parent) const override;
+
+    /**
+     * Read the values of one source row used by the filter. Only called from
+     * the thread of the model.
+     */
+    [[nodiscard]] FilterData filterData(int source_row, const QModelIndex &source_parent) const;
+
+    /**
+     * Test the values of one source row against the current filter. Called
+     * from the thread pool with mDataLock locked for reading, it must not use
+     * the source model.
+     */
+    [[nodiscard]] virtual bool rowMatchesFilter(const FilterData &rowData) const = 0;
+
+    /**
+     * Compare the sort keys of both rows. The keys of all the source rows are
+     * computed in parallel the first time a row is compared for a sort role,
+     * then only for the inserted and modified rows.
+     */
+    [[nodiscard]] bool lessThan(const QModelIndex &source_left, const QModelIndex &source_right) const override;
+
+    /**
+     * Wait for the filter update in progress after having asked it to stop.
+     * Subclasses must call it in their destructor.
+     */
+    void stopFilterUpdate();
 
     void disconnectPlayList();
 
@@ -102,18 +166,136 @@ protected:
 
     QRegularExpression mFilterExpression;
 
+    /**
+     * Database ids of the entries matching mFilterText in the search index.
+     * Only used when mFilterByMatchingIds is true, otherwise the rows are
+     * matched against mFilterExpression.
+     */
+    QSet<qulonglong> mMatchingIds;
+
+    bool mFilterByMatchingIds = false;
+
     QReadWriteLock mDataLock;
 
     QThreadPool mThreadPool;
 
     MediaPlayListProxyModel* mPlayList = nullptr;
 
+private Q_SLOTS:
+
+    void searchResultReady(const QString &searchText, const QVector<qulonglong> &matchingIds, bool isIndexed);
+
+    void dataModelRowsInserted();
+
+    void sourceModelModified();
+
+    void sourceRowsInserted(const QModelIndex &parent, int first, int last);
+
+    void sourceRowsRemoved(const QModelIndex &parent, int first, int last);
+
+    void sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles);
+
+    void allPagesLoaded(const DataTypes::ListTrackRecord &allTracks);
+
 private:
 
+    /**
+     * How the current filter relates to the one of the accepted rows.
+     */
+    enum class FilterChange {
+        Narrower,
+        Wider,
+        Unrelated,
+    };
+
+    [[nodiscard]] FilterChange filterChange() const;
+
+    /**
+     * True when the source model loads its rows by pages. They are then
+     * already sorted, and not filtered as long as the filter is empty.
+     */
+    [[nodiscard]] bool sourceLoadsPages() const;
+
+    /**
+     * Suspend the loading by pages of the source model while the rows are
+     * filtered: all the rows are then loaded and sorted by this model.
+     */
+    void updatePagedLoading();
+
+    /**
+     * Test the source rows in the thread pool. A narrower filter only tests
+     * the accepted rows and a wider one only the rejected rows.
+     */
+    void updateFilter();
+
+    void applyFilter(int generation, const QVector<bool> &acceptedRows);
+
+    /**
+     * Collation key of a text value or number of a numeric value, like the
+     * year or the duration in milliseconds.
+     */
+    struct SortKey
+    {
+        std::optional<QCollatorSortKey> mText;
+
+        qlonglong mNumber = 0;
+    };
+
+    [[nodiscard]] std::vector<SortKey> computeSortKeys(int firstRow, int lastRow) const;
+
+    /**
+     * Check that the sort keys are up to date once addedRowsCount source rows
+     * are taken into account.
+     */
+    [[nodiscard]] bool hasSortKeys(int addedRowsCount) const;
+
     void genericEnqueueToPlayList(const QModelIndex &rootIndex,
                                   ElisaUtils::PlayListEnqueueMode enqueueMode,
                                   ElisaUtils::PlayListEnqueueTriggerPlay triggerPlay);
 
+    QPointer<DataModel> mDataModel;
+
+    /**
+     * Enqueue requests waiting for all the pages of the source model.
+     */
+    QVector<QPair<ElisaUtils::PlayListEnqueueMode, ElisaUtils::PlayListEnqueueTriggerPlay>> mPendingEnqueues;
+
+    /**
+     * Search the index again once the source model has stopped receiving new rows.
+     */
+    QTimer mSearchAgainTimer;
+
+    /**
+     * Source rows accepted by mAppliedFilterText and mAppliedFilterRating.
+     * Empty when the source rows changed since the last filter update.
+     */
+    QVector<bool> mAcceptedRows;
+
+    QString mAppliedFilterText;
+
+    int mAppliedFilterRating = 0;
+
+    bool mAppliedFilterByMatchingIds = false;
+
+    bool mFilterUpdatePending = false;
+
+    std::atomic<int> mFilterGeneration{0};
+
+    /**
+     * Sort keys of the source rows for mSortKeysRole. Filled by the first
+     * comparison after a change of the sort role.
+     */
+    mutable std::vector<SortKey> mSortKeys;
+
+    mutable int mSortKeysRole = -1;
+
+    /**
+     * Settings of the collation keys. Keys are comparable when they come from
+     * collators with the same locale and options, the tasks computing them
+     * each use a collator with these settings.
+     */
+    mutable QCollator mSortCollator;
+
 };
 
 #endif // ABSTRACTMEDIAPROXYMODEL_H
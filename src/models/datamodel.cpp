@@ -11,15 +11,58 @@
 
 #include "models/modelLogging.h"
 
+#include <QSet>
+#include <QTimer>
+
 #include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+/**
+ * Number of tracks of each page read from the database when the tracks are loaded by pages.
+ */
+static const int TracksPageSize = 500;
+
+/**
+ * Number of pages kept before and after the page of the last row read by the view.
+ */
+static const int KeptPagesAround = 4;
+
+/**
+ * Number of removed rows after which the positions stored in the id to row
+ * hash are rebuilt. Until then, the rows removed since the last rebuild are
+ * subtracted on lookup.
+ */
+static const int RemovedRowsBeforeRehash = 1024;
+
+template <typename DataListType>
+static void updateRowsFromId(QHash<qulonglong, int> &rowsFromId, const DataListType &allData, int firstRow)
+{
+    for (int row = firstRow; row < allData.size(); ++row) {
+        rowsFromId[allData[row].databaseId()] = row;
+    }
+}
+
+/**
+ * Views read the database through their own connection. An addition notified by the
+ * database may already be part of the data the view has just read.
+ */
+template <typename DataListType>
+static void removeKnownEntries(DataListType &newData, const QHash<qulonglong, int> &rowsFromId)
+{
+    newData.erase(std::remove_if(newData.begin(), newData.end(), [&rowsFromId](const auto &oneData) {
+                      return rowsFromId.contains(oneData.databaseId());
+                  }),
+                  newData.end());
+}
 
 class DataModelPrivate
 {
 public:
 
-    DataModel::ListTrackDataType mAllTrackData;
+    DataTypes::ListTrackRecord mAllTrackData;
 
-    DataModel::ListRadioDataType mAllRadiosData;
+    DataTypes::ListTrackRecord mAllRadiosData;
 
     DataModel::ListAlbumDataType mAllAlbumData;
 
@@ -27,6 +70,14 @@ public:
 
     DataModel::ListGenreDataType mAllGenreData;
 
+    QHash<qulonglong, int> mRowsFromId;
+
+    /**
+     * Sorted positions, as stored in mRowsFromId, of the rows removed since
+     * the hash was last rebuilt.
+     */
+    QVector<int> mRemovedRows;
+
     ModelDataLoader *mDataLoader = nullptr;
 
     ElisaUtils::PlayListEntryType mModelType = ElisaUtils::Unknown;
@@ -43,14 +94,64 @@ public:
 
     qulonglong mDatabaseId = 0;
 
+    /**
+     * Loaded pages of tracks keyed by their index when the tracks are loaded by pages.
+     */
+    QHash<int, DataTypes::ListTrackRecord> mTrackPages;
+
+    /**
+     * Sort key and database id of the last track of each page read since the
+     * last change of the collection or of the sort. The next page is read
+     * after it instead of skipping all the rows before it.
+     */
+    QHash<int, QPair<QVariant, qulonglong>> mPagesEnd;
+
+    /**
+     * Number of requests of each page waiting for their answer. Only the
+     * answer to the last one is used.
+     */
+    QHash<int, int> mRequestedPages;
+
+    /**
+     * Pages read by the view while not loaded.
+     */
+    QSet<int> mNeededPages;
+
+    /**
+     * Pages to read again even if they are already requested.
+     */
+    QSet<int> mInvalidatedPages;
+
+    QTimer mPagesRequestTimer;
+
+    int mLastReadPage = 0;
+
+    int mTotalRowCount = 0;
+
+    int mPagesSortRole = DataTypes::TitleRole;
+
+    Qt::SortOrder mPagesSortOrder = Qt::AscendingOrder;
+
     bool mIsBusy = false;
 
+    bool mPagedLoading = false;
+
+    bool mIsPagedLoadingSuspended = false;
+
+    bool mIsPaged = false;
+
+    bool mIsLoadingAllPages = false;
+
 };
 
 DataModel::DataModel(QObject *parent) : QAbstractListModel(parent), d(std::make_unique<DataModelPrivate>())
 {
     d->mDataLoader = new ModelDataLoader;
     connect(this, &DataModel::destroyed, d->mDataLoader, &ModelDataLoader::deleteLater);
+
+    d->mPagesRequestTimer.setSingleShot(true);
+    d->mPagesRequestTimer.setInterval(0);
+    connect(&d->mPagesRequestTimer, &QTimer::timeout, this, &DataModel::requestNeededPages);
 }
 
 DataModel::~DataModel()
@@ -64,6 +165,10 @@ int DataModel::rowCount(const QModelIndex &parent) const
         return dataCount;
     }
 
+    if (d->mIsPaged) {
+        return d->mTotalRowCount;
+    }
+
     dataCount = d->mAllTrackData.size() + d->mAllAlbumData.size() + d->mAllArtistData.size() + d->mAllGenreData.size();
 
     return dataCount;
@@ -116,7 +221,7 @@ QVariant DataModel::data(const QModelIndex &index, int role) const
         return result;
     }
 
-    const auto dataCount = d->mModelType == ElisaUtils::Radio ? d->mAllRadiosData.size() : d->mAllTrackData.size() + d->mAllAlbumData.size() + d->mAllArtistData.size() + d->mAllGenreData.size();
+    const auto dataCount = d->mModelType == ElisaUtils::Radio ? d->mAllRadiosData.size() : rowCount();
 
     Q_ASSERT(index.isValid());
     Q_ASSERT(index.column() == 0);
@@ -125,17 +230,26 @@ QVariant DataModel::data(const QModelIndex &index, int role) const
     Q_ASSERT(index.internalId() == 0);
     Q_ASSERT(index.row() >= 0 && index.row() < dataCount);
 
+    // the rows of the pages not loaded yet are empty until their page is read
+    if (d->mIsPaged && !isTrackLoaded(index.row())) {
+        return result;
+    }
+
     switch(role)
     {
     case Qt::DisplayRole:
         switch(d->mModelType)
         {
         case ElisaUtils::Track:
-            result = d->mAllTrackData[index.row()][TrackDataType::key_type::TitleRole];
-            if (result.toString().isEmpty()) {
-                result = d->mAllTrackData[index.row()][TrackDataType::key_type::ResourceRole].toUrl().fileName();
+        {
+            const auto &trackData = trackAt(index.row());
+            if (trackData.title().isEmpty()) {
+                result = trackData.resourceURI().fileName();
+            } else {
+                result = trackData.title();
             }
             break;
+        }
         case ElisaUtils::Album:
             result = d->mAllAlbumData[index.row()][AlbumDataType::key_type::TitleRole];
             break;
@@ -162,7 +276,7 @@ QVariant DataModel::data(const QModelIndex &index, int role) const
         {
         case ElisaUtils::Track:
         {
-            auto trackDuration = d->mAllTrackData[index.row()][TrackDataType::key_type::DurationRole].toTime();
+            auto trackDuration = trackAt(index.row()).duration();
             if (trackDuration.hour() == 0) {
                 result = trackDuration.toString(QStringLiteral("mm:ss"));
             } else {
@@ -188,7 +302,7 @@ QVariant DataModel::data(const QModelIndex &index, int role) const
         switch (d->mModelType)
         {
         case ElisaUtils::Track:
-            result = d->mAllTrackData[index.row()][TrackDataType::key_type::IsSingleDiscAlbumRole];
+            result = trackAt(index.row())[TrackDataType::key_type::IsSingleDiscAlbumRole];
             break;
         case ElisaUtils::Radio:
             result = false;
@@ -213,11 +327,11 @@ QVariant DataModel::data(const QModelIndex &index, int role) const
         {
         case ElisaUtils::Track:
         {
-            auto itArtist = d->mAllTrackData[index.row()].find(TrackDataType::key_type::ArtistRole);
-            if (itArtist != d->mAllTrackData[index.row()].end()) {
-                result = d->mAllTrackData[index.row()][TrackDataType::key_type::ArtistRole];
+            const auto &trackData = trackAt(index.row());
+            if (trackData.hasArtist()) {
+                result = trackData.artist();
             } else {
-                result = d->mAllTrackData[index.row()][TrackDataType::key_type::AlbumArtistRole];
+                result = trackData.value(TrackDataType::key_type::AlbumArtistRole);
             }
             break;
         }
@@ -246,10 +360,10 @@ QVariant DataModel::data(const QModelIndex &index, int role) const
         switch (d->mModelType)
         {
         case ElisaUtils::Track:
-            result = QVariant::fromValue(static_cast<DataTypes::MusicDataType>(d->mAllTrackData[index.row()]));
+            result = QVariant::fromValue(static_cast<DataTypes::MusicDataType>(trackAt(index.row()).toTrackDataType()));
             break;
         case ElisaUtils::Radio:
-            result = QVariant::fromValue(static_cast<DataTypes::MusicDataType>(d->mAllRadiosData[index.row()]));
+            result = QVariant::fromValue(static_cast<DataTypes::MusicDataType>(d->mAllRadiosData[index.row()].toTrackDataType()));
             break;
         case ElisaUtils::Album:
             result = QVariant::fromValue(static_cast<DataTypes::MusicDataType>(d->mAllAlbumData[index.row()]));
@@ -274,7 +388,7 @@ QVariant DataModel::data(const QModelIndex &index, int role) const
         {
         case ElisaUtils::Track:
         case ElisaUtils::FileName:
-            result = d->mAllTrackData[index.row()][TrackDataType::key_type::ResourceRole];
+            result = trackAt(index.row())[TrackDataType::key_type::ResourceRole];
             break;
         case ElisaUtils::Radio:
             result = d->mAllRadiosData[index.row()][TrackDataType::key_type::ResourceRole];
@@ -316,7 +430,7 @@ QVariant DataModel::data(const QModelIndex &index, int role) const
         switch(d->mModelType)
         {
         case ElisaUtils::Track:
-            result = d->mAllTrackData[index.row()][static_cast<TrackDataType::key_type>(role)];
+            result = trackAt(index.row())[static_cast<TrackDataType::key_type>(role)];
             break;
         case ElisaUtils::Album:
             result = d->mAllAlbumData[index.row()][static_cast<AlbumDataType::key_type>(role)];
@@ -383,6 +497,184 @@ bool DataModel::isBusy() const
     return d->mIsBusy;
 }
 
+bool DataModel::pagedLoading() const
+{
+    return d->mPagedLoading;
+}
+
+void DataModel::setPagedLoading(bool value)
+{
+    d->mPagedLoading = value;
+}
+
+bool DataModel::isLoadingPages() const
+{
+    return d->mPagedLoading && !d->mIsPagedLoadingSuspended;
+}
+
+void DataModel::setPagesSort(int sortRole, Qt::SortOrder sortOrder)
+{
+    if (d->mPagesSortRole == sortRole && d->mPagesSortOrder == sortOrder) {
+        return;
+    }
+
+    d->mPagesSortRole = sortRole;
+    d->mPagesSortOrder = sortOrder;
+
+    if (d->mIsPaged) {
+        invalidatePages();
+    }
+}
+
+void DataModel::setPagedLoadingSuspended(bool value)
+{
+    if (d->mIsPagedLoadingSuspended == value) {
+        return;
+    }
+
+    d->mIsPagedLoadingSuspended = value;
+
+    // not initialized yet, the tracks are loaded in the right way once it is
+    if (!d->mPagedLoading || d->mModelType != ElisaUtils::Track || d->mFilterType != ElisaUtils::NoFilter) {
+        return;
+    }
+
+    beginResetModel();
+    d->mAllTrackData.clear();
+    d->mRowsFromId.clear();
+    d->mRemovedRows.clear();
+    clearPages();
+    d->mIsPaged = !value;
+    endResetModel();
+
+    setBusy(true);
+
+    askModelData();
+}
+
+void DataModel::loadAllPages()
+{
+    if (!d->mIsPaged) {
+        return;
+    }
+
+    // the answer also holds the first page
+    d->mIsLoadingAllPages = true;
+    ++d->mRequestedPages[0];
+    Q_EMIT needDataPage(d->mModelType, d->mPagesSortRole, d->mPagesSortOrder, 0, {}, 0, -1);
+}
+
+bool DataModel::isTrackLoaded(int row) const
+{
+    const auto page = row / TracksPageSize;
+
+    d->mLastReadPage = page;
+
+    const auto itPage = d->mTrackPages.constFind(page);
+    if (itPage != d->mTrackPages.cend()) {
+        return row % TracksPageSize < itPage->size();
+    }
+
+    // the view reads the rows while it is laid out, the page cannot be loaded from here
+    d->mNeededPages.insert(page);
+    if (!d->mPagesRequestTimer.isActive()) {
+        d->mPagesRequestTimer.start();
+    }
+
+    return false;
+}
+
+const DataTypes::TrackRecord &DataModel::trackAt(int row) const
+{
+    if (!d->mIsPaged) {
+        return d->mAllTrackData.at(row);
+    }
+
+    return d->mTrackPages.constFind(row / TracksPageSize)->at(row % TracksPageSize);
+}
+
+void DataModel::requestNeededPages()
+{
+    if (!d->mIsPaged) {
+        d->mNeededPages.clear();
+        d->mInvalidatedPages.clear();
+        return;
+    }
+
+    auto neededPages = QVector<int>(d->mNeededPages.cbegin(), d->mNeededPages.cend());
+    for (const auto page : qAsConst(d->mInvalidatedPages)) {
+        if (!d->mNeededPages.contains(page)) {
+            neededPages.push_back(page);
+        }
+    }
+    std::sort(neededPages.begin(), neededPages.end());
+
+    const auto invalidatedPages = std::exchange(d->mInvalidatedPages, {});
+    d->mNeededPages.clear();
+
+    for (const auto page : neededPages) {
+        const auto firstRow = page * TracksPageSize;
+
+        // the first page also reads the number of rows, the others may have been scrolled away or removed
+        if (!invalidatedPages.contains(page) &&
+            (d->mRequestedPages.contains(page) ||
+             (page != 0 && (firstRow >= d->mTotalRowCount || std::abs(page - d->mLastReadPage) > KeptPagesAround)))) {
+            continue;
+        }
+
+        ++d->mRequestedPages[page];
+
+        const auto itPreviousPageEnd = d->mPagesEnd.constFind(page - 1);
+        if (itPreviousPageEnd != d->mPagesEnd.cend()) {
+            Q_EMIT needDataPage(d->mModelType, d->mPagesSortRole, d->mPagesSortOrder, firstRow,
+                                itPreviousPageEnd->first, itPreviousPageEnd->second, TracksPageSize);
+        } else {
+            Q_EMIT needDataPage(d->mModelType, d->mPagesSortRole, d->mPagesSortOrder, firstRow,
+                                {}, 0, TracksPageSize);
+        }
+    }
+}
+
+void DataModel::invalidatePages()
+{
+    d->mPagesEnd.clear();
+
+    d->mInvalidatedPages.insert(0);
+    for (auto itPage = d->mTrackPages.cbegin(); itPage != d->mTrackPages.cend(); ++itPage) {
+        d->mInvalidatedPages.insert(itPage.key());
+    }
+    for (auto itRequest = d->mRequestedPages.cbegin(); itRequest != d->mRequestedPages.cend(); ++itRequest) {
+        d->mInvalidatedPages.insert(itRequest.key());
+    }
+
+    if (!d->mPagesRequestTimer.isActive()) {
+        d->mPagesRequestTimer.start();
+    }
+}
+
+void DataModel::clearPages()
+{
+    // the requests waiting for their answer are kept to drop the answers
+    d->mTrackPages.clear();
+    d->mPagesEnd.clear();
+    d->mNeededPages.clear();
+    d->mInvalidatedPages.clear();
+    d->mTotalRowCount = 0;
+}
+
+void DataModel::setPagesRowCount(int value)
+{
+    if (value > d->mTotalRowCount) {
+        beginInsertRows({}, d->mTotalRowCount, value - 1);
+        d->mTotalRowCount = value;
+        endInsertRows();
+    } else if (value < d->mTotalRowCount) {
+        beginRemoveRows({}, value, d->mTotalRowCount - 1);
+        d->mTotalRowCount = value;
+        endRemoveRows();
+    }
+}
+
 void DataModel::initializeByData(MusicListenersManager *manager, DatabaseInterface *database,
                                  ElisaUtils::PlayListEntryType modelType, ElisaUtils::FilterType filter,
                                  const DataTypes::DataType &dataFilter)
@@ -412,6 +704,9 @@ void DataModel::initializeModel(MusicListenersManager *manager, DatabaseInterfac
     d->mModelType = modelType;
     d->mFilterType = type;
 
+    // only the tracks of the whole collection are loaded by pages
+    d->mPagedLoading = d->mPagedLoading && d->mModelType == ElisaUtils::Track && d->mFilterType == ElisaUtils::NoFilter;
+
     if (manager) {
         manager->connectModel(d->mDataLoader);
     }
@@ -427,6 +722,14 @@ void DataModel::initializeModel(MusicListenersManager *manager, DatabaseInterfac
     switch(d->mFilterType)
     {
     case ElisaUtils::NoFilter:
+        // the tracks loaded by pages are all loaded while the paged loading is suspended
+        if (d->mModelType == ElisaUtils::Track && d->mPagedLoading) {
+            d->mIsPaged = !d->mIsPagedLoadingSuspended;
+            connect(this, &DataModel::needDataPage,
+                    d->mDataLoader, &ModelDataLoader::loadDataPage);
+            connect(d->mDataLoader, &ModelDataLoader::tracksDataPage,
+                    this, &DataModel::tracksPageAdded);
+        }
         connect(this, &DataModel::needData,
                 d->mDataLoader, &ModelDataLoader::loadData);
         break;
@@ -469,7 +772,12 @@ void DataModel::askModelData()
     switch(d->mFilterType)
     {
     case ElisaUtils::NoFilter:
-        Q_EMIT needData(d->mModelType);
+        if (d->mIsPaged) {
+            d->mNeededPages.insert(0);
+            requestNeededPages();
+        } else {
+            Q_EMIT needData(d->mModelType);
+        }
         break;
     case ElisaUtils::FilterById:
         Q_EMIT needDataById(d->mModelType, d->mDatabaseId);
@@ -497,18 +805,63 @@ void DataModel::askModelData()
 
 int DataModel::indexFromId(qulonglong id) const
 {
-    int result;
-    DataModel::ListTrackDataType mAllData = d->mModelType == ElisaUtils::Radio ? d->mAllRadiosData: d->mAllTrackData;
+    const auto storedRow = d->mRowsFromId.value(id, -1);
 
-    for (result = 0; result < mAllData.size(); ++result) {
-        if (mAllData[result].databaseId() == id) {
-            return result;
-        }
+    if (storedRow == -1 || d->mRemovedRows.isEmpty()) {
+        return storedRow;
     }
 
-    result = -1;
+    const auto removedBefore = std::lower_bound(d->mRemovedRows.cbegin(), d->mRemovedRows.cend(), storedRow) - d->mRemovedRows.cbegin();
 
-    return result;
+    return storedRow - static_cast<int>(removedBefore);
+}
+
+void DataModel::updateIndexFromId(int firstRow)
+{
+    if (!d->mRemovedRows.isEmpty()) {
+        firstRow = std::min(firstRow, d->mRemovedRows.first());
+        d->mRemovedRows.clear();
+    }
+
+    if (firstRow == 0) {
+        d->mRowsFromId.clear();
+    }
+
+    switch(d->mModelType)
+    {
+    case ElisaUtils::Track:
+        updateRowsFromId(d->mRowsFromId, d->mAllTrackData, firstRow);
+        break;
+    case ElisaUtils::Radio:
+        updateRowsFromId(d->mRowsFromId, d->mAllRadiosData, firstRow);
+        break;
+    case ElisaUtils::Album:
+        updateRowsFromId(d->mRowsFromId, d->mAllAlbumData, firstRow);
+        break;
+    case ElisaUtils::Artist:
+        updateRowsFromId(d->mRowsFromId, d->mAllArtistData, firstRow);
+        break;
+    case ElisaUtils::Genre:
+        updateRowsFromId(d->mRowsFromId, d->mAllGenreData, firstRow);
+        break;
+    case ElisaUtils::Lyricist:
+    case ElisaUtils::Composer:
+    case ElisaUtils::FileName:
+    case ElisaUtils::Container:
+    case ElisaUtils::Unknown:
+        break;
+    }
+}
+
+void DataModel::removeIndexFromId(qulonglong id, int removedRow)
+{
+    const auto storedRow = d->mRowsFromId.take(id);
+
+    d->mRemovedRows.insert(std::lower_bound(d->mRemovedRows.begin(), d->mRemovedRows.end(), storedRow), storedRow);
+
+    if (d->mRemovedRows.size() >= RemovedRowsBeforeRehash) {
+        updateIndexFromId(removedRow);
+    }
 }
 
 void DataModel::connectModel(DatabaseInterface *database)
@@ -551,9 +904,28 @@ void DataModel::connectModel(DatabaseInterface *database)
             this, &DataModel::radioRemoved);
     connect(d->mDataLoader, &ModelDataLoader::clearedDatabase,
             this, &DataModel::cleanedDatabase);
+    connect(this, &DataModel::needSearch,
+            d->mDataLoader, &ModelDataLoader::searchData);
+    connect(d->mDataLoader, &ModelDataLoader::searchResult,
+            this, &DataModel::searchResult);
+}
+
+void DataModel::search(const QString &searchText)
+{
+    Q_EMIT needSearch(d->mModelType, searchText);
 }
 
-void DataModel::tracksAdded(ListTrackDataType newData)
+void DataModel::searchResult(ElisaUtils::PlayListEntryType dataType, const QString &searchText,
+                             const QVector<qulonglong> &matchingIds, bool isIndexed)
+{
+    if (dataType != d->mModelType) {
+        return;
+    }
+
+    Q_EMIT searchResultReady(searchText, matchingIds, isIndexed);
+}
+
+void DataModel::tracksAdded(ListTrackRecord newData)
 {
     if (newData.isEmpty() && d->mModelType == ElisaUtils::Track) {
         setBusy(false);
@@ -563,6 +935,12 @@ void DataModel::tracksAdded(ListTrackDataType newData)
         return;
     }
 
+    // the new tracks may be sorted before any loaded row
+    if (d->mIsPaged) {
+        invalidatePages();
+        return;
+    }
+
     if (d->mFilterType == ElisaUtils::FilterById && !d->mAllTrackData.isEmpty()) {
         for (const auto &newTrack : newData) {
             auto trackIndex = indexFromId(newTrack.databaseId());
@@ -578,6 +956,7 @@ void DataModel::tracksAdded(ListTrackDataType newData)
                 if (oneTrack.discNumber() >= newTrack.discNumber() && oneTrack.trackNumber() > newTrack.trackNumber()) {
                     beginInsertRows({}, trackIndex, trackIndex);
                     d->mAllTrackData.insert(trackIndex, newTrack);
+                    updateIndexFromId(trackIndex);
                     endInsertRows();
 
                     if (d->mAllTrackData.size() == 1) {
@@ -591,7 +970,8 @@ void DataModel::tracksAdded(ListTrackDataType newData)
 
             if (!trackInserted) {
                 beginInsertRows({}, d->mAllTrackData.count(), d->mAllTrackData.count());
-                d->mAllTrackData.insert(d->mAllTrackData.count(), newTrack);
+                d->mAllTrackData.push_back(newTrack);
+                updateIndexFromId(d->mAllTrackData.count() - 1);
                 endInsertRows();
 
                 if (d->mAllTrackData.size() == 1) {
@@ -602,13 +982,21 @@ void DataModel::tracksAdded(ListTrackDataType newData)
     } else {
         if (d->mAllTrackData.isEmpty()) {
             beginInsertRows({}, 0, newData.size() - 1);
-            d->mAllTrackData.swap(newData);
+            d->mAllTrackData = std::move(newData);
+            updateIndexFromId(0);
             endInsertRows();
 
             setBusy(false);
         } else {
+            removeKnownEntries(newData, d->mRowsFromId);
+            if (newData.isEmpty()) {
+                return;
+            }
+
+            const auto firstNewRow = d->mAllTrackData.size();
             beginInsertRows({}, d->mAllTrackData.size(), d->mAllTrackData.size() + newData.size() - 1);
             d->mAllTrackData.append(newData);
+            updateIndexFromId(firstNewRow);
             endInsertRows();
         }
     }
@@ -638,7 +1026,8 @@ void DataModel::radiosAdded(ListRadioDataType newData)
 
                 if (oneTrack.trackNumber() > newTrack.trackNumber()) {
                     beginInsertRows({}, trackIndex, trackIndex);
-                    d->mAllRadiosData.insert(trackIndex, newTrack);
+                    d->mAllRadiosData.insert(trackIndex, DataTypes::TrackRecord{newTrack});
+                    updateIndexFromId(trackIndex);
                     endInsertRows();
 
                     if (d->mAllRadiosData.size() == 1) {
@@ -652,7 +1041,8 @@ void DataModel::radiosAdded(ListRadioDataType newData)
 
             if (!trackInserted) {
                 beginInsertRows({}, d->mAllRadiosData.count(), d->mAllRadiosData.count());
-                d->mAllRadiosData.insert(d->mAllRadiosData.count(), newTrack);
+                d->mAllRadiosData.push_back(DataTypes::TrackRecord{newTrack});
+                updateIndexFromId(d->mAllRadiosData.count() - 1);
                 endInsertRows();
 
                 if (d->mAllRadiosData.size() == 1) {
@@ -663,13 +1053,16 @@ void DataModel::radiosAdded(ListRadioDataType newData)
     } else {
         if (d->mAllRadiosData.isEmpty()) {
             beginInsertRows({}, 0, newData.size() - 1);
-            d->mAllRadiosData.swap(newData);
+            d->mAllRadiosData = DataTypes::toListTrackRecord(newData);
+            updateIndexFromId(0);
             endInsertRows();
 
             setBusy(false);
         } else {
+            const auto firstNewRow = d->mAllRadiosData.size();
             beginInsertRows({}, d->mAllRadiosData.size(), d->mAllRadiosData.size() + newData.size() - 1);
-            d->mAllRadiosData.append(newData);
+            d->mAllRadiosData.append(DataTypes::toListTrackRecord(newData));
+            updateIndexFromId(firstNewRow);
             endInsertRows();
         }
     }
@@ -681,35 +1074,48 @@ void DataModel::trackModified(const TrackDataType &modifiedTrack)
         return;
     }
 
-    if (!d->mAlbumTitle.isEmpty() && !d->mAlbumArtist.isEmpty()) {
-        if (modifiedTrack.album() != d->mAlbumTitle) {
-            return;
-        }
+    if (!d->mAlbumTitle.isEmpty() && !d->mAlbumArtist.isEmpty() && modifiedTrack.album() != d->mAlbumTitle) {
+        return;
+    }
 
-        auto trackIndex = indexFromId(modifiedTrack.databaseId());
+    if (d->mIsPaged) {
+        for (auto itPage = d->mTrackPages.begin(); itPage != d->mTrackPages.end(); ++itPage) {
+            auto &pageTracks = itPage.value();
+            const auto itTrack = std::find_if(pageTracks.begin(), pageTracks.end(), [&modifiedTrack](const auto &oneTrack) {
+                return oneTrack.databaseId() == modifiedTrack.databaseId();
+            });
 
-        if (trackIndex == -1) {
-            return;
-        }
+            if (itTrack == pageTracks.end()) {
+                continue;
+            }
 
-        d->mAllTrackData[trackIndex] = modifiedTrack;
-        Q_EMIT dataChanged(index(trackIndex, 0), index(trackIndex, 0));
-    } else {
-        auto itTrack = std::find_if(d->mAllTrackData.begin(), d->mAllTrackData.end(),
-                                    [modifiedTrack](auto track) {
-            return track.databaseId() == modifiedTrack.databaseId();
-        });
+            auto modifiedRecord = DataTypes::TrackRecord{modifiedTrack};
 
-        if (itTrack == d->mAllTrackData.end()) {
+            // the track may move to another row
+            const auto sortRole = static_cast<DataTypes::ColumnsRoles>(d->mPagesSortRole);
+            if ((*itTrack)[sortRole] != modifiedRecord[sortRole]) {
+                invalidatePages();
+                return;
+            }
+
+            *itTrack = std::move(modifiedRecord);
+
+            const auto trackRow = itPage.key() * TracksPageSize + static_cast<int>(std::distance(pageTracks.begin(), itTrack));
+            Q_EMIT dataChanged(index(trackRow, 0), index(trackRow, 0));
             return;
         }
 
-        auto position = itTrack - d->mAllTrackData.begin();
+        return;
+    }
 
-        d->mAllTrackData[position] = modifiedTrack;
+    auto trackIndex = indexFromId(modifiedTrack.databaseId());
 
-        Q_EMIT dataChanged(index(position, 0), index(position, 0));
+    if (trackIndex == -1) {
+        return;
     }
+
+    d->mAllTrackData[trackIndex] = DataTypes::TrackRecord{modifiedTrack};
+    Q_EMIT dataChanged(index(trackIndex, 0), index(trackIndex, 0));
 }
 
 void DataModel::radioModified(const TrackDataType &modifiedRadio)
@@ -724,7 +1130,7 @@ void DataModel::radioModified(const TrackDataType &modifiedRadio)
         return;
     }
 
-    d->mAllRadiosData[trackIndex] = modifiedRadio;
+    d->mAllRadiosData[trackIndex] = DataTypes::TrackRecord{modifiedRadio};
     Q_EMIT dataChanged(index(trackIndex, 0), index(trackIndex, 0));
 }
 
@@ -734,30 +1140,22 @@ void DataModel::trackRemoved(qulonglong removedTrackId)
         return;
     }
 
-    if (!d->mAlbumTitle.isEmpty() && !d->mAlbumArtist.isEmpty()) {
-        auto trackIndex = indexFromId(removedTrackId);
-
-        if (trackIndex == -1) {
-            return;
-        }
-
-        beginRemoveRows({}, trackIndex, trackIndex);
-        d->mAllTrackData.removeAt(trackIndex);
-        endRemoveRows();
-    } else {
-        auto itTrack = std::find_if(d->mAllTrackData.begin(), d->mAllTrackData.end(),
-                                    [removedTrackId](auto track) {return track.databaseId() == removedTrackId;});
-
-        if (itTrack == d->mAllTrackData.end()) {
-            return;
-        }
+    // the following rows move up
+    if (d->mIsPaged) {
+        invalidatePages();
+        return;
+    }
 
-        auto position = itTrack - d->mAllTrackData.begin();
+    auto trackIndex = indexFromId(removedTrackId);
 
-        beginRemoveRows({}, position, position);
-        d->mAllTrackData.erase(itTrack);
-        endRemoveRows();
+    if (trackIndex == -1) {
+        return;
     }
+
+    beginRemoveRows({}, trackIndex, trackIndex);
+    d->mAllTrackData.removeAt(trackIndex);
+    removeIndexFromId(removedTrackId, trackIndex);
+    endRemoveRows();
 }
 
 void DataModel::radioRemoved(qulonglong removedRadioId)
@@ -766,18 +1164,15 @@ void DataModel::radioRemoved(qulonglong removedRadioId)
         return;
     }
 
+    auto radioIndex = indexFromId(removedRadioId);
 
-    auto itRadio = std::find_if(d->mAllRadiosData.begin(), d->mAllRadiosData.end(),
-                                [removedRadioId](auto track) {return track.databaseId() == removedRadioId;});
-
-    if (itRadio == d->mAllRadiosData.end()) {
+    if (radioIndex == -1) {
         return;
     }
 
-    auto position = itRadio - d->mAllRadiosData.begin();
-
-    beginRemoveRows({}, position, position);
-    d->mAllRadiosData.erase(itRadio);
+    beginRemoveRows({}, radioIndex, radioIndex);
+    d->mAllRadiosData.removeAt(radioIndex);
+    removeIndexFromId(removedRadioId, radioIndex);
     endRemoveRows();
 }
 
@@ -800,6 +1195,8 @@ void DataModel::removeRadios()
 
     beginRemoveRows({}, 0, d->mAllRadiosData.size());
     d->mAllRadiosData.clear();
+    d->mRowsFromId.clear();
+    d->mRemovedRows.clear();
     endRemoveRows();
 }
 
@@ -816,12 +1213,20 @@ void DataModel::genresAdded(DataModel::ListGenreDataType newData)
     if (d->mAllGenreData.isEmpty()) {
         beginInsertRows({}, d->mAllGenreData.size(), newData.size() - 1);
         d->mAllGenreData.swap(newData);
+        updateIndexFromId(0);
         endInsertRows();
 
         setBusy(false);
     } else {
+        removeKnownEntries(newData, d->mRowsFromId);
+        if (newData.isEmpty()) {
+            return;
+        }
+
+        const auto firstNewRow = d->mAllGenreData.size();
         beginInsertRows({}, d->mAllGenreData.size(), d->mAllGenreData.size() + newData.size() - 1);
         d->mAllGenreData.append(newData);
+        updateIndexFromId(firstNewRow);
         endInsertRows();
     }
 }
@@ -839,12 +1244,20 @@ void DataModel::artistsAdded(DataModel::ListArtistDataType newData)
     if (d->mAllArtistData.isEmpty()) {
         beginInsertRows({}, d->mAllArtistData.size(), newData.size() - 1);
         d->mAllArtistData.swap(newData);
+        updateIndexFromId(0);
         endInsertRows();
 
         setBusy(false);
     } else {
+        removeKnownEntries(newData, d->mRowsFromId);
+        if (newData.isEmpty()) {
+            return;
+        }
+
+        const auto firstNewRow = d->mAllArtistData.size();
         beginInsertRows({}, d->mAllArtistData.size(), d->mAllArtistData.size() + newData.size() - 1);
         d->mAllArtistData.append(newData);
+        updateIndexFromId(firstNewRow);
         endInsertRows();
     }
 }
@@ -855,20 +1268,16 @@ void DataModel::artistRemoved(qulonglong removedDatabaseId)
         return;
     }
 
-    auto removedDataIterator = d->mAllArtistData.end();
+    auto dataIndex = indexFromId(removedDatabaseId);
 
-    removedDataIterator = std::find_if(d->mAllArtistData.begin(), d->mAllArtistData.end(),
-                                       [removedDatabaseId](auto album) {return album.databaseId() == removedDatabaseId;});
-
-    if (removedDataIterator == d->mAllArtistData.end()) {
+    if (dataIndex == -1) {
         return;
     }
 
-    int dataIndex = removedDataIterator - d->mAllArtistData.begin();
-
     beginRemoveRows({}, dataIndex, dataIndex);
 
-    d->mAllArtistData.erase(removedDataIterator);
+    d->mAllArtistData.removeAt(dataIndex);
+    removeIndexFromId(removedDatabaseId, dataIndex);
 
     endRemoveRows();
 }
@@ -886,12 +1295,20 @@ void DataModel::albumsAdded(DataModel::ListAlbumDataType newData)
     if (d->mAllAlbumData.isEmpty()) {
         beginInsertRows({}, d->mAllAlbumData.size(), newData.size() - 1);
         d->mAllAlbumData.swap(newData);
+        updateIndexFromId(0);
         endInsertRows();
 
         setBusy(false);
     } else {
+        removeKnownEntries(newData, d->mRowsFromId);
+        if (newData.isEmpty()) {
+            return;
+        }
+
+        const auto firstNewRow = d->mAllAlbumData.size();
         beginInsertRows({}, d->mAllAlbumData.size(), d->mAllAlbumData.size() + newData.size() - 1);
         d->mAllAlbumData.append(newData);
+        updateIndexFromId(firstNewRow);
         endInsertRows();
     }
 }
@@ -902,20 +1319,16 @@ void DataModel::albumRemoved(qulonglong removedDatabaseId)
         return;
     }
 
-    auto removedDataIterator = d->mAllAlbumData.end();
-
-    removedDataIterator = std::find_if(d->mAllAlbumData.begin(), d->mAllAlbumData.end(),
-                                       [removedDatabaseId](auto album) {return album.databaseId() == removedDatabaseId;});
+    auto dataIndex = indexFromId(removedDatabaseId);
 
-    if (removedDataIterator == d->mAllAlbumData.end()) {
+    if (dataIndex == -1) {
         return;
     }
 
-    int dataIndex = removedDataIterator - d->mAllAlbumData.begin();
-
     beginRemoveRows({}, dataIndex, dataIndex);
 
-    d->mAllAlbumData.erase(removedDataIterator);
+    d->mAllAlbumData.removeAt(dataIndex);
+    removeIndexFromId(removedDatabaseId, dataIndex);
 
     endRemoveRows();
 }
@@ -926,17 +1339,12 @@ void DataModel::albumModified(const DataModel::AlbumDataType &modifiedAlbum)
         return;
     }
 
-    auto modifiedAlbumIterator = std::find_if(d->mAllAlbumData.begin(), d->mAllAlbumData.end(),
-                                              [modifiedAlbum](auto album) {
-        return album.databaseId() == modifiedAlbum.databaseId();
-    });
+    auto albumIndex = indexFromId(modifiedAlbum.databaseId());
 
-    if (modifiedAlbumIterator == d->mAllAlbumData.end()) {
+    if (albumIndex == -1) {
         return;
     }
 
-    auto albumIndex = modifiedAlbumIterator - d->mAllAlbumData.begin();
-
     Q_EMIT dataChanged(index(albumIndex, 0), index(albumIndex, 0));
 }
 
@@ -963,7 +1371,73 @@ void DataModel::cleanedDatabase()
     d->mAllGenreData.clear();
     d->mAllTrackData.clear();
     d->mAllArtistData.clear();
+    d->mRowsFromId.clear();
+    d->mRemovedRows.clear();
+    clearPages();
     endResetModel();
 }
 
+void DataModel::tracksPageAdded(const DataModel::ListTrackRecord &pageData, int sortRole, Qt::SortOrder sortOrder,
+                                int firstRow, const QVariant &lastSortKey, int totalCount)
+{
+    if (d->mIsLoadingAllPages && firstRow == 0 && (pageData.size() > TracksPageSize || pageData.size() == totalCount)) {
+        d->mIsLoadingAllPages = false;
+        Q_EMIT allPagesLoaded(pageData);
+    }
+
+    const auto page = firstRow / TracksPageSize;
+    auto itRequest = d->mRequestedPages.find(page);
+
+    if (firstRow % TracksPageSize != 0 || itRequest == d->mRequestedPages.end()) {
+        return;
+    }
+
+    // the page has been requested again since, only the last answer is up to date
+    if (--itRequest.value() > 0) {
+        return;
+    }
+
+    d->mRequestedPages.erase(itRequest);
+
+    if (!d->mIsPaged || sortRole != d->mPagesSortRole || sortOrder != d->mPagesSortOrder) {
+        return;
+    }
+
+    // the answer to loadAllPages also holds the first page
+    if (pageData.size() <= TracksPageSize) {
+        if (!pageData.isEmpty()) {
+            d->mPagesEnd[page] = {lastSortKey, pageData.last().databaseId()};
+        }
+        d->mTrackPages[page] = pageData;
+    } else {
+        d->mTrackPages[page] = pageData.mid(0, TracksPageSize);
+    }
+
+    // the pages far from the rows read by the view are released
+    for (auto itPage = d->mTrackPages.begin(); itPage != d->mTrackPages.end();) {
+        if (std::abs(itPage.key() - d->mLastReadPage) > KeptPagesAround) {
+            itPage = d->mTrackPages.erase(itPage);
+        } else {
+            ++itPage;
+        }
+    }
+
+    if (totalCount >= 0) {
+        setPagesRowCount(totalCount);
+    }
+
+    const auto itPage = d->mTrackPages.constFind(page);
+    if (itPage != d->mTrackPages.cend()) {
+        const auto lastRow = std::min(firstRow + itPage->size(), d->mTotalRowCount) - 1;
+
+        if (lastRow >= firstRow) {
+            Q_EMIT dataChanged(index(firstRow, 0), index(lastRow, 0));
+        }
+    }
+
+    if (page == 0) {
+        setBusy(false);
+    }
+}
+
 #include "moc_datamodel.cpp"
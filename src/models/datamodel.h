@@ -42,6 +42,8 @@ public:
 
     using ListTrackDataType = DataTypes::ListTrackDataType;
 
+    using ListTrackRecord = DataTypes::ListTrackRecord;
+
     using TrackDataType = DataTypes::TrackDataType;
 
     using ListAlbumDataType = DataTypes::ListAlbumDataType;
@@ -80,6 +82,38 @@ public:
 
     [[nodiscard]] bool isBusy() const;
 
+    [[nodiscard]] bool pagedLoading() const;
+
+    /**
+     * Load the tracks of the whole collection by pages sorted by the database,
+     * when the view reads their rows, instead of all at once. Only the pages
+     * around the last read row are kept. Must be set before the model is
+     * initialized.
+     */
+    void setPagedLoading(bool value);
+
+    /**
+     * True when the tracks are loaded by pages and the loading is not
+     * suspended. The rows are then already sorted and must not be read all.
+     */
+    [[nodiscard]] bool isLoadingPages() const;
+
+    /**
+     * Sort of the pages of tracks read from the database.
+     */
+    void setPagesSort(int sortRole, Qt::SortOrder sortOrder);
+
+    /**
+     * Load all the tracks at once while the loading by pages is suspended,
+     * for example while a proxy model filters the rows.
+     */
+    void setPagedLoadingSuspended(bool value);
+
+    /**
+     * Read all the tracks in the sort of the pages. They are sent with allPagesLoaded.
+     */
+    void loadAllPages();
+
 Q_SIGNALS:
 
     void titleChanged();
@@ -88,6 +122,9 @@ Q_SIGNALS:
 
     void needData(ElisaUtils::PlayListEntryType dataType);
 
+    void needDataPage(ElisaUtils::PlayListEntryType dataType, int sortRole, Qt::SortOrder sortOrder, int firstRow,
+                      const QVariant &afterSortKey, qulonglong afterDatabaseId, int count);
+
     void needDataById(ElisaUtils::PlayListEntryType dataType, qulonglong databaseId);
 
     void needDataByGenre(ElisaUtils::PlayListEntryType dataType, const QString &genre);
@@ -101,11 +138,27 @@ Q_SIGNALS:
 
     void needFrequentlyPlayedData(ElisaUtils::PlayListEntryType dataType);
 
+    void needSearch(ElisaUtils::PlayListEntryType dataType, const QString &searchText);
+
+    /**
+     * Answer to search. isIndexed is false when the database cannot search
+     * this kind of data and matchingIds is then empty.
+     */
+    void searchResultReady(const QString &searchText, const QVector<qulonglong> &matchingIds, bool isIndexed);
+
     void isBusyChanged();
 
+    void allPagesLoaded(const DataModel::ListTrackRecord &allTracks);
+
 public Q_SLOTS:
 
-    void tracksAdded(DataModel::ListTrackDataType newData);
+    /**
+     * Ask the search index for the entries of this model matching each word
+     * of searchText. The answer is sent with searchResultReady.
+     */
+    void search(const QString &searchText);
+
+    void tracksAdded(DataModel::ListTrackRecord newData);
 
     void radiosAdded(DataModel::ListRadioDataType newData);
 
@@ -140,6 +193,14 @@ private Q_SLOTS:
 
     void cleanedDatabase();
 
+    void tracksPageAdded(const DataModel::ListTrackRecord &pageData, int sortRole, Qt::SortOrder sortOrder,
+                         int firstRow, const QVariant &lastSortKey, int totalCount);
+
+    void requestNeededPages();
+
+    void searchResult(ElisaUtils::PlayListEntryType dataType, const QString &searchText,
+                      const QVector<qulonglong> &matchingIds, bool isIndexed);
+
 private:
 
     void radioAdded(const TrackDataType &radiosData);
@@ -148,6 +209,10 @@ private:
 
     [[nodiscard]] int indexFromId(qulonglong id) const;
 
+    void updateIndexFromId(int firstRow);
+
+    void removeIndexFromId(qulonglong id, int removedRow);
+
     void connectModel(DatabaseInterface *database);
 
     void setBusy(bool value);
@@ -157,6 +222,24 @@ private:
 
     void askModelData();
 
+    /**
+     * Check that the page of row is loaded. Otherwise it is asked for once
+     * control returns to the event loop.
+     */
+    [[nodiscard]] bool isTrackLoaded(int row) const;
+
+    [[nodiscard]] const DataTypes::TrackRecord &trackAt(int row) const;
+
+    /**
+     * Read again the loaded pages and the number of rows after a change of
+     * the collection or of the sort. The rows are shown until then.
+     */
+    void invalidatePages();
+
+    void clearPages();
+
+    void setPagesRowCount(int value);
+
     void removeRadios();
 
     std::unique_ptr<DataModelPrivate> d;
@@ -19,21 +19,19 @@ GridViewProxyModel::GridViewProxyModel(QObject *parent) : AbstractMediaProxyMode
     setSortCaseSensitivity(Qt::CaseInsensitive);
 }
 
-GridViewProxyModel::~GridViewProxyModel() = default;
+GridViewProxyModel::~GridViewProxyModel()
+{
+    stopFilterUpdate();
+}
 
-bool GridViewProxyModel::filterAcceptsRow(int source_row, const QModelIndex &source_parent) const
+bool GridViewProxyModel::rowMatchesFilter(const FilterData &rowData) const
 {
     bool result = false;
 
-    auto currentIndex = sourceModel()->index(source_row, 0, source_parent);
-
-    const auto &mainValue = sourceModel()->data(currentIndex, Qt::DisplayRole).toString();
-    const auto &artistValue = sourceModel()->data(currentIndex, DataTypes::ArtistRole).toString();
-    const auto &allArtistsValue = sourceModel()->data(currentIndex, DataTypes::AllArtistsRole).toStringList();
-    bool collectionMaximumRatingValueIsValid = false;
-    const auto collectionMaximumRatingValue = sourceModel()->data(currentIndex, DataTypes::HighestTrackRating).toInt(&collectionMaximumRatingValueIsValid);
-    bool maximumRatingValueIsValid = false;
-    const auto maximumRatingValue = sourceModel()->data(currentIndex, DataTypes::RatingRole).toInt(&maximumRatingValueIsValid);
+    const auto collectionMaximumRatingValueIsValid = rowData.mHasHighestTrackRating;
+    const auto collectionMaximumRatingValue = rowData.mHighestTrackRating;
+    const auto maximumRatingValueIsValid = rowData.mHasRating;
+    const auto maximumRatingValue = rowData.mRating;
 
     if ((collectionMaximumRatingValueIsValid && maximumRatingValueIsValid &&
             collectionMaximumRatingValue < mFilterRating && maximumRatingValue < mFilterRating) ||
@@ -44,17 +42,22 @@ bool GridViewProxyModel::filterAcceptsRow(int source_row, const QModelIndex &sou
         return result;
     }
 
-    if (mFilterExpression.match(mainValue).hasMatch()) {
+    if (mFilterByMatchingIds) {
+        result = mMatchingIds.contains(rowData.mDatabaseId);
+        return result;
+    }
+
+    if (mFilterExpression.match(rowData.mDisplay).hasMatch()) {
         result = true;
         return result;
     }
 
-    if (mFilterExpression.match(artistValue).hasMatch()) {
+    if (mFilterExpression.match(rowData.mArtist).hasMatch()) {
         result = true;
         return result;
     }
 
-    for (const auto &oneArtist : allArtistsValue) {
+    for (const auto &oneArtist : rowData.mAllArtists) {
         if (mFilterExpression.match(oneArtist).hasMatch()) {
             result = true;
             return result;
@@ -29,7 +29,7 @@ public Q_SLOTS:
 
 protected:
 
-    [[nodiscard]] bool filterAcceptsRow(int source_row, const QModelIndex &source_parent) const override;
+    [[nodiscard]] bool rowMatchesFilter(const FilterData &rowData) const override;
 
 };
 
@@ -16,15 +16,15 @@
 #include "managemediaplayercontrol.h"
 #include "manageheaderbar.h"
 #include "audiowrapper.h"
-
-#if defined KF5FileMetaData_FOUND && KF5FileMetaData_FOUND
-#include <KFileMetaData/EmbeddedImageData>
-#endif
+#include "coverimagecache.h"
 
 #include <QCryptographicHash>
 #include <QStringList>
 #include <QDBusMessage>
 #include <QDBusConnection>
+#include <QTimer>
+
+#include <utility>
 
 
 static const double MAX_RATE = 1.0;
@@ -40,7 +40,7 @@ MediaPlayer2Player::MediaPlayer2Player(MediaPlayListProxyModel *playListControle
                                                           QStringLiteral("Update"))),
       mShowProgressOnTaskBar(showProgressOnTaskBar)
 {
-    if (m_playListControler != nullptr) {
+    if (!m_playListControler) {
         return;
     }
 
@@ -64,6 +64,14 @@ MediaPlayer2Player::MediaPlayer2Player(MediaPlayListProxyModel *playListControle
             this, &MediaPlayer2Player::audioDurationChanged);
     connect(m_audioPlayer, &AudioWrapper::volumeChanged,
             this, &MediaPlayer2Player::playerVolumeChanged);
+    connect(m_manageHeaderBar, &ManageHeaderBar::titleChanged,
+            this, &MediaPlayer2Player::updateMetadata);
+    connect(m_manageHeaderBar, &ManageHeaderBar::artistChanged,
+            this, &MediaPlayer2Player::updateMetadata);
+    connect(m_manageHeaderBar, &ManageHeaderBar::albumChanged,
+            this, &MediaPlayer2Player::updateMetadata);
+    connect(m_manageHeaderBar, &ManageHeaderBar::imageChanged,
+            this, &MediaPlayer2Player::updateMetadata);
 
     m_volume = m_audioPlayer->volume() / 100;
     m_canPlay = m_manageMediaPlayerControl->playControlEnabled();
@@ -360,8 +368,7 @@ void MediaPlayer2Player::playerSeeked(qint64 position)
 
 void MediaPlayer2Player::audioDurationChanged()
 {
-    m_metadata = getMetadataOfCurrentTrack();
-    signalPropertiesChange(QStringLiteral("Metadata"), Metadata());
+    updateMetadata();
 
     skipBackwardControlEnabledChanged();
     skipForwardControlEnabledChanged();
@@ -387,7 +394,18 @@ void MediaPlayer2Player::setCurrentTrack(int newTrackPosition)
 
     emit currentTrackChanged();
 
-    m_metadata = getMetadataOfCurrentTrack();
+    updateMetadata();
+}
+
+void MediaPlayer2Player::updateMetadata()
+{
+    auto newMetadata = getMetadataOfCurrentTrack();
+
+    if (newMetadata == m_metadata) {
+        return;
+    }
+
+    m_metadata = std::move(newMetadata);
     signalPropertiesChange(QStringLiteral("Metadata"), Metadata());
 }
 
@@ -399,6 +417,16 @@ QVariantMap MediaPlayer2Player::getMetadataOfCurrentTrack()
         return {};
     }
 
+    // the art URL needs the cover of the track, only build the metadata again when the track or its data change
+    const auto cacheKey = QStringList{m_currentTrackId, m_manageAudioPlayer->playerSource().toString(),
+            QString::number(m_manageAudioPlayer->audioDuration()), m_manageHeaderBar->title().toString(),
+            m_manageHeaderBar->album().toString(), m_manageHeaderBar->artist().toString(),
+            m_manageHeaderBar->image().toString()}.join(QLatin1Char('\n'));
+
+    if (const auto *cachedMetadata = mMetadataCache.object(cacheKey)) {
+        return *cachedMetadata;
+    }
+
     result[QStringLiteral("mpris:trackid")] = QVariant::fromValue<QDBusObjectPath>(QDBusObjectPath(m_currentTrackId));
     result[QStringLiteral("mpris:length")] = qlonglong(m_manageAudioPlayer->audioDuration()) * 1000;
     //convert milli-seconds into micro-seconds
@@ -415,21 +443,19 @@ QVariantMap MediaPlayer2Player::getMetadataOfCurrentTrack()
     if (!m_manageHeaderBar->image().isEmpty() && !m_manageHeaderBar->image().toString().isEmpty()) {
         if (m_manageHeaderBar->image().scheme() == QStringLiteral("image")) {
             // adding a special case for image:// URLs that are only valid because Elisa installs a special handler for them
-            // converting those URL to data URLs with embedded image data
-#if defined KF5FileMetaData_FOUND && KF5FileMetaData_FOUND
-            KFileMetaData::EmbeddedImageData embeddedImage;
-
-            auto imageData = embeddedImage.imageData(m_manageHeaderBar->image().toString().mid(14));
+            // converting those URL to the file URL of a thumbnail from the cover cache
+            auto thumbnailFileName = CoverImageCache::instance().thumbnailFileName(m_manageHeaderBar->image().toString().mid(14), {512, 512});
 
-            if (imageData.contains(KFileMetaData::EmbeddedImageData::FrontCover)) {
-                result[QStringLiteral("mpris:artUrl")] = QString{QStringLiteral("data:image/png;base64,") + QLatin1String{imageData[KFileMetaData::EmbeddedImageData::FrontCover].toBase64()}};
+            if (!thumbnailFileName.isEmpty()) {
+                result[QStringLiteral("mpris:artUrl")] = QUrl::fromLocalFile(thumbnailFileName).toString();
             }
-#endif
         } else {
             result[QStringLiteral("mpris:artUrl")] = m_manageHeaderBar->image().toString();
         }
     }
 
+    mMetadataCache.insert(cacheKey, new QVariantMap(result));
+
     return result;
 }
 
@@ -481,14 +507,25 @@ void MediaPlayer2Player::setMediaPlayerPresent(int status)
 
 void MediaPlayer2Player::signalPropertiesChange(const QString &property, const QVariant &value)
 {
-    QVariantMap properties;
-    properties[property] = value;
+    if (mChangedProperties.isEmpty()) {
+        QTimer::singleShot(0, this, &MediaPlayer2Player::sendPropertiesChange);
+    }
+
+    mChangedProperties[property] = value;
+}
+
+void MediaPlayer2Player::sendPropertiesChange()
+{
+    if (mChangedProperties.isEmpty()) {
+        return;
+    }
+
     const int ifaceIndex = metaObject()->indexOfClassInfo("D-Bus Interface");
     QDBusMessage msg = QDBusMessage::createSignal(QStringLiteral("/org/mpris/MediaPlayer2"),
                                                   QStringLiteral("org.freedesktop.DBus.Properties"), QStringLiteral("PropertiesChanged"));
 
     msg << QLatin1String(metaObject()->classInfo(ifaceIndex).value());
-    msg << properties;
+    msg << std::exchange(mChangedProperties, {});
     msg << QStringList();
 
     QDBusConnection::sessionBus().send(msg);
@@ -14,6 +14,7 @@
 #include <QDBusAbstractAdaptor>
 #include <QDBusObjectPath>
 #include <QDBusMessage>
+#include <QCache>
 
 class MediaPlayListProxyModel;
 class ManageAudioPlayer;
@@ -124,7 +125,15 @@ private Q_SLOTS:
 
     void playerVolumeChanged();
 
+    void sendPropertiesChange();
+
+    void updateMetadata();
+
 private:
+    /**
+     * Queue a changed property. All the properties changed during one turn of
+     * the event loop are sent in a single PropertiesChanged signal.
+     */
     void signalPropertiesChange(const QString &property, const QVariant &value);
 
     void setMediaPlayerPresent(int status);
@@ -136,6 +145,8 @@ private:
     QVariantMap getMetadataOfCurrentTrack();
 
     QVariantMap m_metadata;
+    QCache<QString, QVariantMap> mMetadataCache{16};
+    QVariantMap mChangedProperties;
     QString m_currentTrack;
     QString m_currentTrackId;
     double m_rate = 1.0;
@@ -35,20 +35,26 @@
 #include <KI18n/KLocalizedString>
 
 #include <QThread>
+#include <QPointer>
 #include <QStandardPaths>
 #include <QDir>
 #include <QCoreApplication>
 #include <QFileSystemWatcher>
 #include <QAction>
 
+#include <array>
 #include <list>
 
+static const int ReadDatabaseConnectionsCount = 2;
+
 class MusicListenersManagerPrivate
 {
 public:
 
     QThread mDatabaseThread;
 
+    std::array<QThread, ReadDatabaseConnectionsCount> mReadDatabaseThreads;
+
     QThread mListenerThread;
 
 #if defined UPNPQT_FOUND && UPNPQT_FOUND
@@ -69,6 +75,12 @@ public:
 
     DatabaseInterface mDatabaseInterface;
 
+    std::array<DatabaseInterface, ReadDatabaseConnectionsCount> mReadDatabases;
+
+    QList<QPointer<ModelDataLoader>> mPendingDataLoaders;
+
+    QString mDatabaseFileName;
+
     std::unique_ptr<TracksListener> mTracksListener;
 
     QFileSystemWatcher mConfigFileWatcher;
@@ -79,6 +91,10 @@ public:
 
     int mImportedTracksCount = 0;
 
+    int mNextReadDatabase = 0;
+
+    bool mReadDatabasesReady = false;
+
     bool mIndexerBusy = false;
 
     bool mFileSystemIndexerActive = false;
@@ -133,6 +149,14 @@ MusicListenersManager::MusicListenersManager(QObject *parent)
     QMetaObject::invokeMethod(&d->mDatabaseInterface, "init", Qt::QueuedConnection,
                               Q_ARG(QString, QStringLiteral("listeners")), Q_ARG(QString, databaseFileName));
 
+    d->mDatabaseFileName = databaseFileName;
+    if (!d->mDatabaseFileName.isEmpty()) {
+        for (int i = 0; i < ReadDatabaseConnectionsCount; ++i) {
+            d->mReadDatabaseThreads[i].start();
+            d->mReadDatabases[i].moveToThread(&d->mReadDatabaseThreads[i]);
+        }
+    }
+
     qCInfo(orgKdeElisaIndexersManager) << "Local file system indexer is inactive";
     qCInfo(orgKdeElisaIndexersManager) << "Baloo indexer is unavailable";
     qCInfo(orgKdeElisaIndexersManager) << "Baloo indexer is inactive";
@@ -145,6 +169,11 @@ MusicListenersManager::~MusicListenersManager()
 
     d->mDatabaseThread.quit();
     d->mDatabaseThread.wait();
+
+    for (auto &oneThread : d->mReadDatabaseThreads) {
+        oneThread.quit();
+        oneThread.wait();
+    }
 }
 
 DatabaseInterface *MusicListenersManager::viewDatabase() const
@@ -156,11 +185,12 @@ void MusicListenersManager::subscribeForTracks(MediaPlayList *client)
 {
     createTracksListener();
     connect(d->mTracksListener.get(), &TracksListener::trackHasChanged, client, &MediaPlayList::trackChanged);
+    connect(d->mTracksListener.get(), &TracksListener::tracksHaveChanged, client, &MediaPlayList::tracksChanged);
     connect(d->mTracksListener.get(), &TracksListener::trackHasBeenRemoved, client, &MediaPlayList::trackRemoved);
     connect(d->mTracksListener.get(), &TracksListener::tracksListAdded, client, &MediaPlayList::tracksListAdded);
     connect(client, &MediaPlayList::newEntryInList, d->mTracksListener.get(), &TracksListener::newEntryInList);
     connect(client, &MediaPlayList::newUrlInList, d->mTracksListener.get(), &TracksListener::newUrlInList);
-    connect(client, &MediaPlayList::newTrackByNameInList, d->mTracksListener.get(), &TracksListener::trackByNameInList);
+    connect(client, &MediaPlayList::newTracksByNameInList, d->mTracksListener.get(), &TracksListener::tracksByNameInList);
 }
 
 int MusicListenersManager::importedTracksCount() const
@@ -224,6 +254,23 @@ auto MusicListenersManager::initializeRootPath()
 
 void MusicListenersManager::databaseReady()
 {
+    if (!d->mDatabaseFileName.isEmpty() && !d->mReadDatabasesReady) {
+        for (int i = 0; i < ReadDatabaseConnectionsCount; ++i) {
+            QMetaObject::invokeMethod(&d->mReadDatabases[i], "initReadOnly", Qt::QueuedConnection,
+                                      Q_ARG(QString, QStringLiteral("views") + QString::number(i)),
+                                      Q_ARG(QString, d->mDatabaseFileName));
+        }
+
+        d->mReadDatabasesReady = true;
+
+        for (const auto &oneDataLoader : qAsConst(d->mPendingDataLoaders)) {
+            if (oneDataLoader) {
+                useReadDatabase(oneDataLoader);
+            }
+        }
+        d->mPendingDataLoaders.clear();
+    }
+
     auto initialRootPath = Elisa::ElisaConfiguration::rootPath();
     if (initialRootPath.isEmpty()) {
         initializeRootPath();
@@ -243,6 +290,11 @@ void MusicListenersManager::applicationAboutToQuit()
     d->mDatabaseThread.exit();
     d->mDatabaseThread.wait();
 
+    for (auto &oneThread : d->mReadDatabaseThreads) {
+        oneThread.exit();
+        oneThread.wait();
+    }
+
     d->mListenerThread.exit();
     d->mListenerThread.wait();
 }
@@ -303,6 +355,26 @@ void MusicListenersManager::deleteElementById(ElisaUtils::PlayListEntryType entr
 void MusicListenersManager::connectModel(ModelDataLoader *dataLoader)
 {
     dataLoader->moveToThread(&d->mDatabaseThread);
+
+    if (d->mDatabaseFileName.isEmpty()) {
+        return;
+    }
+
+    if (d->mReadDatabasesReady) {
+        useReadDatabase(dataLoader);
+    } else {
+        d->mPendingDataLoaders.push_back(dataLoader);
+    }
+}
+
+void MusicListenersManager::useReadDatabase(ModelDataLoader *dataLoader)
+{
+    auto readDatabase = &d->mReadDatabases[d->mNextReadDatabase];
+    d->mNextReadDatabase = (d->mNextReadDatabase + 1) % ReadDatabaseConnectionsCount;
+
+    QMetaObject::invokeMethod(dataLoader, [dataLoader, readDatabase]() {
+        dataLoader->setReadDatabase(readDatabase);
+    }, Qt::QueuedConnection);
 }
 
 void MusicListenersManager::resetMusicData()
@@ -310,6 +382,15 @@ void MusicListenersManager::resetMusicData()
     Q_EMIT clearDatabase();
 }
 
+void MusicListenersManager::scanMusicCollectionAgain()
+{
+    if (!d->mFileSystemIndexerActive) {
+        return;
+    }
+
+    QMetaObject::invokeMethod(d->mFileListener.fileListing(), "rescanAllContent", Qt::QueuedConnection);
+}
+
 void MusicListenersManager::configChanged()
 {
     auto currentConfiguration = Elisa::ElisaConfiguration::self();
@@ -396,6 +477,12 @@ void MusicListenersManager::configChanged()
 #endif
     } else if (d->mFileSystemIndexerActive) {
         qCInfo(orgKdeElisaIndexersManager()) << "trigger init of local file indexer";
+        auto metadataExtractionThreadCount = currentConfiguration->metadataExtractionThreadCount();
+        if (metadataExtractionThreadCount <= 0) {
+            metadataExtractionThreadCount = QThread::idealThreadCount();
+        }
+        QMetaObject::invokeMethod(d->mFileListener.fileListing(), "setMetadataExtractionThreadCount", Qt::QueuedConnection,
+                                  Q_ARG(int, metadataExtractionThreadCount));
         QMetaObject::invokeMethod(d->mFileListener.fileListing(), "init", Qt::QueuedConnection);
     } else if (d->mAndroidIndexerActive) {
 #if defined Q_OS_ANDROID
@@ -412,7 +499,7 @@ void MusicListenersManager::configChanged()
 
 }
 
-void MusicListenersManager::increaseImportedTracksCount(const DataTypes::ListTrackDataType &allTracks)
+void MusicListenersManager::increaseImportedTracksCount(const DataTypes::ListTrackRecord &allTracks)
 {
     d->mImportedTracksCount += allTracks.size();
 
@@ -512,6 +599,8 @@ void MusicListenersManager::startLocalFileSystemIndexing()
             this, &MusicListenersManager::monitorStartingListeners);
     connect(&d->mFileListener, &FileListener::indexingFinished,
             this, &MusicListenersManager::monitorEndingListeners);
+    connect(&d->mFileListener, &FileListener::indexingStatistics,
+            this, &MusicListenersManager::fileSystemIndexingStatistics);
 
     qCInfo(orgKdeElisaIndexersManager) << "Local file system indexer is active";
 
@@ -116,6 +116,8 @@ Q_SIGNALS:
 
     void indexerBusyChanged();
 
+    void fileSystemIndexingStatistics(int scannedDirectoriesCount, int skippedDirectoriesCount, int skippedFilesCount);
+
     void clearDatabase();
 
     void clearedDatabase();
@@ -148,11 +150,13 @@ public Q_SLOTS:
 
     void resetMusicData();
 
+    void scanMusicCollectionAgain();
+
 private Q_SLOTS:
 
     void configChanged();
 
-    void increaseImportedTracksCount(const DataTypes::ListTrackDataType &allTracks);
+    void increaseImportedTracksCount(const DataTypes::ListTrackRecord &allTracks);
 
     void decreaseImportedTracksCount();
 
@@ -176,6 +180,8 @@ private:
 
     auto initializeRootPath();
 
+    void useReadDatabase(ModelDataLoader *dataLoader);
+
     std::unique_ptr<MusicListenersManagerPrivate> d;
 
     void createTracksListener();
@@ -0,0 +1,179 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "parallelfilescanner.h"
+
+#include "filescanner.h"
+
+#include "abstractfile/indexercommon.h"
+
+#include <QThreadPool>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QWaitCondition>
+#include <QQueue>
+#include <QPair>
+#include <QFileInfo>
+
+#include <algorithm>
+#include <utility>
+
+class ParallelFileScannerPrivate
+{
+public:
+
+    QThreadPool mThreadPool;
+
+    QMutex mMutex;
+
+    QWaitCondition mWorkAvailable;
+
+    QWaitCondition mQueueNotFull;
+
+    QWaitCondition mWorkDone;
+
+    QQueue<QPair<QUrl, QUrl>> mPendingFiles;
+
+    ParallelFileScanner::ListScanResult mResults;
+
+    ParallelFileScanner::ScanFunction mScanFunction;
+
+    int mWorkerCount = 1;
+
+    int mMaximumPendingFiles = 1;
+
+    int mFilesInProgress = 0;
+
+    bool mWorkersStarted = false;
+
+    bool mStopWorkers = false;
+
+};
+
+ParallelFileScanner::ParallelFileScanner(int workerCount, ScanFunction scanFunction)
+    : d(std::make_unique<ParallelFileScannerPrivate>())
+{
+    d->mWorkerCount = std::max(1, workerCount);
+    d->mMaximumPendingFiles = 4 * d->mWorkerCount;
+    d->mScanFunction = std::move(scanFunction);
+    d->mThreadPool.setMaxThreadCount(d->mWorkerCount);
+    d->mThreadPool.setExpiryTimeout(-1);
+}
+
+ParallelFileScanner::~ParallelFileScanner()
+{
+    {
+        QMutexLocker locker(&d->mMutex);
+        d->mStopWorkers = true;
+        d->mPendingFiles.clear();
+        d->mWorkAvailable.wakeAll();
+        d->mQueueNotFull.wakeAll();
+    }
+
+    d->mThreadPool.waitForDone();
+}
+
+int ParallelFileScanner::workerCount() const
+{
+    return d->mWorkerCount;
+}
+
+void ParallelFileScanner::enqueueFile(const QUrl &scanFile, const QUrl &directory)
+{
+    startWorkers();
+
+    QMutexLocker locker(&d->mMutex);
+
+    while (d->mPendingFiles.size() >= d->mMaximumPendingFiles && !d->mStopWorkers) {
+        d->mQueueNotFull.wait(&d->mMutex);
+    }
+
+    d->mPendingFiles.enqueue({scanFile, directory});
+    d->mWorkAvailable.wakeOne();
+}
+
+ParallelFileScanner::ListScanResult ParallelFileScanner::takeResults()
+{
+    QMutexLocker locker(&d->mMutex);
+
+    return std::exchange(d->mResults, {});
+}
+
+ParallelFileScanner::ListScanResult ParallelFileScanner::waitForResults()
+{
+    QMutexLocker locker(&d->mMutex);
+
+    while (!d->mPendingFiles.isEmpty() || d->mFilesInProgress > 0) {
+        d->mWorkDone.wait(&d->mMutex);
+    }
+
+    return std::exchange(d->mResults, {});
+}
+
+void ParallelFileScanner::cancel()
+{
+    QMutexLocker locker(&d->mMutex);
+
+    d->mPendingFiles.clear();
+    d->mQueueNotFull.wakeAll();
+
+    while (d->mFilesInProgress > 0) {
+        d->mWorkDone.wait(&d->mMutex);
+    }
+
+    d->mResults.clear();
+}
+
+void ParallelFileScanner::startWorkers()
+{
+    if (d->mWorkersStarted) {
+        return;
+    }
+
+    d->mWorkersStarted = true;
+
+    qCDebug(orgKdeElisaIndexer()) << "ParallelFileScanner::startWorkers" << d->mWorkerCount << "workers";
+
+    for (int i = 0; i < d->mWorkerCount; ++i) {
+        d->mThreadPool.start([this]() {workerLoop();});
+    }
+}
+
+void ParallelFileScanner::workerLoop()
+{
+    FileScanner scanner;
+
+    while (true) {
+        auto nextFile = QPair<QUrl, QUrl>{};
+
+        {
+            QMutexLocker locker(&d->mMutex);
+
+            while (d->mPendingFiles.isEmpty() && !d->mStopWorkers) {
+                d->mWorkAvailable.wait(&d->mMutex);
+            }
+
+            if (d->mStopWorkers) {
+                return;
+            }
+
+            nextFile = d->mPendingFiles.dequeue();
+            ++d->mFilesInProgress;
+            d->mQueueNotFull.wakeOne();
+        }
+
+        const auto scanFileInfo = QFileInfo(nextFile.first.toLocalFile());
+        auto newTrack = d->mScanFunction(scanner, nextFile.first, scanFileInfo);
+
+        {
+            QMutexLocker locker(&d->mMutex);
+
+            d->mResults.push_back({nextFile.first, nextFile.second, std::move(newTrack)});
+            --d->mFilesInProgress;
+            d->mWorkDone.wakeAll();
+        }
+    }
+}
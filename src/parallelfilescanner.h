@@ -0,0 +1,87 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef PARALLELFILESCANNER_H
+#define PARALLELFILESCANNER_H
+
+#include "elisaLib_export.h"
+
+#include "datatypes.h"
+
+#include <QUrl>
+#include <QVector>
+
+#include <functional>
+#include <memory>
+
+class QFileInfo;
+class FileScanner;
+class ParallelFileScannerPrivate;
+
+/**
+ * Runs metadata extraction of audio files on a set of worker threads.
+ *
+ * Files are pushed in a bounded queue from the thread enumerating directories
+ * and are consumed by the workers. Each worker owns its own FileScanner. The
+ * scanned tracks are collected and must be fetched from the enumerating thread
+ * with takeResults() or waitForResults().
+ */
+class ELISALIB_EXPORT ParallelFileScanner
+{
+public:
+
+    class ScanResult
+    {
+    public:
+
+        QUrl mFile;
+
+        QUrl mDirectory;
+
+        DataTypes::TrackDataType mTrack;
+    };
+
+    using ListScanResult = QVector<ScanResult>;
+
+    using ScanFunction = std::function<DataTypes::TrackDataType(FileScanner &scanner, const QUrl &scanFile, const QFileInfo &scanFileInfo)>;
+
+    ParallelFileScanner(int workerCount, ScanFunction scanFunction);
+
+    ~ParallelFileScanner();
+
+    [[nodiscard]] int workerCount() const;
+
+    /**
+     * Add one file to the queue of files to scan. Block while the queue is full.
+     */
+    void enqueueFile(const QUrl &scanFile, const QUrl &directory);
+
+    /**
+     * Return the already scanned files without waiting for the pending ones.
+     */
+    ListScanResult takeResults();
+
+    /**
+     * Wait until all queued files have been scanned and return the results.
+     */
+    ListScanResult waitForResults();
+
+    /**
+     * Drop the queued files and wait for the workers to be idle. Results are discarded.
+     */
+    void cancel();
+
+private:
+
+    void startWorkers();
+
+    void workerLoop();
+
+    std::unique_ptr<ParallelFileScannerPrivate> d;
+
+};
+
+#endif // PARALLELFILESCANNER_H
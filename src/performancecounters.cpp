@@ -0,0 +1,29 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "performancecounters.h"
+
+#include <array>
+#include <atomic>
+
+static std::array<std::atomic<qint64>, PerformanceCounters::CountersCount> allCounters = {};
+
+void PerformanceCounters::add(Counter counter, qint64 value)
+{
+    allCounters[counter].fetch_add(value, std::memory_order_relaxed);
+}
+
+qint64 PerformanceCounters::value(Counter counter)
+{
+    return allCounters[counter].load(std::memory_order_relaxed);
+}
+
+void PerformanceCounters::reset()
+{
+    for (auto &oneCounter : allCounters) {
+        oneCounter.store(0, std::memory_order_relaxed);
+    }
+}
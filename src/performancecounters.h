@@ -0,0 +1,79 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef PERFORMANCECOUNTERS_H
+#define PERFORMANCECOUNTERS_H
+
+#include "elisaLib_export.h"
+
+#include <QtGlobal>
+#include <QElapsedTimer>
+
+/**
+ * Process wide counters used to measure the cost of indexing the music collection,
+ * the efficiency of the cover cache and the gaps between played tracks.
+ *
+ * The counters can be updated from any thread. They are read by the benchmark
+ * mode of elisaImport and can be used to tune the size of the caches.
+ */
+class ELISALIB_EXPORT PerformanceCounters
+{
+public:
+
+    enum Counter {
+        ScannedFiles,
+        ScanFileNanoseconds,
+        InsertTracksListCalls,
+        InsertedTracks,
+        InsertTracksListNanoseconds,
+        ExecutedQueries,
+        CoverMemoryCacheHits,
+        CoverDiskCacheHits,
+        CoverCacheMisses,
+        CoverDecodeNanoseconds,
+        TrackTransitions,
+        TrackTransitionNanoseconds,
+        CountersCount,
+    };
+
+    /**
+     * Add the time elapsed during its lifetime to one counter.
+     */
+    class ScopedTimer
+    {
+    public:
+
+        explicit ScopedTimer(Counter counter) : mCounter(counter)
+        {
+            mTimer.start();
+        }
+
+        ~ScopedTimer()
+        {
+            PerformanceCounters::add(mCounter, mTimer.nsecsElapsed());
+        }
+
+        ScopedTimer(const ScopedTimer &) = delete;
+
+        ScopedTimer& operator=(const ScopedTimer &) = delete;
+
+    private:
+
+        QElapsedTimer mTimer;
+
+        Counter mCounter;
+
+    };
+
+    static void add(Counter counter, qint64 value);
+
+    [[nodiscard]] static qint64 value(Counter counter);
+
+    static void reset();
+
+};
+
+#endif // PERFORMANCECOUNTERS_H
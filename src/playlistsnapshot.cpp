@@ -0,0 +1,257 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "playlistsnapshot.h"
+
+#include "playListLogging.h"
+
+#include <QFile>
+#include <QSaveFile>
+#include <QHash>
+#include <QtEndian>
+#include <QDebug>
+
+#include <cstring>
+
+static const char SnapshotMagic[4] = {'E', 'L', 'P', 'S'};
+
+static const quint32 SnapshotVersion = 1;
+
+static const qint64 HeaderSize = 32;
+
+static const qint64 EntrySize = 40;
+
+static const qint64 StringIndexSize = 8;
+
+enum EntryFlags : quint32 {
+    HasTrackNumber = 0x1,
+    HasDiscNumber = 0x2,
+};
+
+enum SnapshotFlags : quint32 {
+    ShufflePlayList = 0x1,
+};
+
+template <typename T>
+static void appendValue(QByteArray &data, T value)
+{
+    char buffer[sizeof(T)];
+    qToLittleEndian(value, buffer);
+    data.append(buffer, sizeof(T));
+}
+
+template <typename T>
+static T readValue(const uchar *data)
+{
+    return qFromLittleEndian<T>(data);
+}
+
+QByteArray PlayListSnapshot::toByteArray() const
+{
+    auto stringsIndexes = QHash<QString, quint32>{};
+    auto allStrings = QList<QString>{};
+
+    // the first string is always the empty string
+    allStrings.push_back({});
+    stringsIndexes[QString{}] = 0;
+
+    auto internString = [&stringsIndexes, &allStrings](const QString &value) -> quint32 {
+        if (value.isEmpty()) {
+            return 0;
+        }
+
+        auto itString = stringsIndexes.find(value);
+        if (itString == stringsIndexes.end()) {
+            itString = stringsIndexes.insert(value, static_cast<quint32>(allStrings.size()));
+            allStrings.push_back(value);
+        }
+
+        return itString.value();
+    };
+
+    auto result = QByteArray{};
+    result.reserve(static_cast<int>(HeaderSize + mEntries.size() * EntrySize));
+
+    result.append(SnapshotMagic, sizeof(SnapshotMagic));
+    appendValue<quint32>(result, SnapshotVersion);
+    appendValue<quint32>(result, static_cast<quint32>(mEntries.size()));
+
+    // the count of strings is only known once all entries are written
+    const auto stringsCountPosition = result.size();
+    appendValue<quint32>(result, 0);
+
+    appendValue<qint32>(result, mCurrentTrack);
+    appendValue<quint32>(result, mShufflePlayList ? ShufflePlayList : 0);
+    appendValue<qint32>(result, mRepeatMode);
+    appendValue<quint32>(result, 0);
+
+    for (const auto &oneEntry : mEntries) {
+        auto flags = quint32{0};
+        if (oneEntry.mTrackNumber) {
+            flags |= HasTrackNumber;
+        }
+        if (oneEntry.mDiscNumber) {
+            flags |= HasDiscNumber;
+        }
+
+        appendValue<quint64>(result, oneEntry.mDatabaseId);
+        appendValue<quint32>(result, internString(oneEntry.mTitle));
+        appendValue<quint32>(result, internString(oneEntry.mArtist));
+        appendValue<quint32>(result, internString(oneEntry.mAlbum));
+        appendValue<quint32>(result, internString(oneEntry.mTrackUrl));
+        appendValue<qint32>(result, oneEntry.mTrackNumber.value_or(0));
+        appendValue<qint32>(result, oneEntry.mDiscNumber.value_or(0));
+        appendValue<quint32>(result, static_cast<quint32>(oneEntry.mEntryType));
+        appendValue<quint32>(result, flags);
+    }
+
+    qToLittleEndian(static_cast<quint32>(allStrings.size()), result.data() + stringsCountPosition);
+
+    auto stringOffset = quint32{0};
+    for (const auto &oneString : allStrings) {
+        appendValue<quint32>(result, stringOffset);
+        appendValue<quint32>(result, static_cast<quint32>(oneString.size()));
+
+        // keep each string aligned on four bytes
+        stringOffset += static_cast<quint32>(oneString.size() + oneString.size() % 2);
+    }
+
+    for (const auto &oneString : allStrings) {
+        for (const auto &oneCharacter : oneString) {
+            appendValue<quint16>(result, oneCharacter.unicode());
+        }
+        if (oneString.size() % 2) {
+            appendValue<quint16>(result, 0);
+        }
+    }
+
+    return result;
+}
+
+bool PlayListSnapshot::fromData(const uchar *data, qint64 size)
+{
+    if (size < HeaderSize || std::memcmp(data, SnapshotMagic, sizeof(SnapshotMagic)) != 0) {
+        qCDebug(orgKdeElisaPlayList()) << "PlayListSnapshot::fromData" << "invalid header";
+        return false;
+    }
+
+    const auto version = readValue<quint32>(data + 4);
+    if (version != SnapshotVersion) {
+        qCDebug(orgKdeElisaPlayList()) << "PlayListSnapshot::fromData" << "unsupported version" << version;
+        return false;
+    }
+
+    const auto entriesCount = qint64{readValue<quint32>(data + 8)};
+    const auto stringsCount = qint64{readValue<quint32>(data + 12)};
+
+    const auto entriesStart = HeaderSize;
+    const auto stringsIndexStart = entriesStart + entriesCount * EntrySize;
+    const auto stringsStart = stringsIndexStart + stringsCount * StringIndexSize;
+
+    if (stringsCount == 0 || stringsStart > size) {
+        qCDebug(orgKdeElisaPlayList()) << "PlayListSnapshot::fromData" << "truncated data";
+        return false;
+    }
+
+    auto allStrings = QList<QString>{};
+    allStrings.reserve(static_cast<int>(stringsCount));
+
+    for (qint64 i = 0; i < stringsCount; ++i) {
+        const auto *stringIndex = data + stringsIndexStart + i * StringIndexSize;
+        const auto stringOffset = qint64{readValue<quint32>(stringIndex)};
+        const auto stringSize = qint64{readValue<quint32>(stringIndex + 4)};
+
+        const auto *stringData = data + stringsStart + stringOffset * 2;
+        if (stringsStart + (stringOffset + stringSize) * 2 > size) {
+            qCDebug(orgKdeElisaPlayList()) << "PlayListSnapshot::fromData" << "truncated string table";
+            return false;
+        }
+
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+        allStrings.push_back(QString(reinterpret_cast<const QChar *>(stringData), static_cast<int>(stringSize)));
+#else
+        auto oneString = QString{};
+        oneString.reserve(static_cast<int>(stringSize));
+        for (qint64 j = 0; j < stringSize; ++j) {
+            oneString.append(QChar{readValue<quint16>(stringData + j * 2)});
+        }
+        allStrings.push_back(oneString);
+#endif
+    }
+
+    auto stringFromIndex = [&allStrings](quint32 index) -> QString {
+        if (index >= static_cast<quint32>(allStrings.size())) {
+            return {};
+        }
+        return allStrings[static_cast<int>(index)];
+    };
+
+    mCurrentTrack = readValue<qint32>(data + 16);
+    mShufflePlayList = (readValue<quint32>(data + 20) & ShufflePlayList) != 0;
+    mRepeatMode = readValue<qint32>(data + 24);
+
+    mEntries.clear();
+    mEntries.reserve(static_cast<int>(entriesCount));
+
+    for (qint64 i = 0; i < entriesCount; ++i) {
+        const auto *entryData = data + entriesStart + i * EntrySize;
+        const auto flags = readValue<quint32>(entryData + 36);
+
+        auto oneEntry = Entry{};
+        oneEntry.mDatabaseId = readValue<quint64>(entryData);
+        oneEntry.mTitle = stringFromIndex(readValue<quint32>(entryData + 8));
+        oneEntry.mArtist = stringFromIndex(readValue<quint32>(entryData + 12));
+        oneEntry.mAlbum = stringFromIndex(readValue<quint32>(entryData + 16));
+        oneEntry.mTrackUrl = stringFromIndex(readValue<quint32>(entryData + 20));
+        if (flags & HasTrackNumber) {
+            oneEntry.mTrackNumber = readValue<qint32>(entryData + 24);
+        }
+        if (flags & HasDiscNumber) {
+            oneEntry.mDiscNumber = readValue<qint32>(entryData + 28);
+        }
+        oneEntry.mEntryType = static_cast<ElisaUtils::PlayListEntryType>(readValue<quint32>(entryData + 32));
+
+        mEntries.push_back(std::move(oneEntry));
+    }
+
+    return true;
+}
+
+bool PlayListSnapshot::save(const QString &fileName) const
+{
+    QSaveFile snapshotFile(fileName);
+    if (!snapshotFile.open(QIODevice::WriteOnly)) {
+        qCWarning(orgKdeElisaPlayList()) << "PlayListSnapshot::save" << fileName << snapshotFile.errorString();
+        return false;
+    }
+
+    const auto snapshotData = toByteArray();
+    if (snapshotFile.write(snapshotData) != snapshotData.size()) {
+        qCWarning(orgKdeElisaPlayList()) << "PlayListSnapshot::save" << fileName << snapshotFile.errorString();
+        snapshotFile.cancelWriting();
+        return false;
+    }
+
+    return snapshotFile.commit();
+}
+
+bool PlayListSnapshot::load(const QString &fileName)
+{
+    QFile snapshotFile(fileName);
+    if (!snapshotFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    const auto snapshotSize = snapshotFile.size();
+    if (auto *mappedData = snapshotFile.map(0, snapshotSize)) {
+        const auto result = fromData(mappedData, snapshotSize);
+        snapshotFile.unmap(mappedData);
+        return result;
+    }
+
+    const auto snapshotData = snapshotFile.readAll();
+    return fromData(reinterpret_cast<const uchar *>(snapshotData.constData()), snapshotData.size());
+}
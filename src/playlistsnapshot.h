@@ -0,0 +1,80 @@
+/*
+   SPDX-FileCopyrightText: 2026 (c) agent <agent@local>
+
+   SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef PLAYLISTSNAPSHOT_H
+#define PLAYLISTSNAPSHOT_H
+
+#include "elisaLib_export.h"
+
+#include "elisautils.h"
+
+#include <QString>
+#include <QList>
+#include <QByteArray>
+
+#include <optional>
+
+/**
+ * Binary snapshot of the play list and of the state of the player.
+ *
+ * The file starts with a fixed size header followed by one fixed size record
+ * per entry and by a table of the strings used by the entries. Each distinct
+ * string is stored once and the records only store its index. All integers
+ * are little endian and all sections are aligned on four bytes so that the
+ * file can be read directly from a memory mapping.
+ */
+class ELISALIB_EXPORT PlayListSnapshot
+{
+public:
+
+    class Entry
+    {
+    public:
+
+        qulonglong mDatabaseId = 0;
+
+        QString mTitle;
+
+        QString mArtist;
+
+        QString mAlbum;
+
+        QString mTrackUrl;
+
+        std::optional<int> mTrackNumber;
+
+        std::optional<int> mDiscNumber;
+
+        ElisaUtils::PlayListEntryType mEntryType = ElisaUtils::Unknown;
+    };
+
+    [[nodiscard]] QByteArray toByteArray() const;
+
+    /**
+     * Read a snapshot from memory.
+     *
+     * @return false if the data is not a valid snapshot of a supported version
+     */
+    bool fromData(const uchar *data, qint64 size);
+
+    /**
+     * Atomically replace the content of the file with this snapshot.
+     */
+    bool save(const QString &fileName) const;
+
+    bool load(const QString &fileName);
+
+    QList<Entry> mEntries;
+
+    int mCurrentTrack = -1;
+
+    int mRepeatMode = 0;
+
+    bool mShufflePlayList = false;
+
+};
+
+#endif // PLAYLISTSNAPSHOT_H
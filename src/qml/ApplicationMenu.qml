@@ -30,6 +30,16 @@ Menu {
         }
     }
 
+    Action {
+        text: i18nc("Scan again all the files of the music collection application menu entry", "Scan Again for Modified Files")
+        icon.name: "view-refresh"
+        enabled: ElisaApplication.musicManager.fileSystemIndexerActive
+        onTriggered: {
+            applicationMenu.close()
+            ElisaApplication.musicManager.scanMusicCollectionAgain()
+        }
+    }
+
     Menu {
         title: i18n("Color Scheme")
         Repeater {
@@ -150,7 +150,11 @@ Kirigami.ApplicationWindow {
             persistentSettings.width = mainWindow.width;
             persistentSettings.height = mainWindow.height;
 
-            persistentSettings.playListState = ElisaApplication.mediaPlayListProxyModel.persistentState;
+            if (ElisaApplication.mediaPlayListProxyModel.saveSession()) {
+                persistentSettings.playListState = ElisaApplication.mediaPlayListProxyModel.sessionPersistentState();
+            } else {
+                persistentSettings.playListState = ElisaApplication.mediaPlayListProxyModel.persistentState;
+            }
             persistentSettings.audioPlayerState = ElisaApplication.audioControl.persistentState
 
             persistentSettings.playControlItemVolume = mediaPlayerControl.playerControl.volume
@@ -318,6 +322,13 @@ Kirigami.ApplicationWindow {
                     onOpenNowPlaying: { contentView.openNowPlaying() }
                     onOpenAlbum: { contentView.openAlbum(album, albumArtist, image, albumID) }
 
+                    // the cover of the next track is ready when the track starts
+                    CoverPrefetcher {
+                        playList: ElisaApplication.mediaPlayListProxyModel
+                        thumbnailSize: Qt.size(headerBar.imageSourceSize * Screen.devicePixelRatio,
+                                               headerBar.imageSourceSize * Screen.devicePixelRatio)
+                    }
+
                     playerControl.onOpenMenu: {
                         if (applicationMenu.visible) {
                             applicationMenu.close()
@@ -173,6 +173,28 @@ FocusScope {
             }
         }
 
+        CoverPrefetcher {
+            id: coverPrefetcher
+
+            model: gridView.haveTreeModel ? null : gridView.contentModel
+
+            thumbnailSize: {
+                let coverSize = (Kirigami.Settings.isMobile ? contentDirectoryView.cellWidth :
+                                                             elisaTheme.gridDelegateSize - 2 * Kirigami.Units.largeSpacing) * Screen.devicePixelRatio
+                return Qt.size(coverSize, coverSize)
+            }
+        }
+
+        Timer {
+            id: prefetchTimer
+
+            interval: 100
+
+            onTriggered: coverPrefetcher.prefetchRows(contentDirectoryView.indexAt(0, contentDirectoryView.contentY),
+                                                      contentDirectoryView.indexAt(contentDirectoryView.width - 1,
+                                                                                   contentDirectoryView.contentY + contentDirectoryView.height - 1))
+        }
+
         FocusScope {
 
             Layout.fillHeight: true
@@ -210,6 +232,10 @@ FocusScope {
                         text: i18n("Nothing to display")
                     }
 
+                    onContentYChanged: prefetchTimer.restart()
+                    onCountChanged: prefetchTimer.restart()
+                    onHeightChanged: prefetchTimer.restart()
+
                     cellWidth: {
                         let columns = Math.max(Math.floor(scrollView.availableSpace / elisaTheme.gridDelegateSize), 2);
                         return Math.floor(scrollView.availableSpace / columns);
@@ -139,6 +139,33 @@ FocusScope {
             }
         }
 
+        CoverPrefetcher {
+            id: coverPrefetcher
+
+            model: listView.haveTreeModel ? null : listView.contentModel
+        }
+
+        Timer {
+            id: prefetchTimer
+
+            interval: 100
+
+            onTriggered: {
+                let firstRow = contentDirectoryView.indexAt(0, contentDirectoryView.contentY)
+                let firstItem = contentDirectoryView.itemAtIndex(firstRow)
+
+                // the covers are only displayed by detailed delegates
+                if (!firstItem || (!Kirigami.Settings.isMobile && firstItem.detailedView === false)) {
+                    coverPrefetcher.cancel()
+                    return
+                }
+
+                let coverSize = (firstItem.height - Kirigami.Units.smallSpacing * (Kirigami.Settings.isMobile ? 2 : 1)) * Screen.devicePixelRatio
+                coverPrefetcher.thumbnailSize = Qt.size(coverSize, coverSize)
+                coverPrefetcher.prefetchRows(firstRow, contentDirectoryView.indexAt(0, contentDirectoryView.contentY + contentDirectoryView.height - 1))
+            }
+        }
+
         Rectangle {
             color: myPalette.base
 
@@ -180,9 +207,14 @@ FocusScope {
                         text: i18n("Nothing to display")
                     }
 
-                    onCountChanged: if (count === 0) {
-                        currentIndex = -1;
+                    onCountChanged: {
+                        if (count === 0) {
+                            currentIndex = -1;
+                        }
+                        prefetchTimer.restart()
                     }
+                    onContentYChanged: prefetchTimer.restart()
+                    onHeightChanged: prefetchTimer.restart()
                 }
             }
         }
@@ -31,6 +31,13 @@ MenuBar {
             onTriggered: ElisaApplication.musicManager.resetMusicData()
         }
 
+        MenuItem {
+            text: i18nc("Scan again all the files of the music collection application menu entry", "Scan Again for Modified Files")
+            iconName: "view-refresh"
+            enabled: ElisaApplication.musicManager.fileSystemIndexerActive
+            onTriggered: ElisaApplication.musicManager.scanMusicCollectionAgain()
+        }
+
         MenuSeparator {
         }
 
@@ -45,11 +45,11 @@ TracksListener::TracksListener(DatabaseInterface *database, QObject *parent) : Q
 TracksListener::~TracksListener()
 = default;
 
-void TracksListener::tracksAdded(const ListTrackDataType &allTracks)
+void TracksListener::tracksAdded(const ListTrackRecord &allTracks)
 {
     for (const auto &oneTrack : allTracks) {
         if (d->mTracksByIdSet.contains(oneTrack.databaseId())) {
-            Q_EMIT trackHasChanged(oneTrack);
+            Q_EMIT trackHasChanged(oneTrack.toTrackDataType());
         }
 
         if (d->mTracksByNameSet.isEmpty()) {
@@ -82,7 +82,7 @@ void TracksListener::tracksAdded(const ListTrackDataType &allTracks)
                 continue;
             }
 
-            Q_EMIT trackHasChanged(TrackDataType(oneTrack));
+            Q_EMIT trackHasChanged(oneTrack.toTrackDataType());
 
             d->mTracksByIdSet.insert(oneTrack.databaseId());
             itTrack = d->mTracksByNameSet.erase(itTrack);
@@ -104,44 +104,28 @@ void TracksListener::trackModified(const TrackDataType &modifiedTrack)
     }
 }
 
-void TracksListener::trackByNameInList(const QVariant &title, const QVariant &artist, const QVariant &album,
-                                       const QVariant &trackNumber, const QVariant &discNumber)
+void TracksListener::tracksByNameInList(const ListTrackDataType &tracks)
 {
-    const auto realTitle = title.toString();
-    const auto realArtist = artist.toString();
-    const auto albumIsValid = !album.isNull() && album.isValid() && !album.toString().isEmpty();
-    auto realAlbum = std::optional<QString>{};
-    if (albumIsValid) {
-        realAlbum = album.toString();
-    }
-    auto trackNumberIsValid = bool{};
-    const auto trackNumberValue = trackNumber.toInt(&trackNumberIsValid);
-    auto realTrackNumber = std::optional<int>{};
-    if (trackNumberIsValid) {
-        realTrackNumber = trackNumberValue;
-    }
-    auto discNumberIsValid = bool{};
-    const auto discNumberValue = discNumber.toInt(&discNumberIsValid);
-    auto realDiscNumber = std::optional<int>{};
-    if (discNumberIsValid) {
-        realDiscNumber = discNumberValue;
-    }
+    const auto newTracks = d->mDatabase->tracksDataFromTitleAlbumTrackDiscNumber(tracks);
 
-    auto newTrackId = d->mDatabase->trackIdFromTitleAlbumTrackDiscNumber(realTitle, realArtist, realAlbum,
-                                                                         realTrackNumber, realDiscNumber);
-    if (newTrackId == 0) {
-        auto newTrack = std::tuple<QString, QString, QString, int, int>(realTitle, realArtist, album.toString(), trackNumber.toInt(), discNumber.toInt());
-        d->mTracksByNameSet.push_back(newTrack);
+    auto resolvedTracks = ListTrackDataType{};
 
-        return;
-    }
+    for (int i = 0; i < tracks.size(); ++i) {
+        const auto &oneTrack = tracks[i];
 
-    d->mTracksByIdSet.insert(newTrackId);
+        if (i >= newTracks.size() || newTracks[i].isEmpty()) {
+            d->mTracksByNameSet.push_back({oneTrack.title(), oneTrack.artist(), oneTrack.album(),
+                                           oneTrack.hasTrackNumber() ? oneTrack.trackNumber() : 0,
+                                           oneTrack.hasDiscNumber() ? oneTrack.discNumber() : 0});
+            continue;
+        }
 
-    auto newTrack = d->mDatabase->trackDataFromDatabaseId(newTrackId);
+        d->mTracksByIdSet.insert(newTracks[i].databaseId());
+        resolvedTracks.push_back(newTracks[i]);
+    }
 
-    if (!newTrack.isEmpty()) {
-        Q_EMIT trackHasChanged(newTrack);
+    if (!resolvedTracks.isEmpty()) {
+        Q_EMIT tracksHaveChanged(resolvedTracks);
     }
 }
 
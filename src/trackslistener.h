@@ -27,6 +27,8 @@ public:
 
     using ListTrackDataType = DataTypes::ListTrackDataType;
 
+    using ListTrackRecord = DataTypes::ListTrackRecord;
+
     using TrackDataType = DataTypes::TrackDataType;
 
     explicit TracksListener(DatabaseInterface *database, QObject *parent = nullptr);
@@ -37,6 +39,8 @@ Q_SIGNALS:
 
     void trackHasChanged(const TracksListener::TrackDataType &audioTrack);
 
+    void tracksHaveChanged(const TracksListener::ListTrackDataType &audioTracks);
+
     void trackHasBeenRemoved(qulonglong id);
 
     void tracksListAdded(qulonglong newDatabaseId,
@@ -46,13 +50,13 @@ Q_SIGNALS:
 
 public Q_SLOTS:
 
-    void tracksAdded(const TracksListener::ListTrackDataType &allTracks);
+    void tracksAdded(const TracksListener::ListTrackRecord &allTracks);
 
     void trackRemoved(qulonglong id);
 
     void trackModified(const TracksListener::TrackDataType &modifiedTrack);
 
-    void trackByNameInList(const QVariant &title, const QVariant &artist, const QVariant &album, const QVariant &trackNumber, const QVariant &discNumber);
+    void tracksByNameInList(const TracksListener::ListTrackDataType &tracks);
 
     void newEntryInList(qulonglong newDatabaseId,
                         const QString &entryTitle,
@@ -292,9 +292,15 @@ void ViewManager::openViewFromData(const ViewParameters &viewParamaters)
         break;
     }
     case GenericDataModel:
-        newModel = new DataModel;
+    {
+        auto *realModel = new DataModel;
+        // the view of all the tracks reads them by pages around its visible rows
+        realModel->setPagedLoading(viewParamaters.mDataType == ElisaUtils::Track &&
+                                   viewParamaters.mFilterType == ElisaUtils::NoFilter);
+        newModel = realModel;
         proxyModel = new GridViewProxyModel;
         break;
+    }
     case UnknownModelType:
         qCDebug(orgKdeElisaViews()) << "ViewManager::openViewFromData" << "unknown model type";
         break;